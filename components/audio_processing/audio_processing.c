@@ -8,7 +8,7 @@
 static const char *TAG = "audio_processing";
 
 // Global configuration
-static audio_config_t g_audio_config = {0};
+static audio_analysis_config_t g_audio_config = {0};
 static bool g_initialized = false;
 
 // Window function coefficients
@@ -19,7 +19,7 @@ static esp_err_t generate_window_coeffs(int window_type, int length);
 static float calculate_spectral_centroid(const float *spectrum, int size, int sample_rate);
 static float calculate_spectral_rolloff(const float *spectrum, int size, int sample_rate, float threshold);
 
-esp_err_t audio_processing_init(const audio_config_t *config) {
+esp_err_t audio_processing_init(const audio_analysis_config_t *config) {
     if (!config) {
         ESP_LOGE(TAG, "Invalid configuration");
         return ESP_ERR_INVALID_ARG;
@@ -37,7 +37,7 @@ esp_err_t audio_processing_init(const audio_config_t *config) {
     }
     
     // Store configuration
-    memcpy(&g_audio_config, config, sizeof(audio_config_t));
+    memcpy(&g_audio_config, config, sizeof(audio_analysis_config_t));
     
     // Initialize ESP-DSP
     esp_err_t ret = dsps_fft2r_init_fc32(NULL, config->fft_size);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "esp_err.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -49,14 +50,15 @@ typedef struct {
     int64_t last_beat_time;         // Timestamp of last beat
 } beat_detector_t;
 
-// Frequency Analysis Configuration
+// Frequency Analysis Configuration; capture (pins, DMA, ring) is
+// configured with audio_recorder's audio_config_t
 typedef struct {
     int sample_rate;                // Sample rate in Hz
     int fft_size;                   // FFT size (power of 2)
     int window_type;                // Window function type
     int hop_size;                   // Hop size for overlapping frames
     bool normalize;                 // Normalize output
-} audio_config_t;
+} audio_analysis_config_t;
 
 // Audio Processing Functions
 
@@ -65,7 +67,7 @@ typedef struct {
  * @param config Audio processing configuration
  * @return ESP_OK on success, error code on failure
  */
-esp_err_t audio_processing_init(const audio_config_t *config);
+esp_err_t audio_processing_init(const audio_analysis_config_t *config);
 
 /**
  * @brief Apply window function to audio samples
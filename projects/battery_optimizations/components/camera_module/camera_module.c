@@ -1,6 +1,12 @@
 #include "camera_module.h"
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <math.h>
 
 static const char *TAG = "camera_module";
 
@@ -22,7 +28,64 @@ static const char *TAG = "camera_module";
 #define CAM_PIN_HREF    47
 #define CAM_PIN_PCLK    13
 
+#define STREAM_MAX_FRAMES       8       // power of two, also the ring size
+#define STREAM_TASK_STACK       3072
+#define STREAM_STOP_TIMEOUT_MS  1000
+#define STREAM_FPS_WINDOW_US    1000000
+
 static bool camera_initialized = false;
+static int s_fb_count = 1;
+
+// A slot owns one driver fb while its reference count is non-zero. Only the
+// grab task claims free slots; any task may drop references.
+typedef struct {
+    camera_frame_t frame;
+    atomic_int refs;
+} stream_slot_t;
+
+static stream_slot_t s_slots[STREAM_MAX_FRAMES];
+static uint8_t s_ring[STREAM_MAX_FRAMES];
+static atomic_uint s_ring_head;     // advanced by the grab task only
+static atomic_uint s_ring_tail;     // advanced by the consumer only
+static unsigned s_ring_depth = 1;
+
+static TaskHandle_t s_grab_task = NULL;
+static SemaphoreHandle_t s_frame_ready = NULL;
+static SemaphoreHandle_t s_grab_stopped = NULL;
+static atomic_bool s_stream_running = false;
+static bool s_stop_pending = false;     // the grab task outlived a stop's timeout
+static camera_stream_stats_t s_stats;
+static uint64_t s_latency_sum_us = 0;
+
+// Quality steps the controller output must move past the current setting
+// before the sensor is reprogrammed; keeps it from toggling on noise.
+#define RC_HYSTERESIS           0.75f
+#define RC_ERROR_ALPHA          0.3f
+
+static int s_quality = 12;
+
+// Serialises SCCB register writes; the grab task and the app both reprogram
+// the sensor. Created once and kept across deinit.
+static SemaphoreHandle_t s_sensor_lock = NULL;
+
+// Guards s_rc and s_quality, held only for the arithmetic. The app takes it
+// inside s_sensor_lock; the grab task holds it and only tries the sensor
+// lock, never waits on it, so the two orders cannot deadlock.
+static SemaphoreHandle_t s_rc_lock = NULL;
+
+static struct {
+    camera_rate_control_config_t config;
+    bool enabled;
+    float output;               // continuous quality, rounded when applied
+    float filtered_error;
+    float prev_error;
+    float avg_frame_bytes;
+    uint32_t adjustments;
+    int64_t window_start_us;
+    uint64_t window_bytes;
+    uint32_t window_frames;
+    uint32_t bytes_per_sec;
+} s_rc;
 
 esp_err_t camera_module_init(const camera_config_params_t *params)
 {
@@ -60,24 +123,42 @@ esp_err_t camera_module_init(const camera_config_params_t *params)
         .jpeg_quality = params->jpeg_quality,
         .fb_count = params->fb_count,
         .fb_location = CAMERA_FB_IN_PSRAM,
-        .grab_mode = CAMERA_GRAB_WHEN_EMPTY,
+        .grab_mode = params->grab_latest ? CAMERA_GRAB_LATEST : CAMERA_GRAB_WHEN_EMPTY,
     };
 
     if (config.pixel_format == PIXFORMAT_JPEG) {
         config.jpeg_quality = params->jpeg_quality;
-        if (params->frame_size > FRAMESIZE_SVGA) {
+        // GRAB_LATEST needs a spare buffer to overwrite, so keep the count
+        if (params->frame_size > FRAMESIZE_SVGA && !params->grab_latest) {
             config.fb_count = 1;
         }
     }
 
+    if (config.fb_count < 1) {
+        config.fb_count = 1;
+    } else if (config.fb_count > STREAM_MAX_FRAMES) {
+        config.fb_count = STREAM_MAX_FRAMES;
+    }
+
+    if (!s_sensor_lock) {
+        s_sensor_lock = xSemaphoreCreateMutex();
+        s_rc_lock = xSemaphoreCreateMutex();
+        if (!s_sensor_lock || !s_rc_lock) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
     esp_err_t err = esp_camera_init(&config);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Camera Init Failed with error 0x%x", err);
         return err;
     }
 
+    s_fb_count = config.fb_count;
+    s_quality = params->jpeg_quality;
     camera_initialized = true;
-    ESP_LOGI(TAG, "Camera initialized successfully");
+    ESP_LOGI(TAG, "Camera initialized successfully (fb_count %d, %s)", s_fb_count,
+             params->grab_latest ? "grab latest" : "grab when empty");
     return ESP_OK;
 }
 
@@ -88,7 +169,14 @@ esp_err_t camera_module_deinit(void)
         return ESP_OK;
     }
 
-    esp_err_t err = esp_camera_deinit();
+    // The driver's buffers go with it; never pull them from under the grab task
+    esp_err_t err = camera_module_stream_stop();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Grab task still running, camera left initialized");
+        return err;
+    }
+
+    err = esp_camera_deinit();
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Camera deinit failed with error 0x%x", err);
         return err;
@@ -106,23 +194,434 @@ camera_fb_t* camera_module_capture(void)
         return NULL;
     }
 
+    // While streaming the grab task owns the driver; hand out its next frame
+    if (s_stop_pending) {
+        ESP_LOGE(TAG, "Grab task still stopping");
+        return NULL;
+    }
+    if (s_stream_running) {
+        camera_frame_t *frame = camera_module_stream_acquire(portMAX_DELAY);
+        return frame ? frame->fb : NULL;
+    }
+
     camera_fb_t *fb = esp_camera_fb_get();
     if (!fb) {
         ESP_LOGE(TAG, "Camera capture failed");
         return NULL;
     }
 
-    ESP_LOGI(TAG, "Picture taken! Size: %zu bytes", fb->len);
+    ESP_LOGD(TAG, "Picture taken! Size: %zu bytes", fb->len);
+    camera_module_rate_control_observe(fb->len);
     return fb;
 }
 
 void camera_module_return_fb(camera_fb_t *fb)
 {
-    if (fb) {
+    if (!fb) {
+        return;
+    }
+
+    for (int i = 0; i < STREAM_MAX_FRAMES; i++) {
+        if (atomic_load(&s_slots[i].refs) > 0 && s_slots[i].frame.fb == fb) {
+            camera_module_frame_release(&s_slots[i].frame);
+            return;
+        }
+    }
+
+    esp_camera_fb_return(fb);
+}
+
+static stream_slot_t *stream_claim_slot(void)
+{
+    for (int i = 0; i < s_fb_count; i++) {
+        if (atomic_load_explicit(&s_slots[i].refs, memory_order_acquire) == 0) {
+            return &s_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static bool stream_ring_push(uint8_t slot_index)
+{
+    unsigned head = atomic_load_explicit(&s_ring_head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&s_ring_tail, memory_order_acquire);
+    if (head - tail >= s_ring_depth) {
+        return false;
+    }
+
+    s_ring[head % STREAM_MAX_FRAMES] = slot_index;
+    atomic_store_explicit(&s_ring_head, head + 1, memory_order_release);
+    return true;
+}
+
+static stream_slot_t *stream_ring_pop(void)
+{
+    unsigned tail = atomic_load_explicit(&s_ring_tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&s_ring_head, memory_order_acquire);
+    if (tail == head) {
+        return NULL;
+    }
+
+    uint8_t slot_index = s_ring[tail % STREAM_MAX_FRAMES];
+    atomic_store_explicit(&s_ring_tail, tail + 1, memory_order_release);
+    return &s_slots[slot_index];
+}
+
+static void camera_grab_task(void *pvParameters)
+{
+    int64_t window_start = esp_timer_get_time();
+    uint32_t window_frames = 0;
+    uint32_t sequence = 0;
+
+    while (s_stream_running) {
+        camera_fb_t *fb = esp_camera_fb_get();
+        if (!fb) {
+            s_stats.grab_failures++;
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+
+        s_stats.frames_captured++;
+        window_frames++;
+        camera_module_rate_control_observe(fb->len);
+
+        int64_t now = esp_timer_get_time();
+        if (now - window_start >= STREAM_FPS_WINDOW_US) {
+            s_stats.fps = window_frames * 1000000.0f / (now - window_start);
+            window_start = now;
+            window_frames = 0;
+        }
+
+        stream_slot_t *slot = stream_claim_slot();
+        if (!slot) {
+            esp_camera_fb_return(fb);
+            s_stats.frames_dropped++;
+            continue;
+        }
+
+        slot->frame.fb = fb;
+        slot->frame.capture_time_us = (int64_t)fb->timestamp.tv_sec * 1000000 + fb->timestamp.tv_usec;
+        slot->frame.sequence = sequence++;
+        atomic_store_explicit(&slot->refs, 1, memory_order_release);
+
+        // The queue owns the first reference until a consumer pops the frame
+        if (!stream_ring_push((uint8_t)(slot - s_slots))) {
+            atomic_store_explicit(&slot->refs, 0, memory_order_release);
+            esp_camera_fb_return(fb);
+            s_stats.frames_dropped++;
+            continue;
+        }
+
+        xSemaphoreGive(s_frame_ready);
+    }
+
+    xSemaphoreGive(s_grab_stopped);
+    vTaskDelete(NULL);
+}
+
+// Waits for the grab task to exit and returns the frames it left queued
+static esp_err_t stream_reap(void)
+{
+    if (xSemaphoreTake(s_grab_stopped, pdMS_TO_TICKS(STREAM_STOP_TIMEOUT_MS)) != pdTRUE) {
+        s_stop_pending = true;
+        return ESP_ERR_TIMEOUT;
+    }
+    s_stop_pending = false;
+    s_grab_task = NULL;
+
+    stream_slot_t *slot;
+    while ((slot = stream_ring_pop()) != NULL) {
+        camera_module_frame_release(&slot->frame);
+    }
+    return ESP_OK;
+}
+
+esp_err_t camera_module_stream_start(const camera_stream_config_t *config)
+{
+    if (!camera_initialized || !config) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (s_stream_running) {
+        return ESP_OK;
+    }
+
+    // The slots and the ring are shared: a second task may not start while
+    // the last one still holds a driver fb
+    if (s_stop_pending && stream_reap() != ESP_OK) {
+        ESP_LOGE(TAG, "Grab task of the last stream still running");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    if (!s_frame_ready) {
+        s_frame_ready = xSemaphoreCreateBinary();
+        s_grab_stopped = xSemaphoreCreateBinary();
+        if (!s_frame_ready || !s_grab_stopped) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    // Never let the queue hold every buffer, or the driver stalls the sensor
+    int depth = config->queue_depth > 0 ? config->queue_depth : 1;
+    if (depth > s_fb_count - 1) {
+        depth = s_fb_count > 1 ? s_fb_count - 1 : 1;
+    }
+    s_ring_depth = depth;
+
+    atomic_store(&s_ring_head, 0);
+    atomic_store(&s_ring_tail, 0);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_latency_sum_us = 0;
+
+    s_stream_running = true;
+    BaseType_t created = xTaskCreatePinnedToCore(camera_grab_task, "camera_grab", STREAM_TASK_STACK, NULL,
+                                                 config->task_priority, &s_grab_task, config->core_id);
+    if (created != pdPASS) {
+        s_stream_running = false;
+        ESP_LOGE(TAG, "Failed to create grab task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Capture stream started on core %d (queue depth %d, fb_count %d)",
+             config->core_id, depth, s_fb_count);
+    return ESP_OK;
+}
+
+esp_err_t camera_module_stream_stop(void)
+{
+    if (!s_stream_running && !s_stop_pending) {
+        return ESP_OK;
+    }
+
+    // Stopped either way; a task that outlives the timeout is reaped by the
+    // next stop or start
+    s_stream_running = false;
+    if (stream_reap() != ESP_OK) {
+        ESP_LOGW(TAG, "Grab task did not stop in time");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    ESP_LOGI(TAG, "Capture stream stopped: %lu captured, %lu delivered, %lu dropped",
+             (unsigned long)s_stats.frames_captured, (unsigned long)s_stats.frames_delivered,
+             (unsigned long)s_stats.frames_dropped);
+    return ESP_OK;
+}
+
+bool camera_module_stream_is_running(void)
+{
+    return s_stream_running;
+}
+
+camera_frame_t* camera_module_stream_acquire(TickType_t wait_ticks)
+{
+    stream_slot_t *slot = stream_ring_pop();
+    while (!slot) {
+        if (!s_stream_running || xSemaphoreTake(s_frame_ready, wait_ticks) != pdTRUE) {
+            return NULL;
+        }
+        slot = stream_ring_pop();
+    }
+
+    int64_t latency = esp_timer_get_time() - slot->frame.capture_time_us;
+    if (latency > 0) {
+        s_latency_sum_us += latency;
+        if (latency > s_stats.latency_max_us) {
+            s_stats.latency_max_us = (uint32_t)latency;
+        }
+    }
+    s_stats.frames_delivered++;
+
+    return &slot->frame;
+}
+
+void camera_module_frame_retain(camera_frame_t *frame)
+{
+    if (frame) {
+        atomic_fetch_add(&((stream_slot_t *)frame)->refs, 1);
+    }
+}
+
+void camera_module_frame_release(camera_frame_t *frame)
+{
+    if (!frame) {
+        return;
+    }
+
+    // Read the fb before dropping our reference: at zero the grab task may reuse the slot
+    camera_fb_t *fb = frame->fb;
+    if (atomic_fetch_sub(&((stream_slot_t *)frame)->refs, 1) == 1) {
         esp_camera_fb_return(fb);
     }
 }
 
+esp_err_t camera_module_get_stream_stats(camera_stream_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    stats->latency_avg_us = s_stats.frames_delivered ?
+                            (uint32_t)(s_latency_sum_us / s_stats.frames_delivered) : 0;
+    return ESP_OK;
+}
+
+esp_err_t camera_module_rate_control_start(const camera_rate_control_config_t *config)
+{
+    if (!camera_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (!config || config->min_quality > config->max_quality) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(s_rc_lock, portMAX_DELAY);
+    memset(&s_rc, 0, sizeof(s_rc));
+    s_rc.config = *config;
+    s_rc.output = s_quality;
+    s_rc.window_start_us = esp_timer_get_time();
+    s_rc.enabled = true;
+    xSemaphoreGive(s_rc_lock);
+
+    ESP_LOGI(TAG, "Rate control started: target %lu bytes/frame, quality %d..%d",
+             (unsigned long)config->target_frame_bytes, config->min_quality, config->max_quality);
+    return ESP_OK;
+}
+
+void camera_module_rate_control_stop(void)
+{
+    if (!s_rc_lock) {
+        return;
+    }
+    xSemaphoreTake(s_rc_lock, portMAX_DELAY);
+    s_rc.enabled = false;
+    xSemaphoreGive(s_rc_lock);
+}
+
+esp_err_t camera_module_rate_control_set_target(uint32_t target_frame_bytes)
+{
+    if (target_frame_bytes == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_rc_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_rc_lock, portMAX_DELAY);
+    s_rc.config.target_frame_bytes = target_frame_bytes;
+    xSemaphoreGive(s_rc_lock);
+    return ESP_OK;
+}
+
+uint32_t camera_module_rate_control_target(uint32_t write_bytes_per_sec, float fps, float headroom)
+{
+    if (write_bytes_per_sec == 0 || fps <= 0.0f) {
+        return 0;
+    }
+    return (uint32_t)(write_bytes_per_sec * headroom / fps);
+}
+
+static void rate_control_log_window(int64_t now)
+{
+    int64_t elapsed = now - s_rc.window_start_us;
+    if (elapsed <= 0 || s_rc.window_frames == 0) {
+        return;
+    }
+
+    s_rc.bytes_per_sec = (uint32_t)(s_rc.window_bytes * 1000000 / elapsed);
+    ESP_LOGI(TAG, "Rate control: %lu B/s at %.1f fps, avg %lu B/frame (target %lu), quality %d",
+             (unsigned long)s_rc.bytes_per_sec, s_rc.window_frames * 1000000.0f / elapsed,
+             (unsigned long)s_rc.avg_frame_bytes, (unsigned long)s_rc.config.target_frame_bytes, s_quality);
+
+    s_rc.window_start_us = now;
+    s_rc.window_bytes = 0;
+    s_rc.window_frames = 0;
+}
+
+// Called with s_rc_lock held
+static void rate_control_update(size_t frame_len)
+{
+    const camera_rate_control_config_t *cfg = &s_rc.config;
+
+    s_rc.avg_frame_bytes = s_rc.avg_frame_bytes > 0.0f ?
+                           s_rc.avg_frame_bytes * 0.9f + frame_len * 0.1f : frame_len;
+    s_rc.window_bytes += frame_len;
+    s_rc.window_frames++;
+
+    // JPEG size is roughly exponential in quality, so work on the log ratio,
+    // smoothed over a few frames so per-frame noise does not hit the sensor
+    float raw_error = logf((float)frame_len / cfg->target_frame_bytes);
+    s_rc.filtered_error += RC_ERROR_ALPHA * (raw_error - s_rc.filtered_error);
+    float error = s_rc.filtered_error;
+    if (fabsf(error) < log1pf(cfg->deadband)) {
+        error = 0.0f;
+    }
+
+    // Velocity form: clamping the output is all the anti-windup it needs
+    s_rc.output += cfg->kp * (error - s_rc.prev_error) + cfg->ki * error;
+    s_rc.prev_error = error;
+    if (s_rc.output < cfg->min_quality) {
+        s_rc.output = cfg->min_quality;
+    } else if (s_rc.output > cfg->max_quality) {
+        s_rc.output = cfg->max_quality;
+    }
+
+    // Never block the grab task on the sensor; if the app holds the lock the
+    // step is retried on the next frame
+    int quality = (int)lroundf(s_rc.output);
+    if (quality != s_quality && fabsf(s_rc.output - s_quality) > RC_HYSTERESIS &&
+        xSemaphoreTake(s_sensor_lock, 0) == pdTRUE) {
+        sensor_t *sensor = esp_camera_sensor_get();
+        if (sensor && sensor->set_quality(sensor, quality) == 0) {
+            ESP_LOGD(TAG, "Rate control: quality %d -> %d (frame %zu bytes)", s_quality, quality, frame_len);
+            s_quality = quality;
+            s_rc.adjustments++;
+        }
+        xSemaphoreGive(s_sensor_lock);
+    }
+
+    if (cfg->log_interval_ms > 0) {
+        int64_t now = esp_timer_get_time();
+        if (now - s_rc.window_start_us >= (int64_t)cfg->log_interval_ms * 1000) {
+            rate_control_log_window(now);
+        }
+    }
+}
+
+void camera_module_rate_control_observe(size_t frame_len)
+{
+    if (frame_len == 0 || !s_rc_lock) {
+        return;
+    }
+
+    xSemaphoreTake(s_rc_lock, portMAX_DELAY);
+    if (s_rc.enabled && s_rc.config.target_frame_bytes != 0) {
+        rate_control_update(frame_len);
+    }
+    xSemaphoreGive(s_rc_lock);
+}
+
+esp_err_t camera_module_get_rate_control_stats(camera_rate_control_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_rc_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_rc_lock, portMAX_DELAY);
+    stats->enabled = s_rc.enabled;
+    stats->quality = s_quality;
+    stats->target_frame_bytes = s_rc.config.target_frame_bytes;
+    stats->bytes_per_sec = s_rc.bytes_per_sec;
+    stats->avg_frame_bytes = (uint32_t)s_rc.avg_frame_bytes;
+    stats->adjustments = s_rc.adjustments;
+    xSemaphoreGive(s_rc_lock);
+    return ESP_OK;
+}
+
 esp_err_t camera_module_set_quality(int quality)
 {
     if (!camera_initialized) {
@@ -134,10 +633,17 @@ esp_err_t camera_module_set_quality(int quality)
         return ESP_FAIL;
     }
 
+    xSemaphoreTake(s_sensor_lock, portMAX_DELAY);
     if (sensor->set_quality(sensor, quality) != 0) {
+        xSemaphoreGive(s_sensor_lock);
         return ESP_FAIL;
     }
 
+    xSemaphoreTake(s_rc_lock, portMAX_DELAY);
+    s_quality = quality;
+    s_rc.output = quality;
+    xSemaphoreGive(s_rc_lock);
+    xSemaphoreGive(s_sensor_lock);
     ESP_LOGI(TAG, "JPEG quality set to %d", quality);
     return ESP_OK;
 }
@@ -153,11 +659,31 @@ esp_err_t camera_module_set_brightness(int brightness)
         return ESP_FAIL;
     }
 
-    if (sensor->set_brightness(sensor, brightness) != 0) {
+    xSemaphoreTake(s_sensor_lock, portMAX_DELAY);
+    int ret = sensor->set_brightness(sensor, brightness);
+    xSemaphoreGive(s_sensor_lock);
+    return ret == 0 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t camera_module_set_manual_exposure(bool manual, int aec_value)
+{
+    if (!camera_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    sensor_t *sensor = esp_camera_sensor_get();
+    if (!sensor) {
         return ESP_FAIL;
     }
 
-    return ESP_OK;
+    // Both registers under one hold so no other write lands between them
+    xSemaphoreTake(s_sensor_lock, portMAX_DELAY);
+    int ret = sensor->set_exposure_ctrl(sensor, manual ? 0 : 1);
+    if (ret == 0 && manual) {
+        ret = sensor->set_aec_value(sensor, aec_value);
+    }
+    xSemaphoreGive(s_sensor_lock);
+    return ret == 0 ? ESP_OK : ESP_FAIL;
 }
 
 esp_err_t camera_module_set_contrast(int contrast)
@@ -171,11 +697,10 @@ esp_err_t camera_module_set_contrast(int contrast)
         return ESP_FAIL;
     }
 
-    if (sensor->set_contrast(sensor, contrast) != 0) {
-        return ESP_FAIL;
-    }
-
-    return ESP_OK;
+    xSemaphoreTake(s_sensor_lock, portMAX_DELAY);
+    int ret = sensor->set_contrast(sensor, contrast);
+    xSemaphoreGive(s_sensor_lock);
+    return ret == 0 ? ESP_OK : ESP_FAIL;
 }
 
 esp_err_t camera_module_set_saturation(int saturation)
@@ -189,9 +714,8 @@ esp_err_t camera_module_set_saturation(int saturation)
         return ESP_FAIL;
     }
 
-    if (sensor->set_saturation(sensor, saturation) != 0) {
-        return ESP_FAIL;
-    }
-
-    return ESP_OK;
+    xSemaphoreTake(s_sensor_lock, portMAX_DELAY);
+    int ret = sensor->set_saturation(sensor, saturation);
+    xSemaphoreGive(s_sensor_lock);
+    return ret == 0 ? ESP_OK : ESP_FAIL;
 }
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "esp_err.h"
 #include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -12,20 +15,107 @@ typedef struct {
     pixformat_t pixel_format;
     int jpeg_quality;
     int fb_count;
+    bool grab_latest;           // CAMERA_GRAB_LATEST instead of CAMERA_GRAB_WHEN_EMPTY
 } camera_config_params_t;
 
+// Continuous capture: a grab task pinned to one core keeps the sensor busy
+// and publishes frames into a lock-free single-producer/single-consumer
+// queue. Frames are reference counted; the fb goes back to the driver when
+// the last holder releases it.
+typedef struct {
+    int core_id;
+    int task_priority;
+    int queue_depth;            // clamped to fb_count - 1 so the driver always owns a buffer
+} camera_stream_config_t;
+
+typedef struct {
+    camera_fb_t *fb;
+    int64_t capture_time_us;    // esp_timer time of the frame's VSYNC
+    uint32_t sequence;
+} camera_frame_t;
+
+typedef struct {
+    uint32_t frames_captured;
+    uint32_t frames_delivered;
+    uint32_t frames_dropped;
+    uint32_t grab_failures;
+    float fps;
+    uint32_t latency_avg_us;    // capture to consumer acquire
+    uint32_t latency_max_us;
+} camera_stream_stats_t;
+
+// Closed-loop JPEG rate control: each frame's size is compared against a
+// bytes/frame budget and a PI controller on the log size error moves the
+// sensor quality (higher number = smaller frames) between the clamps.
+typedef struct {
+    uint32_t target_frame_bytes;
+    int min_quality;            // best quality the controller may pick
+    int max_quality;            // worst quality the controller may pick
+    float kp;                   // quality steps per unit of log size error
+    float ki;
+    float deadband;             // relative size error treated as on target, e.g. 0.1
+    uint32_t log_interval_ms;   // 0 disables the periodic bitrate log
+} camera_rate_control_config_t;
+
+typedef struct {
+    bool enabled;
+    int quality;
+    uint32_t target_frame_bytes;
+    uint32_t bytes_per_sec;     // achieved over the last log window
+    uint32_t avg_frame_bytes;
+    uint32_t adjustments;
+} camera_rate_control_stats_t;
+
 esp_err_t camera_module_init(const camera_config_params_t *params);
 
+// Stops the stream first; if its grab task will not exit, returns
+// ESP_ERR_TIMEOUT and leaves the camera initialized
 esp_err_t camera_module_deinit(void);
 
 camera_fb_t* camera_module_capture(void);
 
 void camera_module_return_fb(camera_fb_t *fb);
 
+// ESP_ERR_TIMEOUT while the grab task of the last stream has not exited
+esp_err_t camera_module_stream_start(const camera_stream_config_t *config);
+
+// On ESP_ERR_TIMEOUT the stream is stopped but its grab task is still in
+// the driver; start, capture and deinit wait for it, and a later stop
+// tries again
+esp_err_t camera_module_stream_stop(void);
+
+bool camera_module_stream_is_running(void);
+
+camera_frame_t* camera_module_stream_acquire(TickType_t wait_ticks);
+
+void camera_module_frame_retain(camera_frame_t *frame);
+
+void camera_module_frame_release(camera_frame_t *frame);
+
+esp_err_t camera_module_get_stream_stats(camera_stream_stats_t *stats);
+
+esp_err_t camera_module_rate_control_start(const camera_rate_control_config_t *config);
+
+void camera_module_rate_control_stop(void);
+
+esp_err_t camera_module_rate_control_set_target(uint32_t target_frame_bytes);
+
+// Bytes/frame that fits a write budget: throughput * headroom / fps
+uint32_t camera_module_rate_control_target(uint32_t write_bytes_per_sec, float fps, float headroom);
+
+// Feeds one frame size to the controller; capture paths call this already
+void camera_module_rate_control_observe(size_t frame_len);
+
+esp_err_t camera_module_get_rate_control_stats(camera_rate_control_stats_t *stats);
+
 esp_err_t camera_module_set_quality(int quality);
 
 esp_err_t camera_module_set_brightness(int brightness);
 
+// manual = false hands exposure back to the sensor's AEC. aec_value is the
+// exposure time in lines, 0..1200 on the OV2640.
+esp_err_t camera_module_set_manual_exposure(bool manual, int aec_value);
+
 esp_err_t camera_module_set_contrast(int contrast);
 
 esp_err_t camera_module_set_saturation(int saturation);
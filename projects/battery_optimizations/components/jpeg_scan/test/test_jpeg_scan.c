@@ -0,0 +1,99 @@
+#include "unity.h"
+#include "jpeg_scan.h"
+#include "jpeg_scan_fixtures.h"
+#include <string.h>
+
+#define FIXTURE_BLOCKS  ((FIXTURE_WIDTH / 8) * (FIXTURE_HEIGHT / 8))
+
+static void check_means(const uint8_t *jpeg, size_t len, const uint8_t *expected)
+{
+    jpeg_scan_info_t info;
+    TEST_ASSERT_EQUAL(ESP_OK, jpeg_scan_get_info(jpeg, len, &info));
+    TEST_ASSERT_EQUAL(FIXTURE_WIDTH, info.width);
+    TEST_ASSERT_EQUAL(FIXTURE_HEIGHT, info.height);
+    TEST_ASSERT_EQUAL(FIXTURE_WIDTH / 8, info.blocks_w);
+    TEST_ASSERT_EQUAL(FIXTURE_HEIGHT / 8, info.blocks_h);
+
+    uint8_t dc[FIXTURE_BLOCKS];
+    jpeg_scan_output_t out = { .luma_dc = dc, .luma_dc_size = sizeof(dc) };
+    TEST_ASSERT_EQUAL(ESP_OK, jpeg_scan_decode(jpeg, len, &out, NULL));
+    for (int i = 0; i < FIXTURE_BLOCKS; i++) {
+        TEST_ASSERT_INT_WITHIN(2, expected[i], dc[i]);
+    }
+}
+
+TEST_CASE("DC means match the block means of a grayscale JPEG", "[jpeg_scan]")
+{
+    check_means(fixture_jpeg_gray, sizeof(fixture_jpeg_gray), fixture_means_gray);
+}
+
+TEST_CASE("DC means match across chroma subsampling", "[jpeg_scan]")
+{
+    check_means(fixture_jpeg_444, sizeof(fixture_jpeg_444), fixture_means_color);
+    check_means(fixture_jpeg_422, sizeof(fixture_jpeg_422), fixture_means_color);
+    check_means(fixture_jpeg_420, sizeof(fixture_jpeg_420), fixture_means_color);
+}
+
+TEST_CASE("DC means survive restart intervals", "[jpeg_scan]")
+{
+    check_means(fixture_jpeg_420_restart, sizeof(fixture_jpeg_420_restart), fixture_means_color);
+}
+
+TEST_CASE("a strided DC map leaves the padding alone", "[jpeg_scan]")
+{
+    const int stride = FIXTURE_WIDTH / 8 + 3;
+    uint8_t dc[stride * (FIXTURE_HEIGHT / 8)];
+    memset(dc, 0xA5, sizeof(dc));
+    jpeg_scan_output_t out = { .luma_dc = dc, .luma_dc_size = sizeof(dc), .luma_dc_stride = stride };
+    TEST_ASSERT_EQUAL(ESP_OK, jpeg_scan_decode(fixture_jpeg_420, sizeof(fixture_jpeg_420), &out, NULL));
+    for (int y = 0; y < FIXTURE_HEIGHT / 8; y++) {
+        for (int x = 0; x < stride; x++) {
+            if (x < FIXTURE_WIDTH / 8) {
+                TEST_ASSERT_INT_WITHIN(2, fixture_means_color[y * (FIXTURE_WIDTH / 8) + x], dc[y * stride + x]);
+            } else {
+                TEST_ASSERT_EQUAL(0xA5, dc[y * stride + x]);
+            }
+        }
+    }
+}
+
+TEST_CASE("truncated and undersized inputs are refused", "[jpeg_scan]")
+{
+    uint8_t dc[FIXTURE_BLOCKS];
+    jpeg_scan_output_t out = { .luma_dc = dc, .luma_dc_size = sizeof(dc) };
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, jpeg_scan_decode(fixture_jpeg_420, sizeof(fixture_jpeg_420) / 2, &out, NULL));
+
+    out.luma_dc_size = FIXTURE_BLOCKS - 1;
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, jpeg_scan_decode(fixture_jpeg_420, sizeof(fixture_jpeg_420), &out, NULL));
+
+    jpeg_scan_info_t info;
+    static const uint8_t not_jpeg[] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, jpeg_scan_get_info(not_jpeg, sizeof(not_jpeg), &info));
+}
+
+TEST_CASE("a kept DC map is reused and emptied by a failed decode", "[jpeg_scan]")
+{
+    jpeg_scan_dc_map_t map = {0};
+    TEST_ASSERT_EQUAL(ESP_OK, jpeg_scan_dc_map(fixture_jpeg_420, sizeof(fixture_jpeg_420), &map));
+    TEST_ASSERT_EQUAL(FIXTURE_WIDTH / 8, map.blocks_w);
+    TEST_ASSERT_EQUAL(FIXTURE_HEIGHT / 8, map.blocks_h);
+    TEST_ASSERT_EQUAL(FIXTURE_BLOCKS, map.size);
+    for (int i = 0; i < FIXTURE_BLOCKS; i++) {
+        TEST_ASSERT_INT_WITHIN(2, fixture_means_color[i], map.luma_dc[i]);
+    }
+
+    uint8_t *grid = map.luma_dc;
+    TEST_ASSERT_EQUAL(ESP_OK, jpeg_scan_dc_map(fixture_jpeg_gray, sizeof(fixture_jpeg_gray), &map));
+    TEST_ASSERT_EQUAL_PTR(grid, map.luma_dc);
+    for (int i = 0; i < FIXTURE_BLOCKS; i++) {
+        TEST_ASSERT_INT_WITHIN(2, fixture_means_gray[i], map.luma_dc[i]);
+    }
+
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, jpeg_scan_dc_map(fixture_jpeg_420, sizeof(fixture_jpeg_420) / 2, &map));
+    TEST_ASSERT_EQUAL(0, map.blocks_w);
+    TEST_ASSERT_EQUAL(0, map.blocks_h);
+
+    jpeg_scan_dc_map_free(&map);
+    TEST_ASSERT_NULL(map.luma_dc);
+    TEST_ASSERT_EQUAL(0, map.size);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_camera.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Motion detection on a decimated luma grid: one cell per 8x8 block, taken
+// from the JPEG DC terms (no full decode) or box-averaged from a grayscale
+// frame. Cells are differenced against a running background four at a time
+// and thresholded; the zone mask limits which cells count.
+#define MOTION_MAX_ZONES    4
+
+typedef struct {
+    uint8_t x0;                 // percent of frame width/height, x1/y1 exclusive
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+    bool exclude;               // carve the rectangle out instead of adding it
+} motion_zone_t;
+
+typedef struct {
+    uint8_t cell_threshold;         // luma change (1..127) for a cell to count
+    float min_changed_fraction;     // sensitivity: share of zone cells that must change
+    float global_change_fraction;   // above this the whole scene shifted (exposure), rebaseline
+    uint8_t learn_shift;            // background moves 1/2^n towards each frame, 1..4
+    motion_zone_t zones[MOTION_MAX_ZONES];
+    int zone_count;                 // 0 = whole frame
+} motion_detect_config_t;
+
+typedef struct {
+    bool motion;
+    float score;                // share of zone cells that changed
+    uint32_t changed_cells;
+    uint16_t x;                 // bounding box of changed cells, frame pixels
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t eval_us;           // grid extraction + differencing for this frame
+} motion_result_t;
+
+typedef struct {
+    uint32_t frames_evaluated;
+    uint32_t motion_frames;
+    uint32_t rebaselines;
+    uint32_t decode_avg_us;
+    uint32_t eval_avg_us;
+    uint32_t eval_max_us;
+} motion_detect_stats_t;
+
+esp_err_t motion_detect_init(const motion_detect_config_t *config);
+
+void motion_detect_deinit(void);
+
+// The first frame, and the first after a change of frame size, only
+// becomes the background and never reports motion
+esp_err_t motion_detect_process(const camera_fb_t *fb, motion_result_t *result);
+
+// Drops the background so the next frame becomes the new reference
+void motion_detect_reset(void);
+
+esp_err_t motion_detect_get_stats(motion_detect_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
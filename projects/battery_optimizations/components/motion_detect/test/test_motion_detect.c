@@ -0,0 +1,177 @@
+#include "unity.h"
+#include "motion_detect.h"
+#include "frame_test_util.h"
+#include <string.h>
+#include <stdlib.h>
+
+#define FRAME_W     160
+#define FRAME_H     120
+#define GRID_W      (FRAME_W / 8)
+#define GRID_H      (FRAME_H / 8)
+
+static camera_fb_t *s_fb;
+
+// Gradient scene scaled by gain, with per-pixel noise and an optional bright square
+static void draw_scene(float gain, int square_x, int square_y, int square_size)
+{
+    for (int y = 0; y < FRAME_H; y++) {
+        for (int x = 0; x < FRAME_W; x++) {
+            int v = 60 + x / 2 + y / 3;
+            if (x >= square_x && x < square_x + square_size && y >= square_y && y < square_y + square_size) {
+                v = 230;
+            }
+            s_fb->buf[y * FRAME_W + x] = frame_test_clamp8((int)(v * gain) + frame_test_noise(6));
+        }
+    }
+}
+
+static void detect_start(const motion_detect_config_t *config)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_init(config));
+    s_fb = frame_test_gray(FRAME_W, FRAME_H);
+    motion_result_t result;
+    draw_scene(1.0f, 0, 0, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_FALSE(result.motion);
+}
+
+static const motion_detect_config_t default_config = {
+    .cell_threshold = 12,
+    .min_changed_fraction = 0.01f,
+    .global_change_fraction = 0.6f,
+    .learn_shift = 3,
+};
+
+TEST_CASE("sensor noise alone does not trigger", "[motion]")
+{
+    detect_start(&default_config);
+    motion_result_t result;
+    for (int i = 0; i < 20; i++) {
+        draw_scene(1.0f, 0, 0, 0);
+        TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+        TEST_ASSERT_FALSE(result.motion);
+        TEST_ASSERT_EQUAL(0, result.changed_cells);
+    }
+    motion_detect_deinit();
+}
+
+TEST_CASE("a moving object triggers with its bounding box", "[motion]")
+{
+    detect_start(&default_config);
+    motion_result_t result;
+    draw_scene(1.0f, 64, 40, 24);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_TRUE(result.motion);
+    TEST_ASSERT_EQUAL(9, result.changed_cells);
+    TEST_ASSERT_EQUAL(64, result.x);
+    TEST_ASSERT_EQUAL(40, result.y);
+    TEST_ASSERT_EQUAL(24, result.width);
+    TEST_ASSERT_EQUAL(24, result.height);
+
+    // Straddling cell borders the box grows to whole cells
+    draw_scene(1.0f, 100, 84, 12);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_TRUE(result.motion);
+    TEST_ASSERT_LESS_OR_EQUAL(96, result.x);
+    TEST_ASSERT_LESS_OR_EQUAL(80, result.y);
+    TEST_ASSERT_GREATER_OR_EQUAL(112, result.x + result.width);
+    TEST_ASSERT_GREATER_OR_EQUAL(96, result.y + result.height);
+
+    motion_detect_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_get_stats(&stats));
+    TEST_ASSERT_EQUAL(2, stats.motion_frames);
+    motion_detect_deinit();
+}
+
+TEST_CASE("an exposure step rebaselines instead of triggering", "[motion]")
+{
+    detect_start(&default_config);
+    motion_result_t result;
+    draw_scene(1.4f, 0, 0, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_FALSE(result.motion);
+    TEST_ASSERT_GREATER_THAN(0.6f, result.score);
+
+    // The new exposure is the background now
+    draw_scene(1.4f, 0, 0, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_FALSE(result.motion);
+    TEST_ASSERT_EQUAL(0, result.changed_cells);
+
+    motion_detect_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_get_stats(&stats));
+    TEST_ASSERT_EQUAL(1, stats.rebaselines);
+    TEST_ASSERT_EQUAL(0, stats.motion_frames);
+    motion_detect_deinit();
+}
+
+TEST_CASE("excluded zones do not count", "[motion]")
+{
+    motion_detect_config_t config = default_config;
+    config.zones[0] = (motion_zone_t) { .x0 = 0, .y0 = 0, .x1 = 50, .y1 = 100, .exclude = true };
+    config.zones[1] = (motion_zone_t) { .x0 = 50, .y0 = 0, .x1 = 100, .y1 = 100 };
+    config.zone_count = 2;
+    detect_start(&config);
+
+    motion_result_t result;
+    draw_scene(1.0f, 16, 40, 24);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_FALSE(result.motion);
+    TEST_ASSERT_EQUAL(0, result.changed_cells);
+
+    draw_scene(1.0f, 104, 40, 24);
+    TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+    TEST_ASSERT_TRUE(result.motion);
+    // Half the frame is in the zone, so the score is over its 150 cells
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 9.0f / (GRID_W * GRID_H / 2), result.score);
+    motion_detect_deinit();
+}
+
+// Flat 8x8 blocks make every cell exact, so the packed four-cell compare
+// can be checked against a plain per-cell one across the whole byte range
+TEST_CASE("packed differencing matches a per-cell compare", "[motion]")
+{
+    static uint8_t background[GRID_W * GRID_H];
+    static uint8_t current[GRID_W * GRID_H];
+    static const uint8_t thresholds[] = { 1, 12, 64, 127 };
+    s_fb = frame_test_gray(FRAME_W, FRAME_H);
+
+    for (int t = 0; t < sizeof(thresholds); t++) {
+        motion_detect_config_t config = {
+            .cell_threshold = thresholds[t],
+            .min_changed_fraction = 0.0f,
+            .global_change_fraction = 2.0f,
+            .learn_shift = 1,
+        };
+        TEST_ASSERT_EQUAL(ESP_OK, motion_detect_init(&config));
+
+        for (int round = 0; round < 50; round++) {
+            for (int i = 0; i < GRID_W * GRID_H; i++) {
+                background[i] = (uint8_t)frame_test_noise(128);
+                // Half the cells sit right at the threshold edge
+                int edge = thresholds[t] + (i & 1) * (frame_test_noise(1));
+                current[i] = (i & 2) ? (uint8_t)frame_test_noise(128)
+                                     : frame_test_clamp8(background[i] + (frame_test_noise(1) < 0 ? -edge : edge));
+            }
+
+            uint32_t expected = 0;
+            for (int i = 0; i < GRID_W * GRID_H; i++) {
+                expected += abs(current[i] - background[i]) > thresholds[t];
+            }
+
+            motion_result_t result;
+            for (int pass = 0; pass < 2; pass++) {
+                const uint8_t *cells = pass ? current : background;
+                for (int y = 0; y < FRAME_H; y++) {
+                    for (int x = 0; x < FRAME_W; x++) {
+                        s_fb->buf[y * FRAME_W + x] = cells[(y / 8) * GRID_W + x / 8];
+                    }
+                }
+                TEST_ASSERT_EQUAL(ESP_OK, motion_detect_process(s_fb, &result));
+            }
+            TEST_ASSERT_EQUAL(expected, result.changed_cells);
+            motion_detect_reset();
+        }
+        motion_detect_deinit();
+    }
+}
\ No newline at end of file
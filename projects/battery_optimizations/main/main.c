@@ -26,6 +26,7 @@
 #include "driver/ledc.h"
 #include "camera_module.h"
 #include "sdcard_module.h"
+#include "motion_detect.h"
 
 static const char *TAG = "battery_optimizations";
 
@@ -45,6 +46,11 @@ static const char *TAG = "battery_optimizations";
 #define THERMAL_THRESHOLD_C         50.0   // Temperature threshold
 #define MAX_SD_FILES               10
 
+// Motion gating: frames are only written when the scene changed, plus one
+// keepalive photo so a quiet scene still shows the camera is alive
+#define MOTION_POLL_MS             2000
+#define KEEPALIVE_MS               (15 * 60 * 1000)
+
 // LED GPIO definitions for XIAO ESP32S3 Sense
 #define LED_TX_RED_GPIO    GPIO_NUM_21     // Red LED for TX activity
 #define LED_RX_ORANGE_GPIO GPIO_NUM_47     // Orange LED for RX activity
@@ -284,6 +290,7 @@ static void capture_task(void *pvParameters) {
     char filename[64];
     float current_temp = 0;
     int capture_interval_ms = CAPTURE_INTERVAL_NORMAL_MS;
+    TickType_t last_save = 0;
     
     while (1) {
         // Get current temperature for thermal management
@@ -299,7 +306,8 @@ static void capture_task(void *pvParameters) {
             }
         }
         
-        ESP_LOGI(TAG, "Taking picture (Temp: %.1f°C)...", current_temp);
+        // Hot: poll at the reduced capture rate; cool: poll for motion
+        int poll_ms = current_temp > THERMAL_THRESHOLD_C ? capture_interval_ms : MOTION_POLL_MS;
         
         camera_fb_t *fb = camera_module_capture();
         if (!fb) {
@@ -308,6 +316,27 @@ static void capture_task(void *pvParameters) {
             continue;
         }
         
+        TickType_t now = xTaskGetTickCount();
+        motion_result_t motion = {0};
+        esp_err_t motion_ret = motion_detect_process(fb, &motion);
+        bool keepalive = last_save == 0 || (now - last_save) >= pdMS_TO_TICKS(KEEPALIVE_MS);
+        
+        // If the detector is unusable fall back to plain interval capture
+        bool due = motion_ret != ESP_OK ? (now - last_save) >= pdMS_TO_TICKS(capture_interval_ms) : motion.motion;
+        if (!due && !keepalive) {
+            camera_module_return_fb(fb);
+            vTaskDelay(pdMS_TO_TICKS(poll_ms));
+            continue;
+        }
+        last_save = now;
+        
+        if (motion.motion) {
+            ESP_LOGI(TAG, "Motion %.1f%% box %dx%d at (%d,%d), evaluated in %lu us",
+                     motion.score * 100.0f, motion.width, motion.height, motion.x, motion.y,
+                     (unsigned long)motion.eval_us);
+        }
+        ESP_LOGI(TAG, "Taking picture (Temp: %.1f°C)...", current_temp);
+        
         snprintf(filename, sizeof(filename), "photo_%04d_%.0fC.jpg", photo_index++, current_temp);
         
         esp_err_t err = sdcard_module_save_jpeg(fb->buf, fb->len, filename);
@@ -326,7 +355,7 @@ static void capture_task(void *pvParameters) {
         
         camera_module_return_fb(fb);
         
-        vTaskDelay(pdMS_TO_TICKS(capture_interval_ms));
+        vTaskDelay(pdMS_TO_TICKS(poll_ms));
     }
 }
 
@@ -377,13 +406,17 @@ static esp_err_t stats_get_handler(httpd_req_t *req) {
     }
     ESP_ERROR_CHECK(temperature_sensor_get_celsius(temp_sensor, &tsens_value));
     
-    char resp_str[512];
+    motion_detect_stats_t motion_stats = {0};
+    motion_detect_get_stats(&motion_stats);
+    
+    char resp_str[640];
     snprintf(resp_str, sizeof(resp_str),
              "{\"chip\":\"%s\",\"cores\":%d,\"revision\":%d,"
              "\"flash_size_mb\":%lu,\"heap_free\":%d,\"heap_total\":%d,"
              "\"psram_free\":%d,\"psram_total\":%d,"
              "\"temperature_c\":%.1f,\"uptime_ms\":%llu,"
-             "\"usb_powered\":%s}",
+             "\"usb_powered\":%s,\"motion_frames\":%lu,\"motion_evaluated\":%lu,"
+             "\"motion_eval_avg_us\":%lu,\"motion_eval_max_us\":%lu}",
              chip_info.model == CHIP_ESP32S3 ? "ESP32-S3" : "Unknown",
              chip_info.cores,
              chip_info.revision,
@@ -394,7 +427,11 @@ static esp_err_t stats_get_handler(httpd_req_t *req) {
              (int)heap_caps_get_total_size(MALLOC_CAP_SPIRAM),
              tsens_value,
              (unsigned long long)(esp_timer_get_time() / 1000),
-             usb_powered ? "true" : "false");
+             usb_powered ? "true" : "false",
+             (unsigned long)motion_stats.motion_frames,
+             (unsigned long)motion_stats.frames_evaluated,
+             (unsigned long)motion_stats.eval_avg_us,
+             (unsigned long)motion_stats.eval_max_us);
     
     // Save stats to SD card
     if (sdcard_module_is_mounted()) {
@@ -489,6 +526,17 @@ void app_main(void) {
     
     start_webserver();
     
+    motion_detect_config_t motion_config = {
+        .cell_threshold = 12,
+        .min_changed_fraction = 0.002f,
+        .global_change_fraction = 0.6f,
+        .learn_shift = 3,
+        .zone_count = 0
+    };
+    if (motion_detect_init(&motion_config) != ESP_OK) {
+        ESP_LOGE(TAG, "Motion detect init failed - falling back to interval capture");
+    }
+    
     // Start camera capture task if both camera and SD card initialized
     if (cam_ret == ESP_OK && sd_ret == ESP_OK) {
         ESP_LOGI(TAG, "Starting thermal-aware capture task...");
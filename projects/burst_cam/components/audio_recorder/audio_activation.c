@@ -0,0 +1,267 @@
+#include "audio_activation.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "audio_activation";
+
+#define ACTIVATION_TASK_STACK       4096
+#define ACTIVATION_STOP_TIMEOUT_MS  2000
+#define SEGMENT_PATH_MAX            128
+
+typedef struct {
+    audio_reader_t reader;
+    audio_wav_writer_t writer;
+    bool open;
+    uint32_t seen;              // detector onsets accounted for
+    uint64_t end;               // first sample left out, UINT64_MAX while activity goes on
+    char path[SEGMENT_PATH_MAX];
+} segment_t;
+
+static audio_activation_config_t s_config;
+static uint64_t s_preroll_samples = 0;
+static uint64_t s_hold_samples = 0;
+
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_stopped = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static atomic_bool s_running = false;
+static atomic_bool s_in_segment = false;
+static bool s_stop_pending = false;         // the task outlived a stop's timeout
+
+// Totals of closed segments; the task adds the open one when publishing
+static audio_activation_stats_t s_closed;
+static audio_activation_stats_t s_stats;
+
+static uint64_t segment_end(const audio_vad_state_t *vad)
+{
+    return vad->active ? UINT64_MAX : vad->release_sample + s_hold_samples;
+}
+
+static uint64_t segment_start(const audio_vad_state_t *vad)
+{
+    return vad->onset_sample > s_preroll_samples ? vad->onset_sample - s_preroll_samples : 0;
+}
+
+static void open_segment(segment_t *seg, const audio_vad_state_t *vad)
+{
+    audio_block_info_t start;
+    audio_recorder_reader_seek(&seg->reader, segment_start(vad), &start);
+    s_config.make_path(seg->path, sizeof(seg->path), &start, s_config.ctx);
+    if (audio_wav_open(&seg->writer, seg->path, &s_config.wav) != ESP_OK) {
+        // The onset stays unseen, so the next poll tries again while the
+        // ring still holds it
+        ESP_LOGE(TAG, "Cannot open segment %s", seg->path);
+        s_closed.failed++;
+        return;
+    }
+
+    seg->seen = vad->onsets;
+    seg->open = true;
+    seg->end = segment_end(vad);
+    atomic_store(&s_in_segment, true);
+    ESP_LOGI(TAG, "Segment %s opened %lu ms ahead of the onset", seg->path,
+             (unsigned long)((vad->onset_sample - start.first_sample) * 1000 / s_config.wav.sample_rate));
+}
+
+static void close_segment(segment_t *seg)
+{
+    esp_err_t ret = audio_wav_close(&seg->writer);
+    seg->open = false;
+    atomic_store(&s_in_segment, false);
+
+    const audio_wav_stats_t *ws = &seg->writer.stats;
+    s_closed.stored_samples += ws->samples;
+    s_closed.stored_bytes += ws->data_bytes + seg->writer.header_bytes;
+    if (ret == ESP_OK) {
+        s_closed.segments++;
+    } else {
+        s_closed.failed++;
+    }
+    ESP_LOGI(TAG, "Segment %s closed: %lu ms in %lu bytes, %lu samples lost", seg->path,
+             (unsigned long)((uint64_t)ws->samples * 1000 / s_config.wav.sample_rate),
+             (unsigned long)ws->data_bytes, (unsigned long)seg->reader.samples_lost);
+}
+
+static void publish_stats(const segment_t *seg, const audio_vad_state_t *vad, const audio_vad_state_t *base)
+{
+    audio_activation_stats_t stats = s_closed;
+    if (seg->open) {
+        stats.stored_samples += seg->writer.stats.samples;
+        stats.stored_bytes += seg->writer.stats.data_bytes + seg->writer.header_bytes;
+    }
+    stats.onsets = vad->onsets - base->onsets;
+    stats.samples = vad->samples - base->samples;
+    stats.active_samples = vad->active_samples - base->active_samples;
+
+    uint64_t continuous = stats.samples * audio_wav_byte_rate(&s_config.wav) / s_config.wav.sample_rate;
+    stats.saved_bytes = continuous > stats.stored_bytes ? continuous - stats.stored_bytes : 0;
+    stats.duty_permille = stats.samples ? (uint32_t)(stats.stored_samples * 1000 / stats.samples) : 0;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_stats = stats;
+    xSemaphoreGive(s_lock);
+}
+
+static void activation_task(void *pvParameters)
+{
+    static segment_t seg;
+    memset(&seg, 0, sizeof(seg));
+    audio_recorder_reader_init(&seg.reader);
+
+    audio_vad_state_t base, vad;
+    audio_recorder_get_vad(&base);
+    vad = base;
+    // Activity already going on opens a segment right away
+    seg.seen = base.active ? base.onsets - 1 : base.onsets;
+
+    while (atomic_load(&s_running)) {
+        if (audio_recorder_get_vad(&vad) == ESP_OK && vad.onsets != seg.seen) {
+            if (!seg.open) {
+                open_segment(&seg, &vad);
+            } else if (segment_start(&vad) <= seg.end) {
+                // Close enough to run on in this segment, without a gap
+                seg.seen = vad.onsets;
+                seg.end = segment_end(&vad);
+            }
+        } else if (seg.open && seg.end == UINT64_MAX && !vad.active) {
+            seg.end = segment_end(&vad);
+        }
+
+        if (seg.open) {
+            audio_wav_write_until(&seg.writer, &seg.reader, seg.end, NULL);
+            if (audio_recorder_reader_position(&seg.reader) >= seg.end) {
+                close_segment(&seg);
+                publish_stats(&seg, &vad, &base);
+                // A later onset may be waiting already
+                continue;
+            }
+        }
+        publish_stats(&seg, &vad, &base);
+        vTaskDelay(pdMS_TO_TICKS(s_config.poll_ms));
+    }
+
+    if (seg.open) {
+        audio_wav_write_from(&seg.writer, &seg.reader, NULL);
+        close_segment(&seg);
+    }
+    publish_stats(&seg, &vad, &base);
+    xSemaphoreGive(s_stopped);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t reap_task(void)
+{
+    if (xSemaphoreTake(s_stopped, pdMS_TO_TICKS(ACTIVATION_STOP_TIMEOUT_MS)) != pdTRUE) {
+        s_stop_pending = true;
+        return ESP_ERR_TIMEOUT;
+    }
+    s_stop_pending = false;
+    s_task = NULL;
+    return ESP_OK;
+}
+
+esp_err_t audio_activation_start(const audio_activation_config_t *config)
+{
+    if (!config || !config->make_path || config->wav.sample_rate == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (atomic_load(&s_running) || !audio_recorder_is_recording()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // The task's segment is static: a second one may not start while the
+    // last is still closing its file
+    if (s_stop_pending && reap_task() == ESP_ERR_TIMEOUT) {
+        ESP_LOGE(TAG, "Activation task of the last run still running");
+        return ESP_ERR_TIMEOUT;
+    }
+    audio_vad_state_t vad;
+    esp_err_t ret = audio_recorder_get_vad(&vad);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "The recorder's activity detector is off");
+        return ret;
+    }
+
+    s_config = *config;
+    if (s_config.preroll_ms == 0) {
+        s_config.preroll_ms = AUDIO_ACTIVATION_PREROLL_MS_DEFAULT;
+    }
+    if (s_config.hold_ms == 0) {
+        s_config.hold_ms = AUDIO_ACTIVATION_HOLD_MS_DEFAULT;
+    }
+    if (s_config.poll_ms == 0) {
+        s_config.poll_ms = AUDIO_ACTIVATION_POLL_MS_DEFAULT;
+    }
+    s_preroll_samples = (uint64_t)s_config.preroll_ms * s_config.wav.sample_rate / 1000;
+    s_hold_samples = (uint64_t)s_config.hold_ms * s_config.wav.sample_rate / 1000;
+
+    audio_recorder_stats_t recorder;
+    audio_recorder_get_stats(&recorder);
+    uint32_t held_ms = (uint32_t)((uint64_t)(recorder.ring_blocks - 1) * recorder.block_samples * 1000 /
+                                  s_config.wav.sample_rate);
+    if (s_config.preroll_ms + s_config.poll_ms > held_ms) {
+        ESP_LOGW(TAG, "The ring holds %lu ms, short of %lu ms preroll and a %lu ms poll; onsets will be clipped",
+                 (unsigned long)held_ms, (unsigned long)s_config.preroll_ms, (unsigned long)s_config.poll_ms);
+    }
+
+    if (!s_stopped) {
+        s_stopped = xSemaphoreCreateBinary();
+        s_lock = xSemaphoreCreateMutex();
+        if (!s_stopped || !s_lock) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    memset(&s_closed, 0, sizeof(s_closed));
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    atomic_store(&s_running, true);
+    BaseType_t created = xTaskCreatePinnedToCore(activation_task, "audio_activation", ACTIVATION_TASK_STACK, NULL,
+                                                 s_config.task_priority, &s_task, s_config.task_core);
+    if (created != pdPASS) {
+        atomic_store(&s_running, false);
+        ESP_LOGE(TAG, "Failed to create activation task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Sound-activated recording: %lu ms preroll, %lu ms hold",
+             (unsigned long)s_config.preroll_ms, (unsigned long)s_config.hold_ms);
+    return ESP_OK;
+}
+
+esp_err_t audio_activation_stop(void)
+{
+    if (!atomic_load(&s_running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Stopped either way; a task that outlives the timeout is reaped by the
+    // next start
+    atomic_store(&s_running, false);
+    esp_err_t ret = reap_task();
+    if (ret == ESP_ERR_TIMEOUT) {
+        ESP_LOGW(TAG, "Activation task did not stop in time");
+    }
+    return ret;
+}
+
+esp_err_t audio_activation_get_stats(audio_activation_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *stats = s_stats;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+bool audio_activation_in_segment(void)
+{
+    return atomic_load(&s_in_segment);
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "audio_recorder.h"
+
+// Microphone under audio_recorder: I2S PDM or standard mode on the
+// device, a generated signal in sim/ on linux builds. Reads give the raw
+// slots, 32 bits wide for a standard mode microphone so configured.
+
+esp_err_t audio_port_init(const audio_config_t *config);
+
+esp_err_t audio_port_enable(void);
+
+esp_err_t audio_port_disable(void);
+
+// Blocks until bytes are read or timeout_ms passes; bytes_read may be short
+esp_err_t audio_port_read(void *dest, size_t bytes, size_t *bytes_read, uint32_t timeout_ms);
+
+// DMA buffers the driver overwrote before they were read, since enable
+uint32_t audio_port_dma_overflows(void);
+
+void audio_port_deinit(void);
\ No newline at end of file
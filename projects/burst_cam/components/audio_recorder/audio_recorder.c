@@ -1,139 +1,798 @@
 #include "audio_recorder.h"
-#include "driver/i2s_pdm.h"
+#include "audio_port.h"
+#include "audio_vad.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include <stdatomic.h>
 #include <string.h>
 
 static const char *TAG = "audio_recorder";
 
-static i2s_chan_handle_t s_rx_handle = NULL;
+#define CAPTURE_TASK_STACK      3072
+#define CAPTURE_READ_TIMEOUT_MS 100
+#define CAPTURE_STOP_TIMEOUT_MS 500
+#define READY_BITS              8       // event bits the block sequence rotates through
+#define TIME_SMOOTHING          8       // a late read moves the block times 1/8 of the way
+
+typedef struct {
+    uint64_t first_sample;
+    int64_t time_us;
+} block_meta_t;
+
+// A ring slot holds one reference to its block and every lent block one
+// more; the last to let go of a block the ring has dropped makes it a spare
+typedef struct {
+    int16_t *samples;
+    atomic_uint refs;
+} block_t;
+
+static bool s_initialized = false;
 static bool s_is_recording = false;
 static audio_config_t s_config = {0};
 
+// The ring is written by the capture task only. A block is published by
+// advancing s_written, which keeps counting across recordings; readers
+// check it again after copying, since the task may have started
+// overwriting the block meanwhile. Slots point into a pool of ring_blocks
+// plus ref_blocks blocks, so a slot whose block is lent out can take a
+// spare instead.
+static int16_t *s_ring = NULL;
+static block_t *s_blocks = NULL;
+static block_t *_Atomic *s_slots = NULL;
+static block_t **s_spares = NULL;
+static uint32_t s_spare_count = 0;
+static SemaphoreHandle_t s_spare_lock = NULL;
+static block_meta_t *s_meta = NULL;
+static uint32_t s_ring_blocks = 0;
+static uint32_t s_pool_blocks = 0;
+static uint32_t s_block_samples = 0;
+static atomic_uint s_written;
+static uint32_t s_start_seq;            // s_written when this recording started
+
+// Standard I2S slots wider than a sample land here before they are cut down
+static int32_t *s_slot_buf = NULL;
+static uint8_t s_slot_shift = 0;
+
+static TaskHandle_t s_capture_task = NULL;
+static EventGroupHandle_t s_events = NULL;
+static SemaphoreHandle_t s_capture_stopped = NULL;
+static atomic_bool s_capturing = false;
+static bool s_stop_pending = false;    // a stop timed out and the task has not been seen to exit
+static audio_recorder_stats_t s_stats;
+static SemaphoreHandle_t s_stats_lock = NULL;
+static audio_reader_t s_default_reader;
+
+// The detector is the capture task's; what it concluded is copied out
+// under the lock after every block
+static audio_vad_t s_vad;
+static audio_vad_state_t s_vad_state;
+static SemaphoreHandle_t s_vad_lock = NULL;
+
+static void *alloc_psram(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+static void free_ring(void)
+{
+    heap_caps_free(s_ring);
+    heap_caps_free(s_blocks);
+    heap_caps_free(s_slots);
+    heap_caps_free(s_spares);
+    heap_caps_free(s_meta);
+    heap_caps_free(s_slot_buf);
+    s_ring = NULL;
+    s_blocks = NULL;
+    s_slots = NULL;
+    s_spares = NULL;
+    s_meta = NULL;
+    s_slot_buf = NULL;
+}
+
+static bool wide_slots(void)
+{
+    return s_config.mode == AUDIO_MIC_STD && s_config.std_slot_bits == 32;
+}
+
+// Hands out the blocks past the ring as spares, the others to the slots
+static void reset_pool(void)
+{
+    s_spare_count = 0;
+    for (uint32_t i = 0; i < s_pool_blocks; i++) {
+        s_blocks[i].samples = s_ring + (size_t)i * s_block_samples;
+        if (i < s_ring_blocks) {
+            atomic_store(&s_blocks[i].refs, 1);
+            atomic_store(&s_slots[i], &s_blocks[i]);
+        } else {
+            atomic_store(&s_blocks[i].refs, 0);
+            s_spares[s_spare_count++] = &s_blocks[i];
+        }
+    }
+}
+
 esp_err_t audio_recorder_init(const audio_config_t *config)
 {
-    if (!config) {
+    if (!config || config->sample_rate == 0 || config->buffer_count < 2 ||
+        config->buffer_len < (int)sizeof(int16_t)) {
         return ESP_ERR_INVALID_ARG;
     }
-    
+    if (config->mode == AUDIO_MIC_STD && ((config->std_slot_bits != 0 && config->std_slot_bits != 16 &&
+                                           config->std_slot_bits != 32) || config->std_gain_shift > 15)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
     memcpy(&s_config, config, sizeof(audio_config_t));
-    
-    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
-    chan_cfg.auto_clear = true;
-    
-    esp_err_t ret = i2s_new_channel(&chan_cfg, NULL, &s_rx_handle);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to create I2S channel: %s", esp_err_to_name(ret));
-        return ret;
+    if (s_config.ring_ms == 0) {
+        s_config.ring_ms = AUDIO_RING_MS_DEFAULT;
     }
-    
-    i2s_pdm_rx_config_t pdm_rx_cfg = {
-        .clk_cfg = I2S_PDM_RX_CLK_DEFAULT_CONFIG(config->sample_rate),
-        .slot_cfg = I2S_PDM_RX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
-        .gpio_cfg = {
-            .clk = config->pdm_clk_gpio,
-            .din = config->pdm_data_gpio,
-            .invert_flags = {
-                .clk_inv = false,
-            },
-        },
-    };
-    
-    ret = i2s_channel_init_pdm_rx_mode(s_rx_handle, &pdm_rx_cfg);
+    if (s_config.task_priority == 0) {
+        s_config.task_priority = AUDIO_TASK_PRIO_DEFAULT;
+    }
+    if (s_config.ref_blocks == 0) {
+        s_config.ref_blocks = AUDIO_REF_BLOCKS_DEFAULT;
+    }
+    if (s_config.mode == AUDIO_MIC_STD && s_config.std_slot_bits == 0) {
+        s_config.std_slot_bits = 32;
+    }
+    s_slot_shift = 16 - s_config.std_gain_shift;
+
+    s_block_samples = config->buffer_len / sizeof(int16_t);
+    uint64_t ring_samples = (uint64_t)s_config.sample_rate * s_config.ring_ms / 1000;
+    s_ring_blocks = (uint32_t)((ring_samples + s_block_samples - 1) / s_block_samples);
+    if (s_ring_blocks < 2) {
+        s_ring_blocks = 2;
+    }
+    s_pool_blocks = s_ring_blocks + s_config.ref_blocks;
+    size_t ring_bytes = (size_t)s_pool_blocks * s_block_samples * sizeof(int16_t);
+    s_ring = alloc_psram(ring_bytes);
+    s_blocks = heap_caps_malloc(s_pool_blocks * sizeof(block_t), MALLOC_CAP_8BIT);
+    s_slots = heap_caps_malloc(s_ring_blocks * sizeof(*s_slots), MALLOC_CAP_8BIT);
+    s_spares = heap_caps_malloc(s_pool_blocks * sizeof(*s_spares), MALLOC_CAP_8BIT);
+    s_meta = heap_caps_malloc(s_ring_blocks * sizeof(block_meta_t), MALLOC_CAP_8BIT);
+    if (wide_slots()) {
+        // Internal RAM, the driver copies out of DMA into it
+        s_slot_buf = heap_caps_malloc(s_block_samples * sizeof(int32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!s_events) {
+        s_events = xEventGroupCreate();
+        s_capture_stopped = xSemaphoreCreateBinary();
+        s_vad_lock = xSemaphoreCreateMutex();
+        s_spare_lock = xSemaphoreCreateMutex();
+        s_stats_lock = xSemaphoreCreateMutex();
+    }
+    if (!s_ring || !s_blocks || !s_slots || !s_spares || !s_meta || (wide_slots() && !s_slot_buf) ||
+        !s_events || !s_capture_stopped || !s_vad_lock || !s_spare_lock || !s_stats_lock) {
+        ESP_LOGE(TAG, "No memory for a %u KB capture ring", (unsigned)(ring_bytes / 1024));
+        free_ring();
+        return ESP_ERR_NO_MEM;
+    }
+
+    reset_pool();
+    s_stats.block_samples = s_block_samples;
+    s_stats.ring_blocks = s_ring_blocks;
+    s_stats.ref_blocks = s_config.ref_blocks;
+
+    esp_err_t ret = audio_port_init(&s_config);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize PDM RX mode: %s", esp_err_to_name(ret));
-        i2s_del_channel(s_rx_handle);
-        s_rx_handle = NULL;
+        free_ring();
         return ret;
     }
-    
-    ESP_LOGI(TAG, "Audio recorder initialized with sample rate: %lu Hz", config->sample_rate);
+
+    s_initialized = true;
+    ESP_LOGI(TAG, "Audio recorder initialized with %s microphone at %lu Hz, %lu ms ring "
+             "(%u KB, %lu blocks of %lu samples, %lu spares)",
+             s_config.mode == AUDIO_MIC_STD ? "I2S" : "PDM", (unsigned long)s_config.sample_rate,
+             (unsigned long)s_config.ring_ms, (unsigned)(ring_bytes / 1024), (unsigned long)s_ring_blocks,
+             (unsigned long)s_block_samples, (unsigned long)s_config.ref_blocks);
     return ESP_OK;
 }
 
+// Waits for the capture task to exit and turns the microphone off. After
+// a stop that timed out, the next start or deinit finishes it here.
+static esp_err_t reap_capture_task(void)
+{
+    if (xSemaphoreTake(s_capture_stopped, pdMS_TO_TICKS(CAPTURE_STOP_TIMEOUT_MS)) != pdTRUE) {
+        s_stop_pending = true;
+        return ESP_ERR_TIMEOUT;
+    }
+    s_stop_pending = false;
+    s_capture_task = NULL;
+    uint32_t overflows = audio_port_dma_overflows();
+    xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+    s_stats.dma_overflows = overflows;
+    xSemaphoreGive(s_stats_lock);
+
+    esp_err_t ret = audio_port_disable();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to disable I2S channel: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
 esp_err_t audio_recorder_deinit(void)
 {
     if (s_is_recording) {
         audio_recorder_stop_recording();
     }
-    
-    if (s_rx_handle) {
-        esp_err_t ret = i2s_del_channel(s_rx_handle);
-        s_rx_handle = NULL;
-        return ret;
+    if (!s_initialized) {
+        return ESP_OK;
+    }
+    // The ring cannot go while the capture task may still write to it
+    if (s_stop_pending && reap_capture_task() == ESP_ERR_TIMEOUT) {
+        ESP_LOGE(TAG, "Capture task still running, not deinitializing");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    audio_port_deinit();
+    free_ring();
+    s_initialized = false;
+    return ESP_OK;
+}
+
+// Keeps 16 bits of each slot below the headroom given up, saturating
+static void narrow_slots(const int32_t *in, int16_t *out, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        int32_t v = in[i] >> s_slot_shift;
+        out[i] = v > INT16_MAX ? INT16_MAX : v < INT16_MIN ? INT16_MIN : (int16_t)v;
+    }
+}
+
+// Fills one ring block, however many reads that takes; a short read only
+// means the timeout passed, the rest of the block follows in the next one
+static esp_err_t capture_block(int16_t *block)
+{
+    uint8_t *dest = wide_slots() ? (uint8_t *)s_slot_buf : (uint8_t *)block;
+    size_t filled = 0;
+    size_t wanted = s_block_samples * (wide_slots() ? sizeof(int32_t) : sizeof(int16_t));
+    while (filled < wanted) {
+        if (!atomic_load_explicit(&s_capturing, memory_order_relaxed)) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        size_t got = 0;
+        esp_err_t ret = audio_port_read(dest + filled, wanted - filled, &got, CAPTURE_READ_TIMEOUT_MS);
+        if (ret != ESP_OK && ret != ESP_ERR_TIMEOUT) {
+            xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+            s_stats.read_errors++;
+            xSemaphoreGive(s_stats_lock);
+            vTaskDelay(1);
+        }
+        filled += got;
+    }
+    if (wide_slots()) {
+        narrow_slots(s_slot_buf, block, s_block_samples);
     }
-    
     return ESP_OK;
 }
 
+static void put_ref(block_t *block)
+{
+    if (atomic_fetch_sub(&block->refs, 1) == 1) {
+        xSemaphoreTake(s_spare_lock, portMAX_DELAY);
+        s_spares[s_spare_count++] = block;
+        xSemaphoreGive(s_spare_lock);
+    }
+}
+
+// A reference only counts on a block still in the ring or still lent out;
+// one that went back to the spares has been lapped
+static bool get_ref(block_t *block)
+{
+    unsigned refs = atomic_load(&block->refs);
+    while (refs > 0) {
+        if (atomic_compare_exchange_weak(&block->refs, &refs, refs + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The block to fill for a slot: its own, unless it is lent out, in which
+// case a spare takes its place. With none left the task waits; the DMA
+// covers the wait up to its depth.
+static block_t *claim_slot(uint32_t slot)
+{
+    block_t *block = atomic_load(&s_slots[slot]);
+    if (atomic_load(&block->refs) == 1) {
+        return block;
+    }
+
+    block_t *spare = NULL;
+    bool waited = false;
+    while (!spare) {
+        xSemaphoreTake(s_spare_lock, portMAX_DELAY);
+        if (s_spare_count > 0) {
+            spare = s_spares[--s_spare_count];
+        }
+        xSemaphoreGive(s_spare_lock);
+        if (!spare) {
+            if (!atomic_load_explicit(&s_capturing, memory_order_relaxed)) {
+                return NULL;
+            }
+            if (!waited) {
+                xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+                s_stats.ref_waits++;
+                xSemaphoreGive(s_stats_lock);
+                waited = true;
+            }
+            vTaskDelay(1);
+        }
+    }
+    atomic_store(&spare->refs, 1);
+    atomic_store(&s_slots[slot], spare);
+    put_ref(block);
+    return spare;
+}
+
+static EventBits_t ready_bit(uint32_t seq)
+{
+    return (EventBits_t)1 << (seq % READY_BITS);
+}
+
+static void audio_capture_task(void *pvParameters)
+{
+    int64_t block_us = (int64_t)s_block_samples * 1000000 / s_config.sample_rate;
+    int64_t expected = 0;
+    uint64_t sample = 0;
+
+    while (atomic_load_explicit(&s_capturing, memory_order_relaxed)) {
+        uint32_t seq = atomic_load_explicit(&s_written, memory_order_relaxed);
+        uint32_t slot = seq % s_ring_blocks;
+        // s_written already says the slot's old block is gone, so a reader
+        // taking a reference to it after this backs off again
+        block_t *block = claim_slot(slot);
+        int64_t start = esp_timer_get_time();
+        if (!block || capture_block(block->samples) != ESP_OK) {
+            break;
+        }
+        int64_t now = esp_timer_get_time();
+
+        // The read returns some time after the block's last sample came in,
+        // never before; the block starts one block period earlier than that
+        int64_t measured = now - block_us;
+        int64_t time_us = measured;
+        if (sample > 0 && measured > expected) {
+            time_us = expected + (measured - expected) / TIME_SMOOTHING;
+        }
+        expected = time_us + block_us;
+
+        s_meta[slot].first_sample = sample;
+        s_meta[slot].time_us = time_us;
+        sample += s_block_samples;
+        xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+        if (now - start > s_stats.read_max_us) {
+            s_stats.read_max_us = (uint32_t)(now - start);
+        }
+        s_stats.blocks++;
+        s_stats.samples = sample;
+        xSemaphoreGive(s_stats_lock);
+
+        // A reader seeing the new s_written waits on the next block's bit,
+        // last set a rotation ago, so it is cleared first. This block's bit
+        // then stays set for a whole rotation: a reader that read s_written
+        // before the store and only now waits still finds it, unless it was
+        // held off READY_BITS blocks, and then it wakes on the next one.
+        xEventGroupClearBits(s_events, ready_bit(seq + 1));
+        atomic_store(&s_written, seq + 1);
+        xEventGroupSetBits(s_events, ready_bit(seq));
+
+        if (s_config.vad.enabled) {
+            int64_t vad_start = esp_timer_get_time();
+            audio_vad_process(&s_vad, block->samples, s_block_samples, s_meta[slot].first_sample);
+            int64_t vad_us = esp_timer_get_time() - vad_start;
+            xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+            s_stats.vad_us += vad_us;
+            xSemaphoreGive(s_stats_lock);
+            xSemaphoreTake(s_vad_lock, portMAX_DELAY);
+            s_vad_state = s_vad.state;
+            xSemaphoreGive(s_vad_lock);
+        }
+    }
+
+    xSemaphoreGive(s_capture_stopped);
+    vTaskDelete(NULL);
+}
+
 esp_err_t audio_recorder_start_recording(void)
 {
-    if (!s_rx_handle) {
+    if (!s_initialized) {
         return ESP_ERR_INVALID_STATE;
     }
-    
+
     if (s_is_recording) {
         return ESP_OK;
     }
-    
-    esp_err_t ret = i2s_channel_enable(s_rx_handle);
-    if (ret == ESP_OK) {
-        s_is_recording = true;
-        ESP_LOGI(TAG, "Audio recording started");
-    } else {
+    if (s_stop_pending && reap_capture_task() == ESP_ERR_TIMEOUT) {
+        ESP_LOGE(TAG, "Capture task of the last recording still running");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.block_samples = s_block_samples;
+    s_stats.ring_blocks = s_ring_blocks;
+    s_stats.ref_blocks = s_config.ref_blocks;
+    xSemaphoreGive(s_stats_lock);
+    s_start_seq = atomic_load(&s_written);
+    audio_recorder_reader_init(&s_default_reader);
+    if (s_config.vad.enabled) {
+        audio_vad_init(&s_vad, &s_config.vad, s_config.sample_rate, s_block_samples);
+        s_vad_state = s_vad.state;
+    }
+
+    esp_err_t ret = audio_port_enable();
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to enable I2S channel: %s", esp_err_to_name(ret));
+        return ret;
     }
-    
-    return ret;
+
+    atomic_store(&s_capturing, true);
+    BaseType_t created = xTaskCreatePinnedToCore(audio_capture_task, "audio_capture", CAPTURE_TASK_STACK, NULL,
+                                                 s_config.task_priority, &s_capture_task, s_config.task_core);
+    if (created != pdPASS) {
+        atomic_store(&s_capturing, false);
+        audio_port_disable();
+        ESP_LOGE(TAG, "Failed to create capture task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_is_recording = true;
+    ESP_LOGI(TAG, "Audio recording started");
+    return ESP_OK;
 }
 
 esp_err_t audio_recorder_stop_recording(void)
 {
-    if (!s_rx_handle) {
+    if (!s_initialized) {
         return ESP_ERR_INVALID_STATE;
     }
-    
+
     if (!s_is_recording) {
         return ESP_OK;
     }
-    
-    esp_err_t ret = i2s_channel_disable(s_rx_handle);
-    if (ret == ESP_OK) {
-        s_is_recording = false;
-        ESP_LOGI(TAG, "Audio recording stopped");
-    } else {
-        ESP_LOGE(TAG, "Failed to disable I2S channel: %s", esp_err_to_name(ret));
+
+    // The recording is over either way; a task that outlives the timeout
+    // is reaped by the next start or deinit
+    atomic_store(&s_capturing, false);
+    s_is_recording = false;
+    esp_err_t ret = reap_capture_task();
+    if (ret == ESP_ERR_TIMEOUT) {
+        ESP_LOGE(TAG, "Capture task did not stop in time");
+        return ret;
     }
-    
+
+    audio_recorder_stats_t stats;
+    audio_recorder_get_stats(&stats);
+    ESP_LOGI(TAG, "Audio recording stopped: %llu samples, %lu DMA overflows",
+             (unsigned long long)stats.samples, (unsigned long)stats.dma_overflows);
     return ret;
 }
 
+esp_err_t audio_recorder_reader_init(audio_reader_t *reader)
+{
+    if (!reader) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(reader, 0, sizeof(*reader));
+    reader->next_block = atomic_load_explicit(&s_written, memory_order_acquire);
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_reader_seek(audio_reader_t *reader, uint64_t sample, audio_block_info_t *info)
+{
+    if (!reader) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_ring) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Blocks of this recording: captured, and the oldest still held
+    uint32_t written = atomic_load_explicit(&s_written, memory_order_acquire);
+    uint32_t captured = written - s_start_seq;
+    uint32_t oldest = captured > s_ring_blocks - 1 ? captured - (s_ring_blocks - 1) : 0;
+
+    uint64_t block = sample / s_block_samples;
+    uint32_t offset = sample % s_block_samples;
+    if (block < oldest) {
+        block = oldest;
+        offset = 0;
+    } else if (block >= captured) {
+        block = captured;
+        offset = 0;
+    }
+    reader->next_block = s_start_seq + (uint32_t)block;
+    reader->offset = offset;
+
+    if (info) {
+        // Timed from the newest block, which stays put for a ring length
+        uint64_t landed = block * s_block_samples + offset;
+        info->first_sample = landed;
+        if (captured > 0) {
+            const block_meta_t *newest = &s_meta[(written - 1) % s_ring_blocks];
+            info->time_us = newest->time_us -
+                            ((int64_t)newest->first_sample - (int64_t)landed) * 1000000 / s_config.sample_rate;
+        } else {
+            info->time_us = esp_timer_get_time();
+        }
+    }
+    return ESP_OK;
+}
+
+uint64_t audio_recorder_reader_position(const audio_reader_t *reader)
+{
+    if (!reader) {
+        return 0;
+    }
+    return (uint64_t)(reader->next_block - s_start_seq) * s_block_samples + reader->offset;
+}
+
+uint64_t audio_recorder_sample_at(int64_t time_us)
+{
+    if (!s_ring) {
+        return 0;
+    }
+    uint32_t written = atomic_load_explicit(&s_written, memory_order_acquire);
+    if (written == s_start_seq) {
+        return 0;
+    }
+    const block_meta_t *newest = &s_meta[(written - 1) % s_ring_blocks];
+    int64_t offset = (time_us - newest->time_us) * s_config.sample_rate / 1000000;
+    if (offset < 0 && (uint64_t)-offset > newest->first_sample) {
+        return 0;
+    }
+    return newest->first_sample + offset;
+}
+
+// The block being written shares its slot with the one a ring length back,
+// so a reader may hold ring_blocks - 1 blocks at most
+static uint32_t held_blocks(const audio_reader_t *reader, uint32_t written)
+{
+    return written - reader->next_block;
+}
+
+static void skip_overrun(audio_reader_t *reader, uint32_t written)
+{
+    uint32_t oldest = written - (s_ring_blocks - 1);
+    reader->samples_lost += (uint64_t)(oldest - reader->next_block) * s_block_samples - reader->offset;
+    reader->next_block = oldest;
+    reader->offset = 0;
+    reader->overruns++;
+}
+
+// s_written once the reader has a block to take or timeout_ms passed
+static uint32_t wait_for_block(const audio_reader_t *reader, uint32_t timeout_ms)
+{
+    uint32_t written = atomic_load_explicit(&s_written, memory_order_acquire);
+    if (held_blocks(reader, written) == 0 && timeout_ms > 0) {
+        TickType_t wait = timeout_ms == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+        xEventGroupWaitBits(s_events, ready_bit(written), pdFALSE, pdFALSE, wait);
+        written = atomic_load_explicit(&s_written, memory_order_acquire);
+    }
+    return written;
+}
+
+size_t audio_recorder_reader_available(const audio_reader_t *reader)
+{
+    if (!reader || !s_ring) {
+        return 0;
+    }
+    uint32_t written = atomic_load_explicit(&s_written, memory_order_acquire);
+    uint32_t held = held_blocks(reader, written);
+    if (held > s_ring_blocks - 1) {
+        // Lapped; the next read starts at the oldest block
+        return (size_t)(s_ring_blocks - 1) * s_block_samples;
+    }
+    return held ? (size_t)held * s_block_samples - reader->offset : 0;
+}
+
+esp_err_t audio_recorder_reader_read(audio_reader_t *reader, int16_t *samples, size_t max_samples,
+                                     size_t *count, audio_block_info_t *info, uint32_t timeout_ms)
+{
+    if (!reader || !samples || !count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *count = 0;
+    if (!s_ring) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t written = wait_for_block(reader, timeout_ms);
+    if (held_blocks(reader, written) == 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    bool first = true;
+    while (*count < max_samples) {
+        if (held_blocks(reader, written) > s_ring_blocks - 1) {
+            skip_overrun(reader, written);
+            first = true;
+            *count = 0;
+        }
+        if (held_blocks(reader, written) == 0) {
+            break;
+        }
+
+        uint32_t slot = reader->next_block % s_ring_blocks;
+        size_t take = s_block_samples - reader->offset;
+        if (take > max_samples - *count) {
+            take = max_samples - *count;
+        }
+        if (first && info) {
+            info->first_sample = s_meta[slot].first_sample + reader->offset;
+            info->time_us = s_meta[slot].time_us +
+                            (int64_t)reader->offset * 1000000 / s_config.sample_rate;
+        }
+        memcpy(samples + *count, atomic_load(&s_slots[slot])->samples + reader->offset, take * sizeof(int16_t));
+
+        // Lapped while copying: what was copied may be torn
+        written = atomic_load_explicit(&s_written, memory_order_acquire);
+        if (held_blocks(reader, written) > s_ring_blocks - 1) {
+            continue;
+        }
+
+        first = false;
+        *count += take;
+        reader->offset += take;
+        if (reader->offset == s_block_samples) {
+            reader->offset = 0;
+            reader->next_block++;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_reader_acquire(audio_reader_t *reader, audio_block_ref_t *ref, size_t max_samples,
+                                        uint32_t timeout_ms)
+{
+    if (!reader || !ref) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(ref, 0, sizeof(*ref));
+    if (!s_ring) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (max_samples == 0) {
+        return ESP_OK;
+    }
+
+    uint32_t written = wait_for_block(reader, timeout_ms);
+    if (held_blocks(reader, written) == 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    block_t *block;
+    block_meta_t meta;
+    while (1) {
+        if (held_blocks(reader, written) > s_ring_blocks - 1) {
+            skip_overrun(reader, written);
+        }
+        uint32_t slot = reader->next_block % s_ring_blocks;
+        block = atomic_load(&s_slots[slot]);
+        if (get_ref(block)) {
+            meta = s_meta[slot];
+            // Pairs with the capture task's store of s_written before it
+            // looks at the slot's references
+            written = atomic_load(&s_written);
+            if (held_blocks(reader, written) <= s_ring_blocks - 1) {
+                break;
+            }
+            put_ref(block);
+        } else {
+            written = atomic_load(&s_written);
+        }
+    }
+
+    size_t take = s_block_samples - reader->offset;
+    if (take > max_samples) {
+        take = max_samples;
+    }
+    ref->samples = block->samples + reader->offset;
+    ref->count = take;
+    ref->info.first_sample = meta.first_sample + reader->offset;
+    ref->info.time_us = meta.time_us + (int64_t)reader->offset * 1000000 / s_config.sample_rate;
+    ref->block = block;
+
+    reader->offset += take;
+    if (reader->offset == s_block_samples) {
+        reader->offset = 0;
+        reader->next_block++;
+    }
+    return ESP_OK;
+}
+
+void audio_recorder_block_release(audio_block_ref_t *ref)
+{
+    if (ref && ref->block) {
+        put_ref(ref->block);
+        ref->block = NULL;
+        ref->samples = NULL;
+        ref->count = 0;
+    }
+}
+
+uint32_t audio_recorder_sample_rate(void)
+{
+    return s_initialized ? s_config.sample_rate : 0;
+}
+
 esp_err_t audio_recorder_read_samples(int16_t *buffer, size_t buffer_size, size_t *bytes_read)
 {
-    if (!s_rx_handle || !buffer || !bytes_read) {
+    if (!s_initialized || !buffer || !bytes_read) {
         return ESP_ERR_INVALID_ARG;
     }
-    
+
     if (!s_is_recording) {
         return ESP_ERR_INVALID_STATE;
     }
-    
-    esp_err_t ret = i2s_channel_read(s_rx_handle, buffer, buffer_size, bytes_read, portMAX_DELAY);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to read I2S data: %s", esp_err_to_name(ret));
+
+    size_t wanted = buffer_size / sizeof(int16_t);
+    size_t got = 0;
+    while (got < wanted && s_is_recording) {
+        size_t count = 0;
+        esp_err_t ret = audio_recorder_reader_read(&s_default_reader, buffer + got, wanted - got, &count,
+                                                   NULL, CAPTURE_READ_TIMEOUT_MS);
+        if (ret != ESP_OK && ret != ESP_ERR_TIMEOUT) {
+            ESP_LOGE(TAG, "Failed to read audio: %s", esp_err_to_name(ret));
+            *bytes_read = got * sizeof(int16_t);
+            return ret;
+        }
+        got += count;
     }
-    
-    return ret;
+    *bytes_read = got * sizeof(int16_t);
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_get_stats(audio_recorder_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_stats_lock, portMAX_DELAY);
+    *stats = s_stats;
+    xSemaphoreGive(s_stats_lock);
+    if (s_is_recording) {
+        stats->dma_overflows = audio_port_dma_overflows();
+    }
+    return ESP_OK;
 }
 
-esp_err_t audio_recorder_create_wav_header(wav_header_t *header, uint32_t sample_rate, 
+esp_err_t audio_recorder_get_vad(audio_vad_state_t *state)
+{
+    if (!state) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!s_config.vad.enabled) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    xSemaphoreTake(s_vad_lock, portMAX_DELAY);
+    *state = s_vad_state;
+    xSemaphoreGive(s_vad_lock);
+    return ESP_OK;
+}
+
+esp_err_t audio_recorder_create_wav_header(wav_header_t *header, uint32_t sample_rate,
                                           uint16_t channels, uint32_t data_size)
 {
     if (!header) {
         return ESP_ERR_INVALID_ARG;
     }
-    
+
     memcpy(header->riff, "RIFF", 4);
     header->file_size = data_size + sizeof(wav_header_t) - 8;
     memcpy(header->wave, "WAVE", 4);
@@ -147,7 +806,7 @@ esp_err_t audio_recorder_create_wav_header(wav_header_t *header, uint32_t sample
     header->block_align = channels * (header->bits_per_sample / 8);
     memcpy(header->data, "data", 4);
     header->data_size = data_size;
-    
+
     return ESP_OK;
 }
 
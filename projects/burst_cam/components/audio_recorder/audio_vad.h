@@ -0,0 +1,22 @@
+#pragma once
+
+#include "audio_recorder.h"
+
+// Activity detector under audio_recorder; the capture task owns one and
+// feeds it every block as it lands in the ring
+
+typedef struct {
+    audio_vad_config_t config;
+    uint32_t hangover_blocks;
+    uint32_t hang;              // quiet blocks still counted as active
+    float rise_db;              // floor creep per block
+    int32_t dc;                 // mean of the last block
+    bool primed;
+    audio_vad_state_t state;
+} audio_vad_t;
+
+void audio_vad_init(audio_vad_t *vad, const audio_vad_config_t *config, uint32_t sample_rate,
+                    uint32_t block_samples);
+
+// Judges one block whose first sample is first_sample
+void audio_vad_process(audio_vad_t *vad, const int16_t *block, uint32_t count, uint64_t first_sample);
\ No newline at end of file
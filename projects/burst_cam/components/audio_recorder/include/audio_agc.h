@@ -0,0 +1,87 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Automatic gain control with a look-ahead peak limiter, in fixed point,
+// for audio on its way into a file. Samples go through a delay line of
+// lookahead_ms in frames of AUDIO_AGC_FRAME. The gain steers the RMS of
+// each frame towards target_dbfs, cutting at the attack rate and
+// boosting at the release rate, within max_gain_db either way; frames
+// under gate_dbfs hold it, so pauses and hiss are not pulled up. The
+// limiter sees every peak a delay line ahead and ramps the gain down
+// before it arrives, so nothing leaves above ceiling_dbfs. Output is the
+// input delayed; draining at the end gives back the samples held, so
+// the count out matches the count in.
+#define AUDIO_AGC_FRAME                 64
+#define AUDIO_AGC_TARGET_DBFS_DEFAULT   (-18)
+#define AUDIO_AGC_MAX_GAIN_DB_DEFAULT   30
+#define AUDIO_AGC_MAX_GAIN_DB_LIMIT     42
+#define AUDIO_AGC_ATTACK_MS_DEFAULT     50
+#define AUDIO_AGC_RELEASE_MS_DEFAULT    2000
+#define AUDIO_AGC_LOOKAHEAD_MS_DEFAULT  5
+#define AUDIO_AGC_CEILING_DBFS_DEFAULT  (-1)
+#define AUDIO_AGC_GATE_DBFS_DEFAULT     (-65)
+#define AUDIO_AGC_LIMIT_RELEASE_MS      60      // limiter recovery per 6 dB
+
+typedef struct {
+    bool enabled;
+    int8_t target_dbfs;         // 0 = AUDIO_AGC_TARGET_DBFS_DEFAULT
+    uint8_t max_gain_db;        // 0 = AUDIO_AGC_MAX_GAIN_DB_DEFAULT, up to AUDIO_AGC_MAX_GAIN_DB_LIMIT
+    uint16_t attack_ms;         // time constant of a cut, 0 = AUDIO_AGC_ATTACK_MS_DEFAULT
+    uint16_t release_ms;        // time constant of a boost, 0 = AUDIO_AGC_RELEASE_MS_DEFAULT
+    uint8_t lookahead_ms;       // 0 = AUDIO_AGC_LOOKAHEAD_MS_DEFAULT, at least a frame
+    int8_t ceiling_dbfs;        // 0 = AUDIO_AGC_CEILING_DBFS_DEFAULT
+    int8_t gate_dbfs;           // 0 = AUDIO_AGC_GATE_DBFS_DEFAULT
+} audio_agc_config_t;
+
+// Levels and gains are log2 of amplitude in Q16, full scale 0
+typedef struct {
+    int32_t target;
+    int32_t max_gain;
+    int32_t ceiling;
+    int32_t gate;
+    int32_t attack;             // share of the gap closed per frame, Q16
+    int32_t release;
+    int32_t limit_rise;         // most the limited gain recovers per frame
+    uint32_t lookahead_frames;
+    uint32_t slots;             // frames the delay line holds
+    int16_t *delay;
+    int32_t *allow;             // per frame held: the most gain its peak takes
+    uint32_t oldest;
+    uint32_t held;              // whole frames in the delay line
+    uint32_t fill;              // samples of the frame being gathered
+    uint32_t last_real;         // samples of the padded last frame that are audio
+    int32_t agc;                // smoothed gain towards the target
+    int32_t gain;               // gain at the end of the last frame out
+    uint32_t gain_q16;          // the same, linear
+    // Since init
+    uint32_t frames;
+    uint32_t limited;           // frames the limiter held under the AGC gain
+    int32_t gain_min;
+    int32_t gain_max;
+} audio_agc_t;
+
+esp_err_t audio_agc_init(audio_agc_t *agc, const audio_agc_config_t *config, uint32_t sample_rate);
+
+void audio_agc_deinit(audio_agc_t *agc);
+
+// Takes count samples and writes the ones leaving the delay line to out,
+// which needs room for count + AUDIO_AGC_FRAME; returns how many
+size_t audio_agc_process(audio_agc_t *agc, const int16_t *in, size_t count, int16_t *out);
+
+// Gives back up to a frame still held, into out of AUDIO_AGC_FRAME; 0
+// once empty
+size_t audio_agc_drain(audio_agc_t *agc, int16_t *out);
+
+float audio_agc_db(int32_t log2_q16);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -9,12 +9,66 @@
 extern "C" {
 #endif
 
+// While recording, a capture task pinned to one core drains the I2S DMA a
+// block at a time straight into a ring in PSRAM, so no sample is lost to a
+// busy caller. Each block is stamped with the index of its first sample and
+// the esp_timer time it was taken. Readers keep their own position and copy
+// out at their own pace; one the task laps skips ahead to the oldest block
+// still held and counts the overrun.
+//
+// Consumers that only look at the samples take blocks by reference
+// instead: the block stays in place while any reference is out, and the
+// capture task fills one of ref_blocks spares in its stead when it comes
+// round to it. A PDM microphone and a standard I2S one such as the
+// INMP441 both end up as 16-bit mono in the ring; wide slots are cut down
+// once, on capture.
+#define AUDIO_RING_MS_DEFAULT       2000
+#define AUDIO_TASK_PRIO_DEFAULT     10
+#define AUDIO_REF_BLOCKS_DEFAULT    4
+
+// Activity detector, run by the capture task on every block when enabled.
+// A block's level is its energy, DC removed, against a noise floor that
+// follows quiet blocks down quickly and creeps up, so a steady noise stops
+// counting after a while. Activity starts on a block on_db over the floor,
+// or off_db over it crossing zero as often as a fricative does; it goes on
+// while blocks stay off_db over and ends hangover_ms after the last one.
+#define AUDIO_VAD_ON_DB_DEFAULT         12
+#define AUDIO_VAD_OFF_DB_DEFAULT        6
+#define AUDIO_VAD_ZCR_DEFAULT           300
+#define AUDIO_VAD_HANGOVER_MS_DEFAULT   300
+#define AUDIO_VAD_MIN_DBFS_DEFAULT      (-70)
+
 typedef struct {
+    bool enabled;
+    uint8_t on_db;              // 0 = AUDIO_VAD_ON_DB_DEFAULT
+    uint8_t off_db;             // 0 = AUDIO_VAD_OFF_DB_DEFAULT, below on_db
+    uint16_t zcr_per_mille;     // crossings per 1000 samples, 0 = AUDIO_VAD_ZCR_DEFAULT
+    uint32_t hangover_ms;       // 0 = AUDIO_VAD_HANGOVER_MS_DEFAULT
+    int8_t min_dbfs;            // quieter blocks never count, 0 = AUDIO_VAD_MIN_DBFS_DEFAULT
+} audio_vad_config_t;
+
+typedef enum {
+    AUDIO_MIC_PDM = 0,
+    AUDIO_MIC_STD,              // Philips I2S, left slot
+} audio_mic_mode_t;
+
+typedef struct {
+    audio_mic_mode_t mode;
     int pdm_clk_gpio;
     int pdm_data_gpio;
+    int std_bclk_gpio;
+    int std_ws_gpio;
+    int std_din_gpio;
+    uint8_t std_slot_bits;      // 16 or 32, 0 = 32
+    uint8_t std_gain_shift;     // 32-bit slots: bits of headroom given up for gain, 0 = the top 16 bits
     uint32_t sample_rate;
-    int buffer_count;
-    int buffer_len;
+    int buffer_count;           // DMA buffers
+    int buffer_len;             // bytes per DMA buffer, also the ring's block size
+    uint32_t ring_ms;           // audio the ring holds, 0 = AUDIO_RING_MS_DEFAULT
+    int task_core;
+    int task_priority;          // 0 = AUDIO_TASK_PRIO_DEFAULT
+    uint32_t ref_blocks;        // spares for blocks referenced as the task comes round, 0 = AUDIO_REF_BLOCKS_DEFAULT
+    audio_vad_config_t vad;
 } audio_config_t;
 
 typedef struct {
@@ -33,17 +87,106 @@ typedef struct {
     uint32_t data_size;
 } __attribute__((packed)) wav_header_t;
 
+// Where a run of samples sits in the recording
+typedef struct {
+    uint64_t first_sample;      // index since recording started
+    int64_t time_us;            // esp_timer time of that sample
+} audio_block_info_t;
+
+// Samples of a ring block lent out by audio_recorder_reader_acquire()
+typedef struct {
+    const int16_t *samples;
+    size_t count;
+    audio_block_info_t info;    // places samples[0]
+    void *block;                // the recorder's, for the release
+} audio_block_ref_t;
+
+typedef struct {
+    uint32_t next_block;        // sequence of the block read next
+    uint32_t offset;            // samples of it already read
+    uint32_t overruns;          // times the capture task lapped this reader
+    uint64_t samples_lost;
+} audio_reader_t;
+
+typedef struct {
+    uint32_t blocks;
+    uint64_t samples;
+    uint32_t dma_overflows;     // the task fell behind the DMA, samples are gone
+    uint32_t read_errors;
+    uint32_t block_samples;
+    uint32_t ring_blocks;
+    uint32_t ref_blocks;        // spares; a consumer holding this many at once can stall the task
+    uint32_t read_max_us;       // longest wait for a block, near a block period when healthy
+    uint64_t vad_us;            // spent in the activity detector
+    uint32_t ref_waits;         // the task found every spare taken and waited for a release
+} audio_recorder_stats_t;
+
+typedef struct {
+    bool active;
+    uint32_t onsets;            // activity periods begun this recording
+    uint64_t onset_sample;      // first sample of the latest
+    uint64_t release_sample;    // first sample after it, once it has ended
+    uint64_t samples;           // judged so far
+    uint64_t active_samples;
+    float level_db;             // last block, dBFS
+    float floor_db;
+} audio_vad_state_t;
+
 esp_err_t audio_recorder_init(const audio_config_t *config);
 
 esp_err_t audio_recorder_deinit(void);
 
 esp_err_t audio_recorder_start_recording(void);
 
+// Ends the recording. ESP_ERR_TIMEOUT means the capture task has not
+// exited yet; the next start or deinit waits for it again.
 esp_err_t audio_recorder_stop_recording(void);
 
+// Fills the buffer from the recorder's own reader, waiting as long as it
+// takes; for a single consumer
 esp_err_t audio_recorder_read_samples(int16_t *buffer, size_t buffer_size, size_t *bytes_read);
 
-esp_err_t audio_recorder_create_wav_header(wav_header_t *header, uint32_t sample_rate, 
+// Starts a reader at the newest sample
+esp_err_t audio_recorder_reader_init(audio_reader_t *reader);
+
+// Moves the reader to a sample of this recording, within what the ring
+// still holds; info, when given, places where it landed
+esp_err_t audio_recorder_reader_seek(audio_reader_t *reader, uint64_t sample, audio_block_info_t *info);
+
+// Index of the sample the reader takes next
+uint64_t audio_recorder_reader_position(const audio_reader_t *reader);
+
+// Index of the sample taken at an esp_timer time of this recording, from
+// the newest block's stamp; later times are extrapolated
+uint64_t audio_recorder_sample_at(int64_t time_us);
+
+// Samples the reader can take without waiting
+size_t audio_recorder_reader_available(const audio_reader_t *reader);
+
+// Copies up to max_samples, waiting up to timeout_ms for the first block.
+// info, when given, places the first sample copied; after an overrun it
+// is further on than where the last read ended.
+esp_err_t audio_recorder_reader_read(audio_reader_t *reader, int16_t *samples, size_t max_samples,
+                                     size_t *count, audio_block_info_t *info, uint32_t timeout_ms);
+
+// Lends up to max_samples of the reader's current block without copying,
+// waiting up to timeout_ms for it, and moves the reader past them. Release
+// the reference when done; while a reader holds more than the spares
+// cover, the capture task waits for it.
+esp_err_t audio_recorder_reader_acquire(audio_reader_t *reader, audio_block_ref_t *ref, size_t max_samples,
+                                        uint32_t timeout_ms);
+
+void audio_recorder_block_release(audio_block_ref_t *ref);
+
+// 0 before init
+uint32_t audio_recorder_sample_rate(void);
+
+esp_err_t audio_recorder_get_stats(audio_recorder_stats_t *stats);
+
+// ESP_ERR_NOT_SUPPORTED unless the detector is enabled
+esp_err_t audio_recorder_get_vad(audio_vad_state_t *state);
+
+esp_err_t audio_recorder_create_wav_header(wav_header_t *header, uint32_t sample_rate,
                                           uint16_t channels, uint32_t data_size);
 
 bool audio_recorder_is_recording(void);
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "audio_wav.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Continuous recording into a run of WAV segments, on top of a running
+// recorder. A task of its own moves the ring into the open segment and
+// rotates to the next file at a sample boundary: after segment_ms of
+// audio, before the file would pass max_bytes, or where a mark says a clip
+// starts. One reader and one writer carry on across the seam, so no sample
+// is lost or repeated between segments and the encoder and gain control
+// never restart. Each finished segment is handed to on_closed with its
+// first sample and the time it was taken.
+#define AUDIO_SEGMENTS_POLL_MS_DEFAULT  100
+#define AUDIO_SEGMENTS_MARKS            8       // marks waiting for the task
+#define AUDIO_SEGMENT_PATH_MAX          128
+#define AUDIO_SEGMENT_NO_CLIP           UINT32_MAX
+
+typedef enum {
+    AUDIO_SEGMENT_STARTED = 0,  // first segment of the run
+    AUDIO_SEGMENT_DURATION,
+    AUDIO_SEGMENT_SIZE,
+    AUDIO_SEGMENT_MARK,
+    AUDIO_SEGMENT_REOPENED,     // after a file could not be opened
+} audio_segment_cause_t;
+
+typedef struct {
+    char path[AUDIO_SEGMENT_PATH_MAX];
+    uint32_t index;             // segments since start
+    uint32_t clip;              // mark it starts at, or the last one before it; AUDIO_SEGMENT_NO_CLIP before any
+    audio_segment_cause_t cause;
+    audio_block_info_t start;   // first sample and its esp_timer time
+    uint32_t samples;           // set at close
+    uint32_t file_bytes;
+    bool ok;                    // written and closed without an error
+} audio_segment_t;
+
+// Names a segment from its index, clip and start; runs on the segment task
+typedef void (*audio_segments_path_fn)(char *path, size_t size, const audio_segment_t *segment, void *ctx);
+
+// Gets each segment once it is closed; runs on the segment task
+typedef void (*audio_segments_closed_fn)(const audio_segment_t *segment, void *ctx);
+
+typedef struct {
+    uint32_t segment_ms;        // rotate after this much audio, 0 = no limit
+    uint32_t max_bytes;         // rotate before a file grows past this, 0 = no limit
+    uint32_t poll_ms;           // 0 = AUDIO_SEGMENTS_POLL_MS_DEFAULT
+    audio_wav_config_t wav;
+    audio_segments_path_fn make_path;
+    audio_segments_closed_fn on_closed;
+    void *ctx;
+    int task_core;
+    int task_priority;
+} audio_segments_config_t;
+
+typedef struct {
+    uint32_t segments;          // closed
+    uint32_t failed;            // segments not opened or not finished cleanly
+    uint32_t marks;             // taken by the task
+    uint32_t late_marks;        // came after the task had written past them; rotated where it was
+    uint32_t dropped_marks;     // found the queue full
+    uint64_t samples;           // written to segments
+    uint64_t samples_lost;      // lapped by the capture task before they were written
+} audio_segments_stats_t;
+
+// Starts segments at the newest sample. ESP_ERR_TIMEOUT if the task of the
+// last run is still closing its file
+esp_err_t audio_segments_start(const audio_segments_config_t *config);
+
+// Closes the open segment with what has arrived. On ESP_ERR_TIMEOUT the
+// segments are stopped but the task is still finishing; the next start
+// waits for it
+esp_err_t audio_segments_stop(void);
+
+// Starts a new segment at the sample taken at time_us (esp_timer) for clip
+esp_err_t audio_segments_mark(uint32_t clip, int64_t time_us);
+
+esp_err_t audio_segments_get_stats(audio_segments_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "audio_port.h"
+#include "audio_port_sim.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "audio_port_sim";
+
+static audio_port_sim_config_t s_sim_config = {
+    .signal = AUDIO_PORT_SIM_RAMP,
+    .tone_hz = 440.0f,
+    .amplitude = 8000,
+    .path = NULL
+};
+
+static uint32_t s_sample_rate = 16000;
+static uint32_t s_dma_samples = 0;      // what the DMA buffers hold
+static bool s_wide = false;             // 32-bit slots, the sample in the top half
+static bool s_initialized = false;
+static bool s_enabled = false;
+static int64_t s_enabled_at = 0;
+static uint64_t s_consumed = 0;         // samples due since enable that were read or lost
+static uint64_t s_signal_base = 0;      // the signal picks up where the last enable left it
+static uint32_t s_overflows = 0;
+static int16_t *s_file = NULL;
+static size_t s_file_samples = 0;
+
+esp_err_t audio_port_sim_configure(const audio_port_sim_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_sim_config = *config;
+    return ESP_OK;
+}
+
+static esp_err_t load_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        ESP_LOGE(TAG, "Cannot open %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    s_file_samples = size > 0 ? (size_t)size / sizeof(int16_t) : 0;
+    s_file = s_file_samples ? malloc(s_file_samples * sizeof(int16_t)) : NULL;
+    if (!s_file || fread(s_file, sizeof(int16_t), s_file_samples, f) != s_file_samples) {
+        fclose(f);
+        free(s_file);
+        s_file = NULL;
+        return ESP_FAIL;
+    }
+    fclose(f);
+    return ESP_OK;
+}
+
+esp_err_t audio_port_init(const audio_config_t *config)
+{
+    s_sample_rate = config->sample_rate;
+    s_dma_samples = config->buffer_count * config->buffer_len / sizeof(int16_t);
+    s_wide = config->mode == AUDIO_MIC_STD && config->std_slot_bits != 16;
+    s_signal_base = 0;
+    if (s_sim_config.signal == AUDIO_PORT_SIM_FILE) {
+        esp_err_t ret = load_file(s_sim_config.path);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    s_initialized = true;
+    ESP_LOGI(TAG, "Simulated microphone, %lu Hz, %lu samples of DMA",
+             (unsigned long)s_sample_rate, (unsigned long)s_dma_samples);
+    return ESP_OK;
+}
+
+esp_err_t audio_port_enable(void)
+{
+    if (!s_initialized || s_enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_enabled_at = esp_timer_get_time();
+    s_consumed = 0;
+    s_overflows = 0;
+    s_enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t audio_port_disable(void)
+{
+    if (!s_enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_enabled = false;
+    s_signal_base += s_consumed;
+    return ESP_OK;
+}
+
+static uint64_t samples_due(int64_t now)
+{
+    return (uint64_t)(now - s_enabled_at) * s_sample_rate / 1000000;
+}
+
+static int16_t signal_at(uint64_t index)
+{
+    switch (s_sim_config.signal) {
+    case AUDIO_PORT_SIM_TONE:
+        return (int16_t)(s_sim_config.amplitude *
+                         sinf(2.0f * (float)M_PI * s_sim_config.tone_hz * (float)(index % s_sample_rate) / s_sample_rate));
+    case AUDIO_PORT_SIM_FILE:
+        return s_file[index % s_file_samples];
+    default:
+        return (int16_t)index;
+    }
+}
+
+esp_err_t audio_port_read(void *dest, size_t bytes, size_t *bytes_read, uint32_t timeout_ms)
+{
+    *bytes_read = 0;
+    if (!s_enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    size_t slot_bytes = s_wide ? sizeof(int32_t) : sizeof(int16_t);
+    size_t wanted = bytes / slot_bytes;
+    int64_t give_up = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+    int16_t *out = dest;
+    int32_t *out_wide = dest;
+    size_t got = 0;
+    while (got < wanted) {
+        int64_t now = esp_timer_get_time();
+        uint64_t due = samples_due(now);
+        if (due - s_consumed > s_dma_samples) {
+            // The oldest buffers were overwritten before anyone read them
+            s_consumed = due - s_dma_samples;
+            s_overflows++;
+        }
+        while (got < wanted && s_consumed < due) {
+            uint64_t index = s_signal_base + s_consumed++;
+            if (s_wide) {
+                // 24 bits of data as an INMP441 sends them; the recorder
+                // keeps the top 16 unless told to give up headroom
+                out_wide[got++] = (int32_t)((uint32_t)(uint16_t)signal_at(index) << 16) |
+                                  (int32_t)((index * 40503u) & 0xFF00);
+            } else {
+                out[got++] = signal_at(index);
+            }
+        }
+        if (got == wanted) {
+            break;
+        }
+        if (now >= give_up) {
+            *bytes_read = got * slot_bytes;
+            return ESP_ERR_TIMEOUT;
+        }
+        vTaskDelay(1);
+    }
+    *bytes_read = got * slot_bytes;
+    return ESP_OK;
+}
+
+uint32_t audio_port_dma_overflows(void)
+{
+    return s_overflows;
+}
+
+void audio_port_deinit(void)
+{
+    s_enabled = false;
+    s_initialized = false;
+    free(s_file);
+    s_file = NULL;
+}
\ No newline at end of file
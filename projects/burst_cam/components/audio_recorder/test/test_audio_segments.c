@@ -0,0 +1,148 @@
+#include "unity.h"
+#include "audio_segments.h"
+#include "audio_test_util.h"
+#include "sdcard_module.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs on the linux target against the simulated microphone's ramp: a
+// sample lost or repeated at a seam shows as a break in the count
+
+#define TEST_SEGMENT_MS     250
+#define TEST_SEGMENTS_MAX   16
+
+typedef struct {
+    atomic_int naming;          // tasks inside make_path at once
+    int naming_max;
+    uint32_t stall_ms;          // the first make_path sleeps this long
+    uint32_t named;
+    uint32_t closed;
+    audio_segment_t segments[TEST_SEGMENTS_MAX];
+} segments_ctx_t;
+
+static void make_path(char *path, size_t size, const audio_segment_t *segment, void *ctx)
+{
+    segments_ctx_t *test = ctx;
+    int naming = atomic_fetch_add(&test->naming, 1) + 1;
+    if (naming > test->naming_max) {
+        test->naming_max = naming;
+    }
+    if (test->named++ == 0 && test->stall_ms) {
+        vTaskDelay(pdMS_TO_TICKS(test->stall_ms));
+    }
+    snprintf(path, size, "seg_%02lu.wav", (unsigned long)segment->index);
+    atomic_fetch_sub(&test->naming, 1);
+}
+
+static void on_closed(const audio_segment_t *segment, void *ctx)
+{
+    segments_ctx_t *test = ctx;
+    if (test->closed < TEST_SEGMENTS_MAX) {
+        test->segments[test->closed] = *segment;
+    }
+    test->closed++;
+}
+
+static audio_segments_config_t segments_config(segments_ctx_t *test)
+{
+    audio_segments_config_t config = {
+        .segment_ms = TEST_SEGMENT_MS,
+        .poll_ms = 20,
+        .wav = { .sample_rate = AUDIO_TEST_RATE, .channels = 1 },
+        .make_path = make_path,
+        .on_closed = on_closed,
+        .ctx = test,
+        .task_priority = 5,
+    };
+    return config;
+}
+
+TEST_CASE("segments join without a lost or repeated sample", "[audio][segments]")
+{
+    sdcard_config_t sd = {0};
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_init(&sd));
+    audio_test_recorder_start(0);
+    static segments_ctx_t test;
+    memset(&test, 0, sizeof(test));
+    audio_segments_config_t config = segments_config(&test);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_start(&config));
+    vTaskDelay(pdMS_TO_TICKS(4 * TEST_SEGMENT_MS + 100));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_stop());
+
+    audio_segments_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_get_stats(&stats));
+    TEST_ASSERT_EQUAL(0, stats.samples_lost);
+    TEST_ASSERT_EQUAL(0, stats.failed);
+    TEST_ASSERT_GREATER_OR_EQUAL(4, test.closed);
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_SEGMENTS_MAX, test.closed);
+
+    // Every file picks up on the sample after the last one's end
+    uint64_t total = 0;
+    int16_t last = 0;
+    for (uint32_t i = 0; i < test.closed; i++) {
+        const audio_segment_t *seg = &test.segments[i];
+        TEST_ASSERT_TRUE(seg->ok);
+        TEST_ASSERT_EQUAL(i, seg->index);
+        TEST_ASSERT_EQUAL(test.segments[0].start.first_sample + total, seg->start.first_sample);
+        if (i + 1 < test.closed) {
+            TEST_ASSERT_EQUAL(TEST_SEGMENT_MS * AUDIO_TEST_RATE / 1000, seg->samples);
+        }
+
+        size_t len;
+        uint8_t *wav = audio_test_read_card(seg->path, &len);
+        uint32_t data_bytes;
+        const uint8_t *data = audio_test_wav_data(wav, len, &data_bytes);
+        TEST_ASSERT_NOT_NULL(data);
+        TEST_ASSERT_EQUAL(seg->samples * sizeof(int16_t), data_bytes);
+        for (uint32_t s = 0; s < seg->samples; s++) {
+            int16_t sample = (int16_t)audio_test_u16(data + 2 * s);
+            if (i > 0 || s > 0) {
+                TEST_ASSERT_EQUAL_INT16((int16_t)(last + 1), sample);
+            }
+            last = sample;
+        }
+        free(wav);
+        total += seg->samples;
+    }
+    TEST_ASSERT_EQUAL(total, stats.samples);
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_deinit());
+}
+
+TEST_CASE("a start after a timed-out stop waits for the last task", "[audio][segments]")
+{
+    sdcard_config_t sd = {0};
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_init(&sd));
+    audio_test_recorder_start(0);
+    static segments_ctx_t test;
+    memset(&test, 0, sizeof(test));
+    test.stall_ms = 2500;
+    audio_segments_config_t config = segments_config(&test);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_start(&config));
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    // Stuck naming its first file, the task outlives the stop
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, audio_segments_stop());
+
+    // The next run only begins once the last task has gone, and its stop
+    // waits for its own task rather than taking the old one's leave
+    test.stall_ms = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_start(&config));
+    vTaskDelay(pdMS_TO_TICKS(TEST_SEGMENT_MS + 100));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_stop());
+    TEST_ASSERT_EQUAL(1, test.naming_max);
+    TEST_ASSERT_EQUAL(0, atomic_load(&test.naming));
+
+    audio_segments_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_segments_get_stats(&stats));
+    TEST_ASSERT_EQUAL(0, stats.failed);
+    TEST_ASSERT_GREATER_THAN(0, stats.segments);
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_deinit());
+}
\ No newline at end of file
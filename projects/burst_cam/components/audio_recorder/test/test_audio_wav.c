@@ -0,0 +1,125 @@
+#include "unity.h"
+#include "audio_wav.h"
+#include "audio_test_util.h"
+#include "sdcard_module.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Runs on the linux target. A file read back while its writer is still
+// open is what the card holds if the power goes at that moment.
+
+#define TEST_SAMPLES        (AUDIO_TEST_RATE * 5 / 4)
+#define TEST_CHUNK_BYTES    4096
+#define TEST_CHECKPOINT_MS  100
+
+static int16_t s_pcm[TEST_SAMPLES];
+
+// Fills the clip with a ramp and writes it in pieces of random size, as
+// the capture task would, leaving the writer open
+static void write_open(audio_wav_writer_t *writer, const char *path, const audio_wav_config_t *config)
+{
+    sdcard_config_t sd = {0};
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_init(&sd));
+    for (int i = 0; i < TEST_SAMPLES; i++) {
+        s_pcm[i] = (int16_t)(i * 7);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, audio_wav_open(writer, path, config));
+    srand(11);
+    for (size_t offset = 0; offset < TEST_SAMPLES;) {
+        size_t piece = 1 + rand() % 700;
+        piece = piece > TEST_SAMPLES - offset ? TEST_SAMPLES - offset : piece;
+        TEST_ASSERT_EQUAL(ESP_OK, audio_wav_write(writer, s_pcm + offset, piece));
+        offset += piece;
+    }
+}
+
+TEST_CASE("a clip cut off after a checkpoint plays up to it", "[audio][wav]")
+{
+    audio_wav_config_t config = {
+        .sample_rate = AUDIO_TEST_RATE,
+        .channels = 1,
+        .chunk_bytes = TEST_CHUNK_BYTES,
+        .checkpoint_ms = TEST_CHECKPOINT_MS,
+    };
+    audio_wav_writer_t writer;
+    write_open(&writer, "wav_cut.wav", &config);
+    TEST_ASSERT_GREATER_THAN(0, writer.stats.checkpoints);
+
+    // Only whole chunks reach the card, the first one short by the header
+    size_t len;
+    uint8_t *wav = audio_test_read_card("wav_cut.wav", &len);
+    TEST_ASSERT_EQUAL(0, len % TEST_CHUNK_BYTES);
+    TEST_ASSERT_EQUAL(writer.stats.data_bytes + writer.header_bytes, len);
+
+    // The header covers what was there at the last checkpoint, which is
+    // at most a chunk and a checkpoint behind, and the samples are intact
+    uint32_t data_bytes;
+    const uint8_t *data = audio_test_wav_data(wav, len, &data_bytes);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL(writer.header_bytes - 8 + data_bytes, audio_test_u32(wav + 4));
+    TEST_ASSERT_LESS_OR_EQUAL(len - writer.header_bytes, data_bytes);
+    uint32_t checkpoint_bytes = AUDIO_TEST_RATE * sizeof(int16_t) * TEST_CHECKPOINT_MS / 1000;
+    TEST_ASSERT_GREATER_OR_EQUAL(TEST_SAMPLES * sizeof(int16_t) - TEST_CHUNK_BYTES - checkpoint_bytes, data_bytes);
+    TEST_ASSERT_EQUAL(0, data_bytes % sizeof(int16_t));
+    TEST_ASSERT_EQUAL_MEMORY(s_pcm, data, data_bytes);
+    free(wav);
+
+    // Closed, it holds every sample
+    TEST_ASSERT_EQUAL(ESP_OK, audio_wav_close(&writer));
+    wav = audio_test_read_card("wav_cut.wav", &len);
+    data = audio_test_wav_data(wav, len, &data_bytes);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL(TEST_SAMPLES * sizeof(int16_t), data_bytes);
+    TEST_ASSERT_EQUAL(len - 8, audio_test_u32(wav + 4));
+    TEST_ASSERT_EQUAL_MEMORY(s_pcm, data, data_bytes);
+    free(wav);
+}
+
+TEST_CASE("an ADPCM checkpoint covers whole blocks and counts their samples", "[audio][wav]")
+{
+    audio_wav_config_t config = {
+        .sample_rate = AUDIO_TEST_RATE,
+        .channels = 1,
+        .chunk_bytes = TEST_CHUNK_BYTES,
+        .checkpoint_ms = TEST_CHECKPOINT_MS,
+        .format = AUDIO_WAV_IMA_ADPCM,
+    };
+    audio_wav_writer_t writer;
+    write_open(&writer, "wav_cut_adpcm.wav", &config);
+    TEST_ASSERT_GREATER_THAN(0, writer.stats.checkpoints);
+
+    size_t len;
+    uint8_t *wav = audio_test_read_card("wav_cut_adpcm.wav", &len);
+    uint16_t align = audio_test_u16(wav + 32);
+    size_t per_block = audio_test_u16(wav + 38);
+    TEST_ASSERT_EQUAL(audio_codec_adpcm_block_samples(align), per_block);
+    uint32_t data_bytes;
+    const uint8_t *data = audio_test_wav_data(wav, len, &data_bytes);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_GREATER_THAN(0, data_bytes);
+    TEST_ASSERT_EQUAL(0, data_bytes % align);
+    TEST_ASSERT_LESS_OR_EQUAL(len - writer.header_bytes, data_bytes);
+    TEST_ASSERT_EQUAL(data_bytes / align * per_block, audio_test_u32(wav + 48));
+    free(wav);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_wav_close(&writer));
+}
+
+TEST_CASE("without checkpoints the sizes wait for the close", "[audio][wav]")
+{
+    audio_wav_config_t config = {
+        .sample_rate = AUDIO_TEST_RATE,
+        .channels = 1,
+        .chunk_bytes = TEST_CHUNK_BYTES,
+    };
+    audio_wav_writer_t writer;
+    write_open(&writer, "wav_nocheck.wav", &config);
+    TEST_ASSERT_EQUAL(0, writer.stats.checkpoints);
+
+    size_t len;
+    uint8_t *wav = audio_test_read_card("wav_nocheck.wav", &len);
+    uint32_t data_bytes;
+    TEST_ASSERT_NOT_NULL(audio_test_wav_data(wav, len, &data_bytes));
+    TEST_ASSERT_EQUAL(0, data_bytes);
+    free(wav);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_wav_close(&writer));
+}
\ No newline at end of file
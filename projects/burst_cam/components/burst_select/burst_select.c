@@ -0,0 +1,356 @@
+#include "burst_select.h"
+#include "jpeg_scan.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "burst_select";
+
+#define STRUCTURE_SHARE     4       // 1/4 of the blocks, those with the most low-band energy
+#define CLIP_LOW            6       // block means at or past these are clipped
+#define CLIP_HIGH           249
+#define MIN_STRUCTURED      16      // fewer structured blocks than this: a flat frame
+
+typedef struct {
+    camera_fb_t fb;
+    bool used;
+    uint16_t index;
+    burst_select_score_t score;
+} slot_t;
+
+static burst_select_config_t s_config;
+static bool s_initialized = false;
+static uint8_t *s_pool = NULL;
+static size_t s_slot_bytes = 0;
+static slot_t s_slots[BURST_SELECT_MAX_KEEP];
+static uint16_t s_burst_index = 0;
+static float s_first_score = -1.0f;
+static uint16_t s_first_beaten = 0;
+
+// Maps sized for the largest frame seen
+static uint8_t *s_dc = NULL;
+static uint16_t *s_low = NULL;
+static uint16_t *s_high = NULL;
+static size_t s_map_blocks = 0;
+
+static burst_select_stats_t s_stats;
+static uint64_t s_score_sum_us = 0;
+static uint64_t s_copy_sum_us = 0;
+static uint32_t s_copies = 0;
+static uint64_t s_first_rank_sum = 0;
+
+static void *alloc_psram(size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : heap_caps_malloc(size, MALLOC_CAP_8BIT);
+}
+
+static void free_maps(void)
+{
+    heap_caps_free(s_dc);
+    heap_caps_free(s_low);
+    heap_caps_free(s_high);
+    s_dc = NULL;
+    s_low = NULL;
+    s_high = NULL;
+    s_map_blocks = 0;
+}
+
+static esp_err_t ensure_maps(size_t blocks)
+{
+    if (s_dc && blocks <= s_map_blocks) {
+        return ESP_OK;
+    }
+    free_maps();
+    s_dc = alloc_psram(blocks);
+    s_low = alloc_psram(blocks * sizeof(uint16_t));
+    s_high = alloc_psram(blocks * sizeof(uint16_t));
+    if (!s_dc || !s_low || !s_high) {
+        free_maps();
+        return ESP_ERR_NO_MEM;
+    }
+    s_map_blocks = blocks;
+    return ESP_OK;
+}
+
+// Low-band level above which a quarter of the blocks lie, from a histogram
+// over log2 buckets so no sort is needed
+static uint32_t structure_threshold(size_t blocks)
+{
+    uint32_t buckets[18] = {0};
+    for (size_t i = 0; i < blocks; i++) {
+        uint32_t v = s_low[i];
+        int b = 0;
+        while (v) {
+            b++;
+            v >>= 1;
+        }
+        buckets[b]++;
+    }
+
+    size_t wanted = blocks / STRUCTURE_SHARE;
+    size_t seen = 0;
+    for (int b = 17; b > 0; b--) {
+        seen += buckets[b];
+        if (seen >= wanted) {
+            return 1u << (b - 1);
+        }
+    }
+    return 1;
+}
+
+static float exposure_factor(uint8_t mean, float clipped)
+{
+    float factor = 1.0f - clipped;
+    if (s_config.target_mean && s_config.exposure_weight > 0) {
+        float stops = fabsf(log2f((mean + 1.0f) / (s_config.target_mean + 1.0f)));
+        factor *= fmaxf(0.0f, 1.0f - s_config.exposure_weight * stops);
+    }
+    return factor;
+}
+
+esp_err_t burst_select_score_jpeg(const uint8_t *jpeg, size_t len, burst_select_score_t *score)
+{
+    if (!jpeg || !score) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t start = esp_timer_get_time();
+    jpeg_scan_info_t info;
+    esp_err_t ret = jpeg_scan_get_info(jpeg, len, &info);
+    size_t blocks = (size_t)info.blocks_w * info.blocks_h;
+    if (ret == ESP_OK) {
+        ret = ensure_maps(blocks);
+    }
+    if (ret == ESP_OK) {
+        jpeg_scan_output_t out = {
+            .luma_dc = s_dc,
+            .luma_dc_size = s_map_blocks,
+            .luma_dc_stride = 0,
+            .luma_ac_low = s_low,
+            .luma_ac_high = s_high,
+        };
+        ret = jpeg_scan_decode(jpeg, len, &out, NULL);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGD(TAG, "Cannot scan JPEG: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    uint32_t threshold = structure_threshold(blocks);
+    uint64_t mean_sum = 0;
+    uint32_t clipped = 0;
+    uint64_t low_sum = 0;
+    uint64_t high_sum = 0;
+    uint32_t structured = 0;
+    for (size_t i = 0; i < blocks; i++) {
+        mean_sum += s_dc[i];
+        clipped += s_dc[i] <= CLIP_LOW || s_dc[i] >= CLIP_HIGH;
+        if (s_low[i] >= threshold) {
+            low_sum += s_low[i];
+            high_sum += s_high[i];
+            structured++;
+        }
+    }
+
+    memset(score, 0, sizeof(*score));
+    score->mean = (uint8_t)(mean_sum / blocks);
+    if (structured >= MIN_STRUCTURED && low_sum + high_sum > 0) {
+        score->sharpness = (float)high_sum / (float)(low_sum + high_sum);
+        score->detail = (float)(low_sum + high_sum) / structured;
+    }
+    score->exposure = exposure_factor(score->mean, (float)clipped / blocks);
+    score->score = score->sharpness * score->exposure;
+    score->score_us = (uint32_t)(esp_timer_get_time() - start);
+    return ESP_OK;
+}
+
+esp_err_t burst_select_init(const burst_select_config_t *config)
+{
+    if (!config || config->keep < 1 || config->keep > BURST_SELECT_MAX_KEEP || config->pool_bytes < config->keep) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_pool = alloc_psram(config->pool_bytes);
+    if (!s_pool) {
+        ESP_LOGE(TAG, "No memory for a %u KB frame pool", (unsigned)(config->pool_bytes / 1024));
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_config = *config;
+    s_slot_bytes = config->pool_bytes / config->keep;
+    memset(s_slots, 0, sizeof(s_slots));
+    for (int i = 0; i < config->keep; i++) {
+        s_slots[i].fb.buf = s_pool + i * s_slot_bytes;
+    }
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_score_sum_us = 0;
+    s_copy_sum_us = 0;
+    s_copies = 0;
+    s_first_rank_sum = 0;
+    s_burst_index = 0;
+    s_first_score = -1.0f;
+    s_initialized = true;
+
+    ESP_LOGI(TAG, "Keeping the best %d frames of each burst, %u KB per frame",
+             config->keep, (unsigned)(s_slot_bytes / 1024));
+    return ESP_OK;
+}
+
+static void close_burst(void)
+{
+    if (s_burst_index == 0 || s_first_score < 0) {
+        return;
+    }
+    s_stats.bursts++;
+    s_first_rank_sum += s_first_beaten + 1;
+    s_stats.first_rank_avg = (float)s_first_rank_sum / s_stats.bursts;
+}
+
+void burst_select_begin(void)
+{
+    close_burst();
+    for (int i = 0; i < BURST_SELECT_MAX_KEEP; i++) {
+        s_slots[i].used = false;
+    }
+    s_burst_index = 0;
+    s_first_score = -1.0f;
+    s_first_beaten = 0;
+}
+
+esp_err_t burst_select_offer(const camera_fb_t *fb, burst_select_score_t *score)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!fb || fb->format != PIXFORMAT_JPEG) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    burst_select_score_t local;
+    burst_select_score_t *result = score ? score : &local;
+    esp_err_t ret = burst_select_score_jpeg(fb->buf, fb->len, result);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    s_stats.frames++;
+    s_score_sum_us += result->score_us;
+    s_stats.score_avg_us = (uint32_t)(s_score_sum_us / s_stats.frames);
+    if (result->score_us > s_stats.score_max_us) {
+        s_stats.score_max_us = result->score_us;
+    }
+
+    uint16_t index = s_burst_index++;
+    if (index == 0) {
+        s_first_score = result->score;
+    } else if (result->score > s_first_score) {
+        s_first_beaten++;
+    }
+
+    if (fb->len > s_slot_bytes) {
+        s_stats.too_large++;
+        ESP_LOGW(TAG, "Frame %d is %u bytes, over the %u byte slot", index,
+                 (unsigned)fb->len, (unsigned)s_slot_bytes);
+        return ESP_OK;
+    }
+
+    // A free slot, or else the worst held frame if this one beats it
+    slot_t *target = NULL;
+    for (int i = 0; i < s_config.keep; i++) {
+        slot_t *slot = &s_slots[i];
+        if (!slot->used) {
+            target = slot;
+            break;
+        }
+        if (!target || slot->score.score < target->score.score) {
+            target = slot;
+        }
+    }
+    if (target->used && result->score <= target->score.score) {
+        return ESP_OK;
+    }
+
+    int64_t copy_start = esp_timer_get_time();
+    uint8_t *buf = target->fb.buf;
+    memcpy(buf, fb->buf, fb->len);
+    target->fb = *fb;
+    target->fb.buf = buf;
+    target->used = true;
+    target->index = index;
+    target->score = *result;
+    s_copy_sum_us += esp_timer_get_time() - copy_start;
+    s_copies++;
+    s_stats.copy_avg_us = (uint32_t)(s_copy_sum_us / s_copies);
+    return ESP_OK;
+}
+
+int burst_select_count(void)
+{
+    int count = 0;
+    for (int i = 0; i < s_config.keep; i++) {
+        count += s_slots[i].used;
+    }
+    return count;
+}
+
+esp_err_t burst_select_get(int rank, burst_select_frame_t *frame)
+{
+    if (!frame) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // keep is small; rank by counting the better frames
+    for (int i = 0; i < s_config.keep; i++) {
+        const slot_t *slot = &s_slots[i];
+        if (!slot->used) {
+            continue;
+        }
+        int better = 0;
+        for (int j = 0; j < s_config.keep; j++) {
+            const slot_t *other = &s_slots[j];
+            if (j != i && other->used &&
+                (other->score.score > slot->score.score ||
+                 (other->score.score == slot->score.score && other->index < slot->index))) {
+                better++;
+            }
+        }
+        if (better == rank) {
+            frame->fb = slot->fb;
+            frame->index = slot->index;
+            frame->score = slot->score;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t burst_select_get_stats(burst_select_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *stats = s_stats;
+    return ESP_OK;
+}
+
+void burst_select_deinit(void)
+{
+    heap_caps_free(s_pool);
+    s_pool = NULL;
+    free_maps();
+    memset(s_slots, 0, sizeof(s_slots));
+    s_initialized = false;
+}
\ No newline at end of file
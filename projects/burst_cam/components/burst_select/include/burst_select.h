@@ -0,0 +1,77 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_camera.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Keeps the best few frames of a burst. Every frame is scored from one
+// entropy pass over its JPEG, with no IDCT: the quarter of the blocks with
+// the most low-band AC energy is where the scene has structure, and the
+// share of their energy in the high band is the sharpness. Motion blur and
+// defocus drain the high band while barely touching the low one, so the
+// ratio does not move with scene contrast or exposure. A penalty for
+// clipped blocks and for a mean far from the target keeps frames caught
+// mid auto-exposure from winning. The best frames are copied into a PSRAM
+// pool so the camera buffers go straight back to the driver.
+#define BURST_SELECT_MAX_KEEP   8
+
+typedef struct {
+    uint8_t keep;               // frames held, 1..BURST_SELECT_MAX_KEEP
+    size_t pool_bytes;          // PSRAM shared by the held JPEGs, keep slots of equal size
+    uint8_t target_mean;        // block mean the exposure term prefers, 0 = ignore exposure
+    float exposure_weight;      // score lost per stop away from target_mean, e.g. 0.5
+} burst_select_config_t;
+
+typedef struct {
+    float sharpness;            // high-band share of the AC energy in the structured blocks, 0..1
+    float detail;               // their mean AC energy per block
+    float exposure;             // 0..1 multiplier from clipping and mean
+    float score;                // sharpness * exposure
+    uint8_t mean;               // block mean of the frame
+    uint32_t score_us;
+} burst_select_score_t;
+
+typedef struct {
+    camera_fb_t fb;             // the held JPEG, buf in the pool until the next begin
+    uint16_t index;             // position in the burst
+    burst_select_score_t score;
+} burst_select_frame_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t too_large;         // scored, but bigger than a pool slot
+    uint32_t score_avg_us;
+    uint32_t score_max_us;
+    uint32_t copy_avg_us;       // JPEG into the pool
+    uint32_t bursts;
+    float first_rank_avg;       // where the burst's first frame ranked, 1 = best
+} burst_select_stats_t;
+
+esp_err_t burst_select_init(const burst_select_config_t *config);
+
+// Empties the pool for a new burst
+void burst_select_begin(void);
+
+// Scores one JPEG frame and holds a copy when it ranks among the best so far
+esp_err_t burst_select_offer(const camera_fb_t *fb, burst_select_score_t *score);
+
+esp_err_t burst_select_score_jpeg(const uint8_t *jpeg, size_t len, burst_select_score_t *score);
+
+int burst_select_count(void);
+
+// Held frames by rank, 0 = best
+esp_err_t burst_select_get(int rank, burst_select_frame_t *frame);
+
+esp_err_t burst_select_get_stats(burst_select_stats_t *stats);
+
+void burst_select_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,1380 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A 128x96 grayscale burst of one scene (pink noise with edges) encoded by
+// libjpeg at quality 80. Frame 0 is a sharp frame at 0.4x gain, caught
+// mid auto-exposure; the rest are exposed alike with motion blur of the
+// given length in pixels and sensor noise of sigma 2.5.
+
+#define FIXTURE_BURST_FRAMES    6
+#define FIXTURE_BURST_SHARPEST  3
+
+static const float fixture_burst_blur[FIXTURE_BURST_FRAMES] = { 0.0f, 10.0f, 4.0f, 0.0f, 2.0f, 7.0f };
+
+static const uint8_t fixture_burst_0[3021] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x60,
+    0x00, 0x80, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xf2, 0xab, 0x79, 0x3c, 0xab, 0x74, 0x40, 0x81,
+    0x40, 0x05, 0x88, 0x1d, 0x4f, 0xe1, 0xef, 0x58, 0x9f, 0x6e, 0x37, 0x57, 0x65, 0xb6, 0xe1, 0xca,
+    0x94, 0x01, 0xd4, 0xfc, 0xdc, 0xfd, 0x3f, 0x4a, 0xb1, 0x9b, 0x45, 0x81, 0x86, 0xe0, 0xb2, 0x7d,
+    0xd0, 0x14, 0x75, 0x27, 0xb1, 0x3e, 0xb5, 0x15, 0xc1, 0x45, 0x30, 0xb3, 0x6e, 0x51, 0xbb, 0x6b,
+    0xf3, 0xce, 0x6a, 0xea, 0x5a, 0xa4, 0xd0, 0x99, 0x77, 0x6c, 0x6d, 0xd8, 0x5f, 0xa7, 0xbd, 0x47,
+    0x71, 0x6b, 0x24, 0xd0, 0x10, 0x8a, 0x59, 0xdd, 0x46, 0x32, 0x40, 0xfc, 0x3f, 0x4a, 0xae, 0x81,
+    0xd5, 0xa4, 0x8e, 0xe2, 0x35, 0x05, 0x57, 0x19, 0x24, 0x12, 0x39, 0xed, 0x52, 0x30, 0x93, 0xf7,
+    0x61, 0xe4, 0x91, 0x41, 0x18, 0xf9, 0xb0, 0xdd, 0x3d, 0xb1, 0x54, 0xaf, 0xae, 0x65, 0x67, 0x11,
+    0xc7, 0x18, 0x0b, 0x8d, 0xdb, 0x97, 0x27, 0x1f, 0x5a, 0x5d, 0x3a, 0x25, 0x65, 0x2e, 0x49, 0x2c,
+    0x1b, 0x18, 0xce, 0x4f, 0x3d, 0xfe, 0x9c, 0xd5, 0xfb, 0xa9, 0x21, 0x4b, 0x41, 0x10, 0x54, 0x50,
+    0x46, 0xdd, 0xf8, 0xe8, 0x7b, 0x0f, 0x7a, 0xc9, 0x36, 0xe5, 0xd5, 0xcc, 0x20, 0xb0, 0x43, 0xb8,
+    0x87, 0x1d, 0x7d, 0xc6, 0x45, 0x16, 0x96, 0xf1, 0x3c, 0xb1, 0xf9, 0x8e, 0xc1, 0x98, 0x86, 0x20,
+    0x8d, 0xb8, 0xa9, 0x24, 0x8b, 0x61, 0x98, 0x3e, 0xed, 0xad, 0xf7, 0x5b, 0x38, 0xc0, 0x15, 0x3a,
+    0xdb, 0x09, 0x6d, 0x93, 0xec, 0xcd, 0x93, 0xb7, 0x3b, 0xca, 0xe3, 0x27, 0xfa, 0xd4, 0xd0, 0xda,
+    0x2a, 0x9c, 0xb8, 0x61, 0x20, 0x7e, 0x48, 0xe7, 0x8f, 0x5a, 0x96, 0x79, 0x1e, 0x40, 0xc1, 0x25,
+    0x21, 0x58, 0x0c, 0x70, 0x38, 0xf7, 0xc5, 0x53, 0x82, 0x23, 0x02, 0xc8, 0xf2, 0x1c, 0xb0, 0xe1,
+    0x18, 0xe7, 0xbf, 0x7f, 0x4e, 0xf5, 0x0d, 0xac, 0xa8, 0xd2, 0xcb, 0xbd, 0x58, 0xe0, 0x64, 0x6c,
+    0x1c, 0x83, 0x8a, 0xd5, 0x86, 0xcc, 0x39, 0x11, 0xed, 0x59, 0x01, 0x60, 0xd9, 0x27, 0x3f, 0x8d,
+    0x5f, 0x60, 0x80, 0x47, 0x98, 0xf7, 0x7f, 0x78, 0x29, 0xe0, 0x7d, 0x6a, 0x47, 0x9a, 0x29, 0xad,
+    0xa3, 0x0c, 0x63, 0x52, 0x30, 0xc1, 0x77, 0x63, 0x23, 0x07, 0xf5, 0xac, 0xeb, 0xa3, 0x1c, 0x7e,
+    0x73, 0x32, 0x82, 0x77, 0x7c, 0xa7, 0x24, 0x9f, 0x6f, 0xc2, 0xa9, 0x41, 0x0c, 0xb3, 0xc8, 0xf3,
+    0x34, 0x4c, 0xa8, 0x8d, 0xf2, 0xc8, 0x32, 0x41, 0x23, 0xb7, 0xbd, 0x43, 0x28, 0x9a, 0x30, 0xce,
+    0x90, 0xb1, 0x57, 0x6c, 0x0e, 0x31, 0xc5, 0x2d, 0x8d, 0xb3, 0x96, 0x89, 0xcc, 0x4e, 0xae, 0xa4,
+    0x67, 0x70, 0x38, 0xc8, 0x3c, 0xd7, 0x4e, 0xab, 0x05, 0xd5, 0x93, 0x07, 0x96, 0x18, 0xd9, 0x48,
+    0xdd, 0xce, 0x4e, 0xef, 0xa6, 0x68, 0x2e, 0x1d, 0x76, 0x24, 0x8b, 0xc1, 0xc9, 0xda, 0xc3, 0xa0,
+    0xa8, 0xee, 0x64, 0xb6, 0x9d, 0x77, 0x89, 0x51, 0x98, 0x70, 0x57, 0x39, 0xdb, 0x8e, 0xf5, 0x5e,
+    0xcd, 0xe2, 0x9a, 0x32, 0x86, 0x72, 0xad, 0xfe, 0xd1, 0x04, 0xfe, 0x55, 0x2d, 0xe9, 0x8f, 0xec,
+    0xdb, 0x21, 0x9c, 0x6e, 0x18, 0x1f, 0x29, 0x1c, 0xf3, 0x9a, 0xc8, 0xbd, 0xb9, 0xf2, 0x0a, 0x63,
+    0x0e, 0xdf, 0xa9, 0xf5, 0xe7, 0xf3, 0xe2, 0xa2, 0x73, 0x2e, 0xd2, 0x78, 0x60, 0x4e, 0x00, 0x2d,
+    0xfa, 0x7a, 0xd5, 0x9b, 0x43, 0x2d, 0xcd, 0xa0, 0x47, 0x1f, 0xde, 0x6e, 0x48, 0xc0, 0xf5, 0xef,
+    0x51, 0x69, 0xd6, 0x57, 0x04, 0xbb, 0xc0, 0x9b, 0x53, 0x77, 0xde, 0x66, 0x1c, 0xf5, 0xe7, 0x35,
+    0xb9, 0x6f, 0x05, 0xd4, 0x72, 0xc4, 0xa5, 0x46, 0xc6, 0x20, 0x33, 0x12, 0x38, 0x1f, 0xe4, 0xd4,
+    0xb7, 0x10, 0xcd, 0x21, 0x92, 0x45, 0x81, 0x46, 0xfe, 0x07, 0x20, 0x1f, 0x4c, 0xd6, 0x02, 0xe9,
+    0x77, 0x7c, 0xc9, 0xb4, 0x08, 0x90, 0x28, 0x01, 0x8f, 0xf8, 0x54, 0xfa, 0x36, 0x9c, 0x93, 0xce,
+    0xcd, 0x39, 0x20, 0xa9, 0x1d, 0x54, 0xe7, 0x1e, 0xd5, 0xd5, 0x8d, 0x32, 0xd4, 0xda, 0xaa, 0xc6,
+    0xa5, 0x41, 0xfb, 0xa4, 0x70, 0x6b, 0x3e, 0xe6, 0xc2, 0xda, 0x07, 0x8d, 0xc6, 0x5d, 0xd4, 0xfc,
+    0xcb, 0xb8, 0xf2, 0x47, 0x3e, 0xb4, 0xd9, 0xb4, 0xe8, 0x24, 0xb8, 0x2e, 0x11, 0xdf, 0xcc, 0x01,
+    0x4f, 0xcc, 0x70, 0x47, 0xa7, 0x5a, 0xa8, 0xf6, 0x90, 0x8b, 0x77, 0x10, 0xa6, 0xd9, 0x0b, 0x15,
+    0xc6, 0x49, 0x20, 0x7b, 0xf3, 0xcf, 0x6a, 0xa4, 0xa9, 0xe5, 0xc5, 0x2e, 0xc0, 0xdb, 0x9c, 0xe7,
+    0x2b, 0x8c, 0x36, 0x3a, 0x81, 0xde, 0xa4, 0x96, 0x3f, 0x91, 0x08, 0xd9, 0x13, 0x8e, 0x46, 0x09,
+    0x07, 0x9e, 0xd4, 0xc8, 0x9d, 0x23, 0x3e, 0x5b, 0x44, 0xef, 0x20, 0x38, 0x2d, 0x8c, 0xfb, 0x64,
+    0xf3, 0x50, 0x48, 0xef, 0x2d, 0xc8, 0x28, 0xca, 0x02, 0x9c, 0xe0, 0x67, 0xe6, 0xe6, 0x89, 0x81,
+    0x03, 0xe6, 0x58, 0x48, 0xe7, 0x81, 0x90, 0x46, 0x69, 0xc8, 0x56, 0x28, 0x8c, 0x92, 0x87, 0x91,
+    0x24, 0xc6, 0xd0, 0xa7, 0x1c, 0x9c, 0x7e, 0x34, 0xb6, 0xd7, 0x82, 0x4b, 0x56, 0x82, 0x28, 0x00,
+    0xe0, 0xee, 0x20, 0xee, 0x24, 0x67, 0xb0, 0x35, 0xb1, 0x6f, 0x22, 0xdb, 0x5a, 0x0f, 0xb2, 0xc4,
+    0xd1, 0xc7, 0xb8, 0x17, 0x19, 0xe4, 0x8f, 0x5a, 0x6d, 0x80, 0x96, 0x49, 0xc1, 0x2a, 0xc2, 0x31,
+    0xb5, 0x86, 0x71, 0x92, 0x09, 0xce, 0x48, 0xfa, 0x56, 0x84, 0xa0, 0x61, 0x41, 0xde, 0xbb, 0x4e,
+    0x40, 0x3e, 0x86, 0x96, 0xe2, 0xc6, 0x39, 0x2c, 0x0a, 0xc2, 0xcc, 0xad, 0xc1, 0x1b, 0x4e, 0x3a,
+    0x91, 0xfe, 0x7f, 0x1a, 0xad, 0xa5, 0x59, 0x3a, 0x09, 0x90, 0xe7, 0x76, 0x41, 0xdf, 0xbb, 0x3d,
+    0x8f, 0x1f, 0xad, 0x6e, 0x5b, 0x2e, 0xcb, 0x55, 0x12, 0x05, 0xc8, 0xce, 0x40, 0xe9, 0x9c, 0xd5,
+    0x5b, 0x9b, 0x58, 0x9d, 0xd9, 0x89, 0x66, 0xc6, 0x5b, 0x19, 0xc0, 0xe6, 0xaa, 0x35, 0xc3, 0x45,
+    0x90, 0xa4, 0x00, 0x17, 0x71, 0x6c, 0x63, 0x6f, 0x5e, 0x45, 0x73, 0xb3, 0xdd, 0xdb, 0xb4, 0x2d,
+    0xbd, 0xc9, 0xd9, 0x21, 0xc6, 0x5b, 0x1b, 0x7a, 0xf2, 0x7f, 0x3a, 0xa9, 0x04, 0xb2, 0x35, 0xc4,
+    0x6b, 0x11, 0x2c, 0x8e, 0x79, 0x23, 0x03, 0xea, 0x6b, 0x45, 0x67, 0x4d, 0xf1, 0xac, 0xc8, 0xa1,
+    0x57, 0x82, 0x4f, 0x03, 0x15, 0x2d, 0xd3, 0x40, 0xe9, 0x2a, 0x41, 0x8c, 0xe3, 0x20, 0x63, 0x9c,
+    0x7a, 0x7b, 0xd6, 0x55, 0x93, 0x96, 0x66, 0x55, 0xc2, 0x01, 0x82, 0x5c, 0xff, 0x00, 0x2a, 0x92,
+    0x69, 0x11, 0x04, 0x2a, 0xef, 0xb8, 0x02, 0x42, 0x10, 0x32, 0x4f, 0x5e, 0x9e, 0xb5, 0x2e, 0x9d,
+    0xb2, 0xe6, 0x36, 0x44, 0x52, 0x3c, 0xb2, 0x08, 0xc1, 0x1c, 0x8a, 0x97, 0x4d, 0xb4, 0x46, 0x91,
+    0x7c, 0xad, 0xca, 0x43, 0xbe, 0x43, 0xe3, 0x77, 0xde, 0xed, 0xc7, 0x4a, 0xe9, 0xa3, 0xb2, 0x57,
+    0x20, 0x60, 0x84, 0xeb, 0x85, 0x20, 0xe3, 0xd3, 0xeb, 0x4d, 0x95, 0x0a, 0xb9, 0x41, 0xfb, 0xc8,
+    0xb0, 0x77, 0x64, 0xe1, 0x8a, 0x8f, 0x4e, 0x39, 0x35, 0x89, 0x77, 0x7e, 0xcf, 0x32, 0xa2, 0x6e,
+    0x20, 0x92, 0x18, 0x92, 0x3a, 0x77, 0x22, 0xa5, 0xd4, 0xa5, 0xf2, 0xb4, 0xe2, 0xc7, 0x70, 0x63,
+    0x8f, 0x95, 0x7a, 0x9c, 0xe3, 0xff, 0x00, 0xaf, 0x54, 0x74, 0x84, 0xde, 0x6e, 0xa4, 0x9b, 0x7e,
+    0x48, 0x01, 0x63, 0xdd, 0xcf, 0x7e, 0x7f, 0x97, 0x35, 0xab, 0x26, 0xac, 0x90, 0xc7, 0x1a, 0xbc,
+    0x40, 0x82, 0xa0, 0x31, 0x0f, 0xd0, 0x54, 0x76, 0xfa, 0x9a, 0x08, 0x24, 0x58, 0xd5, 0x9d, 0xd9,
+    0xf9, 0x6d, 0xc3, 0x23, 0x1e, 0x9f, 0x95, 0x32, 0xe7, 0x50, 0x8d, 0x2e, 0x22, 0x8d, 0xc6, 0x23,
+    0x7c, 0x0c, 0x7e, 0x1c, 0x1a, 0xc3, 0xd5, 0x2d, 0xa0, 0xbc, 0x50, 0x51, 0x8a, 0xae, 0xe3, 0x88,
+    0xcf, 0xb9, 0xaa, 0x31, 0xc7, 0x72, 0xbe, 0x5f, 0x94, 0xd1, 0xc8, 0xad, 0xfc, 0x20, 0xf0, 0x30,
+    0x2b, 0x4e, 0xdf, 0x77, 0xc8, 0x65, 0x0b, 0xe7, 0x46, 0x31, 0xc1, 0xce, 0x47, 0xf5, 0xf4, 0xa7,
+    0x5c, 0xc8, 0xed, 0x10, 0x64, 0x5c, 0x0c, 0xf4, 0xe8, 0x4a, 0xf7, 0x04, 0x55, 0x39, 0x5e, 0x24,
+    0xb6, 0xc4, 0x3e, 0x61, 0x8d, 0xc9, 0x62, 0xc7, 0x80, 0x0f, 0x4c, 0x0a, 0xa6, 0x2e, 0x16, 0x62,
+    0x0c, 0x8a, 0x58, 0x2b, 0xed, 0x56, 0x1c, 0x7f, 0x9e, 0x6b, 0x56, 0x49, 0xa3, 0x8b, 0xe7, 0x0f,
+    0xb7, 0x70, 0xc9, 0x54, 0x18, 0x24, 0x63, 0xf3, 0xab, 0x9a, 0x31, 0x78, 0x5c, 0x90, 0x24, 0xf3,
+    0x08, 0x27, 0xef, 0xe7, 0x23, 0x3e, 0xdf, 0x4a, 0xe9, 0xcf, 0xef, 0xe0, 0x00, 0x6d, 0x0e, 0xbf,
+    0x79, 0x41, 0xe7, 0xd7, 0x1c, 0x77, 0xa8, 0x98, 0xbc, 0x80, 0x86, 0x31, 0x6f, 0x51, 0xc3, 0x29,
+    0x23, 0x8f, 0x4f, 0xce, 0xb2, 0x4e, 0x9f, 0x20, 0x84, 0xb3, 0xb0, 0x53, 0x8d, 0x9f, 0x78, 0x8c,
+    0x72, 0x7a, 0x71, 0x59, 0x3a, 0xf3, 0x3a, 0xc0, 0x4a, 0xb6, 0x63, 0x41, 0xb4, 0x96, 0x1d, 0xf2,
+    0x2b, 0x1e, 0x3b, 0xb7, 0x92, 0x15, 0x40, 0xce, 0x1b, 0xa1, 0x25, 0x7a, 0xf6, 0x1f, 0xd6, 0xa3,
+    0xb8, 0xb7, 0x95, 0x23, 0xdd, 0x21, 0xdb, 0x8e, 0x79, 0x5e, 0xbf, 0x8d, 0x59, 0x85, 0x76, 0x48,
+    0x8f, 0xb9, 0x47, 0x98, 0x09, 0x50, 0xc0, 0x7f, 0x4a, 0xaf, 0xa8, 0x19, 0xb8, 0xdc, 0x81, 0x54,
+    0x1c, 0x0c, 0x1c, 0x93, 0xfe, 0x4d, 0x55, 0x50, 0x22, 0x39, 0x63, 0xe5, 0xf2, 0x4e, 0x08, 0xe9,
+    0x9f, 0x5a, 0xd3, 0x2c, 0x20, 0x98, 0x2c, 0x6a, 0x85, 0x15, 0x41, 0x62, 0x3d, 0x7f, 0xa5, 0x5a,
+    0xb4, 0x0c, 0x42, 0x2e, 0xd5, 0x63, 0x9d, 0xc1, 0x41, 0x39, 0xe9, 0xc8, 0xfc, 0x85, 0x59, 0xbb,
+    0x9a, 0x26, 0x5c, 0x82, 0x11, 0xd5, 0x71, 0x87, 0x3f, 0xa7, 0xeb, 0x54, 0x7c, 0x86, 0x9c, 0x29,
+    0x45, 0x69, 0x22, 0x6e, 0x98, 0xed, 0x81, 0xf8, 0x62, 0xa0, 0x86, 0x26, 0x86, 0xe5, 0x87, 0x96,
+    0xa4, 0x2f, 0x05, 0x98, 0x9c, 0x0e, 0xfd, 0xbb, 0xd2, 0xa0, 0x60, 0xd2, 0x90, 0x58, 0x8c, 0x9e,
+    0x30, 0x33, 0xf9, 0xd7, 0x43, 0xa6, 0x11, 0x65, 0xa7, 0x42, 0xf3, 0x49, 0x0e, 0xf6, 0xe4, 0x87,
+    0xe1, 0x87, 0x39, 0x15, 0xb1, 0x0d, 0xdc, 0x0b, 0x6e, 0x5c, 0x32, 0x09, 0x42, 0x93, 0x82, 0xd8,
+    0x0c, 0x7b, 0x0a, 0xa9, 0x6f, 0x3b, 0xcf, 0x70, 0xaa, 0x7c, 0xb6, 0x2a, 0x33, 0x8c, 0x8e, 0x46,
+    0x73, 0xcf, 0x3d, 0x6a, 0x5d, 0x46, 0xe5, 0x42, 0xef, 0x77, 0x00, 0x73, 0xb4, 0xf4, 0xc7, 0xb0,
+    0x15, 0x83, 0xa9, 0xbc, 0x73, 0xa4, 0xcb, 0xe6, 0x23, 0x3b, 0x15, 0x0a, 0xb9, 0x18, 0xeb, 0xff,
+    0x00, 0xd7, 0xeb, 0x59, 0xcb, 0xa7, 0x2a, 0x2a, 0x93, 0x29, 0xdc, 0xad, 0x92, 0xd8, 0xc6, 0x39,
+    0xe0, 0x51, 0x7d, 0x22, 0xca, 0x7c, 0xb9, 0x62, 0x2c, 0x08, 0xc7, 0x03, 0xbf, 0x6a, 0xa0, 0x47,
+    0xfa, 0x52, 0x98, 0xbe, 0x57, 0x5f, 0x94, 0x70, 0x47, 0x3f, 0x5f, 0x4c, 0xd6, 0x84, 0x51, 0xc4,
+    0xf1, 0xb2, 0xdc, 0x00, 0x5d, 0x18, 0xe3, 0x60, 0xed, 0x54, 0xef, 0xda, 0x31, 0x27, 0x11, 0x06,
+    0xc2, 0x0e, 0x31, 0x8e, 0x7f, 0x97, 0x15, 0x62, 0xd9, 0x14, 0x91, 0x33, 0x39, 0x62, 0x3a, 0x82,
+    0xd8, 0xc7, 0xa5, 0x5a, 0x58, 0xc4, 0xbe, 0x5b, 0xc5, 0x90, 0x70, 0x39, 0x1c, 0x7e, 0x94, 0xed,
+    0x46, 0x18, 0xfe, 0xc8, 0x8a, 0xc4, 0xab, 0x1f, 0xba, 0x47, 0x50, 0x00, 0xe0, 0x53, 0x6d, 0xb7,
+    0xae, 0x9f, 0x88, 0xd9, 0x55, 0x89, 0x24, 0x3b, 0x0c, 0x93, 0xf5, 0xaa, 0x81, 0xc1, 0x9b, 0x21,
+    0x86, 0x00, 0xc1, 0x27, 0xa6, 0x7f, 0x3a, 0xd7, 0xd2, 0x6c, 0x9e, 0x79, 0x4a, 0x6e, 0x57, 0x0e,
+    0xdf, 0x30, 0xc8, 0x20, 0x0e, 0xbf, 0x8d, 0x5e, 0xd4, 0x2c, 0x92, 0xd8, 0xed, 0x62, 0x24, 0x51,
+    0xca, 0x9c, 0x63, 0xf0, 0x03, 0xf0, 0xe6, 0x9a, 0x02, 0xcc, 0xa8, 0xa0, 0xa8, 0x60, 0x31, 0xb4,
+    0x9e, 0x71, 0xdb, 0xeb, 0x44, 0x85, 0x6c, 0x1c, 0x31, 0x38, 0x65, 0x03, 0x1c, 0x67, 0x9e, 0x7a,
+    0xff, 0x00, 0x8d, 0x67, 0xdd, 0x5c, 0xb5, 0xdf, 0xa1, 0x20, 0x74, 0x20, 0x8c, 0x55, 0x51, 0x03,
+    0xdc, 0xed, 0x62, 0x46, 0xf4, 0xe9, 0x8c, 0xf2, 0x7f, 0xcf, 0xf2, 0xab, 0xb3, 0xc8, 0x85, 0x36,
+    0x02, 0x13, 0x20, 0x82, 0xc7, 0x9c, 0x7a, 0xf5, 0xaa, 0xd3, 0x4b, 0x11, 0x84, 0x89, 0x12, 0x32,
+    0xca, 0xc5, 0x94, 0xab, 0xf3, 0x9c, 0x7a, 0xfd, 0x45, 0x51, 0x95, 0xe1, 0x78, 0xc7, 0x90, 0xac,
+    0x64, 0xc8, 0x24, 0x0e, 0xa0, 0xe7, 0x27, 0xad, 0x38, 0xc9, 0x12, 0x84, 0x47, 0xc8, 0x63, 0x93,
+    0x80, 0x7b, 0x62, 0xb3, 0xef, 0x95, 0x4c, 0xcf, 0xe6, 0x29, 0x60, 0xec, 0x0a, 0x90, 0x3a, 0x7b,
+    0x56, 0xa5, 0xbd, 0x80, 0xb6, 0xb6, 0x0c, 0x8f, 0xba, 0x72, 0xbc, 0x72, 0x4f, 0x7e, 0x98, 0xab,
+    0xb6, 0x0f, 0x3a, 0x2f, 0x96, 0x63, 0x1c, 0x1f, 0xbc, 0x07, 0x3f, 0xe7, 0xa5, 0x17, 0xb8, 0x92,
+    0x51, 0x2e, 0xe5, 0x3c, 0x60, 0x0c, 0xf2, 0x41, 0xea, 0x4f, 0xe9, 0x50, 0x69, 0xd7, 0x81, 0xa4,
+    0x11, 0x46, 0xfb, 0x90, 0x1d, 0xa4, 0x03, 0xc0, 0xa8, 0xa4, 0xb2, 0xf3, 0xa5, 0x02, 0x3d, 0xa3,
+    0xae, 0x4e, 0x79, 0x18, 0xad, 0x68, 0xbc, 0xcb, 0x5d, 0x89, 0x09, 0xc9, 0x24, 0x71, 0x9e, 0x07,
+    0x3d, 0x7f, 0x2a, 0xb3, 0x7c, 0xef, 0x36, 0xc2, 0xdb, 0x18, 0xed, 0xc1, 0x60, 0x79, 0x5c, 0x1e,
+    0x49, 0xa1, 0x1a, 0x32, 0x0c, 0xe3, 0x28, 0xc9, 0xd3, 0x9f, 0xbc, 0x07, 0xbd, 0x32, 0xf2, 0x39,
+    0x64, 0xca, 0xb8, 0x53, 0x19, 0x1c, 0x12, 0x33, 0xd7, 0xaf, 0xd2, 0xb3, 0xda, 0x17, 0xf9, 0xbc,
+    0x90, 0xab, 0x83, 0xc6, 0x0e, 0x33, 0xeb, 0xfd, 0x6a, 0x8c, 0xd3, 0x18, 0x9e, 0x3c, 0x87, 0xcb,
+    0x29, 0xf9, 0x8f, 0x41, 0xf5, 0x03, 0xd6, 0xa9, 0x19, 0x9d, 0x2e, 0x19, 0xa6, 0x42, 0x63, 0x1d,
+    0x36, 0x93, 0xf5, 0xa9, 0x6d, 0xbc, 0xb9, 0x24, 0xc9, 0x51, 0xb8, 0xb6, 0x44, 0x98, 0xcf, 0xe0,
+    0x7b, 0x52, 0xdd, 0x12, 0xb8, 0x42, 0x8a, 0x23, 0x27, 0x8c, 0x1e, 0x84, 0xf5, 0xfe, 0x5c, 0x55,
+    0x59, 0xa3, 0x38, 0x0b, 0x1b, 0x97, 0xe3, 0x0a, 0xdc, 0x81, 0x8c, 0xd6, 0xd4, 0x16, 0xed, 0x70,
+    0x3c, 0xb9, 0x13, 0xe6, 0xd9, 0x8d, 0xcc, 0x7d, 0xc7, 0xf9, 0xe6, 0x8b, 0xed, 0xb0, 0xac, 0x41,
+    0x19, 0x8c, 0x83, 0x8f, 0x9b, 0x82, 0x0f, 0xa7, 0xe9, 0x48, 0x65, 0x50, 0x18, 0xc6, 0x48, 0x95,
+    0x87, 0x27, 0xb6, 0x71, 0xd2, 0xa3, 0x9e, 0xe0, 0x4a, 0xa9, 0x1a, 0xb6, 0xd9, 0x14, 0x01, 0xb4,
+    0x2e, 0x77, 0x11, 0x4d, 0xd2, 0xa1, 0xfb, 0x47, 0x96, 0x91, 0x6c, 0x52, 0x09, 0xc9, 0x55, 0x03,
+    0xfc, 0xfa, 0xd6, 0xd4, 0xf0, 0x4b, 0xbc, 0xed, 0x50, 0x87, 0x04, 0x31, 0x1c, 0xe4, 0xff, 0x00,
+    0x87, 0x15, 0x04, 0xb7, 0x2a, 0xf7, 0x0d, 0x94, 0x20, 0x28, 0xe0, 0x28, 0xcf, 0xbd, 0x0d, 0x21,
+    0xf2, 0x91, 0x9a, 0x35, 0xda, 0xc7, 0x39, 0x66, 0xef, 0xfe, 0x73, 0x4d, 0xd4, 0x24, 0x13, 0x5b,
+    0x91, 0x09, 0x6d, 0xc9, 0xf3, 0x12, 0x1b, 0xa7, 0x6a, 0xaf, 0x14, 0xcc, 0xaa, 0x51, 0xce, 0xe2,
+    0xab, 0x93, 0x93, 0x9c, 0xfb, 0x8f, 0x6a, 0x6d, 0xb0, 0x98, 0x48, 0xf7, 0x12, 0xa9, 0x64, 0x39,
+    0xd8, 0xb8, 0xed, 0xd3, 0x3e, 0xd5, 0x52, 0xfe, 0xc6, 0x48, 0xd9, 0x81, 0x7e, 0x19, 0x77, 0x6e,
+    0xcf, 0x20, 0x56, 0x55, 0xaa, 0x12, 0xac, 0x99, 0x2e, 0xc0, 0xed, 0xda, 0x06, 0x32, 0x31, 0xda,
+    0xb5, 0xad, 0x76, 0x33, 0x00, 0x01, 0x65, 0x24, 0x95, 0x2b, 0xd3, 0x3e, 0x98, 0xa9, 0xee, 0x96,
+    0x38, 0x78, 0xc6, 0x09, 0xc8, 0x0c, 0x09, 0x3c, 0x8a, 0x6d, 0xac, 0x48, 0x36, 0xc8, 0xc1, 0xf0,
+    0x4f, 0x0d, 0x93, 0xc9, 0xef, 0xc7, 0xe5, 0xf9, 0xd5, 0xa8, 0xa2, 0x26, 0xcf, 0x3e, 0x60, 0x0e,
+    0x8c, 0x30, 0x41, 0xe4, 0xfa, 0x62, 0xb3, 0xb5, 0x37, 0xfb, 0x5b, 0xee, 0x3b, 0x81, 0x53, 0x8e,
+    0x47, 0x20, 0x7a, 0xd5, 0x24, 0x7d, 0xae, 0x65, 0x8c, 0x95, 0xd8, 0x78, 0x27, 0xa9, 0xf5, 0xcf,
+    0xe3, 0x8a, 0xb1, 0xa5, 0xb3, 0x5c, 0x5d, 0xf9, 0xb7, 0x27, 0xe6, 0x56, 0xca, 0xe3, 0xaa, 0xd6,
+    0xd4, 0xb0, 0xc5, 0x6a, 0x4c, 0xb0, 0x48, 0xa9, 0xc6, 0x59, 0x54, 0x73, 0x93, 0xd0, 0x8e, 0xff,
+    0x00, 0x8d, 0x58, 0x8a, 0xec, 0x3c, 0x11, 0x96, 0x66, 0x50, 0x48, 0x20, 0x0c, 0x65, 0xff, 0x00,
+    0x1f, 0x4a, 0xa0, 0xd3, 0x79, 0x52, 0xee, 0x40, 0x19, 0x64, 0x18, 0xc9, 0x00, 0x75, 0xfa, 0x51,
+    0xe7, 0xb1, 0x81, 0xd4, 0x32, 0x15, 0x3f, 0xbc, 0x24, 0xf3, 0x8a, 0xad, 0x23, 0x2e, 0x5a, 0x46,
+    0x8c, 0x07, 0x23, 0xa7, 0x40, 0x79, 0xfd, 0x7a, 0xe2, 0xad, 0xd8, 0x59, 0xa4, 0xe9, 0x24, 0xce,
+    0x1c, 0x00, 0x33, 0xd8, 0x54, 0xac, 0x98, 0x56, 0xda, 0x73, 0x1f, 0x5e, 0xbc, 0xae, 0x7f, 0xfa,
+    0xd5, 0x56, 0xf4, 0xcd, 0x1c, 0x00, 0x46, 0x03, 0xae, 0x70, 0x38, 0xe4, 0x1c, 0x77, 0xac, 0xeb,
+    0xc0, 0xa2, 0x0d, 0xe6, 0x4d, 0xcc, 0x98, 0xce, 0x3e, 0x50, 0x09, 0xe9, 0x4f, 0xb1, 0x9f, 0x7c,
+    0x84, 0x21, 0xf9, 0xca, 0x80, 0x33, 0x90, 0x09, 0xc7, 0x5e, 0x3e, 0x95, 0x66, 0x4d, 0xb7, 0x30,
+    0xc0, 0x5e, 0x26, 0xdd, 0x82, 0x03, 0x37, 0x04, 0x1e, 0x79, 0xff, 0x00, 0xeb, 0x52, 0xe9, 0xd3,
+    0x32, 0xb9, 0xb7, 0x91, 0x80, 0xcf, 0x18, 0x23, 0xbe, 0x7b, 0x0a, 0x92, 0xf5, 0x0c, 0x4a, 0xc2,
+    0x36, 0xc0, 0x2d, 0xf9, 0xf0, 0x2b, 0x9c, 0xd5, 0x7c, 0xe7, 0x99, 0x44, 0x2a, 0x71, 0x8d, 0xcd,
+    0xb7, 0x8e, 0x4d, 0x41, 0x96, 0x8d, 0x84, 0x68, 0xad, 0xc1, 0xc2, 0xb1, 0x18, 0xf7, 0xab, 0x16,
+    0x72, 0x3c, 0x8c, 0xcf, 0x00, 0x6d, 0x83, 0x0a, 0xca, 0xc7, 0x1b, 0xb3, 0xe9, 0xde, 0xb7, 0x1e,
+    0xee, 0x3f, 0x29, 0x5a, 0xe1, 0xd1, 0xa5, 0x1c, 0x14, 0xc7, 0x04, 0x63, 0xdb, 0xf2, 0xfc, 0x2a,
+    0x44, 0xd4, 0x08, 0x75, 0x58, 0xa3, 0x0f, 0x1f, 0x19, 0xdc, 0x31, 0xdb, 0xa8, 0x3e, 0xde, 0xd5,
+    0x6a, 0xde, 0xc6, 0x49, 0xb6, 0x85, 0x4c, 0xe4, 0x05, 0x52, 0x1b, 0xb7, 0xd0, 0x55, 0x39, 0x2d,
+    0xcd, 0xb4, 0x93, 0x46, 0x76, 0x97, 0xe4, 0x72, 0x31, 0x95, 0xa8, 0x11, 0x95, 0xa4, 0x0a, 0xac,
+    0x58, 0x0c, 0x9c, 0x11, 0x8c, 0x1f, 0x4a, 0xd8, 0xd2, 0x24, 0x2a, 0xb8, 0xbb, 0x66, 0x26, 0x33,
+    0x82, 0x07, 0x42, 0x4d, 0x4f, 0x0b, 0xac, 0x8e, 0xcc, 0xad, 0x95, 0x07, 0x04, 0x1f, 0x7f, 0x4f,
+    0xf0, 0xa6, 0xc8, 0x63, 0x40, 0xa6, 0x37, 0x04, 0xb7, 0x07, 0x3d, 0x7d, 0xb8, 0xf4, 0xac, 0xcb,
+    0xf7, 0x8c, 0x15, 0x02, 0x30, 0xad, 0x29, 0x27, 0x03, 0xa1, 0xff, 0x00, 0x0a, 0x8e, 0xda, 0x13,
+    0x19, 0xdc, 0xeb, 0x1f, 0xcd, 0x92, 0x08, 0xef, 0xff, 0x00, 0xd7, 0xa9, 0x4c, 0x58, 0xc1, 0x47,
+    0xca, 0x2b, 0x03, 0xb9, 0xb9, 0x00, 0x1e, 0xb9, 0xcf, 0x4e, 0x7d, 0x28, 0xba, 0x28, 0x2e, 0x1b,
+    0xc9, 0xc0, 0x20, 0xfd, 0xe2, 0x7f, 0x3f, 0xd7, 0x8a, 0x84, 0x8b, 0x85, 0x8a, 0x49, 0xf7, 0x96,
+    0x24, 0x0c, 0x21, 0xc6, 0x40, 0xe9, 0x8a, 0xcb, 0x8e, 0x63, 0x38, 0x3b, 0xc6, 0xc2, 0x1b, 0x96,
+    0x2d, 0xd3, 0xd3, 0x9f, 0xc3, 0xa5, 0x37, 0xc8, 0x12, 0xc4, 0x01, 0x62, 0xc0, 0x13, 0x8d, 0xbf,
+    0x41, 0xfc, 0xce, 0x6a, 0x0b, 0x67, 0xb8, 0x86, 0x5d, 0x82, 0x12, 0x91, 0x2b, 0x73, 0x93, 0xdb,
+    0xad, 0x4d, 0x74, 0x92, 0xbb, 0xfd, 0xa6, 0x14, 0x0f, 0x9c, 0x71, 0xd8, 0x7b, 0x55, 0xdb, 0x72,
+    0xc1, 0x82, 0x00, 0x71, 0xd0, 0x83, 0xd0, 0x7b, 0xfa, 0xf7, 0xaf, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_burst_1[2762] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x60,
+    0x00, 0x80, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xe9, 0xc6, 0xa0, 0x96, 0x36, 0x0d, 0x85, 0x11,
+    0xc7, 0x8e, 0xfd, 0x4f, 0xe1, 0x5c, 0x3e, 0xa5, 0xa8, 0x9b, 0xfb, 0xb0, 0x9b, 0x0e, 0xce, 0x84,
+    0xb1, 0xe6, 0xae, 0xc4, 0x6c, 0xad, 0x23, 0x50, 0xcc, 0x32, 0xc3, 0xee, 0xa0, 0xa8, 0x5a, 0x74,
+    0x77, 0x3b, 0x89, 0x45, 0x27, 0x1b, 0x49, 0xe6, 0xb6, 0x34, 0xeb, 0x39, 0x24, 0x40, 0xd2, 0x92,
+    0x23, 0x1d, 0x2a, 0x3b, 0xab, 0x19, 0xd9, 0x9b, 0xec, 0xea, 0xee, 0x3a, 0xf1, 0x9c, 0x56, 0x52,
+    0xdb, 0x1b, 0x36, 0xdf, 0xfb, 0xb5, 0x66, 0x3d, 0xfe, 0x63, 0x9f, 0x61, 0x52, 0x49, 0x23, 0x72,
+    0xf7, 0x04, 0xa2, 0xf6, 0xcf, 0xde, 0x3f, 0x85, 0x61, 0x6a, 0xda, 0xad, 0xc4, 0xcb, 0xe5, 0x59,
+    0x29, 0x55, 0x27, 0xaf, 0x53, 0x52, 0xe8, 0xb6, 0x88, 0xb2, 0xac, 0x97, 0xae, 0x4b, 0xfd, 0x79,
+    0xae, 0x83, 0x51, 0x78, 0x8d, 0xa9, 0x5b, 0x78, 0xd7, 0x6f, 0x42, 0xc4, 0x67, 0xff, 0x00, 0xd7,
+    0x5c, 0x84, 0xfa, 0x55, 0xcd, 0xe4, 0x8d, 0xe5, 0x5b, 0x3e, 0x01, 0xfb, 0xcf, 0xd3, 0xf2, 0xa7,
+    0xdb, 0x78, 0x76, 0x55, 0x0d, 0x24, 0xea, 0xf2, 0x01, 0xed, 0xd2, 0xad, 0x9d, 0x23, 0xcd, 0x65,
+    0x11, 0xa6, 0xc0, 0x3a, 0xe7, 0x8c, 0x55, 0xbb, 0x6d, 0x26, 0x49, 0x18, 0xad, 0xbd, 0xbb, 0x73,
+    0xd6, 0x42, 0x3f, 0x95, 0x69, 0x69, 0xfa, 0x2c, 0x76, 0x73, 0x03, 0x23, 0x92, 0xd9, 0xe7, 0x9c,
+    0xd4, 0x57, 0xb3, 0xdc, 0xde, 0x41, 0x87, 0x20, 0x0f, 0xe5, 0x54, 0x12, 0xc1, 0x20, 0x8c, 0xcb,
+    0x82, 0xef, 0xd4, 0x93, 0x55, 0x23, 0x90, 0x4b, 0x74, 0x00, 0x62, 0x64, 0x27, 0xa2, 0x8e, 0x7f,
+    0xfa, 0xd5, 0xd6, 0x68, 0xfa, 0x40, 0x9a, 0x65, 0x73, 0x06, 0x1b, 0x20, 0x82, 0xd5, 0xd5, 0x24,
+    0x51, 0x5b, 0xed, 0xf3, 0x55, 0xa5, 0x61, 0xd1, 0x40, 0xc2, 0x8a, 0x5b, 0xbb, 0xc8, 0x96, 0x07,
+    0x59, 0xa4, 0x58, 0xd0, 0x71, 0xb1, 0x46, 0x05, 0x73, 0x1a, 0xb5, 0xe5, 0x9d, 0xa2, 0x99, 0x23,
+    0x23, 0x3d, 0x8f, 0x52, 0x6b, 0x06, 0x2b, 0x6b, 0xbd, 0x45, 0x8c, 0xc5, 0x48, 0x8b, 0x3c, 0x13,
+    0xc7, 0x1f, 0x4a, 0xa5, 0xa8, 0x41, 0x2c, 0x64, 0x2c, 0x51, 0xed, 0x03, 0xb9, 0xfe, 0x75, 0x77,
+    0xc3, 0xda, 0x4d, 0xc3, 0x4c, 0x25, 0xbc, 0x4c, 0xa1, 0x3c, 0x17, 0x38, 0xaf, 0x45, 0xb1, 0xb1,
+    0xb2, 0x8d, 0x57, 0xce, 0xf2, 0x80, 0xe3, 0xe5, 0x1c, 0xd5, 0x97, 0xfe, 0xce, 0x69, 0x3c, 0xb8,
+    0xd5, 0x76, 0xf4, 0x00, 0x0a, 0xa3, 0x7b, 0xfd, 0x9f, 0x0f, 0xc8, 0x0a, 0x37, 0x72, 0x00, 0xe0,
+    0x55, 0x6b, 0x5b, 0x6b, 0x39, 0xee, 0x55, 0x99, 0x57, 0x1e, 0xac, 0x39, 0xfc, 0xbf, 0xc6, 0xad,
+    0x6a, 0x52, 0xdb, 0x42, 0x9e, 0x5c, 0x2d, 0xb5, 0x71, 0x8c, 0xaf, 0x53, 0x5c, 0x94, 0xfa, 0x84,
+    0x70, 0xc8, 0xc2, 0x05, 0x2f, 0x26, 0x7d, 0x73, 0x8a, 0xca, 0x79, 0x65, 0xf3, 0x17, 0x70, 0x2c,
+    0x3b, 0x06, 0x1c, 0x7e, 0x5d, 0xea, 0xc1, 0x82, 0xe6, 0xe4, 0x10, 0xfc, 0x2f, 0xa6, 0x2a, 0xce,
+    0x8f, 0xa2, 0x5d, 0x49, 0x74, 0x16, 0xda, 0x05, 0x41, 0xd4, 0xb1, 0x1c, 0x9a, 0xef, 0x34, 0xfd,
+    0x36, 0x6b, 0x64, 0x28, 0xe7, 0x67, 0xa9, 0x23, 0x92, 0x69, 0xda, 0x9d, 0x9d, 0xd1, 0xb6, 0x06,
+    0x35, 0xdb, 0x80, 0x7e, 0x6c, 0x72, 0x6b, 0x89, 0xbc, 0xd0, 0xb5, 0x3b, 0x87, 0x69, 0x64, 0x90,
+    0xa2, 0xff, 0x00, 0xb4, 0x7a, 0x7e, 0x15, 0xa1, 0xe1, 0xbf, 0x08, 0x47, 0x77, 0x7e, 0x86, 0xf6,
+    0x72, 0xea, 0x1b, 0x3f, 0x36, 0x32, 0x7e, 0x8b, 0xda, 0xbd, 0x6a, 0x0f, 0x0b, 0x59, 0x79, 0x2b,
+    0x14, 0x31, 0x80, 0x00, 0xea, 0xc0, 0x13, 0x58, 0xf7, 0xbe, 0x1a, 0xd3, 0x6d, 0xa4, 0x72, 0xe0,
+    0x49, 0x31, 0xe9, 0x95, 0xc8, 0x15, 0x9a, 0xda, 0x15, 0xb4, 0xe8, 0x72, 0x5e, 0x43, 0x9c, 0x6d,
+    0x4e, 0x07, 0xe7, 0x54, 0x75, 0x4b, 0x08, 0xed, 0x17, 0x62, 0x00, 0x9e, 0xbe, 0xc2, 0xb9, 0xd9,
+    0x36, 0x89, 0x36, 0x46, 0xcc, 0xf9, 0xeb, 0x83, 0xfd, 0x69, 0x1a, 0xd9, 0x84, 0x67, 0x73, 0x24,
+    0x6b, 0xea, 0x3a, 0x8a, 0x48, 0xa4, 0x86, 0xd5, 0x48, 0x81, 0x24, 0x96, 0x4c, 0xf3, 0x9a, 0xcc,
+    0xb9, 0xba, 0x9a, 0xe6, 0x52, 0x87, 0xbf, 0xf0, 0xc6, 0x7a, 0xfd, 0x4f, 0x7a, 0x8a, 0x58, 0x7c,
+    0x94, 0xc8, 0x4d, 0xa7, 0x1c, 0x01, 0xda, 0xa4, 0x86, 0x4b, 0x40, 0x16, 0x59, 0xd9, 0x89, 0x3c,
+    0xe0, 0x0e, 0x6a, 0xdd, 0xbe, 0xac, 0x27, 0x95, 0x22, 0x86, 0x31, 0x6f, 0x0f, 0x4c, 0x81, 0x96,
+    0x35, 0xda, 0xd9, 0x5e, 0x9b, 0x5b, 0x4c, 0x5a, 0xc4, 0x22, 0x04, 0x72, 0xe7, 0x97, 0x6a, 0xb1,
+    0xa4, 0xc7, 0x79, 0x79, 0x28, 0x91, 0x95, 0x96, 0x25, 0x6c, 0x82, 0xdd, 0x4d, 0x74, 0x13, 0x41,
+    0xbc, 0x04, 0x91, 0xc6, 0x07, 0x6c, 0xf5, 0xaa, 0x9a, 0x96, 0x9f, 0x1b, 0xc6, 0x55, 0x48, 0x03,
+    0x1d, 0x00, 0xe6, 0xab, 0xe9, 0x36, 0x30, 0xdb, 0x5c, 0x29, 0x89, 0x94, 0x7c, 0xdc, 0x9a, 0xef,
+    0x2d, 0x12, 0x31, 0x11, 0xc4, 0xca, 0x58, 0xfd, 0xec, 0x74, 0xac, 0x9b, 0xfb, 0x4b, 0x7f, 0x30,
+    0xb4, 0xac, 0x24, 0x73, 0xfc, 0x3d, 0x07, 0xff, 0x00, 0x5e, 0xb1, 0x75, 0x5b, 0xcf, 0x22, 0x12,
+    0xb0, 0x2a, 0xa2, 0x8f, 0xe2, 0xc6, 0x00, 0xaf, 0x38, 0xf1, 0x0e, 0xb1, 0x1a, 0x4a, 0x4b, 0xc8,
+    0x64, 0x23, 0x39, 0xc9, 0xc2, 0xff, 0x00, 0xf5, 0xeb, 0x9b, 0xb1, 0xd5, 0xbe, 0xdd, 0x72, 0xde,
+    0x5b, 0x12, 0xa0, 0xf5, 0x51, 0x80, 0x2b, 0xa7, 0xb1, 0x96, 0x03, 0x17, 0xef, 0x1c, 0x70, 0x79,
+    0x24, 0xff, 0x00, 0x2a, 0x76, 0xa9, 0x73, 0x6c, 0xb6, 0xde, 0x5c, 0x28, 0x76, 0x81, 0x92, 0x40,
+    0xeb, 0x5c, 0xe4, 0x53, 0xbc, 0x93, 0x91, 0x00, 0x09, 0x19, 0xe0, 0xb9, 0xa7, 0xdd, 0x4f, 0x04,
+    0x7d, 0x64, 0x05, 0x87, 0x73, 0xd7, 0x3e, 0xc2, 0x8d, 0x3e, 0x2f, 0xb5, 0xc6, 0x18, 0x00, 0x88,
+    0x4f, 0x27, 0x15, 0xd2, 0x68, 0x1a, 0x54, 0x06, 0xf1, 0x42, 0xa8, 0xf6, 0x63, 0xcb, 0x1f, 0xc2,
+    0xbd, 0x3b, 0x4f, 0xd0, 0xe3, 0x30, 0xa9, 0x65, 0x52, 0xa0, 0x74, 0xf4, 0xfa, 0x9a, 0x75, 0xf7,
+    0x97, 0x04, 0x44, 0xc6, 0x40, 0x55, 0xea, 0xc4, 0x71, 0xf8, 0x0e, 0xf5, 0xc4, 0x6a, 0xba, 0xec,
+    0xb2, 0x5d, 0x88, 0xad, 0x43, 0x1e, 0xc5, 0xba, 0x1f, 0x7e, 0x6a, 0xbe, 0xab, 0xaa, 0x4b, 0x69,
+    0x64, 0x55, 0xe5, 0x22, 0x42, 0x33, 0xb1, 0x79, 0x27, 0xeb, 0xff, 0x00, 0xd7, 0xac, 0xef, 0x0f,
+    0x4f, 0x2b, 0xdc, 0x89, 0xaf, 0xee, 0x08, 0x5e, 0xd1, 0x29, 0xe7, 0x1e, 0xe6, 0xba, 0x8b, 0xcf,
+    0x1a, 0xda, 0xda, 0x21, 0x8e, 0x19, 0x51, 0x4f, 0x4c, 0x9e, 0x76, 0xd5, 0x48, 0x7c, 0x69, 0x6d,
+    0x23, 0x1f, 0x29, 0x84, 0x8e, 0x3a, 0xb1, 0xaa, 0x1a, 0xbf, 0x88, 0xed, 0xae, 0x21, 0x61, 0x34,
+    0x8a, 0x47, 0xf7, 0x54, 0xff, 0x00, 0x5a, 0xf3, 0xbd, 0x75, 0xa1, 0xbd, 0x90, 0x16, 0x7e, 0x33,
+    0xc4, 0x6a, 0x78, 0xac, 0xab, 0x51, 0x20, 0x91, 0x63, 0x89, 0x8e, 0xdc, 0xfd, 0xd4, 0x1c, 0x0a,
+    0xe9, 0xb4, 0xd4, 0x16, 0xf8, 0x37, 0x52, 0x86, 0x3e, 0x9d, 0xf1, 0x56, 0x2f, 0x66, 0x7b, 0x84,
+    0x28, 0x31, 0x14, 0x23, 0xbb, 0x0a, 0xc4, 0xba, 0xbc, 0x8e, 0xdd, 0x1b, 0xcb, 0x1b, 0x80, 0xff,
+    0x00, 0x96, 0x8c, 0x30, 0x3f, 0x01, 0x58, 0x76, 0xf7, 0xd1, 0xb5, 0xd9, 0x77, 0x62, 0xdc, 0xf5,
+    0xae, 0xb7, 0xed, 0xcb, 0x0d, 0xb4, 0x71, 0x49, 0x36, 0xde, 0xc1, 0x54, 0x72, 0x4f, 0xd3, 0xad,
+    0x75, 0x5e, 0x10, 0xb8, 0xfd, 0xea, 0x0d, 0x8c, 0x5c, 0xf4, 0x07, 0x96, 0x35, 0xea, 0x16, 0xf2,
+    0xcc, 0x50, 0x07, 0xfb, 0xbf, 0xdc, 0x15, 0x47, 0x56, 0x8e, 0x56, 0x40, 0xaa, 0x49, 0xfa, 0xf6,
+    0xfa, 0xd7, 0x34, 0xda, 0x1c, 0x8a, 0xed, 0x3b, 0xbe, 0x14, 0x0e, 0xb8, 0xc7, 0x3f, 0xe7, 0xd2,
+    0xb8, 0x5f, 0x16, 0xce, 0xf0, 0xb3, 0x6c, 0x62, 0x10, 0xf5, 0x76, 0xe3, 0x8a, 0xe1, 0x24, 0xd6,
+    0xae, 0xf7, 0x18, 0xe1, 0x92, 0x40, 0x3a, 0x6e, 0xcf, 0x5f, 0xc2, 0xa1, 0x36, 0xd7, 0x92, 0x29,
+    0x9a, 0x79, 0x4e, 0x31, 0xc0, 0x2d, 0xd6, 0xae, 0x59, 0x5c, 0x18, 0x22, 0x26, 0x49, 0x1b, 0x03,
+    0xa0, 0x27, 0xbf, 0xb5, 0x67, 0xea, 0xb7, 0x57, 0x52, 0x0c, 0xac, 0x8d, 0x1a, 0x1e, 0x98, 0xe5,
+    0x9a, 0xa8, 0x59, 0xa4, 0xce, 0xe4, 0xcd, 0x23, 0x2a, 0x8e, 0x48, 0xcf, 0x3f, 0x8d, 0x6f, 0xda,
+    0xde, 0x04, 0x84, 0xad, 0xb8, 0x70, 0x7b, 0x93, 0xde, 0xba, 0x0d, 0x2b, 0x3c, 0x34, 0xcd, 0x8c,
+    0x0e, 0x30, 0x32, 0x7f, 0x1a, 0xbb, 0xa8, 0x5d, 0xc2, 0x23, 0xce, 0x53, 0x81, 0xf7, 0x9b, 0x9f,
+    0xca, 0xb9, 0xb9, 0xad, 0x8e, 0xa6, 0xe7, 0x1b, 0xdc, 0x03, 0xdf, 0xa7, 0xe5, 0x4d, 0xb7, 0xd3,
+    0xd2, 0x39, 0x70, 0x63, 0x56, 0x61, 0xc9, 0x67, 0x38, 0x51, 0x4d, 0xb4, 0x32, 0xdc, 0x5c, 0x46,
+    0x22, 0x05, 0x99, 0x8e, 0x0e, 0x3a, 0xe2, 0xbd, 0x4f, 0xc2, 0x91, 0xc5, 0xa6, 0xc6, 0x1e, 0xe9,
+    0x96, 0x16, 0xc7, 0x73, 0x96, 0x35, 0xd8, 0x41, 0xaf, 0x5b, 0xc3, 0x06, 0xf5, 0xdd, 0x27, 0xa1,
+    0x3c, 0x67, 0xf1, 0xaa, 0x10, 0x6a, 0xcd, 0x79, 0x70, 0x79, 0xfd, 0xd8, 0xe8, 0x9d, 0x14, 0x7d,
+    0x6a, 0x6d, 0x62, 0xf9, 0x63, 0xb6, 0xdd, 0x24, 0x81, 0x97, 0x19, 0x04, 0xf0, 0x3f, 0x01, 0x5e,
+    0x61, 0xe2, 0x77, 0x8e, 0xf6, 0x43, 0x96, 0xde, 0x7f, 0x45, 0xac, 0x2b, 0x1d, 0x1a, 0x38, 0xe4,
+    0x6b, 0x87, 0x62, 0xf9, 0xe8, 0x71, 0xc0, 0xfa, 0x55, 0x7d, 0x43, 0x68, 0x72, 0x21, 0x57, 0x38,
+    0x1c, 0x67, 0xfc, 0xf1, 0x58, 0x2b, 0x24, 0x8c, 0xfb, 0x55, 0x4b, 0x12, 0xd8, 0x38, 0xfe, 0xa6,
+    0xb6, 0xec, 0xec, 0x60, 0x41, 0xe6, 0x5c, 0xbe, 0xe7, 0xfe, 0xe2, 0xf5, 0xac, 0xcd, 0x4a, 0xe2,
+    0x08, 0xdd, 0x96, 0xde, 0x35, 0xdc, 0x46, 0x00, 0x07, 0x81, 0xf5, 0xa9, 0xb4, 0xb4, 0x8b, 0x76,
+    0xfb, 0xb9, 0x43, 0xbe, 0x38, 0x5c, 0xe0, 0x0f, 0xf1, 0xae, 0x96, 0xce, 0xdd, 0xae, 0x19, 0x52,
+    0x3c, 0x94, 0x3d, 0x38, 0xc7, 0xe4, 0x3f, 0xc6, 0x9f, 0xa9, 0xd8, 0x25, 0xa6, 0x1a, 0x46, 0xdb,
+    0xe9, 0x9e, 0x4d, 0x43, 0x6c, 0x65, 0xd8, 0xcb, 0x6e, 0xbe, 0x52, 0x63, 0x25, 0xdb, 0xa9, 0xac,
+    0x8b, 0xa9, 0x0c, 0x4e, 0x48, 0x24, 0xb7, 0xf7, 0x98, 0x8c, 0x0f, 0xa5, 0x76, 0x9e, 0x1c, 0xf0,
+    0xdb, 0xbc, 0xd1, 0xec, 0xc1, 0x75, 0xea, 0x4f, 0x45, 0xae, 0x9a, 0xef, 0x45, 0xb6, 0xb3, 0x01,
+    0xe7, 0x95, 0xa5, 0x90, 0x75, 0xcf, 0x41, 0xf4, 0xaa, 0xca, 0x8d, 0x38, 0xda, 0x3e, 0x54, 0x03,
+    0x02, 0xac, 0xca, 0xf1, 0x69, 0x56, 0xfb, 0x99, 0x83, 0x37, 0xf0, 0xa9, 0x3c, 0x8f, 0xad, 0x71,
+    0xda, 0xae, 0xad, 0x35, 0xf4, 0xed, 0x9d, 0xe7, 0xb0, 0x04, 0xf0, 0x2b, 0x3a, 0xd6, 0xcd, 0xa4,
+    0x9f, 0x75, 0xc3, 0x92, 0xa7, 0xf2, 0x1f, 0x85, 0x6a, 0xcd, 0x34, 0x10, 0x20, 0x40, 0x46, 0xde,
+    0x84, 0xf5, 0x35, 0x8b, 0x7d, 0x71, 0x64, 0x9c, 0x17, 0x19, 0x3c, 0xe3, 0x19, 0xcd, 0x64, 0xbd,
+    0xcc, 0x46, 0x53, 0x15, 0xb4, 0x65, 0x89, 0x18, 0xf9, 0x47, 0x4f, 0xc7, 0xb5, 0x31, 0xae, 0x62,
+    0x86, 0x37, 0x19, 0x0e, 0xe7, 0xf8, 0x13, 0xfa, 0x9a, 0xc3, 0xb8, 0x82, 0x5b, 0xd9, 0x40, 0x83,
+    0x25, 0xbb, 0x05, 0xe8, 0x2b, 0xa4, 0xd2, 0x74, 0x94, 0xb4, 0x8d, 0x65, 0xb8, 0x1b, 0xe6, 0x1f,
+    0x8d, 0x74, 0xfa, 0x74, 0xf2, 0x27, 0xcd, 0x1e, 0x23, 0x07, 0xbf, 0x56, 0x35, 0x16, 0xa2, 0xa0,
+    0xfc, 0xf3, 0x8c, 0x91, 0xc9, 0xef, 0x9f, 0xad, 0x66, 0x8b, 0xf4, 0xb8, 0x22, 0x28, 0x41, 0x7c,
+    0x75, 0xd8, 0x38, 0x14, 0xd9, 0x34, 0xc9, 0xae, 0x99, 0x76, 0x26, 0x46, 0x7a, 0x9e, 0xb5, 0xdf,
+    0xd8, 0xc9, 0x25, 0x8e, 0x63, 0x8f, 0x32, 0x30, 0x1c, 0x9e, 0xd4, 0xb2, 0xcc, 0x65, 0xc9, 0x9e,
+    0x4e, 0x4f, 0x7e, 0xc2, 0xa7, 0xb2, 0x95, 0x21, 0x42, 0x70, 0x58, 0x1e, 0xad, 0xdc, 0xd6, 0x6e,
+    0xa2, 0xa6, 0xec, 0x33, 0x1c, 0x44, 0x83, 0xa0, 0xcf, 0x24, 0xd6, 0x0d, 0xdc, 0x2c, 0x80, 0x85,
+    0x29, 0x12, 0x8e, 0xe6, 0xb0, 0x35, 0x1b, 0xe6, 0xb6, 0x42, 0x11, 0x8c, 0x8c, 0x41, 0xeb, 0xc0,
+    0xae, 0x7e, 0x6d, 0x46, 0x59, 0x4f, 0xef, 0xa7, 0x21, 0x87, 0xf0, 0xad, 0x5a, 0xb3, 0x74, 0x99,
+    0xb7, 0x18, 0xcb, 0x63, 0xb9, 0x39, 0xa7, 0xde, 0x34, 0xac, 0xbb, 0x2d, 0xc0, 0x41, 0xdc, 0x74,
+    0xfc, 0x6b, 0x3a, 0x18, 0x9b, 0xcc, 0x0a, 0x41, 0x76, 0x3d, 0xfa, 0x0a, 0xeb, 0x74, 0x1d, 0x21,
+    0xdb, 0x05, 0x55, 0x54, 0x91, 0x92, 0x58, 0x60, 0x7e, 0x15, 0xa5, 0x7a, 0x20, 0xb3, 0x52, 0x16,
+    0x40, 0xcf, 0xd0, 0xb9, 0xe8, 0x3e, 0x95, 0x46, 0x1d, 0x4e, 0x28, 0xce, 0x37, 0xee, 0x27, 0xbe,
+    0x70, 0x05, 0x52, 0xd5, 0x2f, 0x04, 0x88, 0x03, 0x9c, 0x44, 0xdd, 0x95, 0xba, 0xd5, 0x9d, 0x02,
+    0xd8, 0xcd, 0x22, 0xac, 0x48, 0x56, 0x22, 0x4f, 0x41, 0xd2, 0xbb, 0x31, 0xa7, 0x4b, 0xe4, 0xac,
+    0x56, 0xff, 0x00, 0x22, 0x9f, 0xbc, 0x72, 0x49, 0x35, 0x5a, 0x6d, 0x4c, 0x6e, 0xc0, 0x53, 0x18,
+    0x27, 0x84, 0x4e, 0x4f, 0xe2, 0x7a, 0xd4, 0xb1, 0xce, 0xce, 0xca, 0x64, 0x41, 0x1a, 0x8e, 0x46,
+    0xee, 0x7f, 0x4a, 0xa3, 0xa9, 0xea, 0x8e, 0x8d, 0xb2, 0x27, 0x3e, 0x9b, 0xb1, 0xda, 0xb2, 0xa4,
+    0xd4, 0x1a, 0x08, 0xcb, 0xef, 0x0c, 0xe4, 0xf0, 0x4f, 0x39, 0xa6, 0xa4, 0x57, 0x57, 0x85, 0x65,
+    0x90, 0x90, 0x47, 0x45, 0x3d, 0xbf, 0x0a, 0xc2, 0xd7, 0x74, 0xdb, 0x83, 0x92, 0xce, 0x15, 0xbb,
+    0x0f, 0xf1, 0xae, 0x66, 0x1b, 0x0f, 0xf4, 0x8f, 0x9c, 0x34, 0xb8, 0xfb, 0xd8, 0xe0, 0x7d, 0x6b,
+    0xaa, 0xd2, 0x22, 0x47, 0x01, 0x50, 0x02, 0x07, 0xf7, 0x46, 0x02, 0xff, 0x00, 0x8d, 0x68, 0xde,
+    0xc5, 0x6f, 0x04, 0x79, 0xc4, 0x6a, 0xc4, 0x64, 0xb7, 0x5a, 0x8b, 0x4d, 0xb4, 0x49, 0x1c, 0x48,
+    0x06, 0x58, 0x9e, 0xad, 0xfe, 0x15, 0xd0, 0x46, 0x0c, 0x11, 0x9f, 0x30, 0x84, 0x50, 0x38, 0x07,
+    0xaf, 0xe0, 0x2b, 0x8d, 0xd7, 0x67, 0xdf, 0x34, 0x87, 0xcd, 0xdb, 0x1e, 0x79, 0x62, 0x72, 0x4d,
+    0x73, 0xad, 0xa8, 0x2c, 0x03, 0x11, 0x0d, 0xcc, 0x4f, 0xde, 0x66, 0xc9, 0xad, 0x7d, 0x02, 0xd0,
+    0xdf, 0xce, 0xaf, 0x77, 0x29, 0xc6, 0x72, 0x17, 0x3f, 0xe7, 0x15, 0xe8, 0x96, 0xaf, 0x6f, 0x63,
+    0x6c, 0x17, 0x78, 0x41, 0x8c, 0x8d, 0xbc, 0x9f, 0xf1, 0xab, 0xf6, 0xda, 0x9a, 0x9d, 0xc5, 0x8b,
+    0x08, 0xc0, 0xe1, 0x17, 0xef, 0x3f, 0xe3, 0xda, 0xb9, 0xc8, 0xef, 0xd9, 0x23, 0xf9, 0x57, 0x32,
+    0x7f, 0x78, 0x8e, 0x94, 0xcb, 0x8d, 0x4c, 0x95, 0x25, 0x9b, 0x04, 0xf4, 0x24, 0xf5, 0xac, 0xf9,
+    0xe7, 0x24, 0xfc, 0xee, 0x5f, 0x3d, 0x37, 0x74, 0xad, 0x5d, 0x17, 0x48, 0x6b, 0x82, 0x27, 0x9b,
+    0x25, 0x47, 0x3f, 0x37, 0x1f, 0xfe, 0xaa, 0xd6, 0x9e, 0x26, 0x0d, 0x88, 0x06, 0x14, 0x77, 0x03,
+    0xf9, 0x57, 0x3f, 0xab, 0x24, 0x8c, 0x0c, 0x49, 0x16, 0x49, 0x39, 0xe7, 0x8f, 0xce, 0xb9, 0xbb,
+    0xcb, 0x76, 0xb7, 0x2c, 0x6e, 0x89, 0x73, 0xd8, 0x0e, 0x14, 0x7d, 0x7d, 0x69, 0xda, 0x55, 0xe1,
+    0x47, 0x0a, 0x55, 0x80, 0x27, 0xae, 0x30, 0x07, 0xe1, 0x5a, 0xb2, 0x16, 0x67, 0x12, 0xac, 0x79,
+    0x3d, 0x77, 0x48, 0x78, 0x1f, 0x41, 0x56, 0xac, 0xdd, 0xd8, 0x2b, 0x86, 0xda, 0x7a, 0x70, 0x3f,
+    0xa5, 0x3f, 0x57, 0x91, 0xbc, 0x8e, 0x5b, 0x6f, 0xb9, 0x39, 0x26, 0xbc, 0xc3, 0xc4, 0x0f, 0x79,
+    0x3c, 0x8d, 0x14, 0x45, 0x91, 0x07, 0x73, 0xd4, 0xd6, 0x42, 0x34, 0x96, 0xe0, 0xa0, 0xc8, 0x23,
+    0xab, 0xb1, 0xad, 0xbf, 0x0f, 0x6a, 0x17, 0x32, 0xcc, 0xa9, 0x12, 0x12, 0x38, 0xc9, 0xce, 0x05,
+    0x77, 0x31, 0x5f, 0xdb, 0x59, 0x20, 0x7b, 0xd9, 0xc3, 0x91, 0xd1, 0x07, 0x41, 0xfe, 0x35, 0x6e,
+    0xd7, 0xc4, 0x6b, 0x73, 0xb9, 0x2d, 0x22, 0x20, 0x7f, 0x79, 0xb8, 0x03, 0xfc, 0xfb, 0x55, 0xeb,
+    0x1d, 0x1a, 0xe2, 0xe9, 0x07, 0x97, 0x9e, 0x9c, 0x9c, 0x74, 0xff, 0x00, 0x0a, 0x87, 0x51, 0xd3,
+    0x3e, 0xc2, 0xa1, 0x8b, 0x2b, 0x38, 0xfb, 0xc7, 0xb5, 0x63, 0x89, 0x08, 0xb8, 0x1b, 0x10, 0xcb,
+    0x21, 0xe7, 0xd8, 0x57, 0x63, 0xa3, 0xb0, 0x11, 0x2c, 0xb7, 0x93, 0x02, 0x54, 0x60, 0x20, 0x38,
+    0x51, 0xfe, 0x35, 0xaa, 0x2e, 0x21, 0xba, 0x23, 0x61, 0x55, 0x41, 0xc6, 0x7b, 0x0a, 0x86, 0xef,
+    0xec, 0x31, 0xa3, 0x60, 0x02, 0xdd, 0x37, 0x77, 0xfc, 0xab, 0x90, 0xd6, 0xa4, 0xb7, 0x76, 0x65,
+    0x86, 0x32, 0xee, 0x3b, 0x0e, 0xb4, 0xcd, 0x37, 0x4d, 0x70, 0x82, 0x46, 0x55, 0x88, 0x0e, 0x79,
+    0x1f, 0xe7, 0x35, 0x7a, 0x3b, 0x4f, 0x34, 0xbe, 0x73, 0x81, 0xd5, 0xd8, 0xf4, 0xaa, 0xb7, 0x37,
+    0x71, 0x5a, 0xa1, 0x4b, 0x5c, 0x33, 0x93, 0x8d, 0xcd, 0xdf, 0xe9, 0x59, 0xf7, 0x5e, 0x6f, 0x96,
+    0x5e, 0xe5, 0x99, 0x98, 0x8e, 0x98, 0xe7, 0xff, 0x00, 0xad, 0x5c, 0xb5, 0xd9, 0x9e, 0x59, 0xc8,
+    0x45, 0x51, 0x1f, 0x72, 0x78, 0x03, 0xf1, 0xac, 0xeb, 0xab, 0x48, 0x30, 0x1a, 0x56, 0x66, 0x5c,
+    0xf0, 0x14, 0x60, 0x1a, 0x5b, 0x49, 0x2e, 0x9b, 0xfe, 0x3d, 0x20, 0x10, 0xc6, 0x38, 0x04, 0xf7,
+    0xa9, 0xd2, 0x0b, 0x89, 0x65, 0xda, 0xea, 0xce, 0xcb, 0xdc, 0xf4, 0xad, 0xfd, 0x25, 0x25, 0x8c,
+    0x6c, 0xc8, 0x27, 0x38, 0xc6, 0x3f, 0xce, 0x6b, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_burst_2[3310] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x60,
+    0x00, 0x80, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xea, 0x6d, 0x2f, 0x85, 0x8e, 0x9c, 0xdb, 0x61,
+    0x44, 0xda, 0x33, 0xfe, 0xd1, 0xfc, 0x39, 0xae, 0x0a, 0xe3, 0xc4, 0x1f, 0xda, 0x5a, 0xa3, 0x86,
+    0x8f, 0x69, 0x0d, 0x8c, 0x4a, 0x8d, 0x82, 0x3f, 0xef, 0x9a, 0xd2, 0x59, 0x34, 0x54, 0xb6, 0xda,
+    0xf2, 0x24, 0x77, 0x27, 0xfe, 0x79, 0xa7, 0x53, 0xf5, 0xaa, 0x37, 0x8d, 0x6f, 0x11, 0x85, 0xd9,
+    0x59, 0x13, 0xae, 0x49, 0xe4, 0xfe, 0x95, 0xd1, 0x5b, 0xe9, 0x10, 0xdd, 0x59, 0x7d, 0xa5, 0x64,
+    0x31, 0xb0, 0x19, 0x5c, 0x55, 0x6d, 0x47, 0x46, 0xbb, 0x9e, 0xdb, 0x10, 0x42, 0x67, 0x93, 0xea,
+    0x17, 0xf5, 0xac, 0xab, 0x6f, 0xb4, 0x5b, 0x93, 0x0d, 0xed, 0x9c, 0x48, 0x57, 0x80, 0x4b, 0x07,
+    0x6f, 0xeb, 0x53, 0x4b, 0x24, 0xe3, 0x60, 0x96, 0x59, 0x91, 0x3a, 0x8d, 0xe4, 0x10, 0x7f, 0x00,
+    0x38, 0xac, 0x1f, 0x10, 0xea, 0xf7, 0x6e, 0xc2, 0xda, 0x0b, 0x55, 0x31, 0x8e, 0x0c, 0x88, 0x49,
+    0x3f, 0x53, 0x4f, 0xf0, 0xf5, 0xa4, 0x72, 0x0f, 0x36, 0x76, 0x69, 0x18, 0xf5, 0x53, 0xc9, 0xae,
+    0x9b, 0x58, 0xbb, 0xd3, 0xa2, 0xd3, 0x04, 0x26, 0x08, 0x94, 0x9f, 0xe3, 0xdb, 0x96, 0xfc, 0xab,
+    0x85, 0x97, 0x4d, 0x92, 0x78, 0xdd, 0xad, 0x55, 0xa4, 0x41, 0xd7, 0xcc, 0x8c, 0x7e, 0x80, 0x8a,
+    0x76, 0x8d, 0xa5, 0xda, 0x49, 0x70, 0x0d, 0xcc, 0xd2, 0xac, 0x9c, 0xfc, 0xa5, 0x0a, 0x63, 0xf9,
+    0x0a, 0xb9, 0x79, 0x66, 0x90, 0xc8, 0xeb, 0x3b, 0x4d, 0xe4, 0x9e, 0x92, 0x83, 0xd3, 0xf3, 0xcd,
+    0x69, 0x5b, 0xe9, 0x51, 0x5d, 0x5b, 0x28, 0xd3, 0x9d, 0x98, 0xf7, 0x73, 0x1e, 0xd2, 0x7f, 0x51,
+    0x9a, 0xb9, 0x65, 0xa1, 0xc7, 0x17, 0xcd, 0x70, 0x92, 0x19, 0xc0, 0xfe, 0xe9, 0x35, 0x6a, 0xf2,
+    0xe6, 0x5b, 0xd8, 0x36, 0xa5, 0xe3, 0x46, 0x18, 0x74, 0x00, 0x7c, 0xbf, 0x85, 0x62, 0xdb, 0x58,
+    0x35, 0x92, 0xcb, 0x2d, 0xd3, 0x09, 0x5b, 0xaa, 0xbb, 0x6e, 0xff, 0x00, 0xf5, 0x55, 0x1d, 0x2a,
+    0xe6, 0x0b, 0x8b, 0xf7, 0x5b, 0xa4, 0x91, 0xb2, 0x78, 0x68, 0x81, 0x04, 0x7e, 0x42, 0xbb, 0x1d,
+    0x2f, 0x47, 0x33, 0x32, 0x85, 0x8a, 0x39, 0xd0, 0x73, 0x99, 0x1b, 0x24, 0x57, 0x4c, 0xe9, 0x05,
+    0xba, 0xa8, 0x7b, 0x5f, 0x33, 0x60, 0x19, 0x08, 0xc7, 0x68, 0xfa, 0xd5, 0xd9, 0xee, 0xec, 0xef,
+    0x2d, 0x55, 0x19, 0xed, 0xa3, 0x23, 0x80, 0x82, 0x42, 0xbf, 0xd7, 0x35, 0xca, 0x6a, 0xad, 0x6d,
+    0x6c, 0xb2, 0x13, 0x0a, 0x16, 0xe7, 0x69, 0xde, 0xc4, 0xff, 0x00, 0x3a, 0xe7, 0xac, 0xac, 0x6f,
+    0x6f, 0x64, 0x6b, 0xa9, 0x2c, 0xe6, 0x58, 0x14, 0x71, 0x2a, 0x07, 0xc1, 0x1f, 0x4a, 0xce, 0xd4,
+    0x21, 0xbf, 0x84, 0xc8, 0xf1, 0x58, 0x49, 0x22, 0xb7, 0x03, 0x11, 0x32, 0x93, 0xf8, 0x0a, 0x9f,
+    0xc3, 0xfa, 0x55, 0xc3, 0xdc, 0xa5, 0xc3, 0x5a, 0x5c, 0x44, 0xe0, 0xe4, 0xf9, 0xa8, 0xd8, 0xc7,
+    0xe3, 0x5e, 0xbb, 0x66, 0x9a, 0x7d, 0xfe, 0x9a, 0x16, 0x7b, 0x8b, 0x28, 0x24, 0x4e, 0xa3, 0x78,
+    0x27, 0x3f, 0x4c, 0xf1, 0x4e, 0x4b, 0x88, 0x96, 0x25, 0x8a, 0x3b, 0xb8, 0x8a, 0xc7, 0xfd, 0xc9,
+    0x50, 0x64, 0x7e, 0x35, 0x47, 0x54, 0x9f, 0x4a, 0xbc, 0x8b, 0x7a, 0xdf, 0x40, 0xf2, 0xaf, 0xf0,
+    0x87, 0xc9, 0x15, 0x4f, 0x48, 0x92, 0xce, 0xe5, 0x5a, 0x13, 0xa9, 0x04, 0x00, 0xe3, 0xf7, 0x8c,
+    0xa7, 0xf4, 0xab, 0x3a, 0xe3, 0x5a, 0xa5, 0x97, 0x95, 0x69, 0xa8, 0xa8, 0x6f, 0x58, 0xca, 0x9c,
+    0xfe, 0x44, 0x9a, 0xe1, 0xb5, 0x4d, 0x55, 0x6c, 0xa5, 0x89, 0x46, 0xd9, 0x9f, 0x23, 0x27, 0x19,
+    0x35, 0x9d, 0x72, 0xf7, 0xa9, 0x19, 0x60, 0xa8, 0xe0, 0x7d, 0xd5, 0xf3, 0x33, 0x8f, 0xcc, 0x66,
+    0xb6, 0x2c, 0x1a, 0xf3, 0x51, 0xd3, 0x5e, 0x29, 0xe3, 0x38, 0x03, 0x04, 0x79, 0x8a, 0x3f, 0x99,
+    0x15, 0x5f, 0xc3, 0x7e, 0x1b, 0xd5, 0x1e, 0xe1, 0xda, 0xc6, 0xdd, 0x63, 0x8f, 0x3c, 0xb3, 0xc8,
+    0x87, 0x3f, 0xad, 0x7a, 0x1e, 0x99, 0xa7, 0xeb, 0x36, 0x73, 0x20, 0x96, 0xdd, 0x0c, 0x7d, 0xd8,
+    0xc8, 0xa7, 0xf9, 0x93, 0x56, 0x75, 0x8d, 0x2a, 0xf2, 0x68, 0xa5, 0x90, 0x69, 0xf1, 0x61, 0x97,
+    0xae, 0xe5, 0x04, 0xfe, 0xb5, 0xe7, 0x17, 0x1e, 0x11, 0xd6, 0xda, 0x69, 0x2e, 0x1a, 0x35, 0x58,
+    0x41, 0x27, 0x6b, 0xb7, 0x3f, 0x90, 0x35, 0xa9, 0xe0, 0x9f, 0x0b, 0xc1, 0x7f, 0x7e, 0x4e, 0xa3,
+    0x23, 0x26, 0x38, 0xc1, 0x8d, 0xb3, 0xf8, 0x60, 0x57, 0xb2, 0xc3, 0xe1, 0x0d, 0x14, 0xe9, 0xab,
+    0x14, 0x28, 0xd1, 0xe0, 0x0f, 0x9b, 0x25, 0x4d, 0x73, 0x7a, 0x97, 0x86, 0xb4, 0x7b, 0x0b, 0x98,
+    0xe4, 0xde, 0xd2, 0x48, 0x3a, 0xaf, 0x98, 0xdf, 0xe3, 0x8a, 0xad, 0x75, 0xe1, 0x8d, 0x32, 0x69,
+    0x7c, 0xf1, 0x05, 0xcc, 0xa1, 0xc6, 0x4a, 0x89, 0x5b, 0x6f, 0xf3, 0xac, 0x9b, 0xad, 0x12, 0xc2,
+    0x0b, 0x57, 0x16, 0x90, 0x08, 0xa5, 0x1d, 0x89, 0x76, 0xfe, 0xb5, 0xce, 0xa5, 0xbf, 0xd9, 0x91,
+    0x96, 0x28, 0xa5, 0xde, 0x78, 0x25, 0x08, 0xda, 0x7f, 0x31, 0x9a, 0x7c, 0xf6, 0x61, 0xa0, 0x4c,
+    0x08, 0x6d, 0xe5, 0x23, 0xb3, 0x15, 0x6f, 0xe7, 0x51, 0xdb, 0x5c, 0x5b, 0xdb, 0xb1, 0x89, 0xed,
+    0x26, 0x9a, 0x5c, 0x67, 0xcc, 0xc6, 0x47, 0xfe, 0x85, 0x59, 0xd3, 0xdc, 0x4f, 0x75, 0x7d, 0x88,
+    0x59, 0x51, 0x07, 0xf0, 0x05, 0x3c, 0xfd, 0x68, 0xbd, 0x59, 0x40, 0x25, 0xe3, 0xb3, 0x6c, 0x7f,
+    0xbc, 0xac, 0x3f, 0x2a, 0x7a, 0xc9, 0x15, 0xad, 0xab, 0xcb, 0x3a, 0x4f, 0x3a, 0x38, 0xe1, 0x15,
+    0x8a, 0xfe, 0x80, 0x67, 0xf5, 0xa9, 0x74, 0xad, 0x72, 0x2b, 0xa8, 0x1a, 0xd6, 0x2d, 0x33, 0x6a,
+    0x67, 0xe6, 0xfd, 0xe1, 0x77, 0xc7, 0xd0, 0xd7, 0x73, 0xa6, 0xdd, 0x47, 0x63, 0xa4, 0xe3, 0x4f,
+    0xb0, 0x96, 0x05, 0x20, 0xee, 0x1b, 0xbe, 0x62, 0x7e, 0x84, 0x52, 0xe8, 0x42, 0xf2, 0xee, 0xfc,
+    0xbb, 0xc1, 0x30, 0x84, 0x9f, 0xe2, 0x20, 0x93, 0xf8, 0x62, 0xba, 0x6b, 0xf8, 0xe2, 0x65, 0x54,
+    0x90, 0xca, 0x8b, 0x80, 0x36, 0xb0, 0x38, 0xa3, 0x52, 0xd0, 0x2d, 0x6f, 0x34, 0x76, 0x16, 0xb2,
+    0xbc, 0x72, 0x73, 0xf7, 0x1f, 0x6f, 0xf4, 0x15, 0x95, 0xe1, 0x3d, 0x06, 0x78, 0x16, 0x48, 0x70,
+    0x4b, 0x8c, 0xe1, 0xda, 0x4d, 0xc0, 0xd7, 0xa2, 0x69, 0xd0, 0xb5, 0xbd, 0xa0, 0x4b, 0x80, 0x80,
+    0xfa, 0x8a, 0xc7, 0xd5, 0x74, 0x9b, 0x59, 0x1d, 0xa4, 0x69, 0x25, 0x73, 0xd7, 0x1e, 0x66, 0x17,
+    0xf4, 0xac, 0x1b, 0xcd, 0x42, 0x4b, 0x28, 0x24, 0x58, 0xd4, 0x2a, 0x00, 0x79, 0xc0, 0xe3, 0xf5,
+    0xaf, 0x31, 0xd6, 0xb5, 0xfd, 0x3a, 0x58, 0xa5, 0x37, 0x37, 0x25, 0xa4, 0xc9, 0xfb, 0xce, 0x54,
+    0x7f, 0x4a, 0xe7, 0xec, 0x6f, 0x67, 0x96, 0xf5, 0x7e, 0xc9, 0x21, 0x96, 0x23, 0xcf, 0xca, 0x46,
+    0x3f, 0x9d, 0x75, 0xb0, 0xdf, 0xdb, 0x2d, 0xc4, 0x71, 0xdf, 0x5b, 0x46, 0xa0, 0x77, 0x7e, 0x33,
+    0xfa, 0xd4, 0xfa, 0xcc, 0xda, 0x64, 0x96, 0xb2, 0x2d, 0x9e, 0xce, 0x9d, 0x81, 0xcd, 0x71, 0xba,
+    0x4c, 0xdb, 0xa5, 0x91, 0x23, 0xdb, 0x0a, 0xa9, 0x20, 0xc8, 0xd9, 0x1f, 0xce, 0xad, 0x5f, 0xde,
+    0xc1, 0x11, 0x55, 0x9e, 0xea, 0x37, 0xf4, 0x3b, 0x01, 0x35, 0x67, 0xc3, 0xe2, 0x1d, 0x5a, 0xc9,
+    0xe3, 0x48, 0x64, 0x50, 0x8a, 0x7e, 0xe3, 0x8c, 0x9f, 0xe7, 0x5a, 0x9e, 0x17, 0xd1, 0x6d, 0x65,
+    0xbf, 0x1e, 0x48, 0x70, 0xca, 0x41, 0x22, 0x66, 0x50, 0xc7, 0x8f, 0xa5, 0x7a, 0xdd, 0xa6, 0x85,
+    0x04, 0xc8, 0xa0, 0xab, 0xa2, 0x01, 0xfc, 0x2e, 0xa7, 0xfa, 0x54, 0x7a, 0x82, 0x3d, 0xa3, 0x32,
+    0xa1, 0x49, 0xe1, 0x5e, 0xbb, 0x98, 0x23, 0x0f, 0xc8, 0x01, 0x5e, 0x7d, 0xac, 0x78, 0x8a, 0x59,
+    0x6f, 0x45, 0xbd, 0x9a, 0x4c, 0x50, 0x36, 0x08, 0x76, 0x1f, 0xe1, 0x53, 0xf8, 0x8e, 0xef, 0xec,
+    0xda, 0x12, 0x9f, 0xde, 0x89, 0x58, 0x7d, 0xd4, 0x39, 0x27, 0xf9, 0xd7, 0x3f, 0xe0, 0xa8, 0x9d,
+    0xbc, 0xeb, 0x9b, 0xc3, 0x20, 0x7c, 0xe5, 0x62, 0xf3, 0x39, 0xfc, 0x6b, 0xb3, 0xba, 0xf1, 0x94,
+    0x16, 0x36, 0xcb, 0x0b, 0xd9, 0xa9, 0x18, 0xc6, 0xf1, 0x30, 0xc8, 0xfd, 0x2a, 0x0d, 0x3f, 0xc6,
+    0x16, 0xe6, 0x26, 0x4b, 0x78, 0x24, 0x95, 0x9b, 0xa9, 0xf3, 0x14, 0x91, 0xf9, 0x8a, 0xa5, 0xac,
+    0x78, 0xaa, 0xda, 0x39, 0x84, 0x57, 0x51, 0x31, 0x88, 0x8e, 0x57, 0x18, 0x3e, 0xfc, 0x81, 0x5e,
+    0x7b, 0xe3, 0x0d, 0x33, 0x4f, 0xd5, 0xf3, 0x2c, 0x33, 0x79, 0x4a, 0x39, 0x08, 0xe7, 0x1f, 0x9f,
+    0x7a, 0xe7, 0x2d, 0x2c, 0x35, 0x5b, 0x76, 0x48, 0xec, 0xe7, 0xb7, 0x9a, 0x3e, 0x81, 0x16, 0x4c,
+    0x63, 0xeb, 0x5d, 0x7e, 0x9c, 0xb2, 0x80, 0xa6, 0xed, 0x22, 0x59, 0x97, 0xf8, 0x51, 0xf7, 0x54,
+    0xda, 0xb5, 0xd4, 0xb2, 0x5b, 0x6f, 0x58, 0x8c, 0x71, 0xf4, 0x6c, 0x60, 0x13, 0xf8, 0x56, 0x0d,
+    0xec, 0xf6, 0xd0, 0x58, 0x93, 0x6d, 0xf6, 0x92, 0xa7, 0xab, 0x31, 0x00, 0x03, 0x5c, 0xfc, 0x3a,
+    0x8c, 0x57, 0x0e, 0xa6, 0xea, 0x16, 0x91, 0x57, 0x80, 0xc3, 0x83, 0xf8, 0xf3, 0x8a, 0xed, 0x25,
+    0xbb, 0xb7, 0xb6, 0x40, 0x44, 0xca, 0x85, 0x86, 0x36, 0x44, 0x0a, 0x1f, 0xe5, 0x9a, 0xe9, 0x7c,
+    0x09, 0x3c, 0x96, 0xd7, 0x3b, 0xe3, 0x8e, 0xe8, 0xb3, 0x1c, 0x8d, 0xd3, 0x12, 0x0f, 0xe4, 0x2b,
+    0xd6, 0x41, 0x37, 0xb6, 0x6a, 0xd1, 0xf9, 0x51, 0xca, 0xbc, 0x90, 0x49, 0x3f, 0xa0, 0x15, 0x46,
+    0xe5, 0x6e, 0x2e, 0xed, 0x9e, 0x12, 0xd6, 0xc6, 0x40, 0x30, 0x0a, 0xc8, 0xc3, 0xfa, 0x57, 0x21,
+    0x37, 0x86, 0xee, 0x54, 0x3c, 0xb3, 0xcc, 0x14, 0x96, 0x27, 0x3e, 0x71, 0xe9, 0xff, 0x00, 0x7c,
+    0xd7, 0x09, 0xf1, 0x02, 0x4b, 0x88, 0x2d, 0x3f, 0x77, 0x21, 0x68, 0x93, 0xa9, 0x65, 0xdd, 0xfe,
+    0x15, 0xc2, 0xdb, 0x6a, 0xd3, 0xdc, 0xda, 0x88, 0x51, 0xe5, 0x0d, 0xd0, 0x1f, 0x2b, 0xff, 0x00,
+    0xaf, 0x8a, 0xad, 0x79, 0xa6, 0xdd, 0x42, 0x04, 0xd7, 0x2e, 0xf1, 0xe7, 0x9c, 0x34, 0x60, 0x67,
+    0xfa, 0x56, 0x8e, 0x9f, 0x09, 0x87, 0x63, 0xf9, 0xb0, 0x9c, 0x8f, 0xba, 0xea, 0xbf, 0xd2, 0xb3,
+    0xbc, 0x46, 0xf7, 0x66, 0x41, 0xe7, 0x41, 0x18, 0x4e, 0xc5, 0x1b, 0x24, 0xfe, 0x95, 0x93, 0x67,
+    0x1a, 0x45, 0x3a, 0x09, 0x64, 0x10, 0xab, 0x11, 0xc1, 0x19, 0xfe, 0x75, 0xd4, 0xf9, 0xa2, 0xd9,
+    0x91, 0x6d, 0x61, 0x86, 0x48, 0xc8, 0xe5, 0xd4, 0xe0, 0xfe, 0x95, 0xd0, 0x69, 0x25, 0x9b, 0x61,
+    0x22, 0x36, 0x5f, 0xee, 0x87, 0x6d, 0xd5, 0xa3, 0xad, 0xdd, 0xd9, 0x98, 0xc0, 0x66, 0x48, 0x64,
+    0x5e, 0xbe, 0x69, 0xc9, 0xfc, 0x2b, 0x9d, 0x7d, 0x3a, 0x5d, 0x44, 0x6e, 0x8c, 0x4b, 0x34, 0x47,
+    0xb8, 0x5e, 0x07, 0xea, 0x2a, 0x8d, 0x9d, 0xa3, 0xd8, 0xea, 0x40, 0x1b, 0x68, 0xd9, 0x54, 0xf2,
+    0xd2, 0x67, 0x8f, 0xc0, 0x13, 0x49, 0x00, 0x95, 0xa4, 0x93, 0x63, 0x4a, 0x41, 0xe8, 0x02, 0x0e,
+    0x3f, 0x1c, 0x9a, 0xf5, 0x5f, 0x09, 0xbc, 0x7a, 0x46, 0x90, 0x92, 0xdd, 0x5d, 0x58, 0x07, 0x7f,
+    0xe1, 0x95, 0xb6, 0xc9, 0xfc, 0xeb, 0xb8, 0xb4, 0xd7, 0x34, 0xef, 0xec, 0xf6, 0x96, 0x29, 0x62,
+    0x59, 0xb1, 0xff, 0x00, 0x3d, 0x76, 0x83, 0xf9, 0xd6, 0x55, 0x86, 0xad, 0x3d, 0xf6, 0xa1, 0x87,
+    0x36, 0xed, 0xb4, 0xf4, 0x0e, 0x08, 0xfe, 0x7c, 0xd5, 0x9d, 0x7f, 0x53, 0x8a, 0x14, 0x0d, 0x34,
+    0x91, 0xa2, 0x8c, 0x01, 0x82, 0x14, 0x7e, 0xb5, 0xe6, 0x9e, 0x27, 0x9a, 0xcf, 0x52, 0x8d, 0x90,
+    0x5e, 0x42, 0xf2, 0xb6, 0x42, 0xa1, 0x60, 0x7f, 0x4a, 0xe5, 0xad, 0xbc, 0x31, 0x1c, 0x21, 0x26,
+    0x17, 0x2d, 0xe6, 0x2f, 0x3c, 0x29, 0xc0, 0xfd, 0x31, 0x49, 0xac, 0xdc, 0xa4, 0xa0, 0x5b, 0xdc,
+    0xdb, 0x79, 0xca, 0x07, 0x0e, 0x54, 0xd7, 0x32, 0x15, 0x5a, 0xfc, 0x7d, 0x97, 0xf7, 0x6c, 0x3b,
+    0x6c, 0x60, 0x3f, 0x3a, 0xe9, 0xac, 0x62, 0xb4, 0x9a, 0x02, 0x35, 0x34, 0x47, 0x98, 0x60, 0x8f,
+    0x28, 0x67, 0xf4, 0x35, 0x8b, 0xaf, 0x4d, 0x69, 0x1d, 0xc2, 0xac, 0x56, 0xa1, 0xb0, 0xdc, 0x0d,
+    0xa4, 0x11, 0xf5, 0xe7, 0x15, 0x7b, 0x48, 0x82, 0x12, 0xa2, 0xe2, 0x69, 0x8b, 0x36, 0x3e, 0xe1,
+    0x94, 0x00, 0x3f, 0x0e, 0xf5, 0xbd, 0x15, 0x9c, 0x57, 0x45, 0x5e, 0x10, 0xc0, 0xf7, 0xda, 0x70,
+    0x3f, 0x2c, 0x54, 0x9e, 0x22, 0xb0, 0xb6, 0x4d, 0x3d, 0x04, 0xcc, 0x52, 0x5e, 0xcc, 0xa4, 0x06,
+    0xfc, 0xb8, 0xa8, 0x74, 0xb1, 0x34, 0x7a, 0x3b, 0x08, 0x5d, 0x63, 0xc0, 0xff, 0x00, 0x59, 0x22,
+    0xe4, 0x9a, 0xc5, 0xfb, 0x42, 0x9b, 0x86, 0xcb, 0x09, 0x07, 0x7d, 0xfd, 0x3f, 0x0e, 0x6b, 0xbb,
+    0xf0, 0x6f, 0x86, 0xe6, 0xbb, 0xb8, 0x30, 0x19, 0xe3, 0x91, 0x4f, 0x5c, 0x95, 0x20, 0x7e, 0x15,
+    0xbd, 0xae, 0xf8, 0x7e, 0x2d, 0x25, 0xd4, 0x4d, 0x20, 0x98, 0x2f, 0x40, 0x06, 0xcc, 0x7e, 0x19,
+    0xa2, 0x24, 0x8e, 0xfe, 0x34, 0x8a, 0x33, 0x12, 0xb7, 0xf7, 0x77, 0x00, 0xdf, 0xaf, 0x5a, 0x65,
+    0xd9, 0x8b, 0x40, 0x3e, 0x63, 0x4a, 0xb1, 0xc8, 0x33, 0x81, 0xb0, 0x37, 0xe9, 0x9a, 0xe6, 0x75,
+    0x8d, 0x66, 0x6d, 0x5f, 0x2e, 0xcc, 0x8c, 0xc0, 0xf1, 0x94, 0x20, 0x0f, 0xc8, 0xd6, 0x4c, 0x76,
+    0x12, 0x5f, 0x48, 0xb2, 0x48, 0xca, 0x59, 0x3b, 0x02, 0xc3, 0x8f, 0xc6, 0xb6, 0xee, 0x6e, 0x21,
+    0x58, 0x16, 0x2c, 0x22, 0x48, 0xa0, 0x65, 0x9c, 0xe7, 0xf9, 0xd6, 0x45, 0xed, 0xdd, 0x9f, 0xd9,
+    0x76, 0xdc, 0x41, 0x6a, 0xee, 0x3a, 0x34, 0x73, 0x61, 0xbf, 0x4a, 0xe7, 0xae, 0x66, 0xb0, 0x95,
+    0x71, 0x63, 0x1c, 0x86, 0x6e, 0xea, 0x39, 0xfd, 0x49, 0xa7, 0xad, 0xe5, 0xa4, 0x61, 0x12, 0x7d,
+    0xe2, 0x6e, 0x38, 0x0d, 0x91, 0xfa, 0x57, 0x39, 0xac, 0x40, 0x92, 0x5e, 0x88, 0xe5, 0x52, 0xc2,
+    0x4e, 0x14, 0xaa, 0x74, 0xae, 0xb3, 0x49, 0xf0, 0xec, 0x56, 0x16, 0x0b, 0x24, 0x37, 0x01, 0xae,
+    0x1c, 0x64, 0x0d, 0xc4, 0xe0, 0x7d, 0x2b, 0xa5, 0xd0, 0xae, 0xaf, 0xa0, 0x5f, 0x2e, 0x58, 0x15,
+    0x53, 0xfb, 0xe8, 0xbc, 0xfe, 0xb5, 0x17, 0x88, 0x36, 0xbc, 0x86, 0x69, 0x1d, 0x01, 0x1d, 0x55,
+    0xd8, 0x67, 0x8f, 0xa0, 0xcd, 0x67, 0xe8, 0x5a, 0xda, 0xcc, 0xf2, 0x5a, 0xc5, 0x33, 0x49, 0x17,
+    0x75, 0x57, 0xe0, 0x7e, 0x06, 0xab, 0xde, 0x68, 0x4d, 0x79, 0x78, 0x64, 0xb6, 0x58, 0x14, 0x03,
+    0x92, 0x77, 0x1c, 0x8f, 0xcf, 0x8a, 0xed, 0xac, 0xcd, 0xce, 0x93, 0x2a, 0xad, 0xb3, 0xb9, 0x76,
+    0x39, 0x3f, 0x36, 0x07, 0xe9, 0xcd, 0x6a, 0xeb, 0x17, 0x33, 0xdd, 0x08, 0x9e, 0x67, 0xb7, 0x94,
+    0x0e, 0x58, 0xab, 0x12, 0x47, 0xe7, 0x4d, 0xb3, 0x96, 0xd1, 0x95, 0x26, 0x0c, 0x62, 0x95, 0x78,
+    0xe7, 0x23, 0x35, 0x06, 0xb3, 0x1d, 0xd5, 0xd8, 0xff, 0x00, 0x48, 0x8e, 0x3f, 0x21, 0xb9, 0x04,
+    0x8c, 0xfe, 0xb5, 0xcb, 0xcd, 0x61, 0x3a, 0x87, 0x16, 0x82, 0x28, 0xc0, 0xec, 0xac, 0x79, 0xfd,
+    0x2b, 0x9f, 0xbe, 0xbb, 0x9a, 0xd2, 0x45, 0x57, 0x59, 0xbc, 0xc3, 0xc6, 0xe2, 0x7e, 0x5f, 0xd3,
+    0x15, 0xce, 0xbe, 0xa3, 0x73, 0x15, 0xf3, 0x3d, 0xec, 0x65, 0xe2, 0x3d, 0x0c, 0x59, 0x1f, 0xcc,
+    0x55, 0xed, 0x39, 0xac, 0xee, 0x66, 0xdc, 0xb6, 0xc3, 0x77, 0xfc, 0xf4, 0x2a, 0x5b, 0xfc, 0x28,
+    0xd5, 0xe4, 0x91, 0x5f, 0xca, 0x78, 0xe2, 0x58, 0xba, 0x07, 0xe9, 0x8f, 0x7e, 0xe6, 0xb3, 0x25,
+    0x82, 0x6f, 0x3a, 0x35, 0xb7, 0x9a, 0x49, 0x4e, 0x41, 0x05, 0x58, 0x80, 0x2b, 0xb9, 0xd2, 0x34,
+    0xf9, 0x6f, 0xe1, 0x8e, 0x3b, 0xab, 0x77, 0xde, 0x00, 0x3b, 0xcb, 0xf4, 0xfd, 0x2a, 0x5d, 0x71,
+    0x20, 0xd3, 0xc4, 0x69, 0x1c, 0xcc, 0xf2, 0xae, 0x3e, 0xf0, 0x1c, 0x7e, 0xb5, 0x07, 0xda, 0xe2,
+    0x54, 0x0d, 0x6c, 0xcc, 0x26, 0x23, 0xe6, 0x6c, 0x60, 0x7f, 0x3a, 0xab, 0xab, 0x6a, 0x6b, 0x75,
+    0x07, 0x95, 0xe7, 0x08, 0xe5, 0x5c, 0xe5, 0x44, 0x61, 0x83, 0x7e, 0xb4, 0xef, 0x09, 0xda, 0x7d,
+    0xbe, 0x75, 0x4b, 0x5f, 0x29, 0x25, 0x53, 0xce, 0xd8, 0xd5, 0x33, 0xf9, 0x11, 0x5d, 0xd5, 0xee,
+    0x97, 0x76, 0x31, 0x1c, 0x71, 0xa4, 0x5c, 0x61, 0x98, 0x1c, 0xe4, 0x7e, 0x75, 0x42, 0xeb, 0x55,
+    0x13, 0x5d, 0x36, 0xfb, 0x66, 0x01, 0x7a, 0x04, 0x05, 0xbf, 0x32, 0x0d, 0x48, 0xf7, 0x6e, 0xb1,
+    0x2b, 0xcb, 0x67, 0x1a, 0xc6, 0x4f, 0x57, 0x97, 0x07, 0xf5, 0x26, 0xaa, 0xeb, 0xd7, 0x31, 0xdd,
+    0xd9, 0xa8, 0xb1, 0x69, 0x03, 0x80, 0x39, 0x59, 0x47, 0xf3, 0xac, 0xab, 0x1b, 0xe9, 0x63, 0x80,
+    0xc7, 0x3b, 0x97, 0x61, 0xfd, 0xf2, 0x5a, 0x99, 0xa6, 0xdb, 0xdf, 0xbc, 0xef, 0x3d, 0xd4, 0x7e,
+    0x64, 0x2f, 0xc2, 0x8d, 0x84, 0xe3, 0xe9, 0xc8, 0xc5, 0x60, 0x78, 0xa3, 0x43, 0xba, 0x8f, 0xcc,
+    0x6f, 0x34, 0x05, 0x71, 0x9c, 0x03, 0xc8, 0xf6, 0xc7, 0x35, 0xc8, 0xe9, 0x90, 0x81, 0x2b, 0x23,
+    0x4b, 0x34, 0xa5, 0x4f, 0xdd, 0x20, 0x28, 0xfe, 0x55, 0xda, 0x68, 0xb1, 0xc3, 0x21, 0x58, 0xfc,
+    0xa7, 0x65, 0xe0, 0x65, 0x58, 0x00, 0x2b, 0x4f, 0x56, 0x4b, 0x6b, 0x28, 0xc0, 0x64, 0xd8, 0x48,
+    0xfb, 0xe1, 0xc9, 0xaa, 0xfa, 0x7d, 0x8c, 0x2c, 0x86, 0x69, 0x04, 0xdc, 0xf4, 0x72, 0xc4, 0x8f,
+    0xca, 0xb7, 0xad, 0xed, 0x71, 0x62, 0x65, 0x59, 0x95, 0x5d, 0x39, 0x07, 0x71, 0x0c, 0x7f, 0x0f,
+    0xfe, 0xb5, 0x72, 0x1e, 0x26, 0x99, 0x75, 0x09, 0x01, 0x99, 0xa5, 0x56, 0x41, 0xc9, 0x2b, 0xc9,
+    0xfe, 0x55, 0xce, 0xc7, 0x37, 0x91, 0x23, 0x4b, 0x68, 0xc5, 0x64, 0x51, 0xc1, 0x90, 0x72, 0x4f,
+    0xe4, 0x6b, 0x63, 0xc1, 0xfe, 0x66, 0xa3, 0xa9, 0x99, 0x75, 0x47, 0x46, 0xc7, 0x03, 0xe5, 0xe7,
+    0xfa, 0x57, 0x7d, 0x73, 0x65, 0x67, 0xa6, 0x1f, 0xb4, 0xda, 0x5c, 0x42, 0x84, 0xf2, 0x55, 0x54,
+    0x67, 0xf9, 0x56, 0xb5, 0xa6, 0xb2, 0xb2, 0xda, 0x23, 0x48, 0xce, 0x84, 0x76, 0x0a, 0x01, 0x6f,
+    0xc7, 0x8a, 0xe6, 0x25, 0xd4, 0x0d, 0xa4, 0xbe, 0x6c, 0x71, 0x46, 0x55, 0xfa, 0xb3, 0x00, 0xb8,
+    0xfc, 0x45, 0x3f, 0xfb, 0x4a, 0x66, 0xb6, 0x28, 0x86, 0xdd, 0x87, 0xa1, 0xcb, 0xe2, 0xb1, 0xe6,
+    0x78, 0x8b, 0x99, 0x64, 0xb6, 0xda, 0xfd, 0x82, 0x8d, 0xa0, 0xd6, 0xd7, 0x87, 0xf4, 0x1b, 0x7b,
+    0xd8, 0x9a, 0xea, 0x58, 0xe6, 0x5c, 0x74, 0xc1, 0x02, 0xae, 0xc9, 0x6c, 0xd1, 0x2e, 0xc8, 0x5f,
+    0x74, 0x63, 0x80, 0x49, 0x24, 0x8a, 0xc7, 0xd6, 0xe5, 0xbc, 0x82, 0xd9, 0x56, 0x1f, 0x2a, 0x54,
+    0xf5, 0xc6, 0x48, 0xfa, 0xf5, 0xae, 0x5b, 0x58, 0x48, 0xfe, 0xce, 0x27, 0x96, 0xe0, 0x34, 0x8b,
+    0xc9, 0x0b, 0x84, 0x02, 0x9f, 0xa0, 0xea, 0x22, 0x42, 0x7c, 0x96, 0x62, 0xe0, 0x7d, 0xd2, 0x5b,
+    0x07, 0xf2, 0xad, 0xbb, 0xef, 0x2b, 0x51, 0x81, 0x44, 0x96, 0x6c, 0x26, 0x1c, 0x07, 0x76, 0x6f,
+    0xeb, 0x52, 0x68, 0x17, 0x52, 0x45, 0x3f, 0xd8, 0xae, 0x26, 0x5d, 0xa4, 0xf4, 0x2b, 0xfe, 0x38,
+    0xa9, 0xb5, 0xf8, 0x1a, 0xd9, 0x0f, 0x90, 0xfb, 0x07, 0xa1, 0xe7, 0x3f, 0x86, 0x6b, 0xca, 0x7c,
+    0x5b, 0xf6, 0xc9, 0xee, 0x96, 0x3b, 0x65, 0x75, 0x4c, 0xe1, 0xcc, 0x79, 0x07, 0x15, 0x95, 0xe7,
+    0xc9, 0x68, 0x42, 0x88, 0xa7, 0xe9, 0xf3, 0x31, 0x5c, 0x67, 0xf1, 0xad, 0xaf, 0x0f, 0xde, 0xdc,
+    0x4b, 0x2f, 0x99, 0x65, 0xe6, 0xe1, 0x4f, 0x2b, 0x2b, 0x63, 0x91, 0xf4, 0xaf, 0x40, 0xfe, 0xda,
+    0xb2, 0x4b, 0x58, 0xff, 0x00, 0xb4, 0x26, 0x84, 0xcf, 0x80, 0x0c, 0x78, 0x18, 0x1f, 0xd4, 0xd5,
+    0xcb, 0x5f, 0x13, 0xfc, 0xe9, 0x15, 0xa5, 0xb4, 0x72, 0xc0, 0x7a, 0xee, 0x8f, 0x1b, 0x7e, 0x95,
+    0xaf, 0x61, 0xe1, 0xdb, 0xcb, 0xe8, 0xf0, 0x91, 0x15, 0xc8, 0xc8, 0x74, 0x93, 0xfa, 0x0a, 0xc4,
+    0xbd, 0xd2, 0x9f, 0x4b, 0x9e, 0x58, 0xa5, 0xdb, 0xe6, 0xf7, 0x25, 0x48, 0xfd, 0x49, 0xac, 0xe8,
+    0x5c, 0x49, 0x21, 0x8e, 0x19, 0x59, 0xdc, 0x74, 0x0c, 0xb8, 0x03, 0xf4, 0xae, 0xe3, 0xc2, 0x17,
+    0x06, 0x38, 0x9b, 0xfb, 0x46, 0x59, 0x80, 0x1d, 0x00, 0x60, 0x17, 0xf5, 0xc6, 0x6b, 0x5a, 0x19,
+    0xa2, 0xb9, 0x96, 0x49, 0x23, 0x97, 0x31, 0x8e, 0xcc, 0x31, 0xfd, 0x2a, 0x1b, 0xb9, 0x2d, 0x6d,
+    0xfe, 0x68, 0x25, 0x8c, 0xb9, 0xe4, 0x87, 0xc6, 0x7f, 0x2a, 0xe3, 0xfc, 0x43, 0x71, 0x6e, 0xad,
+    0xb1, 0x2d, 0xd5, 0x24, 0x6e, 0xe3, 0xee, 0x9f, 0xe7, 0x55, 0xb4, 0x9d, 0x3c, 0xc0, 0x4b, 0xcc,
+    0x96, 0xca, 0xad, 0xdd, 0x73, 0x9f, 0xd2, 0xaf, 0x7d, 0x8b, 0x6c, 0xa8, 0xd1, 0x48, 0xcd, 0x1f,
+    0x52, 0x59, 0xb2, 0x07, 0xe7, 0x51, 0x6a, 0x52, 0x44, 0x92, 0x86, 0xb4, 0xdb, 0xe6, 0x01, 0xd7,
+    0x71, 0x04, 0xfe, 0x04, 0x62, 0xa8, 0xce, 0x9a, 0x94, 0x56, 0xd2, 0x5d, 0x89, 0x5e, 0x6e, 0xbf,
+    0x20, 0x60, 0x0d, 0x72, 0x02, 0xfa, 0x4b, 0xd3, 0x22, 0xcc, 0x86, 0x06, 0x1d, 0x59, 0xe4, 0x18,
+    0xfc, 0xea, 0xb4, 0xba, 0x78, 0xb9, 0x85, 0x83, 0x48, 0xd3, 0xfa, 0x79, 0x63, 0xad, 0x51, 0xd3,
+    0x26, 0xd4, 0xec, 0xee, 0xcc, 0x69, 0x60, 0xf1, 0x5b, 0x0e, 0xa5, 0x9b, 0x20, 0xfe, 0x55, 0x7f,
+    0x51, 0xb5, 0xbb, 0x9e, 0x75, 0xb9, 0xb7, 0x8c, 0x4b, 0x93, 0xc8, 0x24, 0xf1, 0x5b, 0xba, 0x41,
+    0x94, 0x3a, 0x47, 0xe5, 0x15, 0x27, 0xef, 0x29, 0x19, 0x03, 0xf5, 0x15, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_burst_3[5094] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x60,
+    0x00, 0x80, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xeb, 0x34, 0xab, 0xbf, 0xb2, 0x69, 0x70, 0x42,
+    0x2d, 0xe3, 0x88, 0x04, 0x32, 0x15, 0x1c, 0xb1, 0x20, 0x12, 0x0e, 0xdc, 0x1c, 0x83, 0xc7, 0xbf,
+    0x5e, 0x2b, 0xce, 0xdb, 0xc4, 0x8d, 0xac, 0xeb, 0x32, 0x4d, 0xe5, 0x85, 0x91, 0xe1, 0xf2, 0x82,
+    0xcf, 0x1b, 0x62, 0x5c, 0x36, 0x4f, 0x1b, 0x78, 0xc0, 0xc7, 0x15, 0xac, 0x5b, 0x42, 0x4d, 0x32,
+    0x48, 0xda, 0x64, 0x8e, 0xe4, 0x8f, 0x2d, 0x3c, 0xb0, 0x7e, 0x66, 0x6c, 0x1d, 0xa5, 0xb1, 0x9d,
+    0xd9, 0xe4, 0x9e, 0x00, 0x07, 0xb5, 0x51, 0xd5, 0x1a, 0xde, 0x1f, 0xec, 0xf9, 0x26, 0x12, 0x46,
+    0x9e, 0x6f, 0x91, 0x36, 0x4f, 0xcc, 0x5b, 0x03, 0x1d, 0xba, 0x92, 0x47, 0x7c, 0xf4, 0xed, 0x5d,
+    0x1c, 0x5a, 0x34, 0x37, 0xda, 0x5b, 0x5e, 0x89, 0x3c, 0x99, 0x3c, 0xc2, 0x91, 0xe3, 0xa1, 0x5c,
+    0x0c, 0xee, 0xe3, 0x8e, 0xbd, 0x7a, 0x9a, 0xa9, 0xab, 0x68, 0xf7, 0x77, 0xba, 0x6b, 0x08, 0x61,
+    0xf3, 0xae, 0x2e, 0x11, 0x48, 0x0d, 0x85, 0xe9, 0x8e, 0x09, 0xff, 0x00, 0x80, 0xe3, 0x27, 0x9f,
+    0x5e, 0x95, 0x97, 0x6e, 0x66, 0x81, 0xae, 0xad, 0xb5, 0x1b, 0x34, 0x8c, 0x47, 0x11, 0x8c, 0xb3,
+    0x90, 0xf2, 0x2b, 0x06, 0xc0, 0x00, 0x0c, 0x8c, 0xe3, 0x3c, 0xfb, 0x8f, 0x5a, 0x9a, 0x76, 0xba,
+    0x63, 0x6c, 0xb7, 0x33, 0xdc, 0x42, 0xae, 0x02, 0x82, 0xe5, 0x58, 0x60, 0x73, 0x80, 0x31, 0xc1,
+    0xc0, 0x1d, 0x7d, 0x73, 0xee, 0x30, 0xbc, 0x4b, 0xac, 0xde, 0x4b, 0x73, 0x1d, 0xb5, 0xb5, 0xaa,
+    0x88, 0x82, 0x89, 0x4c, 0xd1, 0x96, 0x60, 0x8d, 0xe8, 0xc7, 0xbf, 0x5c, 0xf3, 0x9f, 0xd6, 0x97,
+    0xc3, 0x16, 0x91, 0x34, 0x66, 0xe6, 0x56, 0x79, 0x1d, 0x64, 0x09, 0xb4, 0xfc, 0xcd, 0xf3, 0x31,
+    0x1b, 0x86, 0x7f, 0x87, 0x07, 0x38, 0xe6, 0xba, 0x8d, 0x66, 0xeb, 0x4e, 0x83, 0x41, 0x5b, 0x55,
+    0x86, 0x04, 0x2e, 0xa6, 0x21, 0x38, 0x5c, 0x95, 0x63, 0x8d, 0xa3, 0xdf, 0x27, 0x9e, 0xf5, 0xc2,
+    0xb6, 0x97, 0x24, 0xf0, 0x4c, 0xd6, 0x31, 0xb4, 0xb1, 0x40, 0xfe, 0x63, 0x2c, 0xd1, 0x8f, 0x9b,
+    0x8c, 0x65, 0x41, 0x1f, 0x8e, 0x33, 0x9f, 0xca, 0x8d, 0x03, 0x49, 0xb2, 0x9e, 0xfa, 0xdb, 0xed,
+    0x33, 0x4a, 0xae, 0xcc, 0xb2, 0x15, 0x65, 0x31, 0xed, 0xe3, 0xdf, 0x00, 0x8c, 0x7f, 0xf5, 0xf1,
+    0xde, 0xdd, 0xe5, 0x9a, 0xc0, 0xf7, 0xe2, 0xe0, 0xcc, 0x2d, 0xe5, 0x20, 0xc5, 0x30, 0x20, 0x6c,
+    0x55, 0xcf, 0xae, 0x79, 0x19, 0x1f, 0x9d, 0x69, 0xc5, 0xa4, 0xa5, 0xee, 0x9b, 0x00, 0xd2, 0x25,
+    0x2d, 0x20, 0x8b, 0x77, 0x9c, 0xf1, 0x6c, 0x2c, 0xe1, 0x41, 0x19, 0x1d, 0xc7, 0xe1, 0x57, 0xec,
+    0x74, 0x28, 0x22, 0x91, 0xe4, 0x98, 0x4a, 0x2e, 0x85, 0xc1, 0xcb, 0x6d, 0x2c, 0x42, 0xf3, 0x93,
+    0xd7, 0x00, 0xe4, 0x74, 0xfc, 0xcf, 0x35, 0x77, 0x52, 0xb8, 0x92, 0xe7, 0xcd, 0x48, 0xae, 0xdd,
+    0x12, 0x55, 0x40, 0x06, 0x17, 0xe4, 0x03, 0xab, 0x95, 0xec, 0x47, 0xa0, 0xec, 0x46, 0x6b, 0x07,
+    0x4f, 0xb1, 0x6d, 0x36, 0x2b, 0xa9, 0xee, 0xa4, 0xf3, 0x65, 0x8f, 0x09, 0x6f, 0x33, 0xee, 0xf9,
+    0x8b, 0x03, 0xf3, 0x63, 0xa7, 0x7c, 0xf7, 0xac, 0xed, 0x1a, 0xee, 0xde, 0x5d, 0x42, 0xf4, 0x5d,
+    0x45, 0x33, 0xaa, 0x46, 0x4c, 0x66, 0x10, 0x43, 0x21, 0x20, 0x72, 0x30, 0x38, 0x38, 0xc6, 0x4f,
+    0xd3, 0xa5, 0x76, 0x7a, 0x66, 0x84, 0x67, 0x90, 0x5a, 0x98, 0xe2, 0xbb, 0x8c, 0xc9, 0x1c, 0x81,
+    0xdd, 0xf7, 0x1c, 0x80, 0x39, 0xfa, 0xe0, 0x1f, 0xc0, 0x0a, 0xea, 0x26, 0x48, 0x55, 0x6d, 0x37,
+    0xda, 0x89, 0x76, 0x83, 0xe6, 0x04, 0x6f, 0xdd, 0xa9, 0x03, 0x03, 0x20, 0x74, 0xf5, 0x27, 0xdf,
+    0x15, 0x66, 0x7b, 0xeb, 0x2d, 0x43, 0x4b, 0xb6, 0x2d, 0x2d, 0xb4, 0x5b, 0x76, 0xc8, 0x23, 0x12,
+    0x15, 0xf9, 0x76, 0x9e, 0xbc, 0xf2, 0x72, 0x7b, 0xfb, 0xd7, 0x2d, 0xac, 0x9b, 0x5b, 0x55, 0xd4,
+    0x1a, 0x58, 0x93, 0x79, 0x97, 0x11, 0x36, 0xf7, 0x66, 0x04, 0xf2, 0xa7, 0xa9, 0x38, 0xc6, 0x08,
+    0x1d, 0xbd, 0x38, 0xae, 0x7f, 0x4d, 0xb0, 0xbf, 0xd4, 0x2e, 0xa6, 0xd4, 0x64, 0xb4, 0x96, 0x3b,
+    0x7b, 0x79, 0x31, 0x15, 0xca, 0x6f, 0x20, 0xb0, 0xc8, 0x2b, 0x80, 0x7e, 0x61, 0xd7, 0x9f, 0x63,
+    0x59, 0xd7, 0xa9, 0x7b, 0x6e, 0x26, 0xbb, 0x82, 0xc2, 0x49, 0x22, 0xb8, 0x97, 0x6a, 0x11, 0x11,
+    0x53, 0x8e, 0x46, 0x78, 0x1c, 0x8c, 0xf7, 0xe3, 0xa5, 0x49, 0xe1, 0xbd, 0x1a, 0xe9, 0xe5, 0xb3,
+    0x9d, 0xac, 0xee, 0x21, 0xb9, 0x8d, 0x94, 0x11, 0x32, 0x30, 0x52, 0xca, 0xff, 0x00, 0x37, 0x27,
+    0x90, 0x06, 0x49, 0xe7, 0xb7, 0xe7, 0x5e, 0xbf, 0x0a, 0xe9, 0xfa, 0xc6, 0x85, 0x2c, 0x77, 0x17,
+    0x36, 0x56, 0xd2, 0x46, 0xca, 0xb2, 0x61, 0x83, 0x10, 0xe3, 0xb6, 0xdc, 0xf1, 0xd0, 0x93, 0x4f,
+    0xf3, 0xd2, 0x78, 0x45, 0xac, 0x57, 0x51, 0x7e, 0xed, 0xbc, 0xc6, 0xf2, 0xa6, 0x40, 0x36, 0xaf,
+    0x4e, 0xbf, 0x97, 0xe5, 0x54, 0x75, 0x7b, 0xad, 0x2b, 0x52, 0x88, 0xdc, 0x2d, 0xed, 0xb4, 0x97,
+    0x00, 0x6c, 0x31, 0xee, 0xc8, 0x40, 0xa4, 0x02, 0x7f, 0x3f, 0xaf, 0x38, 0xaa, 0x1a, 0x14, 0x96,
+    0x57, 0xd6, 0xcf, 0x6c, 0x75, 0x32, 0x8c, 0x48, 0x3f, 0xbd, 0x2a, 0xc4, 0xf1, 0x8f, 0xbb, 0xc1,
+    0xc6, 0x32, 0x33, 0x9f, 0xc2, 0xad, 0x78, 0x85, 0xad, 0x7f, 0xb2, 0x0d, 0xbd, 0x96, 0xa2, 0x82,
+    0x45, 0xda, 0xa3, 0xcb, 0x2a, 0x7c, 0xc3, 0xb8, 0x1c, 0x0c, 0x12, 0x70, 0x30, 0x7d, 0x3f, 0x4c,
+    0xd7, 0x0b, 0xaf, 0xea, 0xc3, 0x4f, 0x7b, 0x7d, 0x98, 0xb8, 0x98, 0x0f, 0x98, 0x91, 0x96, 0x3c,
+    0x0c, 0x92, 0x7e, 0xb9, 0xc2, 0xe0, 0x67, 0x1d, 0x4d, 0x51, 0xb8, 0x6b, 0xd3, 0x11, 0x72, 0xab,
+    0x30, 0x67, 0x01, 0x50, 0xc8, 0x4e, 0x00, 0x38, 0x20, 0x64, 0x6e, 0xe9, 0xdf, 0x8e, 0x6b, 0x63,
+    0x46, 0x92, 0xf7, 0x57, 0xd1, 0x16, 0xde, 0xe1, 0x09, 0xc9, 0x79, 0x30, 0xd2, 0xa8, 0x00, 0x0c,
+    0x86, 0x3c, 0xb0, 0xe9, 0xd3, 0xe9, 0xfa, 0xd3, 0xf0, 0x97, 0x87, 0x35, 0x47, 0x92, 0x69, 0xb4,
+    0xdb, 0x71, 0x1d, 0xb8, 0x90, 0x9f, 0x32, 0x49, 0x63, 0x26, 0x41, 0x82, 0x09, 0x27, 0x27, 0x07,
+    0x93, 0x8e, 0xe7, 0xf4, 0xaf, 0x46, 0xd2, 0xb4, 0xfd, 0x66, 0xd2, 0xea, 0xce, 0x19, 0x61, 0x41,
+    0x6d, 0x2b, 0xa2, 0xc9, 0x31, 0x91, 0x4e, 0xc5, 0xc7, 0x20, 0x64, 0x90, 0x32, 0x4e, 0x71, 0xf8,
+    0xe2, 0xaf, 0x6a, 0x5a, 0x6d, 0xf5, 0xcb, 0x5c, 0xdd, 0xa6, 0x99, 0x14, 0x62, 0x73, 0xe5, 0xc6,
+    0x0b, 0x28, 0x61, 0x82, 0x41, 0x61, 0x83, 0x83, 0xc1, 0xe7, 0x1c, 0x60, 0x57, 0x98, 0x2f, 0x83,
+    0xb5, 0xa6, 0x2f, 0x76, 0x62, 0x55, 0xb4, 0x81, 0x62, 0x01, 0x24, 0x6c, 0xf0, 0xa7, 0x38, 0x20,
+    0x1e, 0x79, 0xf4, 0xcf, 0x6f, 0x5a, 0xd4, 0xf0, 0x17, 0x85, 0xa1, 0xd4, 0xf5, 0x3b, 0x86, 0xd4,
+    0x65, 0x74, 0x92, 0x36, 0x45, 0x1b, 0xa3, 0x25, 0x8a, 0x11, 0xd1, 0x40, 0x18, 0x03, 0x1e, 0xbc,
+    0xe2, 0xbd, 0xa9, 0x3c, 0x21, 0xa2, 0x3e, 0x8c, 0x90, 0x5a, 0xa3, 0x46, 0x9c, 0xf9, 0x52, 0x03,
+    0xb5, 0xb2, 0x4f, 0x5e, 0xd9, 0x3d, 0x38, 0x3d, 0x70, 0x2b, 0x97, 0xd6, 0x3c, 0x37, 0xa3, 0xe9,
+    0xb7, 0x36, 0xb3, 0x82, 0x65, 0x9e, 0x06, 0xcc, 0x91, 0x89, 0x5b, 0x04, 0x8e, 0x79, 0xe7, 0xae,
+    0x3a, 0x8e, 0x6a, 0x2b, 0xef, 0x0b, 0x69, 0x97, 0x1a, 0x9c, 0x97, 0x0b, 0x0d, 0xc4, 0xe2, 0xe9,
+    0x12, 0x26, 0x51, 0x29, 0xd8, 0xcb, 0x8f, 0xba, 0x0e, 0x70, 0x0f, 0x5e, 0x9d, 0x0f, 0xad, 0x63,
+    0x4f, 0xa2, 0xd8, 0xc7, 0xa6, 0x4c, 0x2c, 0x20, 0x58, 0x6e, 0x8c, 0xaf, 0x1a, 0xa9, 0x2c, 0xe5,
+    0x63, 0x00, 0xaf, 0x27, 0x38, 0x6e, 0xc7, 0xdc, 0x7e, 0xbc, 0xe2, 0xc0, 0x6d, 0xad, 0xaf, 0x05,
+    0xb4, 0x52, 0xac, 0xb3, 0xb1, 0x62, 0xf0, 0xed, 0xdb, 0x21, 0x00, 0xee, 0x03, 0x23, 0x23, 0xa7,
+    0x4f, 0xd7, 0x9e, 0x2c, 0x5c, 0xda, 0x83, 0x05, 0xbb, 0x46, 0x2d, 0xed, 0x2e, 0x39, 0xdb, 0xb5,
+    0xca, 0x30, 0x04, 0x7d, 0xdc, 0xe7, 0xa7, 0x6f, 0xa7, 0xa5, 0x45, 0x65, 0x35, 0xbd, 0xbc, 0x9f,
+    0x65, 0x92, 0xce, 0x79, 0xee, 0x54, 0x80, 0xd3, 0x15, 0xcf, 0x62, 0x01, 0x6c, 0xb6, 0x31, 0x9f,
+    0x5c, 0xf5, 0xf6, 0xac, 0xb9, 0x6e, 0x66, 0xbb, 0xd5, 0x53, 0xec, 0xee, 0x11, 0x22, 0x6d, 0xe1,
+    0x13, 0x3f, 0x3e, 0x1b, 0x04, 0x73, 0xd7, 0x3f, 0x95, 0x17, 0xc9, 0x2f, 0x96, 0x8d, 0x24, 0x56,
+    0x32, 0x46, 0x32, 0x42, 0x0c, 0xa3, 0x02, 0xd9, 0x04, 0x70, 0x71, 0x8c, 0x9e, 0x73, 0xe9, 0x8e,
+    0xd5, 0x34, 0x32, 0x43, 0x65, 0x60, 0xf7, 0x37, 0x29, 0x71, 0x73, 0x15, 0xc9, 0x01, 0x23, 0x8d,
+    0x8a, 0x9d, 0xed, 0xdf, 0x00, 0x64, 0x70, 0x3a, 0xe7, 0xf1, 0xf5, 0x76, 0x8b, 0xaf, 0x0b, 0x9d,
+    0x2a, 0x4d, 0x3e, 0xcf, 0x4e, 0x58, 0xd9, 0x55, 0x8c, 0x8d, 0xbc, 0xc9, 0x21, 0x1b, 0xcf, 0xdd,
+    0x53, 0x9e, 0x46, 0x71, 0xd3, 0xf3, 0xae, 0xf7, 0x4a, 0xbb, 0x83, 0x4c, 0xd0, 0xd7, 0xfb, 0x1e,
+    0xc2, 0x5b, 0x4b, 0x55, 0x71, 0x24, 0xa8, 0x5f, 0xe7, 0x2a, 0x31, 0x83, 0x82, 0x3a, 0x9c, 0xf6,
+    0xf4, 0xa8, 0xfc, 0x34, 0x97, 0x93, 0xea, 0x48, 0xcf, 0x04, 0xa9, 0x6c, 0xbe, 0x5c, 0x80, 0x48,
+    0x57, 0x79, 0x0c, 0xe1, 0x81, 0x23, 0x1c, 0x70, 0x7a, 0x83, 0xd0, 0x57, 0x51, 0xa8, 0xac, 0x42,
+    0x18, 0xd2, 0x4f, 0x3a, 0x15, 0x8d, 0xfc, 0xc5, 0x8d, 0x81, 0x00, 0xa9, 0x18, 0xc0, 0xe7, 0x20,
+    0xf5, 0xfd, 0x28, 0xd4, 0xfc, 0x3f, 0x69, 0x73, 0xe1, 0x99, 0x63, 0xb2, 0x9a, 0x48, 0x65, 0x50,
+    0xac, 0x85, 0x24, 0x28, 0x46, 0xe6, 0x52, 0x41, 0xe0, 0x60, 0x70, 0x7f, 0x33, 0x9a, 0xc9, 0xf0,
+    0x56, 0x81, 0x3c, 0x2b, 0xa8, 0x5a, 0x9d, 0xc2, 0x60, 0xd1, 0x9f, 0x38, 0xca, 0x1b, 0x1f, 0x2b,
+    0x0d, 0xbc, 0x83, 0xc6, 0x48, 0xff, 0x00, 0x22, 0xbd, 0x13, 0x48, 0x8d, 0xad, 0xf4, 0xa8, 0x52,
+    0xe9, 0x63, 0x57, 0x5c, 0x96, 0x09, 0x92, 0x33, 0xb8, 0x9c, 0xf3, 0xf9, 0xfb, 0x56, 0x3e, 0xad,
+    0xa3, 0xda, 0x4f, 0x2c, 0xef, 0x24, 0x93, 0xc9, 0xb0, 0xb4, 0xbb, 0x3c, 0xc2, 0x14, 0x96, 0x3c,
+    0x8e, 0x3d, 0x08, 0xe8, 0x78, 0xe9, 0xe9, 0x58, 0xb2, 0x6a, 0x73, 0x59, 0x87, 0xf2, 0xf6, 0x22,
+    0x88, 0x8c, 0x86, 0x40, 0xa3, 0x11, 0xfd, 0xec, 0xb0, 0xe7, 0xdb, 0x9e, 0xe7, 0x27, 0x15, 0xe5,
+    0x7a, 0x9e, 0xbd, 0xa6, 0xc9, 0x61, 0x29, 0xb9, 0xb8, 0x25, 0xa1, 0xb9, 0x75, 0x5d, 0xf2, 0x14,
+    0xf2, 0xf9, 0x70, 0x58, 0xf4, 0xcf, 0x2d, 0x9f, 0x6e, 0x05, 0x60, 0xe9, 0xd7, 0x97, 0x33, 0x6a,
+    0x56, 0xd1, 0xd9, 0xb1, 0x96, 0x1b, 0x87, 0xc3, 0x79, 0x64, 0x28, 0xc7, 0x73, 0xd7, 0x18, 0xc9,
+    0x1c, 0x9e, 0x78, 0xc7, 0xd7, 0xae, 0x4d, 0x4a, 0xdd, 0x6e, 0xad, 0x23, 0xbe, 0xb7, 0x8a, 0x28,
+    0xe3, 0x1e, 0x5b, 0xbc, 0xa3, 0x03, 0x69, 0xe3, 0xe5, 0x19, 0xeb, 0xdb, 0x1d, 0x78, 0xfa, 0xd5,
+    0xad, 0x6d, 0xf4, 0xd9, 0xa0, 0xbf, 0x82, 0xc0, 0x2e, 0x4a, 0x6e, 0x55, 0x20, 0x96, 0x00, 0x74,
+    0x07, 0xd7, 0xbf, 0x7e, 0x98, 0xae, 0x2b, 0xc3, 0xd7, 0x1e, 0x6c, 0xb2, 0xc5, 0x09, 0x10, 0xa2,
+    0x61, 0x9e, 0x67, 0x24, 0x67, 0x0a, 0x72, 0x0f, 0xd4, 0xf1, 0xc6, 0x47, 0xd2, 0xad, 0x5e, 0xde,
+    0x5b, 0xc2, 0xb6, 0x31, 0x4f, 0x70, 0x92, 0x28, 0x72, 0xb0, 0x1d, 0x81, 0x9d, 0xb3, 0x9f, 0xbb,
+    0xea, 0x38, 0xef, 0x82, 0x31, 0xf8, 0xd5, 0xcf, 0x0a, 0xf9, 0x3a, 0xd5, 0xac, 0xd0, 0xc5, 0x0b,
+    0x27, 0xd9, 0x59, 0x5d, 0x76, 0x38, 0xc9, 0x1d, 0x32, 0x73, 0x9e, 0xfb, 0x8f, 0x6c, 0xd5, 0xdf,
+    0x07, 0xe8, 0x76, 0xb3, 0x5d, 0x5b, 0x8b, 0x61, 0x2c, 0x66, 0x39, 0xe7, 0xf3, 0x16, 0xe0, 0xaf,
+    0x98, 0x40, 0x94, 0x70, 0x38, 0xe0, 0x67, 0xfc, 0x9c, 0x57, 0xb1, 0x5a, 0xe8, 0x36, 0xf7, 0x1e,
+    0x52, 0x34, 0x6d, 0x1c, 0x3b, 0x8b, 0x6c, 0x47, 0x52, 0x10, 0x81, 0x81, 0xcf, 0xf1, 0x74, 0xe3,
+    0xf1, 0xea, 0x31, 0x50, 0xdf, 0xc1, 0x24, 0x33, 0xbc, 0x0b, 0xb6, 0xea, 0xd0, 0xc6, 0x44, 0x9b,
+    0x9c, 0x24, 0x85, 0x17, 0xb2, 0xe0, 0x00, 0xc4, 0x63, 0xf2, 0x1e, 0xe2, 0xbc, 0xeb, 0x5e, 0xf1,
+    0x34, 0xd7, 0x37, 0xb1, 0xdb, 0xda, 0x19, 0x8a, 0x16, 0x65, 0x95, 0x9d, 0x87, 0xdd, 0xc8, 0x04,
+    0x82, 0x07, 0x00, 0x71, 0xf8, 0x74, 0xab, 0x9e, 0x2b, 0xbc, 0x16, 0x7e, 0x15, 0x79, 0x59, 0x66,
+    0x49, 0x9c, 0x2f, 0xee, 0x63, 0xe5, 0x98, 0x92, 0x98, 0x1d, 0x49, 0x1d, 0xfa, 0x9c, 0x74, 0x3d,
+    0x45, 0x73, 0xbe, 0x04, 0xb7, 0x79, 0x0e, 0xb1, 0x73, 0xa8, 0xb4, 0xa2, 0x66, 0x8d, 0x56, 0x3b,
+    0x65, 0x93, 0x2d, 0xd1, 0xf9, 0x3e, 0x9c, 0x95, 0x39, 0x1c, 0x67, 0x9e, 0xd5, 0xda, 0xdd, 0xf8,
+    0xda, 0x0b, 0x0b, 0x4b, 0x38, 0xa7, 0xb2, 0x46, 0x0c, 0x8a, 0xb2, 0xc8, 0xb3, 0x0f, 0x90, 0x12,
+    0x32, 0x7a, 0x11, 0xd7, 0x03, 0x1e, 0xdf, 0x9d, 0x4d, 0x3b, 0xc5, 0xf1, 0x26, 0x9f, 0x75, 0x0d,
+    0xac, 0x52, 0x4f, 0x71, 0x24, 0xc0, 0x34, 0x9e, 0x6a, 0xe5, 0x40, 0xc8, 0xf9, 0x72, 0x3a, 0x00,
+    0x08, 0xfc, 0x7f, 0x0a, 0x83, 0x58, 0xf1, 0x55, 0xa5, 0xbe, 0xab, 0x6b, 0x6d, 0x3c, 0x44, 0x41,
+    0x26, 0xd4, 0xd9, 0x8d, 0xa7, 0x3b, 0x7e, 0x56, 0xc8, 0x1d, 0x70, 0x41, 0x1d, 0xb8, 0xef, 0x5e,
+    0x6f, 0xe3, 0x2d, 0x27, 0x4d, 0xd7, 0xe2, 0x0d, 0x0c, 0xad, 0x14, 0x01, 0xd8, 0xad, 0xb3, 0x1c,
+    0x12, 0x1c, 0x92, 0x72, 0x38, 0xdd, 0xf8, 0x62, 0xb9, 0xeb, 0x3b, 0x3d, 0x5a, 0x37, 0xb6, 0xfb,
+    0x24, 0xf6, 0xd7, 0x31, 0x4d, 0x81, 0xe5, 0x45, 0x27, 0xca, 0x84, 0x27, 0x07, 0xd7, 0xb7, 0xa6,
+    0x47, 0xd2, 0xba, 0xed, 0x35, 0x27, 0xfd, 0xcb, 0xde, 0x24, 0x22, 0xf6, 0xd9, 0x00, 0x0a, 0x8d,
+    0x9d, 0xe3, 0xa9, 0xc0, 0xea, 0x78, 0x38, 0x03, 0xd6, 0xa7, 0xd5, 0xae, 0xa6, 0x9a, 0xca, 0x39,
+    0xad, 0xe0, 0x31, 0x46, 0x1f, 0x69, 0x03, 0x00, 0xbc, 0x67, 0x92, 0x19, 0x41, 0xec, 0x07, 0xf9,
+    0xe6, 0xb0, 0x2e, 0xe5, 0xb3, 0x87, 0x47, 0xc5, 0x87, 0xda, 0x5a, 0xd6, 0x66, 0x69, 0x5a, 0x46,
+    0x60, 0xa1, 0x0e, 0x31, 0xb5, 0x78, 0x3f, 0x5e, 0x7d, 0x4f, 0xad, 0x73, 0xf1, 0x6a, 0x71, 0xde,
+    0xc8, 0x92, 0x5e, 0x44, 0x65, 0x58, 0xae, 0x04, 0x51, 0xca, 0x06, 0x0f, 0x39, 0x19, 0x3c, 0xe3,
+    0x82, 0x3a, 0xd7, 0x71, 0x3d, 0xfd, 0xad, 0xa4, 0x82, 0xe0, 0x4e, 0x23, 0x49, 0x50, 0xb1, 0x8e,
+    0x25, 0x31, 0xbb, 0x2e, 0x38, 0xe3, 0xa9, 0x39, 0xc9, 0xc1, 0xf5, 0xe0, 0xf4, 0xad, 0xef, 0x87,
+    0xd2, 0xcf, 0x63, 0x3b, 0x98, 0xe3, 0xba, 0xfb, 0x41, 0x8d, 0x8a, 0x8f, 0x38, 0xb0, 0x20, 0xb6,
+    0x47, 0x00, 0x7f, 0xb3, 0xff, 0x00, 0xd7, 0xaf, 0x5e, 0x2b, 0xfd, 0xa1, 0xa6, 0xaa, 0xc6, 0xa9,
+    0x1c, 0xd1, 0x8f, 0xde, 0x44, 0x09, 0x24, 0xf1, 0xb8, 0x2f, 0x03, 0x1b, 0xb9, 0xeb, 0xda, 0xa9,
+    0xbb, 0x4f, 0x77, 0x13, 0xc6, 0xf2, 0xda, 0x34, 0xd1, 0xa1, 0x09, 0x2a, 0x48, 0xcb, 0xc7, 0x03,
+    0x1d, 0x38, 0x24, 0xf5, 0xfa, 0x73, 0xc6, 0x2b, 0x89, 0x3e, 0x17, 0xbb, 0x8e, 0xc8, 0xbd, 0xcc,
+    0xbe, 0x5b, 0x90, 0x62, 0xe2, 0x62, 0x85, 0x41, 0x27, 0x95, 0x21, 0x7b, 0x60, 0x74, 0xae, 0x23,
+    0xe2, 0x5c, 0xd3, 0x45, 0xa7, 0x3c, 0x91, 0xc9, 0xba, 0xd6, 0x05, 0x11, 0x33, 0xba, 0xf0, 0x0e,
+    0xe5, 0xc1, 0x1d, 0x38, 0xe8, 0x7d, 0x7a, 0x57, 0x0b, 0x69, 0xac, 0x4b, 0x3d, 0x84, 0x30, 0x07,
+    0x9b, 0x72, 0xe5, 0x77, 0x18, 0xb9, 0x66, 0x27, 0x0a, 0x00, 0xe4, 0x63, 0x3b, 0xba, 0xfa, 0x55,
+    0x4d, 0x4f, 0x4b, 0xbb, 0xb6, 0xb5, 0x13, 0xdd, 0xbb, 0x42, 0xd8, 0xf3, 0x0a, 0xb4, 0x7f, 0x2b,
+    0x82, 0x4e, 0x01, 0x3d, 0x30, 0x6b, 0x5a, 0xc2, 0x11, 0x15, 0xd4, 0x13, 0x99, 0x62, 0xc5, 0xca,
+    0xb3, 0xa2, 0x4a, 0x8b, 0xf2, 0xf4, 0x18, 0xe3, 0x9c, 0x63, 0xa8, 0xf6, 0xfc, 0xf2, 0xbc, 0x53,
+    0x25, 0xde, 0x55, 0xee, 0x61, 0x8d, 0x22, 0x0c, 0x16, 0x32, 0xad, 0x96, 0x72, 0x08, 0xe4, 0x60,
+    0x76, 0x39, 0xcf, 0x1d, 0x3d, 0x2b, 0x22, 0x30, 0xb6, 0xce, 0x7c, 0xe9, 0x3e, 0xcc, 0xac, 0xe5,
+    0xf6, 0xb0, 0xce, 0xdc, 0xf0, 0x43, 0x71, 0x8e, 0x4e, 0x48, 0xf4, 0xc5, 0x75, 0xd3, 0xcc, 0xb6,
+    0x37, 0xea, 0x96, 0x70, 0xc3, 0x25, 0xba, 0xc4, 0x24, 0x95, 0xd4, 0xed, 0x39, 0x23, 0xa8, 0xc7,
+    0xdd, 0x3d, 0x41, 0x23, 0x3d, 0x2b, 0x6f, 0x46, 0x46, 0x64, 0xb7, 0x8d, 0x96, 0x37, 0x05, 0xbc,
+    0xc4, 0x8d, 0x5c, 0x97, 0xe4, 0x10, 0x47, 0xa7, 0x40, 0x0e, 0x71, 0xc7, 0x43, 0x8a, 0xd4, 0xd7,
+    0xaf, 0xac, 0xa4, 0x8f, 0x70, 0x64, 0x82, 0xe2, 0x28, 0xc2, 0x30, 0x99, 0xb2, 0x48, 0xe7, 0x20,
+    0x7e, 0x60, 0x03, 0x5c, 0xe1, 0xd3, 0xa5, 0xd4, 0x84, 0x6f, 0x02, 0x4f, 0x73, 0x69, 0x20, 0x3b,
+    0x18, 0x0c, 0x6d, 0x65, 0x50, 0x71, 0xd4, 0x10, 0x71, 0x8f, 0x7e, 0x2b, 0x3a, 0xd6, 0xcd, 0xec,
+    0x75, 0x79, 0x23, 0x4b, 0x68, 0x66, 0x8d, 0x38, 0x67, 0x93, 0x21, 0x7a, 0x6e, 0xe3, 0x69, 0xe1,
+    0xb1, 0xcf, 0x23, 0x9f, 0xa5, 0x3e, 0xdb, 0xce, 0x59, 0x2e, 0xcc, 0x6d, 0x33, 0x26, 0xe2, 0xa1,
+    0x36, 0x2e, 0xe0, 0x38, 0x00, 0x06, 0x27, 0xa6, 0x72, 0x0d, 0x7a, 0xa7, 0x83, 0xdd, 0x74, 0x0f,
+    0x0b, 0x58, 0xdc, 0x5f, 0x5d, 0xd8, 0x09, 0xe6, 0xcb, 0x95, 0x9c, 0xed, 0x95, 0x41, 0x62, 0x54,
+    0x0c, 0x9c, 0x8c, 0x67, 0x9c, 0xfb, 0x57, 0x75, 0xa7, 0xeb, 0x9a, 0x72, 0x69, 0x92, 0x5c, 0x41,
+    0x2c, 0x4b, 0x78, 0x91, 0xb4, 0x98, 0x32, 0xec, 0x12, 0x31, 0x27, 0x0a, 0x09, 0xe7, 0xa0, 0xc6,
+    0x47, 0xe3, 0x58, 0x9a, 0x5e, 0xa7, 0x71, 0xaa, 0x6a, 0x51, 0x42, 0xdf, 0x67, 0x72, 0x8a, 0x1d,
+    0x50, 0xba, 0xe1, 0x97, 0x76, 0x49, 0x6e, 0x7e, 0xf1, 0xc6, 0x32, 0x72, 0x6a, 0xef, 0x8a, 0x35,
+    0x68, 0x62, 0x84, 0x4f, 0x3c, 0xca, 0xb0, 0xe1, 0xfc, 0xa6, 0x5c, 0x26, 0x0f, 0x1f, 0x2a, 0x83,
+    0xd7, 0x23, 0x3c, 0xf3, 0xef, 0x5e, 0x6b, 0xe3, 0x19, 0xec, 0xf5, 0x18, 0x2f, 0xa3, 0x37, 0x56,
+    0xef, 0x3c, 0xae, 0x89, 0x1c, 0x25, 0xc6, 0xde, 0x19, 0x4f, 0x4e, 0x98, 0xe7, 0xef, 0x0e, 0xd5,
+    0xc9, 0xdb, 0xf8, 0x56, 0x28, 0x61, 0x8a, 0x46, 0xbb, 0x6f, 0x36, 0x19, 0x37, 0xc9, 0x2f, 0x96,
+    0xc1, 0x53, 0x07, 0x20, 0x63, 0x18, 0xe3, 0x38, 0xc0, 0xff, 0x00, 0x11, 0x4b, 0xe2, 0x0b, 0x94,
+    0xbb, 0xff, 0x00, 0x44, 0xbd, 0xb3, 0xf3, 0x15, 0x97, 0x69, 0x62, 0x87, 0x20, 0xaf, 0xdd, 0x03,
+    0x03, 0x03, 0xd7, 0x8c, 0x75, 0x1d, 0x7a, 0x57, 0x34, 0xcb, 0x9d, 0x6e, 0x39, 0x2c, 0x49, 0x8e,
+    0x48, 0x87, 0x96, 0x31, 0x1b, 0x01, 0x90, 0x79, 0xe4, 0xf5, 0x50, 0x4e, 0x31, 0xcf, 0x39, 0xae,
+    0x9a, 0xc2, 0xda, 0xce, 0x6b, 0x59, 0x61, 0xd5, 0xd1, 0x5a, 0xe2, 0xde, 0x56, 0x2b, 0xe4, 0x0e,
+    0x71, 0x91, 0x8f, 0x70, 0x49, 0xfe, 0x5f, 0x5c, 0xe0, 0xf8, 0x9a, 0x6b, 0x58, 0x6e, 0x70, 0x96,
+    0x4b, 0x26, 0xd8, 0x01, 0x31, 0x81, 0xb7, 0xe6, 0x27, 0x03, 0x27, 0x3b, 0x46, 0xd1, 0xf5, 0xe6,
+    0xb4, 0xf4, 0x7b, 0x78, 0x5d, 0xd2, 0xf6, 0x7b, 0x97, 0x92, 0x40, 0x01, 0x2a, 0xd2, 0xed, 0x08,
+    0xa3, 0x80, 0x30, 0x39, 0xc1, 0x00, 0xe7, 0xeb, 0xef, 0x5b, 0x56, 0xd6, 0x49, 0x78, 0xb6, 0xd3,
+    0x5a, 0x86, 0x57, 0x01, 0x4e, 0xe4, 0xe0, 0x72, 0x30, 0x00, 0x40, 0x30, 0x4e, 0x38, 0xe7, 0x35,
+    0x37, 0x89, 0xf4, 0xfb, 0x51, 0xa2, 0xc1, 0x1c, 0xa4, 0xc5, 0x2b, 0xff, 0x00, 0xab, 0x65, 0x23,
+    0x7a, 0xaa, 0x0e, 0x14, 0x83, 0x83, 0xc1, 0x27, 0xb7, 0x4c, 0xd4, 0x7a, 0x21, 0x9e, 0x3f, 0x0d,
+    0x7f, 0xa3, 0x48, 0xb1, 0x48, 0x64, 0x72, 0xb3, 0xca, 0xa5, 0x99, 0xfd, 0x72, 0x7b, 0x0f, 0xd0,
+    0x60, 0x56, 0x1a, 0x5c, 0x46, 0xd7, 0xc4, 0xa1, 0x57, 0x8d, 0x10, 0x29, 0xf3, 0x39, 0x5d, 0xe3,
+    0xb8, 0xe4, 0x71, 0xcf, 0x6e, 0x2b, 0xbb, 0xf0, 0x47, 0x87, 0xae, 0x35, 0x1b, 0xe7, 0xb7, 0x32,
+    0xc3, 0x30, 0xb9, 0x97, 0x12, 0xa9, 0x21, 0x95, 0x54, 0x9c, 0x9c, 0x7f, 0x78, 0x8c, 0x1f, 0xcf,
+    0x3c, 0x62, 0xb7, 0x7c, 0x4b, 0xe1, 0xf8, 0xb4, 0x69, 0x36, 0x4d, 0x37, 0xda, 0x62, 0x4c, 0x98,
+    0xce, 0x36, 0x61, 0x7a, 0x00, 0x06, 0x47, 0x3f, 0x2f, 0x3e, 0xb9, 0xa5, 0x54, 0x4d, 0x46, 0x18,
+    0x22, 0x43, 0x12, 0x4a, 0x13, 0xcb, 0xf2, 0x8b, 0x00, 0xdb, 0x0f, 0x2b, 0xfe, 0xf1, 0xed, 0xd7,
+    0xb8, 0xf5, 0x22, 0x92, 0xec, 0x45, 0xe1, 0xab, 0x91, 0x33, 0xca, 0xb1, 0xcf, 0x12, 0xae, 0xc0,
+    0x54, 0x12, 0x5b, 0x9e, 0x1b, 0x04, 0x76, 0xe7, 0x23, 0x8e, 0x71, 0xef, 0x5c, 0xb6, 0xb1, 0xab,
+    0xcb, 0xad, 0xec, 0x77, 0x65, 0x77, 0x8c, 0x12, 0xbf, 0x21, 0x5d, 0xbc, 0xf0, 0x40, 0x07, 0x80,
+    0x3d, 0x05, 0x63, 0x8d, 0x3a, 0x6d, 0x57, 0xcb, 0x95, 0xdd, 0x4d, 0xc4, 0x07, 0xe5, 0x0b, 0x91,
+    0xbd, 0x89, 0x3c, 0x8c, 0xfb, 0x03, 0xd7, 0xd3, 0x8a, 0xe8, 0x2f, 0xee, 0x60, 0x7b, 0x7f, 0x23,
+    0x29, 0x1c, 0x85, 0x48, 0x77, 0x61, 0x9d, 0xa4, 0xfd, 0xee, 0xbd, 0x78, 0xc6, 0x00, 0xf5, 0xac,
+    0x6b, 0xfb, 0xcb, 0x46, 0xb0, 0x2b, 0x73, 0x6d, 0x6b, 0x24, 0xd1, 0xb9, 0x92, 0x36, 0x8a, 0xe3,
+    0xe6, 0x2d, 0xb7, 0x19, 0xc8, 0xc7, 0x04, 0x8f, 0x5f, 0x6a, 0xe7, 0x6f, 0x26, 0xb1, 0x9a, 0xd4,
+    0x2e, 0x9b, 0x1c, 0xbf, 0x6a, 0x2e, 0x85, 0x95, 0x7a, 0xa1, 0xdc, 0x49, 0xe4, 0x91, 0xf9, 0xf1,
+    0xeb, 0xe9, 0x52, 0xb5, 0xe5, 0x9c, 0x5e, 0x4c, 0x53, 0xee, 0x17, 0x0c, 0x0b, 0x6c, 0x47, 0xdc,
+    0x19, 0x42, 0xf7, 0x3d, 0xf1, 0x9f, 0x61, 0x9f, 0xad, 0x73, 0x3e, 0x24, 0x44, 0x37, 0xf3, 0x0b,
+    0x85, 0x69, 0x12, 0xe5, 0xd1, 0xa2, 0x64, 0x4f, 0xbb, 0x8f, 0xe1, 0xe7, 0x8c, 0xf4, 0x3d, 0xf3,
+    0x8e, 0xfd, 0x2b, 0xb0, 0xd2, 0xbc, 0x34, 0x9a, 0x3e, 0x9c, 0xaf, 0x0d, 0xc8, 0x7d, 0x41, 0xd0,
+    0x05, 0xc3, 0x16, 0x00, 0x12, 0x32, 0xbb, 0x73, 0xd7, 0x19, 0xe8, 0x73, 0x5d, 0x1f, 0x87, 0x2e,
+    0xb5, 0x18, 0x61, 0x5b, 0x56, 0x81, 0x70, 0xae, 0x48, 0x95, 0x57, 0x2c, 0x48, 0x38, 0x03, 0x27,
+    0x1d, 0x88, 0xc7, 0x6a, 0x6e, 0xbf, 0xb2, 0xe2, 0xf1, 0x2e, 0xf7, 0xa1, 0x26, 0x3d, 0x8b, 0x1b,
+    0x38, 0xdc, 0xca, 0xdf, 0x79, 0x98, 0x85, 0xcf, 0x61, 0xed, 0xe9, 0x8e, 0x95, 0x9b, 0xe1, 0x3d,
+    0x79, 0x26, 0xb8, 0x5b, 0x1b, 0x69, 0xda, 0x7b, 0x60, 0xc6, 0x32, 0xaa, 0xdc, 0x29, 0x5c, 0x82,
+    0x30, 0x71, 0xc7, 0x1d, 0x47, 0xbe, 0x6a, 0x9d, 0xc7, 0x87, 0x9a, 0xfe, 0xf6, 0x21, 0x6a, 0xb0,
+    0xac, 0x63, 0x71, 0x66, 0x2c, 0x77, 0xa6, 0x08, 0x38, 0xe7, 0x80, 0x47, 0x4f, 0xff, 0x00, 0x55,
+    0x76, 0xd6, 0x62, 0xe7, 0x44, 0x16, 0xf0, 0xd8, 0xb3, 0x34, 0xb2, 0x3a, 0x81, 0x96, 0xc2, 0x0c,
+    0xb1, 0xcb, 0x02, 0x32, 0x71, 0x82, 0x3b, 0x1e, 0xbf, 0x96, 0xc7, 0x88, 0xee, 0x27, 0xbf, 0x68,
+    0x5e, 0x47, 0x82, 0x7f, 0xdc, 0xec, 0x91, 0xd4, 0xe4, 0xc4, 0x41, 0xcb, 0x13, 0x9e, 0xf8, 0xfc,
+    0xf3, 0x4d, 0xb6, 0xb9, 0xb3, 0x72, 0x35, 0x24, 0x63, 0x0c, 0x90, 0x10, 0x13, 0x93, 0x89, 0x42,
+    0xf1, 0xc1, 0xf7, 0xc7, 0xe3, 0xd7, 0xbf, 0x11, 0x6b, 0xf0, 0x5d, 0xdd, 0xef, 0x8a, 0xe5, 0x23,
+    0x36, 0x8c, 0x36, 0xa3, 0x11, 0x92, 0x49, 0x24, 0x9e, 0x7a, 0x83, 0x83, 0x8f, 0xd7, 0xa5, 0x72,
+    0xcf, 0xa7, 0xce, 0x04, 0xcb, 0x63, 0xe5, 0xc4, 0x14, 0xe1, 0x02, 0xb1, 0x01, 0xf1, 0xd7, 0xa8,
+    0xea, 0x4e, 0x78, 0x39, 0xf6, 0xe2, 0xb9, 0xeb, 0xeb, 0xd9, 0x6c, 0xee, 0x2d, 0x8b, 0x2d, 0xc7,
+    0x99, 0x24, 0x47, 0xf7, 0xad, 0xf7, 0x06, 0x38, 0xcb, 0x01, 0x82, 0x73, 0x8c, 0x00, 0x07, 0xf5,
+    0xae, 0x75, 0xb5, 0x0b, 0x98, 0x35, 0x79, 0x1f, 0x50, 0x89, 0xa4, 0xb6, 0x56, 0xf9, 0x0c, 0x0c,
+    0x72, 0x32, 0x33, 0x92, 0x71, 0xd3, 0xdc, 0x7b, 0x55, 0xdd, 0x2d, 0xac, 0xee, 0x6e, 0xdd, 0xfc,
+    0x85, 0x12, 0xc9, 0x26, 0xe1, 0x71, 0xb0, 0xb8, 0x39, 0x04, 0x6d, 0x20, 0x60, 0x03, 0xdb, 0x1e,
+    0x86, 0x97, 0x5b, 0x92, 0x48, 0xdb, 0xc8, 0x30, 0x44, 0xb6, 0xce, 0x4a, 0xaf, 0x6d, 0x85, 0x89,
+    0xdc, 0x0f, 0x7c, 0x10, 0xbc, 0x12, 0x7f, 0xa6, 0x32, 0x6f, 0xad, 0xa4, 0xc8, 0x8a, 0xd6, 0xe2,
+    0x5b, 0x80, 0x17, 0x64, 0x72, 0x29, 0x2a, 0x00, 0xc8, 0x27, 0xf0, 0xe9, 0xd8, 0xe3, 0x15, 0xdf,
+    0xe9, 0xda, 0x6c, 0xba, 0xb9, 0x5b, 0x5b, 0xbb, 0x63, 0xe6, 0x98, 0x19, 0x3c, 0xd7, 0x71, 0x81,
+    0xf3, 0x06, 0xec, 0x30, 0x73, 0x90, 0x72, 0x7f, 0x96, 0x69, 0xde, 0x23, 0xf2, 0x6c, 0x23, 0xb2,
+    0x16, 0xf2, 0xc9, 0x25, 0xd4, 0x64, 0x2e, 0x24, 0x00, 0x15, 0x6e, 0x70, 0xa3, 0x9e, 0x73, 0xb4,
+    0x1e, 0x05, 0x44, 0x6e, 0xe2, 0x5f, 0x30, 0xd9, 0x3b, 0x2d, 0xdc, 0xca, 0x72, 0xe0, 0x61, 0x37,
+    0xed, 0xe8, 0x79, 0x19, 0xc1, 0x19, 0xaa, 0xba, 0xa6, 0xa7, 0xf6, 0xd8, 0xe0, 0xb6, 0x86, 0x6f,
+    0x26, 0xea, 0x24, 0x55, 0x28, 0xa8, 0x1b, 0xcd, 0x60, 0x33, 0x8c, 0xe7, 0xaf, 0x24, 0x8f, 0x4e,
+    0x6a, 0x3f, 0x06, 0x58, 0x8d, 0x54, 0xda, 0xc1, 0x62, 0x61, 0x89, 0xd2, 0x43, 0xbc, 0xa4, 0x6b,
+    0x18, 0xc8, 0xcf, 0x3c, 0x11, 0x93, 0xfc, 0x47, 0xbf, 0x4a, 0xf4, 0x1d, 0x47, 0x4e, 0xbc, 0x5b,
+    0x86, 0x10, 0xc6, 0x96, 0xed, 0x82, 0xb2, 0x32, 0xe0, 0x96, 0x70, 0x33, 0x93, 0xed, 0xc6, 0x70,
+    0x3d, 0x39, 0xe8, 0x71, 0x9f, 0x77, 0xab, 0x2d, 0xc6, 0xa9, 0x21, 0x92, 0xd8, 0xa2, 0xc4, 0xa3,
+    0x62, 0x44, 0x0b, 0x64, 0x01, 0xb8, 0x82, 0x41, 0xeb, 0xc0, 0x07, 0xd3, 0x3f, 0x5c, 0x13, 0x5d,
+    0xb8, 0xb2, 0x86, 0x59, 0xec, 0xe3, 0x58, 0x5d, 0xb7, 0x16, 0x92, 0x5c, 0x10, 0x71, 0xc6, 0x01,
+    0x27, 0x91, 0xcf, 0x7e, 0xfe, 0xd5, 0x5f, 0xc5, 0x37, 0x49, 0x79, 0xa5, 0xb2, 0xd8, 0xb4, 0xeb,
+    0x2c, 0x39, 0x90, 0x98, 0xe4, 0x19, 0x07, 0x1b, 0x49, 0x07, 0x9e, 0x06, 0x7f, 0xce, 0x05, 0x65,
+    0xd8, 0x5f, 0x4b, 0x14, 0x0f, 0x6d, 0x74, 0xe2, 0x46, 0x8e, 0x3d, 0xce, 0x59, 0x8b, 0x07, 0xce,
+    0x41, 0x65, 0xef, 0xb4, 0x0e, 0x7a, 0x77, 0xef, 0x51, 0x68, 0xf1, 0xdf, 0xa5, 0xcd, 0xc6, 0xa9,
+    0x7d, 0x0f, 0x9d, 0x6c, 0xc5, 0x84, 0x11, 0x14, 0x27, 0xe5, 0xfb, 0x9b, 0x87, 0x23, 0x6f, 0x4c,
+    0xfd, 0x05, 0x61, 0xf8, 0x9b, 0xc3, 0xb7, 0x56, 0x92, 0x49, 0x1b, 0x5c, 0x7c, 0x92, 0x26, 0xf1,
+    0x22, 0xb6, 0x19, 0x57, 0xdf, 0x82, 0x38, 0x39, 0xfc, 0xc7, 0x7a, 0xe2, 0xf4, 0x68, 0x0b, 0x07,
+    0x83, 0xcc, 0x96, 0x79, 0x22, 0x6f, 0x28, 0x40, 0x00, 0x8c, 0x11, 0xb4, 0x67, 0x19, 0xed, 0x90,
+    0x79, 0xfd, 0x7d, 0x7b, 0x9d, 0x1c, 0x5b, 0xcb, 0x2c, 0x4b, 0x1c, 0x6d, 0x24, 0x6e, 0x5c, 0xc4,
+    0xf1, 0xe3, 0x6a, 0x39, 0x23, 0x00, 0xa9, 0xe7, 0x20, 0x73, 0x9a, 0xd3, 0xd6, 0x23, 0xb5, 0xd3,
+    0x40, 0x8c, 0xaf, 0x97, 0xb8, 0x32, 0xa4, 0xab, 0x21, 0x63, 0xbd, 0x4e, 0x4e, 0x7a, 0x67, 0x39,
+    0x03, 0x3e, 0x95, 0x06, 0x8f, 0x65, 0x00, 0x11, 0x5d, 0x4c, 0xb7, 0x04, 0x31, 0x05, 0x64, 0xde,
+    0x79, 0x7c, 0xfc, 0xd8, 0x1e, 0x9b, 0x71, 0xc7, 0xbf, 0x7c, 0x56, 0xd5, 0xa5, 0x8b, 0x9f, 0x0e,
+    0xb3, 0x2d, 0xc4, 0x69, 0x73, 0x6f, 0x2a, 0xb2, 0xc9, 0xb8, 0x86, 0x71, 0x81, 0xb4, 0x00, 0x3a,
+    0x0e, 0xa7, 0xa7, 0x6a, 0xe4, 0xfc, 0x5f, 0x30, 0xd6, 0x6e, 0x56, 0x57, 0x69, 0x12, 0x44, 0x60,
+    0xb9, 0x91, 0x7e, 0x60, 0x06, 0x79, 0xcf, 0x19, 0x27, 0x3d, 0xbb, 0x7d, 0x6b, 0x9c, 0xb6, 0x9d,
+    0x22, 0xba, 0x6b, 0xbb, 0x42, 0xf1, 0xf9, 0x2e, 0x76, 0x3c, 0x83, 0x96, 0x39, 0xe4, 0x1c, 0x02,
+    0x33, 0x92, 0x30, 0x3d, 0x33, 0x5a, 0xfe, 0x08, 0x79, 0x75, 0x3d, 0x68, 0xdf, 0x6b, 0x2e, 0x0c,
+    0xd1, 0xc8, 0x4c, 0x60, 0x0c, 0x3c, 0x79, 0xfd, 0x30, 0x4f, 0x1d, 0x0d, 0x77, 0xf7, 0x56, 0x16,
+    0x7a, 0x3c, 0x8f, 0x7b, 0x61, 0x71, 0x0c, 0x27, 0x68, 0x67, 0x58, 0x97, 0xe6, 0xdc, 0x7a, 0x10,
+    0xa0, 0x13, 0xf5, 0x27, 0xb5, 0x6b, 0x59, 0xeb, 0x4b, 0x3e, 0x99, 0x69, 0x24, 0xae, 0xf0, 0x8d,
+    0xea, 0xc8, 0xb1, 0xaa, 0x86, 0x9c, 0x73, 0x9f, 0x98, 0x74, 0x5e, 0xb8, 0xf7, 0x19, 0xae, 0x66,
+    0x5b, 0xf3, 0x63, 0x78, 0x66, 0x86, 0x34, 0x92, 0x1b, 0xc1, 0x81, 0x23, 0x28, 0x42, 0x4b, 0x7a,
+    0x63, 0xa0, 0xeb, 0xf5, 0xa7, 0x7f, 0x68, 0xca, 0x74, 0xd9, 0xa1, 0x0f, 0x6c, 0x62, 0x6f, 0xf4,
+    0xa7, 0x2d, 0x97, 0x08, 0x72, 0x40, 0xc6, 0x3f, 0x1e, 0x7a, 0x7a, 0x56, 0x45, 0xcc, 0xb1, 0xf9,
+    0x93, 0xdc, 0xcf, 0x6b, 0xb2, 0x76, 0x53, 0x85, 0x1f, 0x28, 0x7f, 0x9b, 0x19, 0xc7, 0x46, 0x27,
+    0x21, 0x48, 0xfe, 0x95, 0xb3, 0xe1, 0xbf, 0x0f, 0xdb, 0x6a, 0x30, 0x5c, 0xdf, 0x4e, 0xb3, 0xa2,
+    0xa0, 0x0c, 0x0e, 0x40, 0x3b, 0x72, 0x32, 0x7d, 0x47, 0x6e, 0x39, 0xeb, 0xd2, 0xae, 0xcb, 0x0b,
+    0x47, 0x04, 0xab, 0x0b, 0x6f, 0x87, 0x87, 0xc0, 0x63, 0x98, 0xc3, 0x1c, 0x10, 0xa7, 0xb7, 0x18,
+    0x19, 0xf4, 0xc5, 0x63, 0xf8, 0x86, 0x5b, 0xdb, 0x4d, 0x3d, 0x23, 0xb5, 0xf2, 0xae, 0x13, 0x71,
+    0x09, 0xc7, 0xcc, 0x18, 0x8e, 0x77, 0x75, 0xf4, 0x1c, 0x67, 0xd7, 0xe9, 0x5c, 0xae, 0xbf, 0x1c,
+    0x43, 0x4f, 0x17, 0x4d, 0x72, 0x25, 0x78, 0x40, 0xdd, 0xb3, 0x11, 0xa8, 0x66, 0xce, 0x32, 0x7b,
+    0x9c, 0x13, 0x91, 0xed, 0x9a, 0x9f, 0xc3, 0xda, 0x80, 0xb8, 0xb8, 0x90, 0x46, 0xe7, 0xce, 0x68,
+    0x82, 0xa0, 0x7d, 0xca, 0xa5, 0x95, 0x7e, 0xf1, 0xdb, 0xd3, 0x95, 0x1d, 0xf9, 0xc5, 0x6c, 0x5d,
+    0xb4, 0x3a, 0xc5, 0x86, 0x9c, 0xd3, 0xd9, 0x48, 0xb7, 0x18, 0x2a, 0x24, 0x90, 0x90, 0x55, 0x86,
+    0x70, 0xc0, 0x1e, 0xa3, 0x3c, 0x6d, 0x1e, 0xa2, 0x9f, 0xe1, 0x9b, 0xc9, 0xa0, 0xb8, 0xfe, 0xca,
+    0xba, 0x99, 0x30, 0x41, 0x5c, 0x14, 0x03, 0x04, 0x92, 0x41, 0x00, 0xe3, 0xbe, 0x7e, 0xbf, 0x9d,
+    0x4d, 0xe2, 0x3b, 0x76, 0xb4, 0x82, 0x54, 0xb5, 0x93, 0xcb, 0x8f, 0xcc, 0x0b, 0xd7, 0x3b, 0xc6,
+    0xd0, 0xa3, 0xa1, 0xe0, 0x8c, 0xe7, 0xf0, 0x35, 0xe5, 0x5e, 0x36, 0x37, 0xf3, 0xdf, 0xc2, 0x96,
+    0x2a, 0xea, 0x14, 0x09, 0x25, 0xf2, 0xb2, 0x0e, 0xe2, 0x00, 0x07, 0x8f, 0x5e, 0x9c, 0x77, 0xcd,
+    0x66, 0xbc, 0x8f, 0x65, 0x3c, 0x76, 0xd6, 0xd1, 0x4f, 0xb4, 0x31, 0xd9, 0x23, 0xa6, 0x33, 0xd0,
+    0x90, 0x4f, 0x38, 0x3d, 0xbf, 0x1e, 0x6b, 0x53, 0xc3, 0xf7, 0xb3, 0x5d, 0x34, 0xd3, 0x58, 0x2c,
+    0xe6, 0x14, 0x55, 0x8a, 0x58, 0xa4, 0x72, 0x3c, 0xcd, 0xe7, 0x9c, 0x11, 0x93, 0x8e, 0xbc, 0xe7,
+    0xa1, 0xaf, 0x44, 0x9b, 0x5d, 0xb3, 0x4b, 0x38, 0x24, 0xd5, 0x66, 0xb7, 0x92, 0xf5, 0x76, 0xa3,
+    0x41, 0xb4, 0x05, 0x28, 0x46, 0x00, 0x24, 0x72, 0x70, 0x38, 0xfc, 0x0d, 0x5a, 0xb5, 0xf1, 0x31,
+    0x12, 0xc1, 0x0d, 0x85, 0xa2, 0x5c, 0xdb, 0x02, 0xb9, 0x12, 0x26, 0xdc, 0x71, 0xd5, 0x4e, 0x78,
+    0xdb, 0xc1, 0xe3, 0xd2, 0xb6, 0x74, 0xdf, 0x0e, 0x5e, 0x5f, 0x2a, 0x24, 0x10, 0x1c, 0xb2, 0x2a,
+    0x23, 0xc7, 0x26, 0x38, 0x19, 0x3c, 0x01, 0x90, 0x3b, 0x1e, 0xf5, 0x87, 0x75, 0xa5, 0x36, 0x93,
+    0x79, 0x7f, 0x6b, 0x26, 0xc6, 0xb8, 0xc3, 0x28, 0x2c, 0x85, 0x77, 0xc6, 0x3b, 0xe4, 0x9f, 0x7f,
+    0xe6, 0x6b, 0x3a, 0xd5, 0xe3, 0x96, 0xe1, 0x61, 0x8e, 0x56, 0x98, 0xc6, 0x19, 0xf6, 0x3a, 0xed,
+    0xc4, 0x83, 0x39, 0x19, 0x03, 0x8e, 0x06, 0x73, 0xdf, 0xa6, 0x38, 0xae, 0xe7, 0xc0, 0xb7, 0x2f,
+    0x14, 0x48, 0xba, 0xcc, 0xb3, 0x33, 0x5b, 0x90, 0xae, 0xaa, 0xc0, 0x23, 0xbb, 0x1e, 0xa0, 0x1c,
+    0x67, 0x18, 0xe7, 0xeb, 0x5a, 0xb6, 0x33, 0x47, 0x79, 0x34, 0xd3, 0x41, 0x21, 0x74, 0x0e, 0x43,
+    0x23, 0x0d, 0xb9, 0x07, 0x3f, 0x74, 0xe3, 0x8e, 0xdf, 0x2f, 0x35, 0x05, 0xc4, 0x96, 0xb0, 0x47,
+    0x14, 0x96, 0x97, 0x09, 0xe6, 0x4c, 0x04, 0x6e, 0x5f, 0x1b, 0x87, 0x19, 0x5e, 0x3a, 0x6d, 0xfc,
+    0xb3, 0xcf, 0x15, 0xc8, 0x78, 0x9e, 0xea, 0xd5, 0x26, 0x45, 0x8e, 0xd5, 0x22, 0x92, 0xed, 0x98,
+    0xed, 0x4f, 0xb8, 0xdd, 0x4e, 0x79, 0xce, 0xc2, 0x79, 0xc7, 0x4e, 0x95, 0x5f, 0x46, 0xb0, 0x6b,
+    0x49, 0x0c, 0xd3, 0x47, 0x6b, 0xfb, 0xc0, 0x4a, 0x15, 0xea, 0xd9, 0xfa, 0x75, 0x6e, 0xa4, 0x7d,
+    0x2a, 0xd4, 0xb6, 0x3e, 0x5a, 0xc7, 0x25, 0xac, 0xa5, 0xed, 0xa3, 0x91, 0x48, 0x96, 0x5e, 0x55,
+    0x03, 0x60, 0x92, 0xc0, 0xfd, 0xdf, 0x98, 0x0c, 0x60, 0x67, 0x22, 0x97, 0x59, 0x78, 0x17, 0x50,
+    0x91, 0xac, 0xf0, 0x1d, 0x58, 0x6e, 0x67, 0x62, 0x0f, 0x03, 0x9e, 0x08, 0x20, 0xe5, 0xb8, 0xfc,
+    0x0f, 0xd6, 0xa8, 0x32, 0x6a, 0x89, 0x67, 0x75, 0xa8, 0x89, 0x64, 0x99, 0xe4, 0x45, 0xc4, 0x04,
+    0x80, 0xc0, 0x1e, 0x08, 0xeb, 0xc7, 0x61, 0xfa, 0x9a, 0xe3, 0x60, 0xbf, 0x93, 0x52, 0x8e, 0x55,
+    0x95, 0x4c, 0x0c, 0x1c, 0x83, 0x2c, 0x92, 0x8c, 0x26, 0x07, 0xcb, 0x93, 0xd4, 0x93, 0x83, 0xc0,
+    0xfd, 0x2a, 0xb9, 0xd3, 0x96, 0xee, 0xd3, 0x63, 0xca, 0xd2, 0x2c, 0x72, 0xb0, 0x5f, 0x29, 0x79,
+    0xdc, 0x14, 0x01, 0x8c, 0xf5, 0xcb, 0x64, 0xe7, 0x07, 0xbd, 0x67, 0xe9, 0x17, 0x1a, 0x9d, 0x95,
+    0xf2, 0xdb, 0xc7, 0xa7, 0xbd, 0xbd, 0x9c, 0x32, 0x92, 0xd9, 0x6c, 0x82, 0x06, 0x48, 0x00, 0x0e,
+    0x09, 0xe4, 0x7e, 0x75, 0xa1, 0xab, 0xdb, 0xde, 0xcb, 0x30, 0xd4, 0xec, 0xa2, 0x49, 0x99, 0xb6,
+    0xa8, 0x88, 0xe7, 0x6a, 0xe7, 0xaa, 0xfa, 0xf7, 0x3c, 0x7d, 0x7a, 0xe3, 0x15, 0xbf, 0xa4, 0x99,
+    0x21, 0x9a, 0x18, 0x61, 0x8d, 0x86, 0xd5, 0xd8, 0xdd, 0x48, 0x07, 0x24, 0x06, 0xc8, 0xc1, 0xcf,
+    0xcd, 0xcf, 0xf4, 0xaf, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_burst_4[4032] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x60,
+    0x00, 0x80, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xeb, 0x74, 0x7b, 0xcf, 0xb1, 0x69, 0x70, 0x22,
+    0xc4, 0xb1, 0x80, 0x85, 0xcf, 0xa9, 0x23, 0x24, 0x7e, 0x7c, 0x57, 0x9c, 0xb7, 0x88, 0x8e, 0xb1,
+    0xac, 0x3c, 0xa5, 0x36, 0xc8, 0xd1, 0x79, 0x40, 0x48, 0xbf, 0x7f, 0x0d, 0xcf, 0xe9, 0x5a, 0xa0,
+    0xe8, 0xc9, 0xa7, 0x4a, 0x85, 0xd5, 0x2e, 0x88, 0x31, 0xa6, 0xd1, 0xcb, 0x16, 0x19, 0xc1, 0x3e,
+    0xb5, 0x53, 0x53, 0x92, 0x18, 0x86, 0x9f, 0x2b, 0x96, 0x54, 0xf3, 0x04, 0x33, 0x73, 0xc9, 0x6c,
+    0x0c, 0x7e, 0x79, 0xae, 0x8e, 0xdb, 0x4a, 0x8e, 0xef, 0x4c, 0x7b, 0xb1, 0x29, 0x85, 0xfc, 0xdd,
+    0xb1, 0xf6, 0x04, 0x71, 0xd6, 0xaa, 0x6a, 0xda, 0x4d, 0xe5, 0xde, 0x98, 0x44, 0x51, 0xef, 0x9a,
+    0x74, 0x52, 0x09, 0xe0, 0x0c, 0x63, 0x8f, 0xd0, 0xfe, 0x75, 0x95, 0x01, 0x9a, 0x26, 0xb9, 0xb7,
+    0xd4, 0x6d, 0x94, 0x79, 0x71, 0x6c, 0xc9, 0xe5, 0x94, 0xee, 0xc0, 0x03, 0xf0, 0xcf, 0xe7, 0x52,
+    0x48, 0x66, 0x66, 0xb5, 0x8e, 0x59, 0x9e, 0x3d, 0xd8, 0x51, 0x9e, 0x78, 0x19, 0x38, 0xc7, 0xae,
+    0x07, 0xeb, 0x58, 0x9e, 0x24, 0xd6, 0x6e, 0xe5, 0xb8, 0x5b, 0x4b, 0x58, 0x00, 0x87, 0x02, 0x42,
+    0xeb, 0xce, 0xd6, 0xf4, 0x34, 0xef, 0x0d, 0x5b, 0xc6, 0xc8, 0x66, 0x95, 0xd9, 0xe4, 0xf3, 0x02,
+    0x6d, 0x27, 0x2c, 0x77, 0x31, 0x04, 0xfd, 0x30, 0x6b, 0xaa, 0xd6, 0x6e, 0x2d, 0x61, 0xd0, 0x56,
+    0xd9, 0x61, 0x08, 0x5c, 0x34, 0x7e, 0x66, 0x0f, 0x04, 0xe3, 0x1f, 0x99, 0xae, 0x15, 0xb4, 0x69,
+    0xe5, 0x86, 0x66, 0xb3, 0x85, 0xda, 0x38, 0x5f, 0xcc, 0x61, 0x22, 0x7d, 0xee, 0x31, 0x91, 0xfc,
+    0xf1, 0x46, 0x85, 0xa3, 0xc1, 0x25, 0xe5, 0xb0, 0xb9, 0x69, 0x51, 0x99, 0x96, 0x42, 0x0a, 0xed,
+    0xda, 0x71, 0xfc, 0xb1, 0xfc, 0xea, 0xdd, 0xd6, 0x9c, 0x62, 0x92, 0xfc, 0x4c, 0xb2, 0x79, 0x32,
+    0x10, 0x52, 0x40, 0x3e, 0xe8, 0x19, 0xfe, 0x43, 0x15, 0xa4, 0x9a, 0x3a, 0xdd, 0x69, 0x90, 0x2e,
+    0x9c, 0x5b, 0x70, 0x8b, 0x77, 0x98, 0xc8, 0x57, 0x2e, 0x14, 0x63, 0xf5, 0xab, 0xb6, 0x5a, 0x24,
+    0x30, 0xc8, 0xcf, 0x30, 0x65, 0x9c, 0x5c, 0x1c, 0x9e, 0xfb, 0x79, 0xc9, 0xfc, 0xc5, 0x5e, 0xd4,
+    0xee, 0x25, 0x9f, 0xcd, 0x58, 0xee, 0x0a, 0xac, 0xa1, 0x15, 0x4f, 0x4d, 0xa0, 0x77, 0xac, 0x0b,
+    0x0d, 0x35, 0xb4, 0xe8, 0xae, 0xa7, 0xb9, 0x3b, 0xde, 0x2f, 0x92, 0x09, 0x0f, 0x72, 0x41, 0xe7,
+    0x1f, 0x8d, 0x67, 0x68, 0xd7, 0x50, 0x4f, 0xa8, 0x5e, 0xad, 0xcc, 0x4e, 0xea, 0xa8, 0x4a, 0x6c,
+    0x1c, 0xab, 0x10, 0x3f, 0x5c, 0x57, 0x6b, 0xa6, 0xe8, 0x6d, 0x33, 0x2d, 0xbb, 0x46, 0xb3, 0xc6,
+    0x64, 0x8e, 0x40, 0xcc, 0x7d, 0x87, 0x3f, 0xa1, 0xae, 0x9a, 0x45, 0x8a, 0x33, 0x6a, 0x1e, 0x0d,
+    0xe4, 0x0f, 0xde, 0x2a, 0x9f, 0x94, 0x1c, 0x71, 0x9f, 0xe7, 0xf8, 0xd5, 0x8b, 0x8b, 0xeb, 0x2b,
+    0xed, 0x2e, 0xd8, 0x99, 0x21, 0x88, 0xae, 0xd9, 0x02, 0x86, 0xc1, 0xdb, 0xb4, 0xfe, 0xb9, 0x35,
+    0xcb, 0x6b, 0x12, 0x5b, 0x5b, 0x0b, 0xf6, 0x75, 0x56, 0x76, 0x93, 0xf7, 0x6c, 0x0e, 0x4f, 0x3c,
+    0x83, 0xf4, 0xc6, 0x2b, 0x03, 0x4f, 0xb2, 0xbd, 0xbf, 0xba, 0x96, 0xfa, 0x58, 0x1d, 0x60, 0xb7,
+    0x93, 0xf7, 0x72, 0x83, 0xc1, 0x61, 0xc6, 0xdf, 0x71, 0x59, 0xd7, 0xa9, 0x79, 0x01, 0x9a, 0xe2,
+    0x1b, 0x46, 0x78, 0xe7, 0x94, 0x2a, 0xf1, 0xce, 0x39, 0xed, 0xf5, 0xfe, 0x54, 0xff, 0x00, 0x0e,
+    0xe9, 0x57, 0x06, 0x4b, 0x59, 0x9a, 0x19, 0x22, 0x9e, 0x22, 0xa1, 0x95, 0xf8, 0x19, 0x0f, 0xcf,
+    0xe1, 0xce, 0x6b, 0xd7, 0x6d, 0xe1, 0xd3, 0x75, 0x6d, 0x12, 0x44, 0x9e, 0x5b, 0x68, 0xa4, 0x8d,
+    0x97, 0x7e, 0x39, 0x3b, 0x87, 0xb7, 0xe0, 0x73, 0x4f, 0xdd, 0x05, 0xc4, 0x7f, 0x67, 0x86, 0x48,
+    0x7e, 0x46, 0xde, 0xc5, 0x31, 0xf7, 0x47, 0x41, 0xfd, 0x2a, 0x96, 0xa7, 0x26, 0x95, 0x7e, 0x86,
+    0x78, 0xe5, 0x85, 0xa6, 0xc6, 0xcd, 0x80, 0x7d, 0xd0, 0xa4, 0x02, 0x6a, 0x86, 0x89, 0xf6, 0x3b,
+    0xdb, 0x67, 0xb6, 0x7b, 0xa0, 0xad, 0x9e, 0x77, 0xa8, 0x27, 0xa7, 0xff, 0x00, 0xae, 0xad, 0x78,
+    0x89, 0x6d, 0x53, 0x4a, 0xfb, 0x35, 0x95, 0xd2, 0x89, 0x10, 0x2a, 0x8d, 0x83, 0x3b, 0x89, 0x6e,
+    0x9f, 0x41, 0x8a, 0xe2, 0x35, 0xdd, 0x53, 0xec, 0x0f, 0x07, 0x97, 0xfb, 0xe7, 0x2b, 0xf3, 0x60,
+    0x75, 0xe0, 0x6e, 0x39, 0xfc, 0x4d, 0x51, 0xb8, 0x37, 0x82, 0x16, 0x70, 0x81, 0xc3, 0xb8, 0x01,
+    0x73, 0xd0, 0x67, 0x91, 0xf9, 0x56, 0xbe, 0x90, 0x6e, 0xb5, 0x6d, 0x15, 0x61, 0x9e, 0x3c, 0x02,
+    0x5d, 0xfe, 0x63, 0x80, 0x00, 0x04, 0x1f, 0xcb, 0xa5, 0x53, 0xf0, 0x97, 0x87, 0x35, 0x19, 0xa4,
+    0x9a, 0x6d, 0x3e, 0x00, 0x20, 0x12, 0x11, 0xb9, 0x88, 0x3b, 0xc6, 0x08, 0x27, 0xf9, 0xd7, 0xa2,
+    0x69, 0x7a, 0x7e, 0xa7, 0x69, 0x79, 0x67, 0x0b, 0x46, 0x82, 0x19, 0x5e, 0x35, 0x77, 0xdc, 0x3e,
+    0x55, 0xc6, 0x0f, 0xd3, 0xad, 0x5f, 0xd4, 0xac, 0x2f, 0x27, 0xfb, 0x4d, 0xd4, 0x76, 0x68, 0x89,
+    0x39, 0xf2, 0xd0, 0x74, 0xe8, 0x48, 0xcf, 0xe4, 0x7f, 0x4a, 0xf3, 0x24, 0xf0, 0xa6, 0xaf, 0x23,
+    0x3d, 0xde, 0x36, 0xda, 0xc2, 0xb1, 0x80, 0xa4, 0xf5, 0x0b, 0x5a, 0xbe, 0x05, 0xf0, 0xda, 0x6a,
+    0x9a, 0x8d, 0xcb, 0xea, 0x12, 0xb0, 0x68, 0xdd, 0x00, 0xdc, 0x33, 0x95, 0xf4, 0x1f, 0x85, 0x7b,
+    0x3c, 0x7e, 0x12, 0xd2, 0x5f, 0x45, 0x48, 0x2d, 0x94, 0xa4, 0x64, 0x1f, 0x2d, 0x81, 0xc7, 0x24,
+    0xf0, 0x6b, 0x98, 0xd5, 0xfc, 0x37, 0xa6, 0x69, 0xd7, 0x16, 0xb3, 0x7f, 0xac, 0x96, 0x06, 0xf9,
+    0xe3, 0xcf, 0x04, 0x8e, 0x6a, 0x3b, 0xdf, 0x0b, 0xd8, 0xcd, 0xa9, 0xbc, 0xd1, 0xc7, 0x2c, 0x9f,
+    0x69, 0x45, 0x8c, 0x80, 0xdc, 0x11, 0x8e, 0x40, 0xf7, 0xeb, 0x58, 0x97, 0x1a, 0x4d, 0x9c, 0x3a,
+    0x5c, 0xe2, 0xd1, 0x04, 0x57, 0x0d, 0x33, 0xa0, 0x04, 0xe7, 0x0a, 0x03, 0x2f, 0x3e, 0xbd, 0x05,
+    0x73, 0xcb, 0x11, 0x82, 0xda, 0xf4, 0x40, 0xaf, 0xbe, 0x52, 0x58, 0xb2, 0x1e, 0x0e, 0x06, 0x08,
+    0x1f, 0x95, 0x4b, 0x75, 0x66, 0xa6, 0xde, 0x06, 0x41, 0x0c, 0x13, 0x12, 0x48, 0x03, 0x83, 0x86,
+    0xed, 0x51, 0xd8, 0xcd, 0x6f, 0x6a, 0xdf, 0x66, 0x7b, 0x77, 0x79, 0xd4, 0x8d, 0xd2, 0xfe, 0x18,
+    0xc9, 0xf6, 0xcf, 0xf3, 0xac, 0xc9, 0x67, 0x96, 0xf7, 0x55, 0x5f, 0xb3, 0xb0, 0x54, 0x89, 0xb7,
+    0x05, 0x5f, 0xe2, 0xc1, 0xc6, 0x3f, 0x1a, 0x4b, 0xf4, 0x71, 0x1a, 0x34, 0xb1, 0xdb, 0xbc, 0x7d,
+    0x54, 0x77, 0xcb, 0x64, 0x63, 0xf3, 0x35, 0x2d, 0xbc, 0x90, 0xda, 0x58, 0xb5, 0xd4, 0xea, 0xf3,
+    0x47, 0x70, 0x54, 0x22, 0xaf, 0x5d, 0xcd, 0xfc, 0xba, 0x53, 0xf4, 0x5d, 0x75, 0x67, 0xd2, 0xe4,
+    0xb0, 0xb5, 0xb2, 0x08, 0xca, 0x8f, 0xb9, 0x81, 0xcb, 0x10, 0x5c, 0xf4, 0xfc, 0xf1, 0x5d, 0xfe,
+    0x97, 0x75, 0x16, 0x9b, 0xa1, 0x28, 0xd3, 0x2c, 0xda, 0x0b, 0x65, 0x70, 0xee, 0xa7, 0xef, 0x15,
+    0x1d, 0x0f, 0xeb, 0x4c, 0xf0, 0xea, 0xde, 0xdc, 0x6a, 0x09, 0x24, 0xb1, 0xc8, 0xb6, 0xa9, 0xe5,
+    0xc9, 0x87, 0xea, 0x43, 0x38, 0x6c, 0x9f, 0xc0, 0xfe, 0x95, 0xd3, 0x6a, 0x02, 0x35, 0x89, 0x11,
+    0xcb, 0xa2, 0xc6, 0xe5, 0xd5, 0x4e, 0x70, 0x54, 0x8c, 0x1f, 0xeb, 0x49, 0xaa, 0x68, 0x76, 0xb7,
+    0x1e, 0x19, 0x9a, 0x3b, 0x59, 0xcc, 0x52, 0x28, 0x47, 0x5c, 0x36, 0x08, 0xcb, 0x2f, 0x07, 0xf2,
+    0x3f, 0x9d, 0x63, 0xf8, 0x2f, 0x46, 0x78, 0x12, 0xfa, 0xd9, 0x9d, 0x44, 0xaa, 0xd1, 0xb7, 0x98,
+    0x5b, 0x38, 0xf9, 0x58, 0x63, 0xe9, 0x92, 0x2b, 0xd1, 0xb4, 0x91, 0xf6, 0x7d, 0x2a, 0x15, 0xb9,
+    0x31, 0x87, 0x5c, 0x96, 0xc1, 0xe3, 0xef, 0x1e, 0x6b, 0x1b, 0x57, 0xd2, 0x6d, 0x27, 0x96, 0x77,
+    0x2e, 0xd2, 0x6c, 0x2d, 0x29, 0x5c, 0xf1, 0x96, 0xea, 0x3f, 0x4a, 0xc8, 0x93, 0x51, 0x92, 0xcc,
+    0x38, 0x40, 0xaa, 0xbe, 0x5e, 0xe2, 0xdd, 0x93, 0xef, 0x72, 0x3f, 0x2f, 0xd6, 0xbc, 0xab, 0x55,
+    0xd7, 0xac, 0x0d, 0x8c, 0x8d, 0x71, 0x31, 0x0d, 0x1d, 0xcb, 0x85, 0x25, 0xb1, 0xb4, 0x7c, 0xe0,
+    0x93, 0xf8, 0x9a, 0xc1, 0xd3, 0xef, 0x2e, 0x26, 0xd4, 0x2d, 0x92, 0x09, 0x0c, 0x90, 0xcc, 0xf8,
+    0x24, 0x1c, 0x00, 0x0f, 0x04, 0xfe, 0xa3, 0xf2, 0xae, 0xb6, 0x3d, 0x46, 0x06, 0xba, 0xb4, 0x8a,
+    0xee, 0x14, 0x50, 0x83, 0x63, 0x16, 0xfe, 0xe9, 0xee, 0x2a, 0xde, 0xb9, 0x25, 0x83, 0xc5, 0x7d,
+    0x15, 0x90, 0x03, 0x28, 0x58, 0x67, 0xae, 0x07, 0x6f, 0xf3, 0xed, 0x5c, 0x4e, 0x81, 0x3e, 0xf9,
+    0x24, 0x58, 0xb6, 0xa4, 0x69, 0x86, 0x32, 0xb7, 0x7c, 0x03, 0x91, 0xf9, 0xd5, 0xbb, 0xeb, 0xb8,
+    0x61, 0x5b, 0x38, 0xa7, 0x99, 0x59, 0x43, 0x91, 0x11, 0xc7, 0xcc, 0xd9, 0xcf, 0xe9, 0x57, 0x7c,
+    0x30, 0x22, 0xd5, 0xad, 0xe6, 0xb7, 0x58, 0xca, 0x9b, 0x52, 0xae, 0xbe, 0xe3, 0xa7, 0xf3, 0xcd,
+    0x5c, 0xf0, 0x6e, 0x89, 0x04, 0xd7, 0x76, 0xff, 0x00, 0x65, 0xdc, 0xa5, 0x27, 0x9f, 0xcc, 0xdf,
+    0xf7, 0x88, 0x12, 0x8e, 0x9e, 0xd5, 0xec, 0x36, 0xfa, 0x1c, 0x13, 0x88, 0xc3, 0x2e, 0xc8, 0x72,
+    0x49, 0x50, 0x7e, 0xee, 0x06, 0x06, 0x7d, 0x7a, 0x54, 0x57, 0x90, 0x35, 0xbc, 0xed, 0x02, 0xed,
+    0x96, 0xd8, 0xc4, 0x43, 0x9c, 0xed, 0x62, 0x8b, 0xe9, 0xee, 0x30, 0x3f, 0x2a, 0xf3, 0xbd, 0x77,
+    0xc4, 0x73, 0xdc, 0xde, 0x47, 0x05, 0xb0, 0x91, 0x95, 0x98, 0xab, 0x96, 0xfe, 0xef, 0x00, 0x91,
+    0xfa, 0x55, 0xcf, 0x15, 0xdf, 0x9b, 0x2f, 0x0a, 0xb4, 0xae, 0xd2, 0x2c, 0xb2, 0x05, 0xf9, 0x14,
+    0xf2, 0xd9, 0xd8, 0x00, 0xfe, 0x7f, 0x9d, 0x73, 0xbe, 0x05, 0xf3, 0x24, 0xfe, 0xd9, 0xba, 0xbf,
+    0x95, 0xc3, 0xb2, 0x2a, 0x47, 0x17, 0x99, 0xc9, 0xe1, 0xb9, 0xfd, 0x56, 0xbb, 0x4b, 0xdf, 0x1d,
+    0x5b, 0x58, 0xda, 0x5a, 0x45, 0x2c, 0x48, 0xe1, 0x91, 0x44, 0xae, 0x24, 0xce, 0xd0, 0x48, 0xc9,
+    0xfc, 0xea, 0x9e, 0x9f, 0xe3, 0x28, 0x13, 0x4f, 0xb9, 0x86, 0x10, 0x65, 0x9e, 0x49, 0x86, 0xe7,
+    0xdf, 0xc8, 0x00, 0xf6, 0xfc, 0x07, 0xeb, 0x55, 0xf5, 0x7f, 0x16, 0x5a, 0xc1, 0xaa, 0x5a, 0x5b,
+    0xcc, 0x07, 0xd9, 0xe4, 0x01, 0x36, 0xf0, 0x3b, 0x1c, 0x1c, 0xfd, 0x0e, 0x6b, 0xcd, 0xfc, 0x5f,
+    0xa7, 0x69, 0xba, 0xe4, 0x3e, 0x64, 0x12, 0xac, 0x71, 0x6f, 0x62, 0x22, 0xdd, 0xd4, 0x31, 0x24,
+    0xe6, 0xb9, 0xfb, 0x1b, 0x5d, 0x4a, 0x29, 0x6d, 0xfe, 0xcd, 0x34, 0x53, 0x47, 0x2e, 0x17, 0x62,
+    0x1c, 0x6d, 0xc2, 0x83, 0x5d, 0x7e, 0x9b, 0xe6, 0x32, 0x42, 0xf7, 0x42, 0x3f, 0xb4, 0xdb, 0xa8,
+    0x1d, 0x73, 0xbc, 0x75, 0x38, 0xf5, 0xe0, 0xe2, 0xac, 0x6a, 0xf7, 0x72, 0xcb, 0x6a, 0x92, 0xc3,
+    0x19, 0x4c, 0x3e, 0x31, 0xd0, 0xb2, 0x1e, 0xb9, 0xfc, 0x05, 0x73, 0xf7, 0x92, 0xdb, 0x41, 0xa5,
+    0x6d, 0xb3, 0xf3, 0x4c, 0x53, 0x31, 0x76, 0x73, 0xc6, 0xd3, 0xd3, 0x03, 0xfc, 0xf7, 0xac, 0x08,
+    0x75, 0x35, 0xbc, 0x95, 0x1a, 0xe5, 0x19, 0xd6, 0x1b, 0x8f, 0x29, 0x18, 0x75, 0xc1, 0xc8, 0xcf,
+    0xe6, 0x2b, 0xb7, 0x9a, 0xfa, 0xda, 0xd1, 0xc5, 0xc4, 0x72, 0x85, 0x8e, 0x44, 0x2c, 0xcb, 0x18,
+    0xc1, 0x23, 0x1c, 0x7e, 0xb9, 0xfc, 0xeb, 0x77, 0xe1, 0xf4, 0xb2, 0xd9, 0xce, 0xec, 0xa9, 0x21,
+    0x9c, 0xa3, 0x15, 0x3b, 0xb3, 0x90, 0x5b, 0x23, 0xf9, 0x57, 0xb0, 0x60, 0xdf, 0xe9, 0xe8, 0xb1,
+    0x05, 0x8e, 0x68, 0xc7, 0xce, 0x80, 0xf2, 0x78, 0xc8, 0x1f, 0x5e, 0xb5, 0x4a, 0x43, 0x35, 0xc4,
+    0x32, 0x24, 0x8d, 0x09, 0x96, 0x35, 0x2a, 0x8e, 0x0e, 0x38, 0xe0, 0x63, 0xf3, 0x35, 0xc4, 0x3f,
+    0x85, 0xee, 0x12, 0xd1, 0x9e, 0xe1, 0xc2, 0xc8, 0xc0, 0xc7, 0xc3, 0x63, 0x03, 0x27, 0xa7, 0xe9,
+    0x5c, 0x57, 0xc4, 0xb9, 0xe7, 0x8a, 0xc1, 0xdd, 0x25, 0xcc, 0x10, 0xa8, 0x8d, 0x99, 0x87, 0x19,
+    0xdc, 0xbc, 0x8f, 0xd2, 0xb8, 0x6b, 0x3d, 0x72, 0x69, 0x6c, 0xe1, 0x89, 0x25, 0x95, 0x64, 0xe5,
+    0x4b, 0x63, 0x96, 0x24, 0xe0, 0x0f, 0xa7, 0x5f, 0xca, 0xa9, 0xea, 0x96, 0x17, 0x96, 0xf6, 0xc2,
+    0x7b, 0xb9, 0x5d, 0x30, 0x37, 0xe1, 0xba, 0x37, 0x27, 0x1f, 0x81, 0x35, 0xaf, 0xa7, 0x06, 0x8a,
+    0xea, 0x19, 0x84, 0xca, 0x4d, 0xca, 0x99, 0x15, 0x58, 0xf4, 0xcf, 0x1f, 0xca, 0xb2, 0xbc, 0x51,
+    0x71, 0x76, 0xcc, 0x8f, 0x32, 0xe1, 0x15, 0x82, 0xc6, 0xca, 0xdc, 0xb1, 0x04, 0x74, 0xfc, 0x73,
+    0xf8, 0x56, 0x4c, 0x64, 0xdb, 0xc8, 0x0c, 0xb2, 0xb4, 0x40, 0xb1, 0x6c, 0x1e, 0x71, 0x9e, 0x0e,
+    0x7e, 0xa7, 0x26, 0xba, 0xd9, 0xe5, 0xfb, 0x05, 0xfa, 0x47, 0x6b, 0x1a, 0xbc, 0x2b, 0x08, 0x79,
+    0x19, 0x4e, 0x30, 0x48, 0xed, 0xe9, 0xc6, 0x47, 0xe1, 0x5b, 0x3a, 0x3a, 0xb3, 0x25, 0xba, 0xb6,
+    0xd6, 0xcb, 0x07, 0x55, 0x04, 0xee, 0xe4, 0x10, 0x47, 0xe4, 0x01, 0xad, 0x4d, 0x76, 0xfe, 0xd6,
+    0x48, 0x01, 0x52, 0xb1, 0x4b, 0x14, 0x60, 0x30, 0x73, 0xd4, 0x73, 0xd3, 0xf3, 0x00, 0x57, 0x38,
+    0x74, 0xe9, 0x35, 0x04, 0x46, 0x88, 0x3c, 0xb6, 0xd2, 0x29, 0xdb, 0x8e, 0x36, 0x90, 0xb9, 0xe9,
+    0xf9, 0x7e, 0x55, 0x9b, 0x6b, 0x66, 0xd6, 0x5a, 0xb4, 0x91, 0x2c, 0x09, 0x24, 0x6b, 0xc1, 0x66,
+    0x3c, 0x74, 0xcf, 0xe7, 0xd6, 0xa4, 0xb7, 0xf3, 0x4c, 0x97, 0x8e, 0x0b, 0xb2, 0x07, 0x60, 0x14,
+    0x8e, 0x40, 0xe0, 0x00, 0x0f, 0xe7, 0x5e, 0xa7, 0xe0, 0xf7, 0x5d, 0x0f, 0xc2, 0xd6, 0x37, 0x37,
+    0x77, 0x10, 0x19, 0xe6, 0x25, 0xc8, 0x7f, 0xbe, 0x01, 0x62, 0x40, 0xfc, 0x33, 0x5d, 0xee, 0x9d,
+    0xad, 0xd8, 0xa6, 0x99, 0x24, 0xf1, 0xb0, 0x4b, 0xa5, 0x8d, 0xa4, 0xe4, 0xe0, 0x3b, 0x1c, 0xe0,
+    0x7e, 0x42, 0xb0, 0xb4, 0x9d, 0x4a, 0x7d, 0x4b, 0x52, 0x8e, 0x13, 0xe5, 0xb6, 0xc5, 0x0e, 0x17,
+    0x3c, 0x32, 0xee, 0xc9, 0xcf, 0xbf, 0x18, 0xab, 0xde, 0x27, 0xd5, 0xa2, 0x8e, 0x3f, 0x36, 0x69,
+    0x40, 0x8c, 0x87, 0xd8, 0x47, 0x1c, 0x8e, 0xc0, 0x7b, 0xf3, 0x5e, 0x69, 0xe3, 0x09, 0x6d, 0xaf,
+    0xed, 0x6f, 0xe3, 0x33, 0x46, 0xd3, 0x4d, 0x22, 0x24, 0x71, 0x67, 0x8e, 0x18, 0x7f, 0x8f, 0x5a,
+    0xe5, 0x20, 0xf0, 0xb4, 0x70, 0xc1, 0x13, 0xb5, 0xc1, 0xf3, 0x61, 0x93, 0xcc, 0x77, 0x1d, 0x06,
+    0x0e, 0x40, 0xfd, 0x68, 0xf1, 0x05, 0xc8, 0xba, 0x61, 0x69, 0x77, 0x6e, 0x5a, 0x36, 0x5d, 0xb9,
+    0xc7, 0x39, 0x5f, 0xba, 0x3f, 0x5c, 0xfe, 0x35, 0xcd, 0xb6, 0x5f, 0x59, 0x85, 0xed, 0x58, 0xab,
+    0xc4, 0x3c, 0xb5, 0x18, 0xe3, 0x20, 0xf3, 0xf8, 0x64, 0xd7, 0x4d, 0x61, 0x05, 0xa4, 0xf6, 0x93,
+    0x47, 0xaa, 0xae, 0x65, 0xb7, 0x95, 0x8a, 0x14, 0x1d, 0xb2, 0x31, 0xf9, 0x9f, 0xe5, 0x58, 0x1e,
+    0x26, 0x9e, 0xd6, 0x2b, 0xa2, 0x16, 0xdd, 0x1c, 0xac, 0x00, 0x95, 0xe9, 0xf3, 0x12, 0x40, 0xe7,
+    0xd8, 0x1a, 0xd2, 0xd1, 0xad, 0xe1, 0x77, 0x4b, 0xc9, 0x66, 0x69, 0x1b, 0xab, 0x2e, 0xee, 0x8a,
+    0x3a, 0x71, 0xe9, 0xc1, 0xad, 0xdb, 0x7b, 0x41, 0x77, 0xf6, 0x69, 0xad, 0xb7, 0x2c, 0x81, 0x57,
+    0x25, 0x7d, 0x08, 0xc6, 0x00, 0xfa, 0x71, 0x52, 0x78, 0x9f, 0x4e, 0xb6, 0x1a, 0x3c, 0x31, 0x48,
+    0x4a, 0x4c, 0xfc, 0xa3, 0x0f, 0xbc, 0x15, 0x40, 0xc0, 0x3f, 0x43, 0x9a, 0x66, 0x85, 0xf6, 0x95,
+    0xf0, 0xd6, 0x2d, 0xce, 0xc6, 0x32, 0xb9, 0x59, 0x18, 0x13, 0xbb, 0x8e, 0x6b, 0x09, 0x2e, 0x57,
+    0xfb, 0x40, 0x90, 0x77, 0x22, 0xa0, 0x53, 0xb8, 0xf5, 0x71, 0xc6, 0x7f, 0x5a, 0xee, 0x7c, 0x11,
+    0xe1, 0xe9, 0x6f, 0xef, 0x1e, 0x16, 0x74, 0x71, 0x71, 0x2e, 0x1d, 0x4f, 0x45, 0x52, 0x72, 0x71,
+    0xef, 0x80, 0x7f, 0x3a, 0xdf, 0xf1, 0x3e, 0x81, 0x0e, 0x95, 0x21, 0x49, 0xe4, 0xf3, 0xd1, 0x32,
+    0xc8, 0x4f, 0xa7, 0x60, 0x3f, 0x2a, 0x72, 0xaa, 0xea, 0x10, 0xc1, 0x12, 0x85, 0x59, 0x55, 0x76,
+    0x79, 0x7d, 0x0e, 0xc3, 0xd3, 0xea, 0x7f, 0xc6, 0x92, 0xef, 0xca, 0xf0, 0xe5, 0xc8, 0x9c, 0xc9,
+    0xb2, 0x58, 0x91, 0x42, 0xf1, 0xf7, 0x8f, 0x3c, 0x1a, 0xe5, 0xb5, 0x8d, 0x5e, 0x4d, 0x6a, 0x25,
+    0x66, 0x21, 0x8a, 0x02, 0x40, 0xe8, 0x07, 0x3d, 0x7f, 0x5a, 0xc5, 0x5d, 0x3e, 0x5d, 0x4b, 0x64,
+    0x92, 0x11, 0xf6, 0x88, 0x0f, 0xca, 0x07, 0x1b, 0x89, 0x24, 0xff, 0x00, 0x21, 0xfa, 0x56, 0xfd,
+    0xfd, 0xd5, 0xb9, 0xb7, 0xf2, 0x14, 0xaa, 0x3b, 0x29, 0x0c, 0x4f, 0x62, 0x7a, 0xff, 0x00, 0x4a,
+    0xc6, 0xbf, 0xbc, 0xb5, 0x6b, 0x17, 0x5b, 0x88, 0xa1, 0x69, 0xa3, 0x72, 0xe8, 0x55, 0xb9, 0x2d,
+    0xb7, 0x1f, 0xcc, 0x57, 0x3d, 0x7b, 0x35, 0xa4, 0xb6, 0xab, 0xf6, 0x14, 0x71, 0x70, 0x59, 0x19,
+    0x80, 0xfe, 0x13, 0xb8, 0xb3, 0x73, 0xf8, 0x8a, 0x99, 0xae, 0xed, 0x63, 0x11, 0x45, 0x38, 0x61,
+    0x33, 0xe5, 0xb0, 0x3a, 0x15, 0xda, 0x31, 0xfa, 0x9a, 0xe6, 0xfc, 0x47, 0x16, 0x6f, 0xe7, 0x13,
+    0xab, 0xb2, 0x5c, 0x32, 0xb2, 0x10, 0x3e, 0xee, 0x38, 0xc7, 0xf2, 0xae, 0xbb, 0x4b, 0xf0, 0xe2,
+    0xe9, 0x3a, 0x62, 0xb2, 0x4c, 0x1a, 0xf6, 0x54, 0x01, 0x72, 0x72, 0x30, 0x48, 0xc8, 0xc7, 0xd3,
+    0x35, 0xd0, 0xf8, 0x6e, 0xe6, 0xf2, 0x18, 0x85, 0xa1, 0x89, 0x70, 0x8e, 0x70, 0xe0, 0x73, 0x90,
+    0x70, 0x07, 0xe5, 0x8a, 0x3c, 0x40, 0x16, 0xe2, 0xe9, 0x2e, 0xc9, 0x52, 0x36, 0x6c, 0x54, 0x3d,
+    0xc3, 0x75, 0x3f, 0xa5, 0x66, 0x78, 0x4f, 0x5a, 0x49, 0xa7, 0x5b, 0x38, 0x1f, 0xcd, 0xb6, 0x0c,
+    0x50, 0x80, 0x78, 0x04, 0x71, 0x8f, 0xd2, 0xaa, 0xdc, 0xf8, 0x7d, 0xaf, 0x6f, 0x23, 0x5b, 0x55,
+    0x54, 0x8f, 0xe6, 0x24, 0xff, 0x00, 0x12, 0xe0, 0x83, 0xff, 0x00, 0xd6, 0xae, 0xda, 0xcf, 0xcf,
+    0xd1, 0x0c, 0x11, 0xd9, 0x92, 0x64, 0x91, 0xd4, 0x0e, 0x71, 0x8c, 0x93, 0x96, 0xfc, 0xbf, 0x9d,
+    0x6b, 0x78, 0x96, 0xe2, 0x5b, 0xe3, 0x13, 0x48, 0xd1, 0xb8, 0x31, 0x79, 0x6c, 0x41, 0xe5, 0x08,
+    0x24, 0x93, 0xf5, 0xc5, 0x10, 0x4f, 0x68, 0xc7, 0xed, 0xe3, 0x31, 0x4b, 0x01, 0x01, 0x01, 0xff,
+    0x00, 0x96, 0x81, 0x46, 0x38, 0xfc, 0xaa, 0xbe, 0xbf, 0x14, 0xf7, 0x4c, 0xe9, 0x70, 0x10, 0xdb,
+    0x30, 0xc2, 0xb7, 0x5c, 0x92, 0x49, 0x3c, 0xf6, 0xe3, 0x8a, 0xe5, 0xe5, 0xb1, 0x94, 0x79, 0xcb,
+    0x6b, 0xb1, 0x0a, 0x9f, 0x90, 0x03, 0x8d, 0xc0, 0x75, 0xfd, 0x73, 0x5c, 0xf5, 0xe5, 0xfb, 0xd9,
+    0xcf, 0x6c, 0x0e, 0xfd, 0xef, 0x19, 0xf9, 0xf3, 0xf2, 0x8c, 0x71, 0x93, 0xf5, 0xff, 0x00, 0x1a,
+    0xe7, 0xce, 0xa7, 0x3c, 0x3a, 0xac, 0x92, 0x5e, 0xa9, 0x92, 0xd8, 0x37, 0xc8, 0x50, 0xfa, 0x8c,
+    0xd5, 0xdd, 0x31, 0xed, 0xee, 0x6e, 0x18, 0xb4, 0x78, 0x79, 0x24, 0xdc, 0x25, 0xea, 0x0e, 0x41,
+    0x1b, 0x68, 0xd6, 0x1d, 0xe3, 0x7f, 0x29, 0x62, 0x51, 0x0b, 0x9d, 0xa0, 0xaf, 0x62, 0x49, 0xdd,
+    0x9f, 0xc1, 0x78, 0xac, 0xab, 0xeb, 0x59, 0x73, 0xe5, 0x41, 0x2b, 0x4a, 0xc1, 0x4c, 0x68, 0xe0,
+    0x60, 0x01, 0x90, 0x4f, 0xf4, 0xae, 0xf3, 0x4e, 0xd3, 0x8e, 0xac, 0x52, 0xde, 0xea, 0x01, 0xbc,
+    0xc2, 0x50, 0x48, 0x48, 0x18, 0x3b, 0x81, 0xcf, 0xeb, 0x52, 0x78, 0x8f, 0xc9, 0xd3, 0xe3, 0xb3,
+    0x48, 0xa5, 0x63, 0x72, 0x84, 0x0c, 0x3f, 0x04, 0x37, 0x38, 0x1e, 0xf9, 0xdb, 0x9a, 0x88, 0xdf,
+    0x46, 0x37, 0xfd, 0x8e, 0x43, 0xf6, 0xa9, 0x14, 0x9d, 0xd9, 0xe3, 0x76, 0xde, 0x9f, 0x81, 0x15,
+    0x57, 0x55, 0xd4, 0x56, 0xf2, 0x08, 0x2d, 0xe3, 0x97, 0xca, 0xba, 0x8e, 0x35, 0x1b, 0x40, 0xce,
+    0xf2, 0x07, 0x4f, 0xd4, 0x9a, 0x8b, 0xc1, 0xd6, 0x43, 0x53, 0x6b, 0x68, 0x2c, 0xcc, 0x71, 0xc8,
+    0x8e, 0x77, 0x90, 0xa0, 0x73, 0xcf, 0x3f, 0x5e, 0xf5, 0xe8, 0x37, 0xda, 0x7d, 0xd0, 0x9d, 0x8d,
+    0xba, 0x24, 0x7c, 0x15, 0x76, 0x1c, 0xee, 0x6c, 0x75, 0xfa, 0x71, 0x54, 0x2e, 0xb5, 0x55, 0xb8,
+    0xd5, 0x65, 0x2f, 0x06, 0xd1, 0x0a, 0x0d, 0x8a, 0x9c, 0xf0, 0x06, 0x48, 0xfd, 0x00, 0xfc, 0x68,
+    0x92, 0xed, 0xfe, 0xc3, 0x1c, 0xcf, 0x00, 0x58, 0x9d, 0xb2, 0x58, 0x9c, 0x10, 0x48, 0xc0, 0x1f,
+    0xce, 0xab, 0x78, 0xa2, 0xea, 0x2b, 0xad, 0x2d, 0xa3, 0xb2, 0x66, 0x59, 0x61, 0xcb, 0x9d, 0xad,
+    0xd0, 0xe3, 0x07, 0xf2, 0xac, 0xeb, 0x0d, 0x42, 0x48, 0xe0, 0x7b, 0x7b, 0x89, 0x77, 0x3c, 0x69,
+    0x96, 0x25, 0xb3, 0xb8, 0xf2, 0x09, 0x1e, 0xd8, 0xfe, 0x75, 0x0e, 0x8c, 0xb7, 0xd1, 0xdc, 0xdc,
+    0x6a, 0x57, 0x6a, 0x64, 0x81, 0xcb, 0xac, 0x31, 0xf3, 0xd3, 0xee, 0xe7, 0xdb, 0xd6, 0xb0, 0xfc,
+    0x4b, 0xa0, 0x5d, 0x5b, 0x48, 0xe8, 0x65, 0x25, 0x24, 0x5d, 0xea, 0xe0, 0xf2, 0xaa, 0x3f, 0xc3,
+    0xfc, 0x2b, 0x8b, 0xd2, 0x61, 0x72, 0xad, 0x14, 0x8f, 0x24, 0xb2, 0x23, 0x79, 0x62, 0x33, 0xc6,
+    0x46, 0xd1, 0xd3, 0xf1, 0x15, 0xdc, 0xe8, 0xcb, 0x0b, 0xc8, 0x88, 0x91, 0xb3, 0x23, 0x16, 0x31,
+    0xb2, 0xf4, 0x56, 0x24, 0x60, 0x11, 0xeb, 0x8e, 0x6b, 0x43, 0x5b, 0x8e, 0xd6, 0xc1, 0x04, 0x4e,
+    0xaa, 0x37, 0x02, 0xa8, 0xf9, 0xce, 0x59, 0x4e, 0x7f, 0x5c, 0xe2, 0xa1, 0xd1, 0xec, 0x21, 0xdb,
+    0x1d, 0xd4, 0xaa, 0xe5, 0x49, 0xc8, 0x7e, 0xc5, 0xb3, 0x83, 0xf8, 0x63, 0x1f, 0x9d, 0x6e, 0x59,
+    0xda, 0x31, 0xf0, 0xfb, 0x30, 0x99, 0x56, 0x78, 0x25, 0x04, 0x3e, 0x79, 0x61, 0x81, 0x81, 0xfc,
+    0xeb, 0x8f, 0xf1, 0x6d, 0xc8, 0xd5, 0xee, 0x96, 0x56, 0x73, 0x1b, 0xab, 0x05, 0xf9, 0xba, 0x80,
+    0x33, 0xcd, 0x60, 0x5b, 0xdc, 0x85, 0xb9, 0x37, 0x36, 0xd2, 0x32, 0x88, 0x98, 0x94, 0x2e, 0x79,
+    0x63, 0x9e, 0x78, 0xfa, 0xe2, 0xb5, 0x3c, 0x10, 0xf2, 0xea, 0x1a, 0xc3, 0x5e, 0xea, 0x8c, 0x03,
+    0xa3, 0x96, 0x50, 0x38, 0x29, 0xd3, 0xf4, 0xcd, 0x7a, 0x0d, 0xdd, 0x95, 0x9e, 0x8e, 0xef, 0x77,
+    0x67, 0x34, 0x71, 0x1d, 0xa1, 0x9d, 0x53, 0xae, 0x48, 0xe0, 0x8a, 0xd6, 0xb5, 0xd6, 0x45, 0xc6,
+    0x9b, 0x6b, 0x2c, 0xac, 0xc8, 0x0c, 0x8a, 0x40, 0x1d, 0x66, 0xce, 0x73, 0xcf, 0xa5, 0x73, 0x53,
+    0x5f, 0x1b, 0x4b, 0xb3, 0x2c, 0x28, 0x24, 0x8a, 0xe8, 0x60, 0x31, 0xe0, 0xe4, 0xd1, 0xfd, 0xa4,
+    0xef, 0xa7, 0xcd, 0x6e, 0x1e, 0x23, 0x19, 0xff, 0x00, 0x48, 0x72, 0x4e, 0x76, 0x1e, 0x9c, 0x7e,
+    0xb5, 0x93, 0x71, 0x3a, 0xef, 0x9a, 0xe6, 0x48, 0x4a, 0xc8, 0xea, 0x40, 0x55, 0x3c, 0x37, 0xcd,
+    0x8f, 0xc7, 0x39, 0x02, 0xb6, 0xfc, 0x35, 0xa0, 0xc5, 0xa8, 0x5b, 0xdc, 0xde, 0xcc, 0x24, 0x55,
+    0x55, 0x1f, 0x52, 0x3a, 0x1f, 0xff, 0x00, 0x55, 0x5b, 0x96, 0x09, 0x23, 0x86, 0x64, 0x8c, 0x96,
+    0x84, 0x80, 0xc0, 0x77, 0x40, 0x49, 0x04, 0x0f, 0xc0, 0x8a, 0xc9, 0xd7, 0xde, 0xf2, 0xde, 0xc9,
+    0x23, 0xb6, 0x0b, 0x3a, 0x82, 0x42, 0xf1, 0x92, 0x09, 0x1c, 0xe7, 0xf2, 0x1f, 0xad, 0x72, 0x7a,
+    0xec, 0x11, 0x47, 0xa7, 0xad, 0xc8, 0x93, 0x7c, 0x90, 0x81, 0xb8, 0xa8, 0xc6, 0x09, 0xce, 0x3f,
+    0x42, 0x7f, 0x2a, 0x9b, 0xc3, 0xb7, 0xc2, 0x7b, 0x89, 0x16, 0x33, 0xfb, 0xe3, 0x18, 0x0a, 0x08,
+    0xc0, 0x2c, 0xab, 0xc9, 0xfc, 0xd6, 0xb6, 0xae, 0x5e, 0x2d, 0x5a, 0xc3, 0x4f, 0x69, 0x6d, 0x98,
+    0x4d, 0x82, 0xbb, 0x98, 0xe3, 0x0d, 0xce, 0x08, 0xfc, 0x7f, 0x98, 0xa7, 0x78, 0x66, 0xee, 0x58,
+    0x6e, 0x46, 0x99, 0x72, 0xe3, 0x18, 0x2a, 0x01, 0x1d, 0x0e, 0x4f, 0x3f, 0x98, 0xab, 0x1e, 0x22,
+    0x81, 0xed, 0x22, 0x99, 0x2d, 0x9c, 0xa2, 0x79, 0x80, 0x63, 0xd4, 0x6d, 0x0a, 0x0f, 0xeb, 0xfc,
+    0xeb, 0xca, 0x7c, 0x6c, 0xd7, 0xf3, 0x5f, 0x44, 0x96, 0x61, 0xc6, 0x00, 0x79, 0x36, 0xf7, 0x62,
+    0x00, 0x1f, 0xe7, 0xda, 0xb3, 0x24, 0x96, 0x4b, 0x49, 0x12, 0xda, 0x15, 0x97, 0x66, 0xe3, 0xb5,
+    0xdb, 0xbf, 0x42, 0x7f, 0x1a, 0xd5, 0xf0, 0xf5, 0xe4, 0xb7, 0x2d, 0x24, 0xf6, 0x2b, 0x27, 0x92,
+    0xa0, 0x44, 0xe8, 0xc7, 0x1b, 0xf7, 0x9e, 0xd5, 0xe8, 0x93, 0x6b, 0x76, 0xcb, 0x65, 0x04, 0x9a,
+    0x84, 0x88, 0xf7, 0x8b, 0xb5, 0x5a, 0x21, 0xd0, 0xae, 0xdc, 0x01, 0xf9, 0x71, 0xf8, 0x55, 0x8b,
+    0x5f, 0x12, 0x62, 0x58, 0x21, 0xb3, 0x81, 0x67, 0xb6, 0x52, 0xa0, 0x86, 0x18, 0xc0, 0x03, 0xa8,
+    0xf4, 0xc7, 0xf4, 0xad, 0xad, 0x3f, 0xc3, 0xd7, 0x37, 0xd1, 0x28, 0x8d, 0x32, 0x0a, 0x2a, 0xab,
+    0x03, 0xd0, 0x0c, 0x9f, 0xf0, 0xac, 0x3b, 0xbd, 0x2d, 0xf4, 0xab, 0xab, 0xfb, 0x57, 0x20, 0xcd,
+    0x86, 0x5c, 0x9e, 0x33, 0x18, 0xef, 0xfa, 0xd6, 0x75, 0xbb, 0xa4, 0x97, 0x29, 0x12, 0x48, 0xd2,
+    0x79, 0x61, 0xdb, 0x0d, 0xd9, 0xc1, 0x39, 0x1f, 0x90, 0x15, 0xdc, 0x78, 0x12, 0xe7, 0xc8, 0x8c,
+    0x26, 0xab, 0x2b, 0x6e, 0x83, 0x08, 0xca, 0x08, 0x0a, 0xcc, 0x4f, 0x5f, 0x7e, 0x95, 0xa7, 0x65,
+    0x3c, 0x37, 0x13, 0x4d, 0x24, 0x4e, 0x0c, 0x6a, 0xc4, 0x32, 0x1e, 0x32, 0x39, 0xe9, 0xfa, 0x54,
+    0x37, 0x8d, 0x6b, 0x04, 0x31, 0x3d, 0xbc, 0xab, 0xba, 0x5f, 0x91, 0xf7, 0x0e, 0x41, 0xc7, 0x07,
+    0xe9, 0x5c, 0x8f, 0x89, 0xe7, 0xb6, 0x0c, 0x91, 0xc7, 0x6c, 0xaa, 0xd7, 0x6c, 0xc4, 0xaa, 0x8f,
+    0x94, 0xf5, 0x3f, 0x87, 0x53, 0x50, 0xe8, 0xba, 0x7b, 0x5a, 0x4b, 0xe6, 0x4a, 0x91, 0x8d, 0xe1,
+    0x8a, 0x9c, 0x75, 0x07, 0xfa, 0xd5, 0x99, 0x2c, 0xbc, 0xaf, 0x2d, 0xe1, 0x90, 0x98, 0x63, 0x91,
+    0x4a, 0xbb, 0x9f, 0xba, 0x1b, 0x04, 0x93, 0xf8, 0x8f, 0xd2, 0x93, 0x59, 0x7b, 0x71, 0xa9, 0x4a,
+    0xd6, 0x41, 0x4b, 0xa9, 0xe5, 0xc9, 0xe7, 0x81, 0xcf, 0xe6, 0x78, 0xaa, 0x32, 0x25, 0xfa, 0xd9,
+    0x5d, 0x6a, 0x3e, 0x61, 0x95, 0x9d, 0x17, 0x11, 0x1e, 0xa0, 0x1e, 0x0f, 0xf4, 0xae, 0x3a, 0x0b,
+    0xc6, 0xd4, 0x16, 0x45, 0x95, 0x7c, 0x86, 0xdf, 0x83, 0x23, 0x1f, 0xbb, 0x81, 0xf2, 0xf3, 0xf8,
+    0x55, 0x73, 0xa7, 0xad, 0xcd, 0xa6, 0xd3, 0x21, 0x7d, 0x92, 0x90, 0x36, 0xf5, 0xc8, 0x55, 0x1c,
+    0x7a, 0xe4, 0xe4, 0xd6, 0x7e, 0x93, 0x3e, 0xa3, 0x67, 0x7e, 0x20, 0x8e, 0xcd, 0xa1, 0xb5, 0x8a,
+    0x42, 0x5b, 0xe8, 0x0e, 0x47, 0xe3, 0x5a, 0x1a, 0xc5, 0xb5, 0xd4, 0xb3, 0x8d, 0x46, 0xd6, 0x35,
+    0x95, 0x98, 0x28, 0xf2, 0xcf, 0x45, 0xf5, 0x1f, 0xaf, 0xeb, 0x5b, 0xfa, 0x4b, 0x3c, 0x77, 0x10,
+    0x42, 0x8a, 0x57, 0x0a, 0x50, 0x83, 0xd0, 0x10, 0x48, 0xcf, 0xd7, 0xe6, 0xe6, 0xbf, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_burst_5[3037] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+    0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+    0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+    0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+    0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x60,
+    0x00, 0x80, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xe9, 0xec, 0xee, 0x85, 0xa6, 0x9a, 0x41, 0x65,
+    0xf3, 0x14, 0x6d, 0x03, 0xd1, 0x85, 0x70, 0xb3, 0xeb, 0x1f, 0xda, 0x3a, 0xab, 0x48, 0x46, 0x64,
+    0xd8, 0x43, 0x7b, 0xe2, 0xae, 0x46, 0x2d, 0x26, 0xb7, 0x23, 0xee, 0xc9, 0x9e, 0x09, 0xfd, 0x3f,
+    0x5f, 0xe7, 0x51, 0x5c, 0xc8, 0xd1, 0x1b, 0x29, 0xd0, 0x72, 0xe7, 0xc8, 0x72, 0x3b, 0x1a, 0xe8,
+    0xe0, 0xb1, 0x69, 0xac, 0x59, 0xe3, 0x6c, 0x4e, 0x09, 0xcd, 0x57, 0xd5, 0x74, 0xeb, 0x89, 0x6d,
+    0x30, 0x49, 0x46, 0x71, 0x91, 0xc7, 0xf1, 0x0e, 0x6b, 0x0e, 0xdf, 0x74, 0x88, 0xd0, 0x5e, 0x02,
+    0xdd, 0x81, 0xc7, 0x42, 0x3f, 0xc9, 0xa9, 0x0c, 0x85, 0x5e, 0x18, 0xf3, 0xf3, 0x80, 0x48, 0xe7,
+    0x9c, 0x8a, 0xc7, 0xd6, 0xef, 0xa4, 0xdc, 0xc8, 0x32, 0x14, 0x8c, 0x8e, 0xfb, 0x4f, 0x7a, 0x7e,
+    0x80, 0xcd, 0x70, 0xe0, 0x93, 0x97, 0x0d, 0xc8, 0x3e, 0x98, 0xae, 0xab, 0x53, 0x88, 0xae, 0x94,
+    0x90, 0xba, 0x0d, 0xaf, 0x98, 0xc1, 0xf4, 0x3d, 0xab, 0x88, 0x9b, 0xc3, 0x77, 0x26, 0x29, 0x24,
+    0x8e, 0x30, 0x24, 0x2d, 0x9c, 0x0a, 0x76, 0x97, 0xa4, 0x4b, 0x1d, 0xd0, 0x57, 0x4d, 0xb9, 0xea,
+    0x4f, 0x63, 0x53, 0x5c, 0x68, 0x8d, 0x0c, 0xd7, 0x2a, 0xd1, 0x86, 0x46, 0xe5, 0x4f, 0xb8, 0xff,
+    0x00, 0x0a, 0xd3, 0x3a, 0x1f, 0x9b, 0x61, 0x11, 0x2a, 0xa8, 0xce, 0xa0, 0x81, 0xee, 0x39, 0xa9,
+    0x6c, 0xf4, 0xa0, 0x30, 0xc5, 0x30, 0xe8, 0x7d, 0x3b, 0x1f, 0xfe, 0xbf, 0xf3, 0xad, 0x1b, 0xcb,
+    0x8d, 0xea, 0x42, 0x9c, 0xa3, 0x8c, 0xe7, 0x3d, 0xeb, 0x02, 0x2d, 0x39, 0xac, 0xd6, 0x77, 0x90,
+    0x05, 0x60, 0xc5, 0xc3, 0x7b, 0x55, 0x4d, 0x12, 0x6f, 0xb4, 0xdd, 0x5c, 0x44, 0xfc, 0x44, 0xdf,
+    0x37, 0x3d, 0x85, 0x76, 0x36, 0x5a, 0x43, 0xdc, 0x2b, 0x42, 0xfc, 0xc6, 0xc4, 0x32, 0x95, 0x3f,
+    0x91, 0xae, 0x8a, 0x55, 0xfb, 0x25, 0xb8, 0x20, 0x6d, 0x0a, 0x36, 0xb8, 0x3e, 0xa3, 0xfc, 0xfe,
+    0xb5, 0x2c, 0xba, 0x85, 0x95, 0xc5, 0x9c, 0x61, 0x4f, 0xef, 0x63, 0x6c, 0x8f, 0xa1, 0xeb, 0x5c,
+    0xc6, 0xa4, 0xd1, 0x17, 0xb9, 0x44, 0x60, 0x70, 0xdc, 0x10, 0x3f, 0x11, 0xfa, 0x56, 0x4d, 0xbd,
+    0x8d, 0xd3, 0xfe, 0xf0, 0xa9, 0x0c, 0xa7, 0x7a, 0x70, 0x78, 0x23, 0xa8, 0xac, 0xcd, 0x42, 0xc2,
+    0x53, 0x70, 0xca, 0xab, 0x94, 0x7e, 0x71, 0x8e, 0x80, 0x8f, 0xf3, 0xf9, 0x53, 0xb4, 0x5b, 0x29,
+    0x51, 0x84, 0x87, 0x2a, 0xf1, 0x1c, 0x38, 0x03, 0xd3, 0x8f, 0xfe, 0xbd, 0x7a, 0xa4, 0x29, 0x63,
+    0xaa, 0x68, 0xae, 0x24, 0x42, 0x26, 0xf7, 0xec, 0x47, 0xa5, 0x47, 0x02, 0x59, 0xb5, 0xbb, 0x15,
+    0x5f, 0xde, 0x27, 0x03, 0x9e, 0x4d, 0x56, 0xd4, 0xa0, 0xd3, 0xae, 0x60, 0x59, 0x63, 0x8c, 0x24,
+    0x8a, 0xb9, 0x6c, 0xf7, 0x35, 0x5f, 0x48, 0x8a, 0xda, 0xea, 0x37, 0x8a, 0x74, 0xf9, 0xc1, 0xc8,
+    0x39, 0xa9, 0x75, 0x5b, 0x7b, 0x64, 0xb0, 0x11, 0xc0, 0x31, 0x32, 0xf2, 0x06, 0x7b, 0x57, 0x25,
+    0xab, 0x5e, 0xc9, 0x04, 0xd0, 0xcb, 0xb3, 0x00, 0xe0, 0xb0, 0x03, 0xa8, 0xef, 0x59, 0xd3, 0x2c,
+    0xab, 0x6d, 0x98, 0xc9, 0x2a, 0xbd, 0x0f, 0xbf, 0x4a, 0xd9, 0xb0, 0x46, 0xbb, 0xd1, 0x1c, 0x4a,
+    0xa4, 0xf1, 0xc1, 0xf5, 0xf6, 0xaa, 0xbe, 0x1c, 0xf0, 0xdc, 0xa5, 0xda, 0x7c, 0x31, 0x00, 0x93,
+    0xf5, 0x1d, 0xff, 0x00, 0xad, 0x77, 0x9a, 0x4d, 0xab, 0xda, 0xdd, 0x41, 0xc9, 0x31, 0x91, 0x81,
+    0xed, 0xfe, 0x7f, 0xa5, 0x69, 0x6b, 0x1a, 0x79, 0x22, 0x53, 0x93, 0x89, 0x14, 0x92, 0x3b, 0x6e,
+    0x1c, 0x7f, 0x9f, 0xa5, 0x79, 0xd5, 0xc6, 0x8f, 0x77, 0x00, 0x79, 0x51, 0xd8, 0x00, 0x4b, 0x00,
+    0x47, 0xb9, 0xff, 0x00, 0xeb, 0xd6, 0xaf, 0x83, 0x74, 0xb6, 0xbd, 0xb9, 0x90, 0x4e, 0x32, 0x10,
+    0xe0, 0x7f, 0xb4, 0xbe, 0x9f, 0xad, 0x7a, 0xf5, 0xaf, 0x84, 0xed, 0x1b, 0x4b, 0x11, 0x85, 0x5c,
+    0xb8, 0x04, 0x1c, 0x74, 0xe2, 0xb9, 0x5d, 0x53, 0xc3, 0xf0, 0x40, 0xf0, 0xc8, 0x88, 0x9c, 0x37,
+    0xce, 0xbe, 0xa3, 0x34, 0xeb, 0x8f, 0x0d, 0xdb, 0xad, 0xe3, 0x5c, 0x40, 0xa8, 0x21, 0x91, 0x72,
+    0xdc, 0x75, 0xe2, 0xb1, 0x27, 0xb5, 0x48, 0x6c, 0xe4, 0x0b, 0x29, 0x0e, 0x0e, 0x0e, 0x3b, 0xf4,
+    0xff, 0x00, 0xeb, 0x1a, 0xc1, 0x86, 0x49, 0x55, 0x64, 0x64, 0x93, 0xe6, 0x3f, 0x30, 0x1e, 0xfd,
+    0xea, 0x59, 0xe0, 0x2e, 0x91, 0xe0, 0xb6, 0xfc, 0xe4, 0x8c, 0xf1, 0x83, 0xda, 0xa1, 0xb4, 0x91,
+    0xad, 0x4b, 0x09, 0x89, 0x4d, 0xa7, 0x04, 0xfa, 0xe7, 0xa1, 0xfc, 0xff, 0x00, 0x9d, 0x67, 0x4d,
+    0x71, 0x2c, 0xf7, 0x5b, 0x91, 0xc9, 0x20, 0xe7, 0xaf, 0xe6, 0x2a, 0x3d, 0x4a, 0x15, 0x72, 0x9b,
+    0x81, 0xc3, 0x1d, 0xcb, 0xe9, 0x83, 0xd6, 0xa6, 0xc0, 0x8a, 0xd9, 0xcf, 0xfc, 0xb2, 0x97, 0x9c,
+    0x9e, 0xc7, 0x15, 0x27, 0x87, 0xb5, 0x15, 0x96, 0xd1, 0xa1, 0x4c, 0x19, 0x10, 0xee, 0x41, 0x8e,
+    0xa2, 0xbb, 0x8d, 0x3d, 0x45, 0x9e, 0x97, 0xe6, 0xc4, 0x15, 0x99, 0x8e, 0xe2, 0xb8, 0xe9, 0xef,
+    0xfe, 0x7d, 0x2a, 0x7d, 0x25, 0x66, 0x17, 0xac, 0x1f, 0x05, 0x15, 0xfe, 0x53, 0xd7, 0x8e, 0xc6,
+    0xba, 0x1d, 0x41, 0xd2, 0x35, 0x2a, 0x30, 0x76, 0xbe, 0xe0, 0x7d, 0x54, 0xf0, 0x47, 0xf3, 0xa8,
+    0xb5, 0x4d, 0x3e, 0xd6, 0x6d, 0x0a, 0x60, 0xac, 0xaa, 0xf9, 0xdc, 0xa6, 0xb0, 0xfc, 0x1b, 0x6b,
+    0x08, 0x37, 0x91, 0x33, 0x80, 0xea, 0xc3, 0x18, 0x3d, 0x32, 0x71, 0x5e, 0x99, 0xa5, 0xb8, 0x8f,
+    0x4c, 0x55, 0x97, 0x82, 0xbc, 0x1a, 0xc9, 0xd5, 0xed, 0x23, 0xb8, 0x59, 0x64, 0x89, 0x81, 0x5c,
+    0xe4, 0x76, 0xfa, 0xd6, 0x0d, 0xc5, 0xc1, 0xb5, 0x56, 0x56, 0x19, 0x01, 0x72, 0x3d, 0xb1, 0xdf,
+    0xfc, 0xfa, 0xd7, 0x99, 0x6b, 0x1a, 0xfc, 0x4b, 0x6e, 0xeb, 0x2f, 0xc8, 0xe2, 0x4c, 0x91, 0x9e,
+    0x80, 0xf1, 0x58, 0x36, 0x97, 0xec, 0x2f, 0xe3, 0x7d, 0xe0, 0xa3, 0xb7, 0x27, 0xd0, 0xff, 0x00,
+    0x9c, 0x57, 0x57, 0x6d, 0x7c, 0x89, 0x71, 0x6d, 0x1c, 0xbd, 0x53, 0xe5, 0x3f, 0x4e, 0xd5, 0x3e,
+    0xb9, 0x1d, 0xbb, 0xc1, 0x74, 0x8a, 0x07, 0x99, 0xb3, 0x72, 0xfb, 0xd7, 0x1b, 0xa4, 0xdc, 0x06,
+    0x66, 0x79, 0x79, 0xdc, 0x72, 0xbc, 0xe3, 0x9e, 0x84, 0x55, 0x9b, 0xfb, 0xc5, 0x46, 0x8a, 0x13,
+    0xdc, 0x9d, 0xa7, 0xd8, 0xf4, 0xab, 0xde, 0x1f, 0x09, 0x7b, 0xa7, 0x5c, 0x5b, 0xca, 0x76, 0xbc,
+    0x47, 0x76, 0x0f, 0x71, 0xfe, 0x73, 0x57, 0xbc, 0x1d, 0xa5, 0xa4, 0xb7, 0x51, 0xcb, 0x10, 0x01,
+    0xe2, 0x62, 0xa5, 0x47, 0xa7, 0x35, 0xeb, 0x76, 0xba, 0x4c, 0x11, 0xa2, 0xa9, 0x01, 0x43, 0x0c,
+    0x63, 0xd0, 0x9a, 0x82, 0xee, 0xd5, 0x2c, 0x24, 0x75, 0x29, 0xf2, 0x88, 0x88, 0xc0, 0xe7, 0x23,
+    0xfc, 0x6b, 0x84, 0xd5, 0xf5, 0xb9, 0x0d, 0xda, 0x0d, 0xc0, 0xe0, 0xed, 0x3c, 0xf5, 0xcf, 0x7f,
+    0xcf, 0x15, 0x6b, 0xc4, 0xba, 0xa1, 0xb7, 0xd0, 0xbf, 0x76, 0xe1, 0x5b, 0x00, 0x1f, 0xd6, 0xb9,
+    0xff, 0x00, 0x08, 0x6a, 0x8f, 0xba, 0xf3, 0xcc, 0x98, 0x06, 0x29, 0x9c, 0xe7, 0xaf, 0xf9, 0xe2,
+    0xba, 0xa9, 0x7c, 0x7b, 0x0c, 0x50, 0xc0, 0x25, 0x98, 0x30, 0x71, 0xb5, 0xff, 0x00, 0x1e, 0x3f,
+    0x9d, 0x32, 0xc3, 0xc6, 0x48, 0xd6, 0xf2, 0xa3, 0x4a, 0x0e, 0xc6, 0xc0, 0x19, 0x1c, 0xd6, 0x7e,
+    0xa9, 0xe2, 0xbb, 0x6b, 0x7d, 0x46, 0x25, 0x91, 0x86, 0xc9, 0x06, 0xd0, 0x7f, 0x97, 0xf9, 0xf6,
+    0xaf, 0x3c, 0xf1, 0x64, 0x56, 0x7a, 0x84, 0x52, 0x3d, 0xac, 0x87, 0x73, 0x31, 0x63, 0xcf, 0x62,
+    0x31, 0xfc, 0xeb, 0x06, 0xd2, 0x09, 0xa1, 0x78, 0x88, 0x76, 0x28, 0x46, 0x18, 0x9f, 0xef, 0x7f,
+    0x9c, 0xd7, 0x5f, 0x67, 0x33, 0x4c, 0x91, 0xbb, 0x7f, 0xaf, 0x8f, 0x9f, 0xf7, 0x96, 0xac, 0xea,
+    0xd3, 0xb2, 0x5b, 0xa4, 0xd1, 0xe4, 0xbc, 0x5d, 0x54, 0xf4, 0x65, 0x3d, 0xab, 0x9e, 0xbd, 0x95,
+    0x2d, 0xed, 0x8c, 0x91, 0x91, 0xb5, 0xf9, 0x50, 0x3b, 0x1e, 0xff, 0x00, 0xe7, 0xde, 0xb1, 0x2d,
+    0xef, 0xe4, 0xbb, 0x54, 0x47, 0x24, 0xb4, 0x72, 0x61, 0x8f, 0xb1, 0xff, 0x00, 0xeb, 0xd7, 0x5f,
+    0x1d, 0xe4, 0x36, 0xb2, 0x2c, 0xf6, 0xf8, 0xdb, 0x22, 0xe1, 0x9b, 0xeb, 0xff, 0x00, 0xd7, 0xae,
+    0x9b, 0xc0, 0x86, 0x54, 0xb9, 0x67, 0x04, 0x61, 0x8e, 0xe0, 0xc3, 0xf8, 0xb8, 0xe2, 0xbd, 0x71,
+    0x24, 0x17, 0x9a, 0x78, 0x92, 0x3e, 0x24, 0x41, 0xc8, 0xf6, 0xed, 0xfd, 0x6a, 0x83, 0xb9, 0xba,
+    0x8c, 0xc3, 0x23, 0x1f, 0x38, 0x7d, 0xd3, 0xea, 0x0d, 0x71, 0x57, 0x1a, 0x1e, 0x32, 0x64, 0x5f,
+    0x98, 0x12, 0x0f, 0xf4, 0xae, 0x27, 0xe2, 0x1c, 0xd3, 0x45, 0xa5, 0xf5, 0xe0, 0x7c, 0x92, 0x63,
+    0xb7, 0x06, 0xb8, 0xbd, 0x37, 0x58, 0x96, 0x48, 0x23, 0x45, 0x6d, 0xae, 0xc7, 0x67, 0x1e, 0x98,
+    0xff, 0x00, 0xf5, 0xd4, 0x1a, 0xc7, 0xdb, 0x20, 0x88, 0x31, 0x24, 0xe0, 0xf1, 0xe9, 0x57, 0x6c,
+    0x2e, 0x99, 0x2e, 0x90, 0xa4, 0x87, 0x6c, 0xa8, 0x09, 0xcf, 0xae, 0x39, 0xff, 0x00, 0x3e, 0xd5,
+    0x43, 0xc4, 0xb7, 0x17, 0x4e, 0xf1, 0x02, 0xcd, 0x9c, 0xf0, 0x7d, 0x39, 0xfe, 0x95, 0x98, 0x97,
+    0x53, 0xc3, 0x71, 0x87, 0x2d, 0xb4, 0xb6, 0x4f, 0xe3, 0xd6, 0xba, 0x23, 0x3b, 0x45, 0x76, 0x02,
+    0x31, 0x64, 0x61, 0x9d, 0xbf, 0xd7, 0xfc, 0xfa, 0x56, 0xe6, 0x99, 0x70, 0x44, 0x8a, 0x37, 0x72,
+    0x3e, 0x61, 0x8f, 0x4e, 0xe3, 0xfa, 0xd6, 0x8e, 0xb7, 0x77, 0x18, 0xb6, 0x1c, 0x0f, 0x30, 0x70,
+    0x47, 0x63, 0x58, 0x26, 0xcf, 0xcf, 0x88, 0x32, 0x1f, 0xdc, 0x4a, 0x0b, 0x74, 0xe8, 0x7b, 0xd6,
+    0x45, 0xa5, 0xaf, 0xd9, 0x75, 0x29, 0x15, 0xbe, 0x65, 0xcf, 0x23, 0x1d, 0x47, 0x5a, 0xb5, 0x6c,
+    0x93, 0x3a, 0x4a, 0xa9, 0x9f, 0x2c, 0x1c, 0x71, 0xdb, 0x3f, 0xe4, 0xd7, 0xa5, 0xf8, 0x56, 0x54,
+    0xd3, 0xf4, 0x7b, 0x66, 0x23, 0x25, 0x7e, 0x51, 0xec, 0x3f, 0xfa, 0xd5, 0xdf, 0x5b, 0xeb, 0x11,
+    0x8d, 0x3e, 0x42, 0x87, 0x64, 0xaa, 0xbc, 0x0e, 0xc4, 0x75, 0xc5, 0x64, 0x69, 0x5a, 0xa1, 0xb8,
+    0xbf, 0x28, 0x09, 0xdc, 0x99, 0x64, 0xcf, 0xf1, 0x2f, 0xf9, 0xe2, 0xac, 0x78, 0x8f, 0x53, 0x8a,
+    0x05, 0x51, 0xbb, 0xef, 0x77, 0x1e, 0xbd, 0xc7, 0xe3, 0x5e, 0x6f, 0xe2, 0x89, 0xa1, 0xd4, 0x22,
+    0xb8, 0xb7, 0xca, 0xe6, 0x41, 0x9e, 0xbd, 0x4d, 0x72, 0x71, 0xf8, 0x7b, 0xca, 0xb7, 0x57, 0x55,
+    0xda, 0x51, 0xb0, 0x09, 0xa9, 0x35, 0x76, 0x32, 0x22, 0xc1, 0x3a, 0x6d, 0xde, 0xa5, 0x41, 0xc7,
+    0x70, 0x6b, 0x9a, 0xc3, 0x8b, 0xc8, 0x39, 0xc6, 0xd3, 0xfe, 0x45, 0x74, 0x56, 0x89, 0x1d, 0xd5,
+    0x8c, 0x96, 0xf7, 0x00, 0x09, 0x23, 0x7e, 0x09, 0xeb, 0x83, 0x5c, 0xff, 0x00, 0x88, 0x5a, 0x18,
+    0xae, 0x06, 0x30, 0xa0, 0x8c, 0x1c, 0x7b, 0x56, 0x9e, 0x93, 0xb6, 0x58, 0x92, 0x58, 0xce, 0xed,
+    0x88, 0x07, 0x26, 0xba, 0x4b, 0x7b, 0x26, 0x99, 0x20, 0x96, 0x1c, 0x00, 0x0f, 0x19, 0x3d, 0x45,
+    0x2f, 0x89, 0x6d, 0x83, 0xe9, 0xfe, 0x5f, 0x22, 0x44, 0x5c, 0xa9, 0xee, 0x3a, 0xf1, 0xf8, 0x54,
+    0x5a, 0x3c, 0x52, 0x0d, 0x04, 0x82, 0x37, 0x3a, 0x1d, 0xc3, 0xd7, 0xfc, 0xf5, 0xfc, 0xab, 0x0c,
+    0x5c, 0x86, 0xd4, 0x55, 0x9b, 0x00, 0xb8, 0x03, 0x91, 0xd0, 0x83, 0xc5, 0x76, 0xfe, 0x0a, 0xd1,
+    0xd2, 0x7b, 0xa2, 0x25, 0x19, 0x8d, 0xcf, 0x20, 0xf4, 0x3c, 0x74, 0xad, 0xed, 0x77, 0x4b, 0x7d,
+    0x2b, 0xfd, 0x19, 0x1b, 0x11, 0xa9, 0x05, 0x7f, 0x1a, 0x9a, 0xd4, 0x89, 0xd2, 0x38, 0x83, 0x32,
+    0xca, 0x83, 0x61, 0xf7, 0x5e, 0xd5, 0x05, 0xeb, 0xbe, 0x93, 0x3a, 0x4a, 0x09, 0xdc, 0xa3, 0x83,
+    0x58, 0x1a, 0xc6, 0xaa, 0xda, 0x9c, 0x07, 0x6b, 0x15, 0xc1, 0xcf, 0xd2, 0xb0, 0xbc, 0xa6, 0xbb,
+    0xc6, 0x1d, 0x96, 0x78, 0xb1, 0xf8, 0x81, 0xfe, 0x7f, 0x4a, 0xd6, 0x9e, 0xf2, 0x09, 0x60, 0x0a,
+    0xe4, 0x6f, 0x61, 0xc8, 0xf7, 0xef, 0x59, 0x17, 0x77, 0x11, 0x5c, 0xd9, 0xbc, 0x6c, 0x3f, 0x7e,
+    0x87, 0x2a, 0x4f, 0xaf, 0x7f, 0xe5, 0x58, 0x77, 0xfe, 0x54, 0x96, 0xe2, 0x74, 0x50, 0xad, 0x9d,
+    0xe0, 0x0e, 0xb9, 0xe9, 0x52, 0xad, 0xe2, 0x07, 0x45, 0xc8, 0x0c, 0x40, 0x19, 0xcf, 0x50, 0x6b,
+    0x07, 0x5d, 0xb6, 0x7f, 0xed, 0x06, 0x47, 0x53, 0xe4, 0x3e, 0x18, 0x31, 0xed, 0x9e, 0xb5, 0xd4,
+    0x69, 0x7a, 0x53, 0x5b, 0xda, 0xa8, 0x53, 0x83, 0xb7, 0x72, 0x8f, 0x5f, 0x51, 0x5b, 0x9e, 0x1d,
+    0x9d, 0xa2, 0x8c, 0xc5, 0x26, 0x49, 0x52, 0x76, 0xe7, 0xd4, 0x7f, 0xf5, 0xb1, 0x52, 0xf8, 0x8f,
+    0x05, 0xd5, 0xc0, 0xc0, 0x23, 0x2c, 0x33, 0xd4, 0x11, 0x59, 0x9e, 0x16, 0xbf, 0x1e, 0x67, 0xd9,
+    0x88, 0xf9, 0x64, 0xc8, 0x00, 0xf6, 0x3e, 0x95, 0x05, 0xf6, 0x8b, 0xba, 0xe8, 0xbc, 0x7b, 0x87,
+    0x51, 0xef, 0xc5, 0x76, 0x76, 0x66, 0x4d, 0x36, 0xe1, 0x0a, 0xe4, 0x0d, 0xc1, 0xb1, 0x5b, 0x3e,
+    0x21, 0xbd, 0x6b, 0xc1, 0x04, 0xa7, 0xf8, 0x94, 0x82, 0x3d, 0x08, 0xc5, 0x43, 0x1c, 0xe9, 0x1c,
+    0x70, 0xcc, 0x58, 0x2c, 0xcb, 0x82, 0x7d, 0xc7, 0x43, 0x50, 0xeb, 0x6e, 0xb7, 0x39, 0x56, 0x3b,
+    0xe3, 0x61, 0x95, 0x23, 0xd3, 0xb5, 0x72, 0x8f, 0x6b, 0x84, 0x9f, 0x63, 0x6e, 0x75, 0x05, 0xb1,
+    0xdb, 0xdf, 0xfa, 0xd6, 0x0d, 0xe6, 0xa2, 0x6d, 0x67, 0x47, 0xdd, 0xb5, 0x59, 0x71, 0x9c, 0xf5,
+    0x22, 0xb0, 0xff, 0x00, 0xb5, 0x65, 0x8b, 0x51, 0x60, 0x1f, 0x74, 0x65, 0xb2, 0x0f, 0xa0, 0x35,
+    0xa1, 0x61, 0x29, 0x9a, 0x62, 0x19, 0xfe, 0x53, 0xf3, 0x2e, 0x7d, 0x2a, 0x2d, 0x46, 0x3f, 0x26,
+    0x50, 0x0a, 0x9f, 0x2d, 0x8f, 0xe0, 0x0e, 0x39, 0x15, 0x9b, 0x71, 0x6f, 0x23, 0x3a, 0x05, 0x24,
+    0xa2, 0xfc, 0xca, 0xc3, 0xd3, 0xfc, 0xff, 0x00, 0x2a, 0xed, 0x34, 0xed, 0x3e, 0x2d, 0x4a, 0x38,
+    0xa2, 0xbb, 0xc6, 0xf6, 0x42, 0x14, 0x9e, 0xe4, 0x53, 0xf5, 0xe9, 0x3e, 0xc7, 0x1d, 0xaa, 0x13,
+    0xb5, 0xe3, 0x3b, 0x71, 0x9e, 0xf8, 0xfe, 0xb4, 0xd8, 0xef, 0xa3, 0xb9, 0x66, 0xf2, 0x19, 0x55,
+    0xa4, 0x5d, 0xc0, 0x74, 0xc1, 0xff, 0x00, 0x22, 0xa0, 0xbf, 0xbf, 0xfe, 0xd1, 0x85, 0x51, 0x01,
+    0xfb, 0x48, 0x52, 0x71, 0xeb, 0x83, 0xd3, 0xf9, 0xd3, 0x7c, 0x23, 0x68, 0x97, 0x93, 0xa3, 0xe0,
+    0xa4, 0xc1, 0xf0, 0xc3, 0xd0, 0xff, 0x00, 0x9c, 0x1a, 0xee, 0xae, 0xec, 0x1b, 0xcc, 0x57, 0xc6,
+    0x1e, 0x41, 0xf3, 0x2f, 0xfb, 0x55, 0x4a, 0xe6, 0xf0, 0xdc, 0x5c, 0xc8, 0xab, 0xd5, 0x72, 0x41,
+    0xc7, 0xe9, 0xfe, 0x7d, 0x6a, 0x49, 0x6f, 0x08, 0xb6, 0x86, 0x4d, 0xc5, 0xa3, 0x76, 0xfc, 0x01,
+    0xff, 0x00, 0x39, 0xaa, 0x7a, 0xed, 0xd2, 0x5c, 0x69, 0xef, 0xe4, 0x92, 0x25, 0x52, 0x18, 0xe3,
+    0xae, 0x3b, 0xd6, 0x75, 0x86, 0xae, 0xed, 0x6c, 0x60, 0x99, 0xb2, 0xc0, 0x7e, 0x7d, 0xaa, 0x3d,
+    0x30, 0xcb, 0x15, 0xd3, 0xbb, 0xb6, 0x62, 0x63, 0xf3, 0x1c, 0x76, 0xef, 0x58, 0x5e, 0x27, 0xd2,
+    0x24, 0x46, 0x70, 0x83, 0x74, 0x4c, 0x0b, 0xc6, 0x7f, 0x3f, 0xe5, 0x5c, 0x7d, 0x82, 0xca, 0xa4,
+    0xc5, 0x30, 0xc4, 0x88, 0x7a, 0x7a, 0x8f, 0x4a, 0xec, 0xb4, 0x48, 0x62, 0x69, 0x11, 0x0f, 0xfa,
+    0xb2, 0x78, 0x3e, 0x95, 0x7b, 0x5b, 0x86, 0x38, 0x88, 0x8e, 0x51, 0x91, 0x20, 0xc8, 0x3e, 0x84,
+    0x7b, 0xfd, 0x29, 0x9a, 0x7d, 0x8a, 0x3c, 0x2b, 0x2b, 0x80, 0xc8, 0xc3, 0x39, 0xf4, 0xe3, 0x07,
+    0xf9, 0x8f, 0xce, 0xb6, 0xad, 0xe3, 0x0b, 0xa4, 0x31, 0x56, 0xc5, 0xcd, 0xb4, 0x9f, 0x21, 0xf5,
+    0x02, 0xb9, 0x2f, 0x16, 0x6a, 0x09, 0x78, 0xeb, 0x23, 0xb0, 0x59, 0x47, 0xde, 0xfa, 0xfa, 0xd7,
+    0x3e, 0x97, 0x8c, 0x18, 0x49, 0x1c, 0x80, 0x38, 0xf9, 0x87, 0xd0, 0xf6, 0xfc, 0xf1, 0x5a, 0xde,
+    0x11, 0xb9, 0x17, 0x5a, 0x91, 0x79, 0x49, 0x05, 0x5c, 0x7d, 0x46, 0x4f, 0xf8, 0xd7, 0x77, 0x79,
+    0x69, 0x0e, 0x9d, 0x75, 0x25, 0xcd, 0x98, 0xc1, 0x63, 0x92, 0xa3, 0xb7, 0xb8, 0xad, 0xeb, 0x6d,
+    0x4d, 0xa7, 0xb4, 0x86, 0x42, 0x07, 0x99, 0xb8, 0x1c, 0xff, 0x00, 0x4a, 0xe5, 0x6e, 0x6e, 0x96,
+    0x0b, 0xef, 0x34, 0x1d, 0xd0, 0x4a, 0x31, 0x9c, 0x74, 0xe3, 0x34, 0xa3, 0x51, 0x56, 0xb0, 0x9e,
+    0x35, 0xfb, 0x99, 0x0c, 0xbc, 0x74, 0x3d, 0xff, 0x00, 0x5a, 0xcc, 0x92, 0xe5, 0x8b, 0x92, 0xac,
+    0x0b, 0x32, 0xf2, 0x0f, 0x43, 0x8f, 0xf3, 0x8a, 0xdb, 0xd0, 0x74, 0xbf, 0xb5, 0x40, 0xf3, 0x23,
+    0x65, 0x80, 0xc8, 0xfa, 0x55, 0x93, 0x6a, 0x61, 0x86, 0x44, 0x55, 0x06, 0x3f, 0xbd, 0xeb, 0xdb,
+    0x06, 0xb3, 0x35, 0xb8, 0xee, 0x0d, 0xaa, 0x2a, 0xa9, 0x60, 0x87, 0x8f, 0xf0, 0xfe, 0x55, 0xc8,
+    0x6b, 0x16, 0x8a, 0x6d, 0x05, 0xd4, 0x48, 0x54, 0x82, 0x37, 0x67, 0x83, 0x8f, 0x53, 0x53, 0xe8,
+    0x53, 0xbc, 0xe6, 0x41, 0x8c, 0x33, 0x26, 0xef, 0xa3, 0x76, 0xad, 0xcb, 0xc9, 0x06, 0xad, 0x67,
+    0x6c, 0x24, 0x60, 0x24, 0x71, 0xb4, 0x9c, 0x74, 0x23, 0xa7, 0xf9, 0xfa, 0x51, 0xe1, 0x79, 0xcc,
+    0x13, 0xb5, 0x8d, 0xda, 0xe0, 0x13, 0x8e, 0x7b, 0x1e, 0xdf, 0xd6, 0xa7, 0xd6, 0x55, 0xed, 0x92,
+    0x6f, 0x21, 0xb8, 0x07, 0xe6, 0xc1, 0xed, 0x5e, 0x5f, 0xe2, 0xf6, 0xb9, 0xfb, 0x6a, 0x4d, 0x16,
+    0x79, 0x23, 0x23, 0xdf, 0xd7, 0xf1, 0xac, 0x77, 0x9a, 0x7b, 0x79, 0x30, 0x4f, 0xde, 0xf9, 0x97,
+    0xfc, 0x2b, 0x67, 0xc3, 0xf7, 0x12, 0xb4, 0xbe, 0x7c, 0x27, 0x92, 0x76, 0xba, 0x03, 0xd5, 0x4d,
+    0x77, 0xc7, 0x5f, 0x56, 0xb3, 0x88, 0x3b, 0x13, 0x24, 0x23, 0x63, 0xff, 0x00, 0xb4, 0xbf, 0xfe,
+    0xae, 0x3f, 0x0a, 0xb3, 0x6b, 0xac, 0x2c, 0x5b, 0x15, 0x58, 0xb4, 0x3d, 0x4e, 0x3a, 0xe3, 0xff,
+    0x00, 0xad, 0xc5, 0x6e, 0xd8, 0xe8, 0x86, 0xee, 0x14, 0x0e, 0x0e, 0xd6, 0x19, 0x15, 0x83, 0x35,
+    0x8c, 0xd6, 0x37, 0x37, 0x70, 0x48, 0x0e, 0x63, 0xce, 0x7d, 0xd4, 0xd6, 0x7c, 0x48, 0xd2, 0x8d,
+    0x8c, 0x0a, 0x86, 0x5e, 0x0f, 0x71, 0xd8, 0xfe, 0x9c, 0xd7, 0x65, 0xe0, 0xbb, 0xe1, 0x6d, 0x19,
+    0x86, 0x70, 0x03, 0xa9, 0x28, 0x72, 0x3a, 0x8e, 0xd5, 0xab, 0x0c, 0xf0, 0x19, 0x64, 0x00, 0x8e,
+    0x09, 0x42, 0x3d, 0x41, 0xaa, 0xf7, 0xed, 0x04, 0x6a, 0x8f, 0x9f, 0x90, 0x9d, 0x84, 0x7b, 0xf6,
+    0x35, 0xca, 0xeb, 0xf1, 0xc4, 0x64, 0x3b, 0x47, 0xee, 0xa4, 0x1b, 0x4f, 0x6c, 0x13, 0xcf, 0xf8,
+    0xd5, 0x5d, 0x27, 0x4e, 0x4b, 0x3b, 0x80, 0x7e, 0xf0, 0xed, 0xef, 0x57, 0x27, 0xb7, 0x5b, 0x52,
+    0xae, 0x08, 0x09, 0xe6, 0x6f, 0x07, 0xd8, 0xff, 0x00, 0xf5, 0xff, 0x00, 0x95, 0x45, 0xa9, 0xb4,
+    0x52, 0x5d, 0x99, 0xa0, 0x20, 0x39, 0xf9, 0xb0, 0x3d, 0xea, 0x1d, 0x41, 0x6e, 0x05, 0x9c, 0xd3,
+    0xe1, 0xb6, 0x95, 0x0c, 0x73, 0xdf, 0xb6, 0x2b, 0x8b, 0x13, 0x2d, 0xe2, 0x11, 0x3a, 0xe5, 0x86,
+    0x54, 0x73, 0xd0, 0xe7, 0xad, 0x55, 0x36, 0x29, 0x73, 0x10, 0x50, 0x00, 0x90, 0x39, 0xc1, 0xf4,
+    0x39, 0xaa, 0x1a, 0x52, 0xcf, 0xa7, 0xde, 0x30, 0x61, 0xc1, 0x62, 0x87, 0xe9, 0x5a, 0xfa, 0xbd,
+    0xb4, 0xef, 0x3c, 0x77, 0x36, 0xe4, 0x84, 0x63, 0xf3, 0x2f, 0xaf, 0x3c, 0x8f, 0xf3, 0xeb, 0x5b,
+    0x1a, 0x37, 0xfa, 0xc8, 0x7a, 0x95, 0x23, 0x07, 0x3f, 0xa1, 0xaf, 0xff, 0xd9,
+};
+
+static const uint8_t *const fixture_burst[FIXTURE_BURST_FRAMES] = {
+    fixture_burst_0,
+    fixture_burst_1,
+    fixture_burst_2,
+    fixture_burst_3,
+    fixture_burst_4,
+    fixture_burst_5,
+};
+
+static const size_t fixture_burst_len[FIXTURE_BURST_FRAMES] = {
+    sizeof(fixture_burst_0),
+    sizeof(fixture_burst_1),
+    sizeof(fixture_burst_2),
+    sizeof(fixture_burst_3),
+    sizeof(fixture_burst_4),
+    sizeof(fixture_burst_5),
+};
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "unity.h"
+#include "burst_select.h"
+#include "burst_select_fixtures.h"
+#include <string.h>
+
+#define POOL_BYTES  (16 * 1024)
+
+static camera_fb_t fixture_fb(int i)
+{
+    camera_fb_t fb = {
+        .buf = (uint8_t *)fixture_burst[i],
+        .len = fixture_burst_len[i],
+        .width = 128,
+        .height = 96,
+        .format = PIXFORMAT_JPEG,
+    };
+    return fb;
+}
+
+static burst_select_score_t score_of(int i)
+{
+    burst_select_score_t score;
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_score_jpeg(fixture_burst[i], fixture_burst_len[i], &score));
+    return score;
+}
+
+static void start(uint8_t keep, size_t pool_bytes)
+{
+    burst_select_config_t config = {
+        .keep = keep,
+        .pool_bytes = pool_bytes,
+        .target_mean = 120,
+        .exposure_weight = 0.5f,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_init(&config));
+    burst_select_begin();
+}
+
+// Rank of v[i] among n values, 0 = smallest
+static float rank_of(const float *v, int n, int i)
+{
+    int below = 0;
+    for (int j = 0; j < n; j++) {
+        below += v[j] < v[i];
+    }
+    return (float)below;
+}
+
+TEST_CASE("sharpness ranks the settled frames by blur", "[burst_select]")
+{
+    start(1, POOL_BYTES);
+    // Past a few pixels of blur the high band is mostly sensor noise, so
+    // long blurs may swap places; the ranking as a whole must hold
+    const int n = FIXTURE_BURST_FRAMES - 1;
+    float blur[FIXTURE_BURST_FRAMES], sharpness[FIXTURE_BURST_FRAMES];
+    for (int i = 0; i < n; i++) {
+        burst_select_score_t score = score_of(i + 1);
+        TEST_ASSERT_GREATER_THAN(0.0f, score.sharpness);
+        TEST_ASSERT_LESS_THAN(1.0f, score.sharpness);
+        blur[i] = -fixture_burst_blur[i + 1];
+        sharpness[i] = score.sharpness;
+    }
+    float d2 = 0;
+    for (int i = 0; i < n; i++) {
+        float d = rank_of(blur, n, i) - rank_of(sharpness, n, i);
+        d2 += d * d;
+    }
+    float spearman = 1.0f - 6.0f * d2 / (n * (n * n - 1));
+    TEST_ASSERT_GREATER_OR_EQUAL(0.85f, spearman);
+    TEST_ASSERT_EQUAL(n - 1, (int)rank_of(sharpness, n, FIXTURE_BURST_SHARPEST - 1));
+    burst_select_deinit();
+}
+
+TEST_CASE("exposure term sinks a frame caught mid auto-exposure", "[burst_select]")
+{
+    start(1, POOL_BYTES);
+    burst_select_score_t dark = score_of(0);
+    burst_select_score_t settled = score_of(FIXTURE_BURST_SHARPEST);
+    // Gain does not move the ratio much, the exposure factor does
+    TEST_ASSERT_FLOAT_WITHIN(0.25f * settled.sharpness, settled.sharpness, dark.sharpness);
+    TEST_ASSERT_LESS_THAN(settled.mean, dark.mean);
+    TEST_ASSERT_LESS_THAN(0.6f, dark.exposure);
+    TEST_ASSERT_GREATER_THAN(0.9f, settled.exposure);
+    TEST_ASSERT_LESS_THAN(settled.score, dark.score);
+    burst_select_deinit();
+}
+
+TEST_CASE("burst keeps the sharpest frames", "[burst_select]")
+{
+    start(2, POOL_BYTES);
+    float scores[FIXTURE_BURST_FRAMES];
+    for (int i = 0; i < FIXTURE_BURST_FRAMES; i++) {
+        camera_fb_t fb = fixture_fb(i);
+        burst_select_score_t score;
+        TEST_ASSERT_EQUAL(ESP_OK, burst_select_offer(&fb, &score));
+        scores[i] = score.score;
+    }
+    TEST_ASSERT_EQUAL(2, burst_select_count());
+
+    // The least blurred frame wins, the next least blurred follows
+    int second = -1;
+    for (int i = 1; i < FIXTURE_BURST_FRAMES; i++) {
+        if (i != FIXTURE_BURST_SHARPEST && (second < 0 || fixture_burst_blur[i] < fixture_burst_blur[second])) {
+            second = i;
+        }
+    }
+    burst_select_frame_t best, next, none;
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_get(0, &best));
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_get(1, &next));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, burst_select_get(2, &none));
+    TEST_ASSERT_EQUAL(FIXTURE_BURST_SHARPEST, best.index);
+    TEST_ASSERT_EQUAL(second, next.index);
+    TEST_ASSERT_EQUAL_FLOAT(scores[FIXTURE_BURST_SHARPEST], best.score.score);
+
+    // The held copies live in the pool, not in the offered buffers
+    TEST_ASSERT_EQUAL(fixture_burst_len[FIXTURE_BURST_SHARPEST], best.fb.len);
+    TEST_ASSERT_TRUE(best.fb.buf != fixture_burst[FIXTURE_BURST_SHARPEST]);
+    TEST_ASSERT_EQUAL_MEMORY(fixture_burst[FIXTURE_BURST_SHARPEST], best.fb.buf, best.fb.len);
+
+    // The first frame was beaten by every settled one
+    burst_select_begin();
+    TEST_ASSERT_EQUAL(0, burst_select_count());
+    burst_select_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_get_stats(&stats));
+    TEST_ASSERT_EQUAL(FIXTURE_BURST_FRAMES, stats.frames);
+    TEST_ASSERT_EQUAL(1, stats.bursts);
+    TEST_ASSERT_EQUAL_FLOAT(FIXTURE_BURST_FRAMES, stats.first_rank_avg);
+    burst_select_deinit();
+}
+
+TEST_CASE("frames over a pool slot are scored but not held", "[burst_select]")
+{
+    start(2, 2 * 4096);
+    for (int i = 0; i < FIXTURE_BURST_FRAMES; i++) {
+        camera_fb_t fb = fixture_fb(i);
+        TEST_ASSERT_EQUAL(ESP_OK, burst_select_offer(&fb, NULL));
+    }
+    burst_select_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_get_stats(&stats));
+    int over = 0;
+    for (int i = 0; i < FIXTURE_BURST_FRAMES; i++) {
+        over += fixture_burst_len[i] > 4096;
+    }
+    TEST_ASSERT_GREATER_THAN(0, over);
+    TEST_ASSERT_EQUAL(over, stats.too_large);
+
+    burst_select_frame_t best;
+    TEST_ASSERT_EQUAL(ESP_OK, burst_select_get(0, &best));
+    TEST_ASSERT_LESS_OR_EQUAL(4096, best.fb.len);
+    burst_select_deinit();
+}
+
+TEST_CASE("burst select refuses bad input", "[burst_select]")
+{
+    burst_select_config_t config = { .keep = BURST_SELECT_MAX_KEEP + 1, .pool_bytes = POOL_BYTES };
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, burst_select_init(&config));
+    camera_fb_t fb = fixture_fb(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, burst_select_offer(&fb, NULL));
+
+    start(1, POOL_BYTES);
+    config.keep = 1;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, burst_select_init(&config));
+    fb.format = PIXFORMAT_GRAYSCALE;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, burst_select_offer(&fb, NULL));
+    // Cut inside the table segments
+    burst_select_score_t score;
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, burst_select_score_jpeg(fixture_burst[0], 200, &score));
+    TEST_ASSERT_EQUAL(0, burst_select_count());
+    burst_select_deinit();
+}
\ No newline at end of file
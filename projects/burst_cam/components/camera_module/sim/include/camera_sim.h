@@ -0,0 +1,45 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulated sensor behind the esp32-camera API for linux target builds. A
+// sensor task produces a frame every frame period into the fb_count buffer
+// pool with the driver's grab-mode rules: WHEN_EMPTY queues frames while a
+// buffer is free and loses them otherwise, LATEST overwrites the oldest
+// unclaimed frame. esp_camera_fb_get() blocks until a frame is ready.
+//
+// Frames are either JPEG files replayed from a directory in name order or
+// synthetic frames at the configured frame size: a gradient with a moving
+// block, with AC noise set by the entropy knob. Synthetic JPEGs are written
+// straight from quantised coefficients, so set_quality changes their size
+// the way it would on the sensor.
+typedef struct {
+    const char *source_dir;     // *.jpg / *.jpeg to replay; NULL or "" = synthetic
+    bool loop;                  // replay: start over after the last file
+    float fps;                  // sensor rate, 0 = typical OV2640 rate for the frame size
+    uint8_t entropy;            // synthetic detail, 0 flat .. 100 noisy
+    uint32_t seed;
+} camera_sim_config_t;
+
+typedef struct {
+    uint32_t frames_produced;
+    uint32_t frames_lost;       // WHEN_EMPTY: no free buffer at VSYNC
+    uint32_t frames_overwritten;    // LATEST: unclaimed frame replaced
+    uint32_t get_timeouts;
+    uint32_t produce_avg_us;    // file read or synthesis per frame
+} camera_sim_stats_t;
+
+// Overrides the Kconfig defaults; takes effect at the next esp_camera_init()
+esp_err_t camera_sim_configure(const camera_sim_config_t *config);
+
+esp_err_t camera_sim_get_stats(camera_sim_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
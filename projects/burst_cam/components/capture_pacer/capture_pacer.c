@@ -0,0 +1,249 @@
+#include "capture_pacer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "capture_pacer";
+
+static const uint32_t s_bucket_edges_us[CAPTURE_PACER_HIST_BUCKETS - 1] = {
+    100, 250, 500, 1000, 2000, 5000, 10000, 20000, 50000
+};
+
+static capture_pacer_config_t s_config;
+static bool s_running = false;
+static esp_timer_handle_t s_timer = NULL;
+static SemaphoreHandle_t s_deadline_sem = NULL;
+
+static int64_t s_start_us = 0;
+static int64_t s_duration_us = 0;
+static int64_t s_tolerance_us = 0;
+static uint32_t s_next_slot = 0;
+
+static bool s_have_previous = false;
+static int64_t s_previous_issue_us = 0;
+static int64_t s_previous_deadline_us = 0;
+
+static capture_pacer_stats_t s_stats;
+static uint64_t s_lateness_sum_us = 0;
+
+static void deadline_callback(void *arg)
+{
+    xSemaphoreGive(s_deadline_sem);
+}
+
+// Computed from the session start every time so rounding never accumulates
+static inline int64_t slot_deadline(uint32_t slot)
+{
+    return s_start_us + (int64_t)slot * s_duration_us / s_config.frame_count;
+}
+
+static int64_t now_us(void)
+{
+    return s_config.clock ? s_config.clock->now(s_config.clock->ctx) : esp_timer_get_time();
+}
+
+static int bucket_for(int64_t us)
+{
+    int i = 0;
+    while (i < CAPTURE_PACER_HIST_BUCKETS - 1 && us > s_bucket_edges_us[i]) {
+        i++;
+    }
+    return i;
+}
+
+static void wait_until(int64_t deadline)
+{
+    int64_t now = now_us();
+    if (deadline <= now) {
+        return;
+    }
+    if (s_config.clock) {
+        s_config.clock->wait_until(deadline, s_config.clock->ctx);
+        return;
+    }
+
+    if (esp_timer_start_once(s_timer, (uint64_t)(deadline - now)) != ESP_OK) {
+        // Tick resolution is still better than not waiting at all
+        vTaskDelay(pdMS_TO_TICKS((deadline - now + 999) / 1000));
+        return;
+    }
+    xSemaphoreTake(s_deadline_sem, portMAX_DELAY);
+}
+
+static void finish_session(void)
+{
+    esp_timer_stop(s_timer);
+    s_stats.elapsed_ms = (uint32_t)((now_us() - s_start_us) / 1000);
+    s_running = false;
+}
+
+esp_err_t capture_pacer_start(const capture_pacer_config_t *config)
+{
+    if (!config || config->frame_count == 0 || config->duration_ms == 0 ||
+        config->policy > CAPTURE_PACER_DROP) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (!s_deadline_sem) {
+        s_deadline_sem = xSemaphoreCreateBinary();
+        if (!s_deadline_sem) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (!s_timer) {
+        const esp_timer_create_args_t timer_args = {
+            .callback = deadline_callback,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "capture_pacer",
+        };
+        esp_err_t ret = esp_timer_create(&timer_args, &s_timer);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to create deadline timer: %s", esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    // A give left over from a stopped session would release the first wait early
+    xSemaphoreTake(s_deadline_sem, 0);
+
+    s_config = *config;
+    s_duration_us = (int64_t)config->duration_ms * 1000;
+    s_tolerance_us = config->late_tolerance_us ? config->late_tolerance_us
+                                               : s_duration_us / config->frame_count / 2;
+    s_next_slot = 0;
+    s_have_previous = false;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_lateness_sum_us = 0;
+
+    s_start_us = now_us();
+    s_running = true;
+
+    ESP_LOGD(TAG, "Session: %lu slots over %lu ms, policy %d",
+             (unsigned long)config->frame_count, (unsigned long)config->duration_ms, config->policy);
+    return ESP_OK;
+}
+
+bool capture_pacer_next(capture_pacer_tick_t *tick)
+{
+    if (!s_running || !tick) {
+        return false;
+    }
+
+    memset(tick, 0, sizeof(*tick));
+    uint32_t slot = s_next_slot;
+    int64_t now = now_us();
+
+    if (slot < s_config.frame_count && now - slot_deadline(slot) > s_tolerance_us) {
+        s_stats.overruns++;
+        if (s_config.policy == CAPTURE_PACER_SKIP) {
+            // Resume at the first slot that can still go out on time
+            uint32_t resume = slot;
+            while (resume < s_config.frame_count && now - slot_deadline(resume) > s_tolerance_us) {
+                resume++;
+            }
+            tick->skipped = resume - slot;
+            s_stats.slots_skipped += tick->skipped;
+            slot = resume;
+        } else if (s_config.policy == CAPTURE_PACER_DROP) {
+            tick->drop = true;
+        }
+    }
+
+    if (slot >= s_config.frame_count) {
+        s_next_slot = slot;
+        wait_until(s_start_us + s_duration_us);
+        finish_session();
+        return false;
+    }
+
+    int64_t deadline = slot_deadline(slot);
+    if (!tick->drop) {
+        wait_until(deadline);
+    }
+    int64_t issued = now_us();
+    int64_t lateness = issued > deadline ? issued - deadline : 0;
+
+    s_stats.lateness_hist[bucket_for(lateness)]++;
+    s_lateness_sum_us += lateness;
+    if (lateness > s_stats.lateness_max_us) {
+        s_stats.lateness_max_us = (uint32_t)lateness;
+    }
+
+    if (tick->drop) {
+        s_stats.slots_dropped++;
+    } else {
+        if (s_have_previous) {
+            int64_t error = (issued - s_previous_issue_us) - (deadline - s_previous_deadline_us);
+            s_stats.interval_hist[bucket_for(error < 0 ? -error : error)]++;
+        }
+        s_have_previous = true;
+        s_previous_issue_us = issued;
+        s_previous_deadline_us = deadline;
+    }
+
+    s_stats.slots_issued++;
+    s_next_slot = slot + 1;
+
+    tick->index = slot;
+    tick->deadline_us = deadline;
+    tick->lateness_us = lateness;
+    return true;
+}
+
+void capture_pacer_stop(void)
+{
+    if (s_running) {
+        finish_session();
+    }
+}
+
+esp_err_t capture_pacer_get_stats(capture_pacer_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    if (s_stats.slots_issued) {
+        stats->lateness_avg_us = (uint32_t)(s_lateness_sum_us / s_stats.slots_issued);
+    }
+    if (s_running) {
+        stats->elapsed_ms = (uint32_t)((now_us() - s_start_us) / 1000);
+    }
+    return ESP_OK;
+}
+
+static void format_hist(char *buf, size_t size, const uint32_t *hist)
+{
+    size_t used = 0;
+    buf[0] = '\0';
+    for (int i = 0; i < CAPTURE_PACER_HIST_BUCKETS && used < size; i++) {
+        used += snprintf(buf + used, size - used, i ? " %lu" : "%lu", (unsigned long)hist[i]);
+    }
+}
+
+void capture_pacer_log_stats(void)
+{
+    capture_pacer_stats_t stats;
+    capture_pacer_get_stats(&stats);
+
+    char lateness[96];
+    char interval[96];
+    format_hist(lateness, sizeof(lateness), stats.lateness_hist);
+    format_hist(interval, sizeof(interval), stats.interval_hist);
+
+    ESP_LOGI(TAG, "%lu/%lu slots in %lu ms (%lu skipped, %lu dropped, %lu late), lateness avg %lu us max %lu us",
+             (unsigned long)(stats.slots_issued - stats.slots_dropped), (unsigned long)s_config.frame_count,
+             (unsigned long)stats.elapsed_ms, (unsigned long)stats.slots_skipped,
+             (unsigned long)stats.slots_dropped, (unsigned long)stats.overruns,
+             (unsigned long)stats.lateness_avg_us, (unsigned long)stats.lateness_max_us);
+    // Buckets: <=100us 250us 500us 1ms 2ms 5ms 10ms 20ms 50ms >50ms
+    ESP_LOGI(TAG, "Lateness histogram: %s", lateness);
+    ESP_LOGI(TAG, "Interval error histogram: %s", interval);
+}
\ No newline at end of file
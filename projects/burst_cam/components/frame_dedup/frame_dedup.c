@@ -0,0 +1,269 @@
+#include "frame_dedup.h"
+#include "jpeg_scan.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "frame_dedup";
+
+#define HASH_SIZE   32      // side of the averaged image fed to the DCT
+#define HASH_FREQS  8       // lowest frequencies kept per axis, 8x8 = 64 bits
+
+static frame_dedup_config_t s_config;
+static bool s_initialized = false;
+
+// cos((2x + 1) * u * pi / 64) for the kept frequencies only
+static float s_cos[HASH_FREQS][HASH_SIZE];
+
+// For frames hashed straight from the JPEG, without a map from the caller
+static jpeg_scan_dc_map_t s_map;
+static float s_image[HASH_SIZE][HASH_SIZE];
+
+static bool s_have_kept = false;
+static uint64_t s_kept_hash = 0;
+static uint8_t s_kept_luma = 0;
+static uint32_t s_since_kept = 0;
+
+static frame_dedup_stats_t s_stats;
+static uint64_t s_hash_sum_us = 0;
+
+// Area average of a w x h plane into HASH_SIZE x HASH_SIZE cells. Planes
+// smaller than the hash repeat samples rather than leaving cells empty.
+static void downsample(const uint8_t *src, int w, int h, int stride, float out[HASH_SIZE][HASH_SIZE])
+{
+    for (int cy = 0; cy < HASH_SIZE; cy++) {
+        int y0 = cy * h / HASH_SIZE;
+        int y1 = (cy + 1) * h / HASH_SIZE;
+        y1 = y1 > y0 ? y1 : y0 + 1;
+        for (int cx = 0; cx < HASH_SIZE; cx++) {
+            int x0 = cx * w / HASH_SIZE;
+            int x1 = (cx + 1) * w / HASH_SIZE;
+            x1 = x1 > x0 ? x1 : x0 + 1;
+            uint32_t sum = 0;
+            for (int y = y0; y < y1; y++) {
+                const uint8_t *row = src + (size_t)y * stride;
+                for (int x = x0; x < x1; x++) {
+                    sum += row[x];
+                }
+            }
+            out[cy][cx] = (float)sum / ((y1 - y0) * (x1 - x0));
+        }
+    }
+}
+
+static uint64_t hash_from_image(float image[HASH_SIZE][HASH_SIZE], uint8_t *mean_luma)
+{
+    // Separable DCT-II, evaluated only at the frequencies that make the hash
+    float rows[HASH_SIZE][HASH_FREQS];
+    float total = 0.0f;
+    for (int y = 0; y < HASH_SIZE; y++) {
+        for (int u = 0; u < HASH_FREQS; u++) {
+            float acc = 0.0f;
+            for (int x = 0; x < HASH_SIZE; x++) {
+                acc += image[y][x] * s_cos[u][x];
+            }
+            rows[y][u] = acc;
+        }
+        // u = 0 is the plain row sum
+        total += rows[y][0];
+    }
+
+    float coeffs[HASH_FREQS * HASH_FREQS];
+    for (int v = 0; v < HASH_FREQS; v++) {
+        for (int u = 0; u < HASH_FREQS; u++) {
+            float acc = 0.0f;
+            for (int y = 0; y < HASH_SIZE; y++) {
+                acc += rows[y][u] * s_cos[v][y];
+            }
+            coeffs[v * HASH_FREQS + u] = acc;
+        }
+    }
+
+    float sorted[HASH_FREQS * HASH_FREQS];
+    memcpy(sorted, coeffs, sizeof(sorted));
+    for (int i = 1; i < HASH_FREQS * HASH_FREQS; i++) {
+        float value = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > value) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = value;
+    }
+    float median = (sorted[31] + sorted[32]) * 0.5f;
+
+    uint64_t hash = 0;
+    for (int i = 0; i < HASH_FREQS * HASH_FREQS; i++) {
+        if (coeffs[i] > median) {
+            hash |= 1ULL << i;
+        }
+    }
+
+    if (mean_luma) {
+        *mean_luma = (uint8_t)(total / (HASH_SIZE * HASH_SIZE) + 0.5f);
+    }
+    return hash;
+}
+
+esp_err_t frame_dedup_init(const frame_dedup_config_t *config)
+{
+    if (!config || config->max_distance > 64) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_config = *config;
+    for (int u = 0; u < HASH_FREQS; u++) {
+        for (int x = 0; x < HASH_SIZE; x++) {
+            s_cos[u][x] = cosf((2 * x + 1) * u * (float)M_PI / (2 * HASH_SIZE));
+        }
+    }
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_hash_sum_us = 0;
+    s_have_kept = false;
+    s_since_kept = 0;
+    s_initialized = true;
+
+    ESP_LOGI(TAG, "Frame dedup initialized: distance <= %d, luma delta <= %d, keyframe every %d",
+             config->max_distance, config->max_luma_delta, config->keyframe_interval);
+    return ESP_OK;
+}
+
+void frame_dedup_deinit(void)
+{
+    jpeg_scan_dc_map_free(&s_map);
+    s_have_kept = false;
+    s_initialized = false;
+}
+
+void frame_dedup_reset(void)
+{
+    s_have_kept = false;
+    s_since_kept = 0;
+}
+
+esp_err_t frame_dedup_hash(const camera_fb_t *fb, uint64_t *hash, uint8_t *mean_luma)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!fb || !hash) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (fb->format == PIXFORMAT_JPEG) {
+        esp_err_t ret = jpeg_scan_dc_map(fb->buf, fb->len, &s_map);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        return frame_dedup_hash_map(s_map.luma_dc, s_map.blocks_w, s_map.blocks_h, hash, mean_luma);
+    }
+    if (fb->format != PIXFORMAT_GRAYSCALE) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    downsample(fb->buf, fb->width, fb->height, fb->width, s_image);
+    *hash = hash_from_image(s_image, mean_luma);
+    return ESP_OK;
+}
+
+esp_err_t frame_dedup_hash_map(const uint8_t *map, uint16_t width, uint16_t height,
+                               uint64_t *hash, uint8_t *mean_luma)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!map || width == 0 || height == 0 || !hash) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    downsample(map, width, height, width, s_image);
+    *hash = hash_from_image(s_image, mean_luma);
+    return ESP_OK;
+}
+
+// Compares a freshly hashed frame with the kept one; a frame that is not a
+// duplicate takes its place
+static esp_err_t decide(esp_err_t ret, int64_t start, size_t frame_bytes, frame_dedup_result_t *result)
+{
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Cannot hash frame: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    result->hash_us = (uint32_t)(esp_timer_get_time() - start);
+
+    s_stats.frames++;
+    s_hash_sum_us += result->hash_us;
+    if (result->hash_us > s_stats.hash_max_us) {
+        s_stats.hash_max_us = result->hash_us;
+    }
+
+    if (s_have_kept) {
+        result->distance = frame_dedup_distance(result->hash, s_kept_hash);
+        int luma_delta = abs((int)result->mean_luma - (int)s_kept_luma);
+        bool same = result->distance <= s_config.max_distance && luma_delta <= s_config.max_luma_delta;
+        if (same && s_config.keyframe_interval && s_since_kept + 1 >= s_config.keyframe_interval) {
+            // Bounds how long a chain of references leans on one file
+            s_stats.keyframes_forced++;
+            same = false;
+        }
+        result->duplicate = same;
+    }
+
+    if (result->duplicate) {
+        s_since_kept++;
+        s_stats.duplicates++;
+        s_stats.bytes_saved += frame_bytes;
+    } else {
+        s_kept_hash = result->hash;
+        s_kept_luma = result->mean_luma;
+        s_have_kept = true;
+        s_since_kept = 0;
+        s_stats.kept++;
+    }
+    return ESP_OK;
+}
+
+esp_err_t frame_dedup_check(const camera_fb_t *fb, frame_dedup_result_t *result)
+{
+    if (!fb || !result) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->distance = -1;
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = frame_dedup_hash(fb, &result->hash, &result->mean_luma);
+    return decide(ret, start, fb->len, result);
+}
+
+esp_err_t frame_dedup_check_map(const uint8_t *map, uint16_t width, uint16_t height, size_t frame_bytes,
+                                frame_dedup_result_t *result)
+{
+    if (!result) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->distance = -1;
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = frame_dedup_hash_map(map, width, height, &result->hash, &result->mean_luma);
+    return decide(ret, start, frame_bytes, result);
+}
+
+esp_err_t frame_dedup_get_stats(frame_dedup_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    if (s_stats.frames) {
+        stats->hash_avg_us = (uint32_t)(s_hash_sum_us / s_stats.frames);
+    }
+    return ESP_OK;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "esp_camera.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Grayscale test frames for the components that work on camera frames;
+// each test draws its own scene into the buffer
+
+#define FRAME_TEST_MAX_PIXELS   (320 * 240)
+
+// The one test frame, resized to width x height; its pixels are left as
+// they were
+camera_fb_t *frame_test_gray(uint16_t width, uint16_t height);
+
+// Repeatable sensor noise in -amplitude..amplitude
+int frame_test_noise(int amplitude);
+
+uint8_t frame_test_clamp8(int v);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_camera.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Brightness statistics without decoding the image: the DC term of every
+// 8x8 luma block in a JPEG is that block's mean, so entropy-decoding the
+// scan (no IDCT, no colour conversion) yields a 1/64-size luma map. The
+// histogram and percentiles are taken over that map, one sample per block.
+typedef struct {
+    uint8_t mean;
+    uint8_t p5;
+    uint8_t p50;
+    uint8_t p95;
+    uint32_t blocks;            // samples behind the statistics
+    uint32_t scan_us;
+} luma_stats_t;
+
+// JPEG frames are measured from their DC map; grayscale frames from every
+// 8th pixel of every 8th row, which leaves no map behind
+esp_err_t luma_meter_measure(const camera_fb_t *fb, luma_stats_t *stats);
+
+esp_err_t luma_meter_measure_jpeg(const uint8_t *jpeg, size_t len, luma_stats_t *stats);
+
+// Histogram of the last measurement, 256 bins of block counts
+void luma_meter_get_histogram(uint32_t hist[256]);
+
+// DC map behind the last JPEG measurement: one byte per 8x8 block, row-major,
+// width bytes per row. Valid until the next measurement; grayscale frames
+// leave no map.
+esp_err_t luma_meter_get_map(const uint8_t **map, uint16_t *width, uint16_t *height);
+
+// Frees the luma map
+void luma_meter_deinit(void);
+
+// Lens cap, dead sensor or a scene with nothing above the noise floor
+static inline bool luma_meter_is_black(const luma_stats_t *stats, uint8_t threshold)
+{
+    return stats->p95 <= threshold;
+}
+
+// Deflicker: the sensor's AEC re-converges on every frame and lands a
+// little differently each time, which is the flicker in a timelapse. The
+// controller switches it off and steers the exposure itself, moving it a
+// fraction of the log error toward target_mean per frame, so a scene change
+// becomes a smooth ramp across frames instead of a jump in one of them.
+typedef struct {
+    uint8_t target_mean;        // frame mean to hold, e.g. 110
+    float rate;                 // fraction of the log error corrected per frame, e.g. 0.2
+    uint8_t deadband;           // luma error left alone
+    uint16_t min_exposure;      // sensor exposure lines, 0..1200 on the OV2640
+    uint16_t max_exposure;
+    uint16_t initial_exposure;
+} luma_deflicker_config_t;
+
+typedef struct {
+    bool enabled;
+    uint16_t exposure;
+    uint32_t frames;
+    uint32_t adjustments;
+    float flicker_rms;          // RMS change of the mean between consecutive frames
+} luma_deflicker_stats_t;
+
+esp_err_t luma_deflicker_start(const luma_deflicker_config_t *config);
+
+// Hands exposure back to the sensor's AEC
+void luma_deflicker_stop(void);
+
+// Re-applies the manual exposure after the sensor was re-initialised and
+// lost its settings
+esp_err_t luma_deflicker_resume(void);
+
+// Feeds one measurement; returns the exposure now set on the sensor
+int luma_deflicker_observe(const luma_stats_t *stats);
+
+esp_err_t luma_deflicker_get_stats(luma_deflicker_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "luma_meter.h"
+#include "camera_module.h"
+#include "jpeg_scan.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "luma_meter";
+
+// Map behind the last measurement; blocks_w is 0 when there is none
+static jpeg_scan_dc_map_t s_map;
+static uint32_t s_hist[256];
+
+// First frames after start correct most of the error at once: the initial
+// exposure is a guess
+#define DEFLICKER_WARMUP_FRAMES 4
+#define DEFLICKER_WARMUP_RATE   0.8f
+
+static luma_deflicker_config_t s_deflicker;
+static bool s_deflicker_enabled = false;
+static float s_exposure = 0.0f;
+static int s_applied = 0;
+static int s_last_mean = -1;
+static double s_change_sq_sum = 0.0;
+static luma_deflicker_stats_t s_deflicker_stats;
+
+static uint8_t percentile(uint32_t count, int pct)
+{
+    // Smallest level with at least pct% of the samples at or below it
+    uint32_t rank = (count * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (int v = 0; v < 256; v++) {
+        seen += s_hist[v];
+        if (seen >= rank && seen > 0) {
+            return (uint8_t)v;
+        }
+    }
+    return 255;
+}
+
+static void stats_from_hist(uint32_t count, luma_stats_t *stats)
+{
+    uint64_t sum = 0;
+    for (int v = 0; v < 256; v++) {
+        sum += (uint64_t)s_hist[v] * v;
+    }
+
+    stats->blocks = count;
+    stats->mean = count ? (uint8_t)((sum + count / 2) / count) : 0;
+    stats->p5 = percentile(count, 5);
+    stats->p50 = percentile(count, 50);
+    stats->p95 = percentile(count, 95);
+}
+
+static void accumulate(const uint8_t *src, size_t count, size_t step)
+{
+    for (size_t i = 0; i < count; i += step) {
+        s_hist[src[i]]++;
+    }
+}
+
+esp_err_t luma_meter_measure_jpeg(const uint8_t *jpeg, size_t len, luma_stats_t *stats)
+{
+    if (!jpeg || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = jpeg_scan_dc_map(jpeg, len, &s_map);
+    if (ret != ESP_OK) {
+        ESP_LOGD(TAG, "Cannot scan JPEG: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    size_t blocks = (size_t)s_map.blocks_w * s_map.blocks_h;
+    memset(s_hist, 0, sizeof(s_hist));
+    accumulate(s_map.luma_dc, blocks, 1);
+    stats_from_hist(blocks, stats);
+    stats->scan_us = (uint32_t)(esp_timer_get_time() - start);
+    return ESP_OK;
+}
+
+esp_err_t luma_meter_measure(const camera_fb_t *fb, luma_stats_t *stats)
+{
+    if (!fb || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (fb->format == PIXFORMAT_JPEG) {
+        return luma_meter_measure_jpeg(fb->buf, fb->len, stats);
+    }
+    if (fb->format != PIXFORMAT_GRAYSCALE) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    // Every 8th pixel of every 8th row, about what the DC map would give
+    int64_t start = esp_timer_get_time();
+    s_map.blocks_w = s_map.blocks_h = 0;
+    memset(s_hist, 0, sizeof(s_hist));
+    uint32_t count = 0;
+    for (size_t y = 0; y < fb->height; y += 8) {
+        accumulate(fb->buf + y * fb->width, fb->width, 8);
+        count += (fb->width + 7) / 8;
+    }
+    stats_from_hist(count, stats);
+    stats->scan_us = (uint32_t)(esp_timer_get_time() - start);
+    return ESP_OK;
+}
+
+void luma_meter_get_histogram(uint32_t hist[256])
+{
+    memcpy(hist, s_hist, sizeof(s_hist));
+}
+
+esp_err_t luma_meter_get_map(const uint8_t **map, uint16_t *width, uint16_t *height)
+{
+    if (!map || !width || !height) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_map.blocks_w == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    *map = s_map.luma_dc;
+    *width = s_map.blocks_w;
+    *height = s_map.blocks_h;
+    return ESP_OK;
+}
+
+void luma_meter_deinit(void)
+{
+    luma_deflicker_stop();
+    jpeg_scan_dc_map_free(&s_map);
+}
+
+static esp_err_t apply_exposure(int exposure)
+{
+    esp_err_t ret = camera_module_set_manual_exposure(true, exposure);
+    if (ret == ESP_OK) {
+        s_applied = exposure;
+    }
+    return ret;
+}
+
+esp_err_t luma_deflicker_start(const luma_deflicker_config_t *config)
+{
+    if (!config || config->rate <= 0.0f || config->rate > 1.0f || config->min_exposure == 0 ||
+        config->min_exposure > config->max_exposure ||
+        config->initial_exposure < config->min_exposure || config->initial_exposure > config->max_exposure) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_deflicker = *config;
+    s_exposure = config->initial_exposure;
+    s_last_mean = -1;
+    s_change_sq_sum = 0.0;
+    memset(&s_deflicker_stats, 0, sizeof(s_deflicker_stats));
+
+    esp_err_t ret = apply_exposure(config->initial_exposure);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot take over sensor exposure: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    s_deflicker_enabled = true;
+
+    ESP_LOGI(TAG, "Deflicker started: target %d, rate %.2f, exposure %d..%d",
+             config->target_mean, config->rate, config->min_exposure, config->max_exposure);
+    return ESP_OK;
+}
+
+void luma_deflicker_stop(void)
+{
+    if (s_deflicker_enabled) {
+        camera_module_set_manual_exposure(false, 0);
+    }
+    s_deflicker_enabled = false;
+}
+
+esp_err_t luma_deflicker_resume(void)
+{
+    if (!s_deflicker_enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // The frame before the gap says nothing about flicker
+    s_last_mean = -1;
+    return apply_exposure(s_applied);
+}
+
+int luma_deflicker_observe(const luma_stats_t *stats)
+{
+    if (!s_deflicker_enabled || !stats || stats->blocks == 0) {
+        return s_applied;
+    }
+
+    if (s_last_mean >= 0) {
+        int change = stats->mean - s_last_mean;
+        s_change_sq_sum += change * change;
+    }
+    s_last_mean = stats->mean;
+    s_deflicker_stats.frames++;
+
+    int error = (int)s_deflicker.target_mean - stats->mean;
+    if (abs(error) <= s_deflicker.deadband) {
+        return s_applied;
+    }
+
+    // Exposure scales the mean roughly linearly until highlights clip, so
+    // the correction is a power of the brightness ratio
+    float rate = s_deflicker_stats.frames <= DEFLICKER_WARMUP_FRAMES ? DEFLICKER_WARMUP_RATE : s_deflicker.rate;
+    float mean = stats->mean > 0 ? stats->mean : 0.5f;
+    s_exposure *= powf(s_deflicker.target_mean / mean, rate);
+    if (s_exposure < s_deflicker.min_exposure) {
+        s_exposure = s_deflicker.min_exposure;
+    } else if (s_exposure > s_deflicker.max_exposure) {
+        s_exposure = s_deflicker.max_exposure;
+    }
+
+    int exposure = (int)lroundf(s_exposure);
+    if (exposure != s_applied) {
+        esp_err_t ret = apply_exposure(exposure);
+        if (ret == ESP_OK) {
+            ESP_LOGD(TAG, "Exposure %d (mean %d)", exposure, stats->mean);
+            s_deflicker_stats.adjustments++;
+        } else {
+            ESP_LOGW(TAG, "Cannot set exposure %d: %s", exposure, esp_err_to_name(ret));
+        }
+    }
+    return s_applied;
+}
+
+esp_err_t luma_deflicker_get_stats(luma_deflicker_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_deflicker_stats;
+    stats->enabled = s_deflicker_enabled;
+    stats->exposure = (uint16_t)s_applied;
+    if (s_deflicker_stats.frames > 1) {
+        stats->flicker_rms = sqrtf((float)(s_change_sq_sum / (s_deflicker_stats.frames - 1)));
+    }
+    return ESP_OK;
+}
\ No newline at end of file
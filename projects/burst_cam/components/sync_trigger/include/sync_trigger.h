@@ -0,0 +1,93 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Shared capture trigger for several cameras over ESP-NOW broadcast. The
+// leader's esp_timer clock is the timebase: it broadcasts a beacon every
+// beacon interval and, in the next beacon, the time the previous one left
+// the radio. Followers pair those times with their own receive times and fit
+// offset and drift by least squares, so any instant converts between the two
+// clocks. A trigger names a capture time T in the leader's clock; every node
+// turns T into its own clock and arms an esp_timer one-shot for it. After
+// capturing, each node reports how far its deadline and its first frame were
+// from T and the leader keeps the spread across nodes.
+//
+// Host builds run the protocol over a simulated radio (sim/): UDP on the
+// loopback with configurable latency, jitter, loss and clock error per node.
+#define SYNC_TRIGGER_FIT_SAMPLES    32
+
+typedef enum {
+    SYNC_TRIGGER_ROLE_LEADER = 0,
+    SYNC_TRIGGER_ROLE_FOLLOWER,
+} sync_trigger_role_t;
+
+typedef struct {
+    sync_trigger_role_t role;
+    uint8_t channel;            // WiFi channel shared by all nodes
+    uint32_t beacon_ms;         // leader beacon interval
+} sync_trigger_config_t;
+
+typedef struct {
+    uint32_t id;
+    int64_t capture_at;         // T, leader clock, us
+    int64_t deadline;           // T in this node's clock
+    int64_t fired_at;           // this node's clock when the one-shot ran
+    int32_t fire_error_us;      // fired_at in the leader clock minus T
+} sync_trigger_event_t;
+
+typedef struct {
+    bool synced;
+    uint8_t samples;            // beacon pairs in the fit
+    float residual_us;          // RMS of the kept pairs around the fit
+    float drift_ppm;            // leader clock rate against ours
+    int64_t offset_us;          // leader clock minus ours, now
+    uint32_t beacons;
+    uint32_t beacons_lost;      // sequence gaps
+    uint32_t triggers;
+    uint32_t triggers_missed;   // arrived unsynced or after their deadline
+} sync_trigger_clock_t;
+
+typedef struct {
+    uint32_t rounds;            // triggers reported by at least two nodes
+    uint8_t last_nodes;
+    int32_t last_fire_skew_us;  // spread of fire errors across nodes
+    int32_t last_frame_skew_us; // spread of first-frame offsets across nodes
+    float fire_skew_avg_us;
+    int32_t fire_skew_max_us;
+    float frame_skew_avg_us;
+    int32_t frame_skew_max_us;
+    float residual_max_us;      // worst follower clock fit in the last round
+} sync_trigger_stats_t;
+
+esp_err_t sync_trigger_init(const sync_trigger_config_t *config);
+
+// Leader: broadcasts a trigger lead_ms ahead and arms its own deadline
+esp_err_t sync_trigger_arm(uint32_t lead_ms, sync_trigger_event_t *event);
+
+// Blocks until the next armed deadline fires. On a follower, a deadline
+// that fired before the call is dropped.
+esp_err_t sync_trigger_wait(sync_trigger_event_t *event, uint32_t timeout_ms);
+
+// Reports the fired event and the esp_timer timestamp of the first frame
+// taken for it (0 if none) to the leader
+esp_err_t sync_trigger_report(const sync_trigger_event_t *event, int64_t frame_time);
+
+// Converts a local esp_timer time to the leader clock
+esp_err_t sync_trigger_leader_time(int64_t local_us, int64_t *leader_us);
+
+esp_err_t sync_trigger_get_clock(sync_trigger_clock_t *clock);
+
+// Leader only; rounds close when the next trigger is armed
+esp_err_t sync_trigger_get_stats(sync_trigger_stats_t *stats);
+
+void sync_trigger_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
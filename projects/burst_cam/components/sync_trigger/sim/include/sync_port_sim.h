@@ -0,0 +1,48 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulated air for linux target builds. Each node is a process with a UDP
+// socket on the loopback at base_port + node_id; a broadcast goes to every
+// other port in the node range. Frames carry the sender's host monotonic
+// time, and the receiver holds each one until its arrival time: the fixed
+// latency plus an exponentially distributed extra delay, or drops it at the
+// loss rate. Every node sees the air through its own clock, esp_timer plus
+// a fixed offset and a rate error, so the followers have something to
+// estimate. The host monotonic clock is the ground truth the nodes share.
+typedef struct {
+    uint8_t node_id;
+    uint8_t node_count;
+    uint16_t base_port;
+    uint32_t latency_us;        // fixed air and stack delay
+    uint32_t jitter_us;         // mean of the extra delay
+    float loss;                 // share of frames lost at each receiver
+    int64_t clock_offset_us;    // node clock minus esp_timer
+    float clock_drift_ppm;      // node clock rate error
+    uint32_t seed;
+} sync_port_sim_config_t;
+
+typedef struct {
+    uint32_t sent;
+    uint32_t received;
+    uint32_t lost;
+    uint32_t fired;
+    int64_t last_fire_host_us;  // host monotonic time of the last deadline
+} sync_port_sim_stats_t;
+
+// Overrides the Kconfig defaults; takes effect at the next sync_trigger_init()
+esp_err_t sync_port_sim_configure(const sync_port_sim_config_t *config);
+
+// Host monotonic time of a node clock reading, for measuring true skew
+int64_t sync_port_sim_to_host(int64_t local_us);
+
+esp_err_t sync_port_sim_get_stats(sync_port_sim_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
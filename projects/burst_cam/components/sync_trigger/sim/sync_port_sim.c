@@ -0,0 +1,342 @@
+#include "sync_port.h"
+#include "sync_port_sim.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+static const char *TAG = "sync_port_sim";
+
+#define SIM_PENDING         16      // frames in flight towards this node
+#define SIM_SPIN_US         2000    // closer than this to a deadline the task stops sleeping
+#define SIM_TASK_STACK      4096
+#define SIM_TASK_PRIO       12
+
+typedef struct __attribute__((packed)) {
+    int64_t host_sent;
+    uint8_t from;
+    uint8_t len;
+} sim_frame_header_t;
+
+typedef struct {
+    bool used;
+    int64_t arrival;            // host monotonic
+    uint8_t len;
+    uint8_t data[SYNC_PORT_MAX_PAYLOAD];
+} sim_pending_t;
+
+static sync_port_sim_config_t s_sim_config = {
+    .node_id = CONFIG_SYNC_TRIGGER_SIM_NODE_ID,
+    .node_count = CONFIG_SYNC_TRIGGER_SIM_NODE_COUNT,
+    .base_port = CONFIG_SYNC_TRIGGER_SIM_BASE_PORT,
+    .latency_us = CONFIG_SYNC_TRIGGER_SIM_LATENCY_US,
+    .jitter_us = CONFIG_SYNC_TRIGGER_SIM_JITTER_US,
+    .loss = CONFIG_SYNC_TRIGGER_SIM_LOSS_PERCENT / 100.0f,
+    .clock_offset_us = CONFIG_SYNC_TRIGGER_SIM_CLOCK_OFFSET_US,
+    .clock_drift_ppm = CONFIG_SYNC_TRIGGER_SIM_DRIFT_PPM,
+    .seed = 1
+};
+
+static sync_port_rx_cb_t s_rx_cb = NULL;
+static sync_port_fire_cb_t s_fire_cb = NULL;
+static int s_socket = -1;
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static volatile bool s_running = false;
+static sim_pending_t s_pending[SIM_PENDING];
+static int64_t s_deadline = 0;      // node clock, 0 = none
+static int64_t s_epoch = 0;         // esp_timer time the drift counts from
+static int64_t s_timer_base = 0;    // esp_timer minus host monotonic
+static uint32_t s_rng = 1;
+static sync_port_sim_stats_t s_stats;
+
+static int64_t host_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int64_t local_from_host(int64_t host)
+{
+    return sync_port_from_timer(host + s_timer_base);
+}
+
+static float next_uniform(void)
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return ((s_rng >> 8) + 0.5f) / 16777216.0f;
+}
+
+static void receive_frames(void)
+{
+    uint8_t buf[sizeof(sim_frame_header_t) + SYNC_PORT_MAX_PAYLOAD];
+    ssize_t n;
+    while ((n = recv(s_socket, buf, sizeof(buf), 0)) > 0) {
+        sim_frame_header_t header;
+        if ((size_t)n < sizeof(header)) {
+            continue;
+        }
+        memcpy(&header, buf, sizeof(header));
+        if (header.len > SYNC_PORT_MAX_PAYLOAD || (size_t)n < sizeof(header) + header.len) {
+            continue;
+        }
+        if (next_uniform() < s_sim_config.loss) {
+            s_stats.lost++;
+            continue;
+        }
+
+        float jitter = -logf(next_uniform()) * s_sim_config.jitter_us;
+        for (int i = 0; i < SIM_PENDING; i++) {
+            if (!s_pending[i].used) {
+                s_pending[i].used = true;
+                s_pending[i].arrival = header.host_sent + s_sim_config.latency_us + (int64_t)jitter;
+                s_pending[i].len = header.len;
+                memcpy(s_pending[i].data, buf + sizeof(header), header.len);
+                break;
+            }
+        }
+    }
+}
+
+static void deliver_due(int64_t now)
+{
+    // Oldest first, so frames overtake each other only as the jitter says
+    while (1) {
+        int due = -1;
+        for (int i = 0; i < SIM_PENDING; i++) {
+            if (s_pending[i].used && s_pending[i].arrival <= now &&
+                (due < 0 || s_pending[i].arrival < s_pending[due].arrival)) {
+                due = i;
+            }
+        }
+        if (due < 0) {
+            return;
+        }
+        s_stats.received++;
+        if (s_rx_cb) {
+            s_rx_cb(s_pending[due].data, s_pending[due].len, local_from_host(s_pending[due].arrival));
+        }
+        s_pending[due].used = false;
+    }
+}
+
+static void sim_task(void *arg)
+{
+    while (s_running) {
+        receive_frames();
+        deliver_due(host_now());
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        int64_t deadline = s_deadline;
+        int64_t now = sync_port_now();
+        bool fire = deadline && now >= deadline;
+        if (fire) {
+            s_deadline = 0;
+            s_stats.fired++;
+            s_stats.last_fire_host_us = host_now();
+        }
+        xSemaphoreGive(s_lock);
+
+        if (fire) {
+            if (s_fire_cb) {
+                s_fire_cb(now);
+            }
+        } else if (deadline && deadline - now < SIM_SPIN_US) {
+            taskYIELD();
+        } else {
+            vTaskDelay(1);
+        }
+    }
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+esp_err_t sync_port_sim_configure(const sync_port_sim_config_t *config)
+{
+    if (!config || config->node_count < 2 || config->node_id >= config->node_count ||
+        config->loss < 0.0f || config->loss >= 1.0f) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_sim_config = *config;
+    return ESP_OK;
+}
+
+esp_err_t sync_port_init(uint8_t channel, sync_port_rx_cb_t rx_cb, sync_port_fire_cb_t fire_cb)
+{
+    if (s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s_socket < 0) {
+        return ESP_FAIL;
+    }
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(s_sim_config.base_port + s_sim_config.node_id),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK)
+    };
+    if (bind(s_socket, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        ESP_LOGE(TAG, "Port %d is taken: %s", ntohs(addr.sin_port), strerror(errno));
+        close(s_socket);
+        s_socket = -1;
+        return ESP_ERR_INVALID_STATE;
+    }
+    fcntl(s_socket, F_SETFL, fcntl(s_socket, F_GETFL) | O_NONBLOCK);
+
+    s_lock = xSemaphoreCreateMutex();
+    if (!s_lock) {
+        close(s_socket);
+        s_socket = -1;
+        return ESP_ERR_NO_MEM;
+    }
+
+    memset(s_pending, 0, sizeof(s_pending));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_rx_cb = rx_cb;
+    s_fire_cb = fire_cb;
+    s_deadline = 0;
+    s_rng = s_sim_config.seed * 2654435761u + s_sim_config.node_id + 1;
+    s_timer_base = esp_timer_get_time() - host_now();
+    s_epoch = esp_timer_get_time();
+
+    s_running = true;
+    if (xTaskCreate(sim_task, "sync_sim", SIM_TASK_STACK, NULL, SIM_TASK_PRIO, &s_task) != pdPASS) {
+        s_running = false;
+        sync_port_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Node %d of %d on udp %d (channel %d): latency %lu us + %lu us jitter, %.0f%% loss, clock %+lld us %+.1f ppm",
+             s_sim_config.node_id, s_sim_config.node_count, ntohs(addr.sin_port), channel,
+             (unsigned long)s_sim_config.latency_us, (unsigned long)s_sim_config.jitter_us,
+             s_sim_config.loss * 100.0f, (long long)s_sim_config.clock_offset_us, s_sim_config.clock_drift_ppm);
+    return ESP_OK;
+}
+
+uint8_t sync_port_node_id(void)
+{
+    return s_sim_config.node_id;
+}
+
+int64_t sync_port_from_timer(int64_t timer_us)
+{
+    double drift = (double)(timer_us - s_epoch) * s_sim_config.clock_drift_ppm * 1e-6;
+    return timer_us + s_sim_config.clock_offset_us + (int64_t)llround(drift);
+}
+
+int64_t sync_port_now(void)
+{
+    return sync_port_from_timer(esp_timer_get_time());
+}
+
+int64_t sync_port_sim_to_host(int64_t local_us)
+{
+    double k = s_sim_config.clock_drift_ppm * 1e-6;
+    double timer_us = ((double)(local_us - s_sim_config.clock_offset_us) + (double)s_epoch * k) / (1.0 + k);
+    return (int64_t)llround(timer_us) - s_timer_base;
+}
+
+esp_err_t sync_port_broadcast(const void *data, size_t len, int64_t *tx_time)
+{
+    if (s_socket < 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!data || len == 0 || len > SYNC_PORT_MAX_PAYLOAD) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t buf[sizeof(sim_frame_header_t) + SYNC_PORT_MAX_PAYLOAD];
+    sim_frame_header_t header = {
+        .host_sent = host_now(),
+        .from = s_sim_config.node_id,
+        .len = (uint8_t)len
+    };
+    memcpy(buf, &header, sizeof(header));
+    memcpy(buf + sizeof(header), data, len);
+
+    for (int node = 0; node < s_sim_config.node_count; node++) {
+        if (node == s_sim_config.node_id) {
+            continue;
+        }
+        struct sockaddr_in addr = {
+            .sin_family = AF_INET,
+            .sin_port = htons(s_sim_config.base_port + node),
+            .sin_addr.s_addr = htonl(INADDR_LOOPBACK)
+        };
+        // Nodes that are not running yet just miss the frame, as on air
+        sendto(s_socket, buf, sizeof(header) + len, 0, (struct sockaddr *)&addr, sizeof(addr));
+    }
+    s_stats.sent++;
+    // The send callback on the device runs once the frame is off the air
+    if (tx_time) {
+        *tx_time = local_from_host(header.host_sent + s_sim_config.latency_us);
+    }
+    return ESP_OK;
+}
+
+esp_err_t sync_port_schedule(int64_t deadline)
+{
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_deadline = deadline;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+void sync_port_cancel(void)
+{
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        s_deadline = 0;
+        xSemaphoreGive(s_lock);
+    }
+}
+
+esp_err_t sync_port_sim_get_stats(sync_port_sim_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = s_stats;
+    return ESP_OK;
+}
+
+void sync_port_deinit(void)
+{
+    if (s_running) {
+        s_running = false;
+        while (s_task) {
+            vTaskDelay(1);
+        }
+    }
+    if (s_lock) {
+        vSemaphoreDelete(s_lock);
+        s_lock = NULL;
+    }
+    if (s_socket >= 0) {
+        close(s_socket);
+        s_socket = -1;
+    }
+    s_rx_cb = NULL;
+    s_fire_cb = NULL;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stddef.h>
+
+// Radio and clock under sync_trigger: ESP-NOW and esp_timer on the device,
+// the simulated air in sim/ on linux builds
+
+#define SYNC_PORT_MAX_PAYLOAD   64
+
+// Called from the radio's task with the local time the frame arrived
+typedef void (*sync_port_rx_cb_t)(const uint8_t *data, size_t len, int64_t rx_time);
+
+// Called when a scheduled deadline is reached, with the local time it ran
+typedef void (*sync_port_fire_cb_t)(int64_t fired_at);
+
+esp_err_t sync_port_init(uint8_t channel, sync_port_rx_cb_t rx_cb, sync_port_fire_cb_t fire_cb);
+
+uint8_t sync_port_node_id(void);
+
+// Local clock, us
+int64_t sync_port_now(void);
+
+// Local clock at an esp_timer time such as a frame buffer's timestamp
+int64_t sync_port_from_timer(int64_t timer_us);
+
+// Broadcasts one frame and waits until it has left; tx_time is the local
+// time the radio reported it sent
+esp_err_t sync_port_broadcast(const void *data, size_t len, int64_t *tx_time);
+
+// Arms the one-shot for a local time, replacing any armed one
+esp_err_t sync_port_schedule(int64_t deadline);
+
+void sync_port_cancel(void);
+
+void sync_port_deinit(void);
\ No newline at end of file
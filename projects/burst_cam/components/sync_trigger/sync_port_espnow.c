@@ -0,0 +1,208 @@
+#include "sync_port.h"
+#include "esp_log.h"
+#include "esp_now.h"
+#include "esp_wifi.h"
+#include "esp_netif.h"
+#include "esp_event.h"
+#include "esp_mac.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+static const char *TAG = "sync_port";
+
+#define SEND_TIMEOUT_MS     20
+
+static const uint8_t s_broadcast[ESP_NOW_ETH_ALEN] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+static sync_port_rx_cb_t s_rx_cb = NULL;
+static sync_port_fire_cb_t s_fire_cb = NULL;
+static esp_timer_handle_t s_timer = NULL;
+static SemaphoreHandle_t s_send_lock = NULL;
+static SemaphoreHandle_t s_sent = NULL;
+static volatile int64_t s_sent_at = 0;
+static volatile bool s_sent_ok = false;
+static uint8_t s_node = 0;
+
+// Runs in the WiFi task as soon as the frame is off the air; broadcasts are
+// not acknowledged, so this is the closest the leader gets to the air time
+static void send_cb(const uint8_t *mac_addr, esp_now_send_status_t status)
+{
+    s_sent_at = esp_timer_get_time();
+    s_sent_ok = status == ESP_NOW_SEND_SUCCESS;
+    xSemaphoreGive(s_sent);
+}
+
+static void recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int len)
+{
+    int64_t rx_time = esp_timer_get_time();
+    if (s_rx_cb && len > 0 && len <= SYNC_PORT_MAX_PAYLOAD) {
+        s_rx_cb(data, len, rx_time);
+    }
+}
+
+static void timer_cb(void *arg)
+{
+    int64_t fired_at = esp_timer_get_time();
+    if (s_fire_cb) {
+        s_fire_cb(fired_at);
+    }
+}
+
+esp_err_t sync_port_init(uint8_t channel, sync_port_rx_cb_t rx_cb, sync_port_fire_cb_t fire_cb)
+{
+    s_rx_cb = rx_cb;
+    s_fire_cb = fire_cb;
+
+    s_send_lock = xSemaphoreCreateMutex();
+    s_sent = xSemaphoreCreateBinary();
+    if (!s_send_lock || !s_sent) {
+        sync_port_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    // time_sync may have set these up already, and releases the driver
+    // after NTP; ESP-NOW needs it started on the shared channel
+    esp_err_t ret = esp_netif_init();
+    if (ret == ESP_OK) {
+        ret = esp_event_loop_create_default();
+    }
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        sync_port_deinit();
+        return ret;
+    }
+
+    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    ret = esp_wifi_init(&cfg);
+    if (ret == ESP_OK) {
+        esp_wifi_set_storage(WIFI_STORAGE_RAM);
+        ret = esp_wifi_set_mode(WIFI_MODE_STA);
+    }
+    if (ret == ESP_OK) {
+        ret = esp_wifi_start();
+    }
+    if (ret == ESP_OK) {
+        // Modem sleep would hold frames back by up to a beacon period
+        esp_wifi_set_ps(WIFI_PS_NONE);
+        ret = esp_wifi_set_channel(channel, WIFI_SECOND_CHAN_NONE);
+    }
+    if (ret == ESP_OK) {
+        ret = esp_now_init();
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "WiFi/ESP-NOW start failed: %s", esp_err_to_name(ret));
+        sync_port_deinit();
+        return ret;
+    }
+
+    esp_now_register_send_cb(send_cb);
+    esp_now_register_recv_cb(recv_cb);
+
+    esp_now_peer_info_t peer = {
+        .channel = channel,
+        .ifidx = WIFI_IF_STA,
+        .encrypt = false
+    };
+    memcpy(peer.peer_addr, s_broadcast, ESP_NOW_ETH_ALEN);
+    ret = esp_now_add_peer(&peer);
+    if (ret != ESP_OK) {
+        sync_port_deinit();
+        return ret;
+    }
+
+    esp_timer_create_args_t timer_args = {
+        .callback = timer_cb,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "sync_deadline"
+    };
+    ret = esp_timer_create(&timer_args, &s_timer);
+    if (ret != ESP_OK) {
+        sync_port_deinit();
+        return ret;
+    }
+
+    uint8_t mac[6];
+    esp_read_mac(mac, ESP_MAC_WIFI_STA);
+    s_node = mac[5];
+    ESP_LOGI(TAG, "ESP-NOW up on channel %d, node %02x", channel, s_node);
+    return ESP_OK;
+}
+
+uint8_t sync_port_node_id(void)
+{
+    return s_node;
+}
+
+int64_t sync_port_now(void)
+{
+    return esp_timer_get_time();
+}
+
+int64_t sync_port_from_timer(int64_t timer_us)
+{
+    return timer_us;
+}
+
+esp_err_t sync_port_broadcast(const void *data, size_t len, int64_t *tx_time)
+{
+    if (!s_send_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!data || len == 0 || len > SYNC_PORT_MAX_PAYLOAD) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // One frame in flight at a time, so each send callback belongs to its send
+    xSemaphoreTake(s_send_lock, portMAX_DELAY);
+    xSemaphoreTake(s_sent, 0);
+    esp_err_t ret = esp_now_send(s_broadcast, data, len);
+    if (ret == ESP_OK) {
+        if (xSemaphoreTake(s_sent, pdMS_TO_TICKS(SEND_TIMEOUT_MS)) != pdTRUE) {
+            ret = ESP_ERR_TIMEOUT;
+        } else if (!s_sent_ok) {
+            ret = ESP_FAIL;
+        } else if (tx_time) {
+            *tx_time = s_sent_at;
+        }
+    }
+    xSemaphoreGive(s_send_lock);
+    return ret;
+}
+
+esp_err_t sync_port_schedule(int64_t deadline)
+{
+    if (!s_timer) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_timer_stop(s_timer);
+    int64_t delay = deadline - esp_timer_get_time();
+    return esp_timer_start_once(s_timer, delay > 0 ? (uint64_t)delay : 0);
+}
+
+void sync_port_cancel(void)
+{
+    if (s_timer) {
+        esp_timer_stop(s_timer);
+    }
+}
+
+void sync_port_deinit(void)
+{
+    if (s_timer) {
+        esp_timer_stop(s_timer);
+        esp_timer_delete(s_timer);
+        s_timer = NULL;
+    }
+    esp_now_deinit();
+    if (s_sent) {
+        vSemaphoreDelete(s_sent);
+        s_sent = NULL;
+    }
+    if (s_send_lock) {
+        vSemaphoreDelete(s_send_lock);
+        s_send_lock = NULL;
+    }
+    s_rx_cb = NULL;
+    s_fire_cb = NULL;
+}
\ No newline at end of file
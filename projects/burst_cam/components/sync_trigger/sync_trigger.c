@@ -0,0 +1,710 @@
+#include "sync_trigger.h"
+#include "sync_port.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "sync_trigger";
+
+#define SYNC_MAGIC              0x5359
+#define SYNC_VERSION            1
+#define SYNC_MSG_BEACON         1
+#define SYNC_MSG_TRIGGER        2
+#define SYNC_MSG_REPORT         3
+
+#define REPORT_SYNCED           0x01
+#define REPORT_FRAME            0x02
+
+#define TRIGGER_REPEATS         3       // broadcasts are not acknowledged
+#define MIN_LEAD_US             2000    // later than this a deadline cannot be met
+#define FIT_MIN_SAMPLES         4
+#define FIT_MAX_DRIFT           200e-6
+#define FIT_ENVELOPE_SHARE      4       // the fastest quarter of the pairs sets the offset
+#define CLOCK_STEP_US           5000    // a pair this far off means the leader restarted
+#define RX_SLOTS                4
+#define RX_QUEUE_LEN            8
+#define SYNC_TASK_STACK         4096
+#define SYNC_TASK_PRIO          10
+
+typedef struct __attribute__((packed)) {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t type;
+    uint8_t node;
+    uint8_t reserved[3];
+    uint32_t seq;
+} sync_header_t;
+
+typedef struct __attribute__((packed)) {
+    sync_header_t header;
+    int64_t prev_tx;            // leader clock when beacon seq - 1 left, 0 = unknown
+} sync_beacon_t;
+
+typedef struct __attribute__((packed)) {
+    sync_header_t header;       // seq = trigger id
+    int64_t capture_at;
+} sync_trigger_msg_t;
+
+typedef struct __attribute__((packed)) {
+    sync_header_t header;       // seq = trigger id
+    int32_t fire_error_us;
+    int32_t frame_offset_us;
+    uint16_t residual_us;
+    uint8_t flags;
+} sync_report_t;
+
+typedef struct {
+    int64_t rx_time;
+    uint8_t len;
+    uint8_t data[SYNC_PORT_MAX_PAYLOAD];
+} rx_msg_t;
+
+typedef struct {
+    int64_t local;
+    int64_t leader;
+} clock_pair_t;
+
+typedef struct {
+    uint32_t id;
+    uint8_t nodes;
+    uint8_t frames;
+    int32_t fire_min, fire_max;
+    int32_t frame_min, frame_max;
+    float residual_max;
+} round_t;
+
+static sync_trigger_config_t s_config;
+static uint8_t s_node = 0;
+static SemaphoreHandle_t s_lock = NULL;
+static SemaphoreHandle_t s_fired = NULL;
+static QueueHandle_t s_rx_queue = NULL;
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+
+// Follower clock model: leader = leader_ref + (local - local_ref) * (1 + drift) + offset
+static clock_pair_t s_pairs[SYNC_TRIGGER_FIT_SAMPLES];
+static int s_pair_count = 0;
+static int s_pair_next = 0;
+static struct {
+    bool valid;
+    int64_t local_ref;
+    int64_t leader_ref;
+    double offset;
+    double drift;
+    float residual;
+    uint8_t kept;
+} s_fit;
+static struct {
+    uint32_t seq;
+    int64_t rx_time;
+} s_rx_slots[RX_SLOTS];
+static uint32_t s_last_beacon_seq = 0;
+
+// Leader
+static uint32_t s_beacon_seq = 0;
+static int64_t s_beacon_tx = 0;
+static uint32_t s_trigger_id = 0;
+static round_t s_round;
+static sync_trigger_stats_t s_stats;
+static double s_fire_skew_sum = 0;
+static double s_frame_skew_sum = 0;
+static uint32_t s_frame_rounds = 0;
+
+// Both
+static sync_trigger_event_t s_event;
+static sync_trigger_clock_t s_clock;
+
+static void fill_header(sync_header_t *header, uint8_t type, uint32_t seq)
+{
+    memset(header, 0, sizeof(*header));
+    header->magic = SYNC_MAGIC;
+    header->version = SYNC_VERSION;
+    header->type = type;
+    header->node = s_node;
+    header->seq = seq;
+}
+
+static int64_t to_leader(int64_t local)
+{
+    if (s_config.role == SYNC_TRIGGER_ROLE_LEADER) {
+        return local;
+    }
+    double dt = (double)(local - s_fit.local_ref);
+    return s_fit.leader_ref + (int64_t)llround(dt + s_fit.offset + dt * s_fit.drift);
+}
+
+static int64_t to_local(int64_t leader)
+{
+    if (s_config.role == SYNC_TRIGGER_ROLE_LEADER) {
+        return leader;
+    }
+    double dt = ((double)(leader - s_fit.leader_ref) - s_fit.offset) / (1.0 + s_fit.drift);
+    return s_fit.local_ref + (int64_t)llround(dt);
+}
+
+// Least squares over the kept pairs, relative to the newest one so the
+// doubles hold microseconds exactly. y is the leader's advance minus ours,
+// which leaves offset and drift as a line's intercept and slope.
+static void fit_pairs(const bool *keep, const clock_pair_t *ref)
+{
+    double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+    for (int i = 0; i < s_pair_count; i++) {
+        if (!keep[i]) {
+            continue;
+        }
+        double x = (double)(s_pairs[i].local - ref->local);
+        double y = (double)(s_pairs[i].leader - ref->leader) - x;
+        n++;
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+
+    double drift = 0.0;
+    double det = n * sxx - sx * sx;
+    if (n >= FIT_MIN_SAMPLES && det > 0) {
+        drift = (n * sxy - sx * sy) / det;
+        drift = drift > FIT_MAX_DRIFT ? FIT_MAX_DRIFT : (drift < -FIT_MAX_DRIFT ? -FIT_MAX_DRIFT : drift);
+    }
+    s_fit.local_ref = ref->local;
+    s_fit.leader_ref = ref->leader;
+    s_fit.drift = drift;
+    s_fit.offset = n > 0 ? (sy - drift * sx) / n : 0.0;
+    s_fit.kept = (uint8_t)n;
+}
+
+static double pair_residual(const clock_pair_t *pair)
+{
+    return (double)(pair->leader - to_leader(pair->local));
+}
+
+static void insert_descending(double *list, int count, double value)
+{
+    int j = count;
+    while (j > 0 && list[j - 1] < value) {
+        list[j] = list[j - 1];
+        j--;
+    }
+    list[j] = value;
+}
+
+static void refit(void)
+{
+    bool keep[SYNC_TRIGGER_FIT_SAMPLES];
+    double residuals[SYNC_TRIGGER_FIT_SAMPLES];
+    double sorted[SYNC_TRIGGER_FIT_SAMPLES];
+    const clock_pair_t *ref = &s_pairs[(s_pair_next + SYNC_TRIGGER_FIT_SAMPLES - 1) % SYNC_TRIGGER_FIT_SAMPLES];
+
+    for (int i = 0; i < s_pair_count; i++) {
+        keep[i] = true;
+    }
+    fit_pairs(keep, ref);
+
+    double sum = 0;
+    for (int i = 0; i < s_pair_count; i++) {
+        residuals[i] = pair_residual(&s_pairs[i]);
+        sum += residuals[i] * residuals[i];
+        insert_descending(sorted, i, residuals[i]);
+    }
+    s_fit.residual = (float)sqrt(sum / s_pair_count);
+
+    // Delays only ever add, so the least-squares line runs the mean delay
+    // below the leader's clock and late frames tilt it. Refit through the
+    // faster half of the pairs, then lift it onto the fastest quarter.
+    int half = (s_pair_count + 1) / 2;
+    if (half >= FIT_MIN_SAMPLES) {
+        for (int i = 0; i < s_pair_count; i++) {
+            keep[i] = residuals[i] >= sorted[half - 1];
+        }
+        fit_pairs(keep, ref);
+    }
+
+    int count = 0;
+    for (int i = 0; i < s_pair_count; i++) {
+        if (keep[i]) {
+            insert_descending(sorted, count++, pair_residual(&s_pairs[i]));
+        }
+    }
+    int envelope = s_pair_count / FIT_ENVELOPE_SHARE;
+    envelope = envelope < 1 ? 1 : (envelope > count ? count : envelope);
+    double lift = 0;
+    for (int i = 0; i < envelope; i++) {
+        lift += sorted[i];
+    }
+    s_fit.offset += lift / envelope;
+    s_fit.valid = s_pair_count >= FIT_MIN_SAMPLES;
+}
+
+static void add_pair(int64_t local, int64_t leader)
+{
+    if (s_fit.valid) {
+        clock_pair_t pair = { local, leader };
+        double r = pair_residual(&pair);
+        if (fabs(r) > CLOCK_STEP_US) {
+            ESP_LOGW(TAG, "Leader clock stepped by %.0f us, resynchronizing", r);
+            s_pair_count = 0;
+            s_pair_next = 0;
+            s_fit.valid = false;
+        }
+    }
+
+    s_pairs[s_pair_next].local = local;
+    s_pairs[s_pair_next].leader = leader;
+    s_pair_next = (s_pair_next + 1) % SYNC_TRIGGER_FIT_SAMPLES;
+    if (s_pair_count < SYNC_TRIGGER_FIT_SAMPLES) {
+        s_pair_count++;
+    }
+
+    bool was_valid = s_fit.valid;
+    refit();
+    if (s_fit.valid && !was_valid) {
+        ESP_LOGI(TAG, "Synchronized to the leader: offset %lld us, residual %.1f us",
+                 (long long)(to_leader(local) - local), s_fit.residual);
+    }
+}
+
+static void handle_beacon(const sync_beacon_t *beacon, int64_t rx_time)
+{
+    uint32_t seq = beacon->header.seq;
+    s_clock.beacons++;
+    if (s_last_beacon_seq && seq > s_last_beacon_seq + 1) {
+        s_clock.beacons_lost += seq - s_last_beacon_seq - 1;
+    }
+    s_last_beacon_seq = seq;
+
+    // Two-step: this beacon carries when the previous one left the leader
+    if (beacon->prev_tx) {
+        for (int i = 0; i < RX_SLOTS; i++) {
+            if (s_rx_slots[i].seq == seq - 1 && s_rx_slots[i].rx_time) {
+                add_pair(s_rx_slots[i].rx_time, beacon->prev_tx);
+                break;
+            }
+        }
+    }
+    s_rx_slots[seq % RX_SLOTS].seq = seq;
+    s_rx_slots[seq % RX_SLOTS].rx_time = rx_time;
+}
+
+static void arm_deadline(uint32_t id, int64_t capture_at, int64_t deadline)
+{
+    s_event.id = id;
+    s_event.capture_at = capture_at;
+    s_event.deadline = deadline;
+    s_event.fired_at = 0;
+    s_event.fire_error_us = 0;
+    sync_port_schedule(deadline);
+}
+
+static void handle_trigger(const sync_trigger_msg_t *trigger)
+{
+    uint32_t id = trigger->header.seq;
+    if (id == s_event.id) {
+        return;     // a repeat
+    }
+    s_clock.triggers++;
+
+    if (!s_fit.valid) {
+        s_event.id = id;
+        s_clock.triggers_missed++;
+        ESP_LOGW(TAG, "Trigger %lu before the clock is synchronized, skipped", (unsigned long)id);
+        return;
+    }
+
+    int64_t deadline = to_local(trigger->capture_at);
+    int64_t lead = deadline - sync_port_now();
+    if (lead < MIN_LEAD_US) {
+        s_event.id = id;
+        s_clock.triggers_missed++;
+        ESP_LOGW(TAG, "Trigger %lu arrived %lld us before its deadline, skipped",
+                 (unsigned long)id, (long long)lead);
+        return;
+    }
+    arm_deadline(id, trigger->capture_at, deadline);
+}
+
+static void fold_report(int32_t fire_error, bool has_frame, int32_t frame_offset, float residual)
+{
+    if (s_round.nodes == 0 || fire_error < s_round.fire_min) {
+        s_round.fire_min = fire_error;
+    }
+    if (s_round.nodes == 0 || fire_error > s_round.fire_max) {
+        s_round.fire_max = fire_error;
+    }
+    s_round.nodes++;
+
+    if (has_frame) {
+        if (s_round.frames == 0 || frame_offset < s_round.frame_min) {
+            s_round.frame_min = frame_offset;
+        }
+        if (s_round.frames == 0 || frame_offset > s_round.frame_max) {
+            s_round.frame_max = frame_offset;
+        }
+        s_round.frames++;
+    }
+    if (residual > s_round.residual_max) {
+        s_round.residual_max = residual;
+    }
+}
+
+static void handle_report(const sync_report_t *report)
+{
+    if (report->header.seq != s_round.id || !(report->flags & REPORT_SYNCED)) {
+        return;
+    }
+    fold_report(report->fire_error_us, report->flags & REPORT_FRAME, report->frame_offset_us,
+                report->residual_us);
+}
+
+static void close_round(void)
+{
+    if (s_round.nodes < 2) {
+        return;
+    }
+
+    int32_t fire_skew = s_round.fire_max - s_round.fire_min;
+    s_stats.rounds++;
+    s_stats.last_nodes = s_round.nodes;
+    s_stats.last_fire_skew_us = fire_skew;
+    s_fire_skew_sum += fire_skew;
+    s_stats.fire_skew_avg_us = (float)(s_fire_skew_sum / s_stats.rounds);
+    if (fire_skew > s_stats.fire_skew_max_us) {
+        s_stats.fire_skew_max_us = fire_skew;
+    }
+    s_stats.residual_max_us = s_round.residual_max;
+
+    s_stats.last_frame_skew_us = -1;
+    if (s_round.frames >= 2) {
+        int32_t frame_skew = s_round.frame_max - s_round.frame_min;
+        s_stats.last_frame_skew_us = frame_skew;
+        s_frame_rounds++;
+        s_frame_skew_sum += frame_skew;
+        s_stats.frame_skew_avg_us = (float)(s_frame_skew_sum / s_frame_rounds);
+        if (frame_skew > s_stats.frame_skew_max_us) {
+            s_stats.frame_skew_max_us = frame_skew;
+        }
+    }
+
+    ESP_LOGI(TAG, "Trigger %lu: %d nodes, fire skew %ld us, frame skew %ld us, worst clock residual %.1f us",
+             (unsigned long)s_round.id, s_round.nodes, (long)fire_skew, (long)s_stats.last_frame_skew_us,
+             s_round.residual_max);
+}
+
+static void send_beacon(void)
+{
+    sync_beacon_t beacon;
+    fill_header(&beacon.header, SYNC_MSG_BEACON, ++s_beacon_seq);
+    beacon.prev_tx = s_beacon_tx;
+
+    int64_t tx_time = 0;
+    if (sync_port_broadcast(&beacon, sizeof(beacon), &tx_time) == ESP_OK) {
+        s_beacon_tx = tx_time;
+    } else {
+        s_beacon_tx = 0;    // followers skip the pair rather than use a guess
+    }
+}
+
+static void handle_message(const rx_msg_t *msg)
+{
+    if (msg->len < sizeof(sync_header_t)) {
+        return;
+    }
+    const sync_header_t *header = (const sync_header_t *)msg->data;
+    if (header->magic != SYNC_MAGIC || header->version != SYNC_VERSION || header->node == s_node) {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_config.role == SYNC_TRIGGER_ROLE_FOLLOWER) {
+        if (header->type == SYNC_MSG_BEACON && msg->len >= sizeof(sync_beacon_t)) {
+            handle_beacon((const sync_beacon_t *)msg->data, msg->rx_time);
+        } else if (header->type == SYNC_MSG_TRIGGER && msg->len >= sizeof(sync_trigger_msg_t)) {
+            handle_trigger((const sync_trigger_msg_t *)msg->data);
+        }
+    } else if (header->type == SYNC_MSG_REPORT && msg->len >= sizeof(sync_report_t)) {
+        handle_report((const sync_report_t *)msg->data);
+    }
+    xSemaphoreGive(s_lock);
+}
+
+static void sync_task(void *arg)
+{
+    TickType_t beacon_ticks = pdMS_TO_TICKS(s_config.beacon_ms);
+    TickType_t next_beacon = xTaskGetTickCount();
+    rx_msg_t msg;
+
+    while (s_running) {
+        TickType_t wait = portMAX_DELAY;
+        if (s_config.role == SYNC_TRIGGER_ROLE_LEADER) {
+            TickType_t now = xTaskGetTickCount();
+            if ((int32_t)(next_beacon - now) <= 0) {
+                xSemaphoreTake(s_lock, portMAX_DELAY);
+                send_beacon();
+                xSemaphoreGive(s_lock);
+                next_beacon += beacon_ticks;
+                continue;
+            }
+            wait = next_beacon - now;
+        } else {
+            wait = pdMS_TO_TICKS(100);  // to notice deinit
+        }
+
+        if (xQueueReceive(s_rx_queue, &msg, wait) == pdTRUE) {
+            handle_message(&msg);
+        }
+    }
+    s_task = NULL;
+    vTaskDelete(NULL);
+}
+
+static void on_receive(const uint8_t *data, size_t len, int64_t rx_time)
+{
+    if (!s_rx_queue || len > SYNC_PORT_MAX_PAYLOAD) {
+        return;
+    }
+    rx_msg_t msg;
+    msg.rx_time = rx_time;
+    msg.len = (uint8_t)len;
+    memcpy(msg.data, data, len);
+    xQueueSend(s_rx_queue, &msg, 0);
+}
+
+static void on_fire(int64_t fired_at)
+{
+    s_event.fired_at = fired_at;
+    xSemaphoreGive(s_fired);
+}
+
+esp_err_t sync_trigger_init(const sync_trigger_config_t *config)
+{
+    if (!config || config->beacon_ms == 0 ||
+        (config->role != SYNC_TRIGGER_ROLE_LEADER && config->role != SYNC_TRIGGER_ROLE_FOLLOWER)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_config = *config;
+    memset(&s_fit, 0, sizeof(s_fit));
+    memset(s_rx_slots, 0, sizeof(s_rx_slots));
+    memset(&s_event, 0, sizeof(s_event));
+    memset(&s_round, 0, sizeof(s_round));
+    memset(&s_stats, 0, sizeof(s_stats));
+    memset(&s_clock, 0, sizeof(s_clock));
+    s_pair_count = 0;
+    s_pair_next = 0;
+    s_last_beacon_seq = 0;
+    s_beacon_seq = 0;
+    s_beacon_tx = 0;
+    s_trigger_id = 0;
+    s_fire_skew_sum = 0;
+    s_frame_skew_sum = 0;
+    s_frame_rounds = 0;
+
+    s_lock = xSemaphoreCreateMutex();
+    s_fired = xSemaphoreCreateBinary();
+    s_rx_queue = xQueueCreate(RX_QUEUE_LEN, sizeof(rx_msg_t));
+    if (!s_lock || !s_fired || !s_rx_queue) {
+        sync_trigger_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = sync_port_init(config->channel, on_receive, on_fire);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Radio init failed: %s", esp_err_to_name(ret));
+        sync_trigger_deinit();
+        return ret;
+    }
+    s_node = sync_port_node_id();
+
+    s_running = true;
+    if (xTaskCreate(sync_task, "sync_trigger", SYNC_TASK_STACK, NULL, SYNC_TASK_PRIO, &s_task) != pdPASS) {
+        s_running = false;
+        sync_port_deinit();
+        sync_trigger_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Node %d is %s on channel %d, beacon every %lu ms", s_node,
+             config->role == SYNC_TRIGGER_ROLE_LEADER ? "leader" : "follower",
+             config->channel, (unsigned long)config->beacon_ms);
+    return ESP_OK;
+}
+
+esp_err_t sync_trigger_arm(uint32_t lead_ms, sync_trigger_event_t *event)
+{
+    if (!s_running || s_config.role != SYNC_TRIGGER_ROLE_LEADER) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if ((int64_t)lead_ms * 1000 < MIN_LEAD_US) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    close_round();
+    memset(&s_round, 0, sizeof(s_round));
+
+    sync_trigger_msg_t trigger;
+    fill_header(&trigger.header, SYNC_MSG_TRIGGER, ++s_trigger_id);
+    trigger.capture_at = sync_port_now() + (int64_t)lead_ms * 1000;
+    s_round.id = s_trigger_id;
+
+    int sent = 0;
+    for (int i = 0; i < TRIGGER_REPEATS; i++) {
+        int64_t tx_time;
+        sent += sync_port_broadcast(&trigger, sizeof(trigger), &tx_time) == ESP_OK;
+    }
+    arm_deadline(s_trigger_id, trigger.capture_at, trigger.capture_at);
+    if (event) {
+        *event = s_event;
+    }
+    xSemaphoreGive(s_lock);
+
+    if (!sent) {
+        ESP_LOGW(TAG, "Trigger %lu was not sent, capturing alone", (unsigned long)s_trigger_id);
+    }
+    return ESP_OK;
+}
+
+esp_err_t sync_trigger_wait(sync_trigger_event_t *event, uint32_t timeout_ms)
+{
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!event) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // A deadline that fired while nobody waited is over
+    if (s_config.role == SYNC_TRIGGER_ROLE_FOLLOWER) {
+        xSemaphoreTake(s_fired, 0);
+    }
+    if (xSemaphoreTake(s_fired, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_event.fire_error_us = (int32_t)(to_leader(s_event.fired_at) - s_event.capture_at);
+    *event = s_event;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t sync_trigger_report(const sync_trigger_event_t *event, int64_t frame_time)
+{
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!event) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    int32_t frame_offset = frame_time ? (int32_t)(to_leader(sync_port_from_timer(frame_time)) - event->capture_at) : 0;
+    if (s_config.role == SYNC_TRIGGER_ROLE_LEADER) {
+        if (event->id == s_round.id) {
+            fold_report(event->fire_error_us, frame_time != 0, frame_offset, 0.0f);
+        }
+        xSemaphoreGive(s_lock);
+        return ESP_OK;
+    }
+
+    sync_report_t report;
+    fill_header(&report.header, SYNC_MSG_REPORT, event->id);
+    report.fire_error_us = event->fire_error_us;
+    report.frame_offset_us = frame_offset;
+    report.residual_us = s_fit.residual > UINT16_MAX ? UINT16_MAX : (uint16_t)s_fit.residual;
+    report.flags = (s_fit.valid ? REPORT_SYNCED : 0) | (frame_time ? REPORT_FRAME : 0);
+    xSemaphoreGive(s_lock);
+
+    int64_t tx_time;
+    return sync_port_broadcast(&report, sizeof(report), &tx_time);
+}
+
+esp_err_t sync_trigger_leader_time(int64_t local_us, int64_t *leader_us)
+{
+    if (!leader_us) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool synced = s_config.role == SYNC_TRIGGER_ROLE_LEADER || s_fit.valid;
+    if (synced) {
+        *leader_us = to_leader(sync_port_from_timer(local_us));
+    }
+    xSemaphoreGive(s_lock);
+    return synced ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t sync_trigger_get_clock(sync_trigger_clock_t *clock)
+{
+    if (!clock) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *clock = s_clock;
+    if (s_config.role == SYNC_TRIGGER_ROLE_LEADER) {
+        clock->synced = true;
+    } else {
+        int64_t now = sync_port_now();
+        clock->synced = s_fit.valid;
+        clock->samples = s_fit.kept;
+        clock->residual_us = s_fit.residual;
+        clock->drift_ppm = (float)(s_fit.drift * 1e6);
+        clock->offset_us = s_fit.valid ? to_leader(now) - now : 0;
+    }
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+esp_err_t sync_trigger_get_stats(sync_trigger_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_running || s_config.role != SYNC_TRIGGER_ROLE_LEADER) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *stats = s_stats;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
+
+void sync_trigger_deinit(void)
+{
+    if (s_running) {
+        s_running = false;
+        // The task leaves within one receive timeout
+        while (s_task) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        sync_port_cancel();
+        sync_port_deinit();
+    }
+
+    if (s_rx_queue) {
+        vQueueDelete(s_rx_queue);
+        s_rx_queue = NULL;
+    }
+    if (s_fired) {
+        vSemaphoreDelete(s_fired);
+        s_fired = NULL;
+    }
+    if (s_lock) {
+        vSemaphoreDelete(s_lock);
+        s_lock = NULL;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "unity.h"
+#include "test_utils.h"
+#include "sync_trigger.h"
+#include "sync_port_sim.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Runs on the linux target over the simulated air. The single-process cases
+// check the API edges; the multi-device case runs a leader and two followers
+// with skewed, drifting clocks and measures each follower's deadline against
+// the leader's in host monotonic time.
+
+#define SYNC_TEST_PORT          47900
+#define SYNC_TEST_NODES         3
+#define SYNC_TEST_BEACON_MS     250
+#define SYNC_TEST_TRIGGERS      10
+#define SYNC_TEST_LEAD_MS       100
+#define SYNC_TEST_TRUE_SKEW_US  300     // follower deadline against the leader's, host time
+#define SYNC_TEST_FIRE_US       2000    // one-shot dispatch on a loaded host
+
+static void sim_node(uint8_t node_id, uint8_t node_count, int64_t offset_us, float drift_ppm)
+{
+    sync_port_sim_config_t sim = {
+        .node_id = node_id,
+        .node_count = node_count,
+        .base_port = SYNC_TEST_PORT,
+        .latency_us = 400,
+        .jitter_us = 150,
+        .loss = 0.05f,
+        .clock_offset_us = offset_us,
+        .clock_drift_ppm = drift_ppm,
+        .seed = 11,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, sync_port_sim_configure(&sim));
+}
+
+static void start(sync_trigger_role_t role)
+{
+    sync_trigger_config_t config = {
+        .role = role,
+        .channel = 1,
+        .beacon_ms = SYNC_TEST_BEACON_MS,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_init(&config));
+}
+
+TEST_CASE("leader fires its own trigger on time", "[sync_trigger]")
+{
+    sim_node(0, 2, 0, 0.0f);
+    start(SYNC_TRIGGER_ROLE_LEADER);
+
+    // Too short a lead cannot reach anyone before the deadline
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, sync_trigger_arm(1, NULL));
+
+    sync_trigger_event_t armed, fired;
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_arm(20, &armed));
+    TEST_ASSERT_EQUAL(armed.capture_at, armed.deadline);
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_wait(&fired, 1000));
+    TEST_ASSERT_EQUAL(armed.id, fired.id);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, fired.fire_error_us);
+    TEST_ASSERT_LESS_THAN(SYNC_TEST_FIRE_US, fired.fire_error_us);
+
+    // The leader clock is the timebase
+    int64_t now = esp_timer_get_time(), leader;
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_leader_time(now, &leader));
+    TEST_ASSERT_EQUAL(now, leader);
+
+    // Nothing armed, nothing fires
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, sync_trigger_wait(&fired, 50));
+    sync_trigger_deinit();
+}
+
+TEST_CASE("follower without a leader stays unsynced", "[sync_trigger]")
+{
+    sim_node(1, 2, 5000, 20.0f);
+    start(SYNC_TRIGGER_ROLE_FOLLOWER);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, sync_trigger_arm(100, NULL));
+    int64_t leader;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, sync_trigger_leader_time(esp_timer_get_time(), &leader));
+    sync_trigger_event_t event;
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, sync_trigger_wait(&event, 3 * SYNC_TEST_BEACON_MS));
+
+    sync_trigger_clock_t clock;
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_get_clock(&clock));
+    TEST_ASSERT_FALSE(clock.synced);
+    TEST_ASSERT_EQUAL(0, clock.beacons);
+    sync_trigger_deinit();
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, sync_trigger_get_clock(&clock));
+}
+
+static void leader_stage(void)
+{
+    sim_node(0, SYNC_TEST_NODES, 0, 0.0f);
+    start(SYNC_TRIGGER_ROLE_LEADER);
+
+    // With no offset or drift the leader clock is esp_timer, and the
+    // followers need its host origin to put T on the shared clock
+    char origin[24];
+    snprintf(origin, sizeof(origin), "%lld", (long long)sync_port_sim_to_host(0));
+    for (int node = 1; node < SYNC_TEST_NODES; node++) {
+        char name[32];
+        snprintf(name, sizeof(name), "leader origin %d", node);
+        unity_send_signal_param(name, origin);
+    }
+    for (int node = 1; node < SYNC_TEST_NODES; node++) {
+        char name[32];
+        snprintf(name, sizeof(name), "follower %d synced", node);
+        unity_wait_for_signal(name);
+    }
+
+    for (int i = 0; i < SYNC_TEST_TRIGGERS; i++) {
+        sync_trigger_event_t event;
+        TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_arm(SYNC_TEST_LEAD_MS, NULL));
+        TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_wait(&event, 1000));
+        TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_report(&event, 0));
+        vTaskDelay(pdMS_TO_TICKS(200));
+    }
+    // Arming closes the last round
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_arm(SYNC_TEST_LEAD_MS, NULL));
+
+    sync_trigger_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_get_stats(&stats));
+    TEST_ASSERT_GREATER_OR_EQUAL(SYNC_TEST_TRIGGERS - 2, stats.rounds);
+    TEST_ASSERT_EQUAL(SYNC_TEST_NODES, stats.last_nodes);
+    TEST_ASSERT_LESS_THAN(SYNC_TEST_FIRE_US, stats.fire_skew_max_us);
+    for (int node = 1; node < SYNC_TEST_NODES; node++) {
+        char name[32];
+        snprintf(name, sizeof(name), "follower %d done", node);
+        unity_wait_for_signal(name);
+    }
+    sync_trigger_deinit();
+}
+
+static void follower_stage(uint8_t node_id, int64_t offset_us, float drift_ppm)
+{
+    char name[32], origin[24];
+    snprintf(name, sizeof(name), "leader origin %d", node_id);
+    unity_wait_for_signal_param(name, origin, sizeof(origin));
+    int64_t leader_origin = strtoll(origin, NULL, 10);
+
+    sim_node(node_id, SYNC_TEST_NODES, offset_us, drift_ppm);
+    start(SYNC_TRIGGER_ROLE_FOLLOWER);
+
+    // A full fit window of beacons before the leader starts triggering
+    sync_trigger_clock_t clock;
+    vTaskDelay(pdMS_TO_TICKS(SYNC_TRIGGER_FIT_SAMPLES * SYNC_TEST_BEACON_MS));
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_get_clock(&clock));
+    TEST_ASSERT_TRUE(clock.synced);
+    snprintf(name, sizeof(name), "follower %d synced", node_id);
+    unity_send_signal(name);
+
+    int fired = 0;
+    int64_t worst = 0;
+    for (int i = 0; i < SYNC_TEST_TRIGGERS; i++) {
+        sync_trigger_event_t event;
+        if (sync_trigger_wait(&event, 2000) != ESP_OK) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_report(&event, 0));
+        fired++;
+        int64_t error = llabs(sync_port_sim_to_host(event.deadline) - (event.capture_at + leader_origin));
+        worst = error > worst ? error : worst;
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(SYNC_TEST_TRIGGERS - 1, fired);
+    TEST_ASSERT_LESS_THAN(SYNC_TEST_TRUE_SKEW_US, worst);
+
+    // The fit recovers the configured rate error, to within what the jitter
+    // allows over one window: the leader runs slow against a fast follower
+    TEST_ASSERT_EQUAL(ESP_OK, sync_trigger_get_clock(&clock));
+    TEST_ASSERT_FLOAT_WITHIN(10.0f, -drift_ppm, clock.drift_ppm);
+    TEST_ASSERT_LESS_OR_EQUAL(1, clock.triggers_missed);
+
+    snprintf(name, sizeof(name), "follower %d done", node_id);
+    unity_send_signal(name);
+    sync_trigger_deinit();
+}
+
+static void follower_ahead_stage(void)
+{
+    follower_stage(1, 3500000, 35.0f);
+}
+
+static void follower_behind_stage(void)
+{
+    follower_stage(2, -81234567, -22.0f);
+}
+
+TEST_CASE_MULTIPLE_DEVICES("followers fire with the leader", "[sync_trigger][multi]",
+                           leader_stage, follower_ahead_stage, follower_behind_stage);
\ No newline at end of file
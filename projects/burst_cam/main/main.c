@@ -1,15 +1,26 @@
 #include <stdio.h>
 #include <string.h>
+#include <sys/time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "camera_module.h"
 #include "sdcard_module.h"
 #include "time_sync.h"
 #include "manifest_manager.h"
 #include "audio_recorder.h"
+#include "audio_wav.h"
+#include "audio_activation.h"
+#include "audio_segments.h"
+#include "capture_pacer.h"
+#include "frame_dedup.h"
+#include "luma_meter.h"
+#include "burst_select.h"
+#include "sync_trigger.h"
+#include "sdkconfig.h"
 #include "wifi_config.h"
 
 static const char *TAG = "timelapse_camera";
@@ -21,6 +32,8 @@ static const char *TAG = "timelapse_camera";
 
 #define CAPTURE_INTERVAL_MS  10000
 #define CAPTURE_DURATION_MS  3000
+#define BURST_FPS           10
+#define BURST_FRAMES        (CAPTURE_DURATION_MS * BURST_FPS / 1000)
 #define MAX_FILES           100
 #define SYNC_TIME_HOURS     24
 
@@ -28,6 +41,226 @@ static const char *TAG = "timelapse_camera";
 #define AUDIO_PDM_DATA_GPIO 41
 #define AUDIO_SAMPLE_RATE   16000
 #define AUDIO_BUFFER_SIZE   1024
+#define AUDIO_BUFFER_COUNT  4
+#define AUDIO_RING_MS       4000
+#define AUDIO_TASK_CORE     0
+#define AUDIO_TASK_PRIO     10
+#define AUDIO_WAV_CHUNK     (4 * 1024)
+#define AUDIO_CHECKPOINT_MS 1000
+// Clip storage: IMA ADPCM takes 8.1 KB/s at 16 kHz against 32 KB/s of PCM
+// (AUDIO_WAV_PCM16) or 16 KB/s of mu-law (AUDIO_WAV_MULAW)
+#define AUDIO_FORMAT        AUDIO_WAV_IMA_ADPCM
+// Gain control on the way to the card: quiet rooms come up towards
+// -18 dBFS, loud ones down, and a look-ahead limiter keeps peaks under -1
+#define AUDIO_AGC           1
+// The recorder runs all the time. By default it writes back-to-back
+// segments, a new one at the start of every session and at least every
+// AUDIO_SEGMENT_MS, each in the manifest with its first sample. With
+// "Sound-activated" picked in menuconfig, a segment is stored only while
+// there is sound, with AUDIO_PREROLL_MS of what came before it and
+// AUDIO_HOLD_MS after it ends.
+#ifdef CONFIG_BURST_CAM_AUDIO_ACTIVATED
+#define AUDIO_ACTIVATED     1
+#else
+#define AUDIO_ACTIVATED     0
+#endif
+#define AUDIO_SEGMENT_MS    60000
+#define AUDIO_PREROLL_MS    1000
+#define AUDIO_HOLD_MS       2000
+#define AUDIO_SEGMENT_PRIO  4
+
+#define CAMERA_GRAB_CORE    1
+#define CAMERA_GRAB_PRIO    6
+#define CAMERA_QUEUE_DEPTH  2
+
+// A session whose frame repeats the last stored one (a dark, still scene)
+// becomes a manifest reference to that file instead of a new JPEG
+#define DEDUP_MAX_DISTANCE   5
+#define DEDUP_MAX_LUMA_DELTA 6
+#define DEDUP_KEYFRAME_EVERY 60
+#define DEDUP_STATS_SESSIONS 30
+
+// Every MANIFEST_SUMMARY_SESSIONS sessions the log sums up the manifest's
+// last hour, read through a time-range query a page at a time
+#define MANIFEST_SUMMARY_SESSIONS 30
+#define MANIFEST_SUMMARY_S        3600
+#define MANIFEST_SUMMARY_PAGE     16
+// The manifest goes to the card after a session at most this often; a
+// power cut loses at most this long of rows, never the files
+#define MANIFEST_SAVE_MS          60000
+
+// Every burst frame is scored for sharpness from its JPEG AC terms, with
+// frames far off the exposure target marked down, and the best BURST_KEEP
+// are held in PSRAM and stored once the burst ends
+#define BURST_KEEP           1
+#define BURST_SLOT_BYTES     (128 * 1024)
+#define BURST_EXPOSURE_WEIGHT 0.5f
+
+// The stored frame's brightness comes from its JPEG DC terms. A frame with
+// nothing above LUMA_BLACK_P95 (lens covered, sensor not ready) is never
+// stored. The best frame's mean, black or not, steers a manual exposure so
+// consecutive sessions do not flicker and a dark scene opens it up.
+#define LUMA_BLACK_P95       12
+#define DEFLICKER_TARGET     110
+#define DEFLICKER_RATE       0.25f
+#define DEFLICKER_DEADBAND   3
+#define DEFLICKER_MAX_EXPOSURE 1200
+
+// Several cameras on one ESP-NOW channel start their bursts together: the
+// leader names the instant, followers wait for it instead of free-running
+#if defined(CONFIG_SYNC_TRIGGER_ROLE_LEADER) || defined(CONFIG_SYNC_TRIGGER_ROLE_FOLLOWER)
+#define SYNC_CAPTURE         1
+#define SYNC_WAIT_MS         (CAPTURE_INTERVAL_MS * 3)
+#else
+#define SYNC_CAPTURE         0
+#endif
+
+static bool s_sync_ready = false;
+
+#if AUDIO_ACTIVATED
+// Segments are named for the wall time of their first sample
+static void audio_segment_path(char *path, size_t size, const audio_block_info_t *start, void *ctx)
+{
+    static uint32_t index = 0;
+    char date_path[64];
+    char name[48];
+    if (time_sync_is_time_set()) {
+        time_sync_get_date_path(date_path, sizeof(date_path));
+        time_t started = time(NULL) - (time_t)((esp_timer_get_time() - start->time_us) / 1000000);
+        struct tm timeinfo;
+        localtime_r(&started, &timeinfo);
+        strftime(name, sizeof(name), "sound_%H%M%S", &timeinfo);
+    } else {
+        snprintf(date_path, sizeof(date_path), "timelapse_data/no_time");
+        snprintf(name, sizeof(name), "sound_%04lu", (unsigned long)index);
+    }
+    sdcard_module_create_dir(date_path);
+    snprintf(path, size, "%s/%s_%04lu.wav", date_path, name, (unsigned long)index++);
+}
+#else
+// Segments started by a session are named for it, the rest for their index
+static void audio_clip_path(char *path, size_t size, const audio_segment_t *segment, void *ctx)
+{
+    char date_path[64];
+    char name[48] = "audio";
+    if (time_sync_is_time_set()) {
+        time_sync_get_date_path(date_path, sizeof(date_path));
+        time_t started = time(NULL) - (time_t)((esp_timer_get_time() - segment->start.time_us) / 1000000);
+        struct tm timeinfo;
+        localtime_r(&started, &timeinfo);
+        strftime(name, sizeof(name), "audio_%H%M%S", &timeinfo);
+    } else {
+        snprintf(date_path, sizeof(date_path), "timelapse_data/no_time");
+    }
+    sdcard_module_create_dir(date_path);
+    if (segment->cause == AUDIO_SEGMENT_MARK) {
+        snprintf(path, size, "%s/%s_%04lu.wav", date_path, name, (unsigned long)segment->clip);
+    } else {
+        snprintf(path, size, "%s/%s_s%04lu.wav", date_path, name, (unsigned long)segment->index);
+    }
+}
+
+// Rows go out with the next manifest save
+static void audio_clip_closed(const audio_segment_t *segment, void *ctx)
+{
+    if (!segment->ok) {
+        return;
+    }
+    // Wall time of the first sample, to the millisecond
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t start_us = (int64_t)now.tv_sec * 1000000 + now.tv_usec - (esp_timer_get_time() - segment->start.time_us);
+    manifest_audio_t audio = {
+        .start_sample = segment->start.first_sample,
+        .start_ms = (uint16_t)(start_us / 1000 % 1000)
+    };
+
+    // "timelapse_data/<dir>/<file>" in, "<dir>" and "<file>" out
+    const char *relative = strchr(segment->path, '/');
+    const char *slash = strrchr(segment->path, '/');
+    if (!relative || relative == slash) {
+        return;
+    }
+    char dir[64];
+    snprintf(dir, sizeof(dir), "%.*s", (int)(slash - relative - 1), relative + 1);
+    uint32_t duration_ms = (uint32_t)((uint64_t)segment->samples * 1000 / AUDIO_SAMPLE_RATE);
+    manifest_add_audio(dir, slash + 1, segment->file_bytes, (int)duration_ms, (time_t)(start_us / 1000000), &audio);
+}
+#endif
+
+#if SYNC_CAPTURE
+static int64_t fb_time_us(const camera_fb_t *fb)
+{
+    return (int64_t)fb->timestamp.tv_sec * 1000000 + fb->timestamp.tv_usec;
+}
+
+// Leader: schedules the shared capture instant. Both: sleeps until it.
+static bool wait_for_trigger(sync_trigger_event_t *event)
+{
+#ifdef CONFIG_SYNC_TRIGGER_ROLE_LEADER
+    if (sync_trigger_arm(CONFIG_SYNC_TRIGGER_LEAD_MS, NULL) != ESP_OK) {
+        return false;
+    }
+#endif
+    esp_err_t ret = sync_trigger_wait(event, SYNC_WAIT_MS);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "No trigger from the leader: %s", esp_err_to_name(ret));
+        return false;
+    }
+    return true;
+}
+
+static void log_sync_stats(void)
+{
+#ifdef CONFIG_SYNC_TRIGGER_ROLE_LEADER
+    sync_trigger_stats_t stats;
+    if (sync_trigger_get_stats(&stats) == ESP_OK && stats.rounds > 0) {
+        ESP_LOGI(TAG, "Sync: %lu rounds, %d nodes last, fire skew avg %.0f us (max %ld), first frame skew avg %.0f us (max %ld)",
+                 (unsigned long)stats.rounds, stats.last_nodes, stats.fire_skew_avg_us, (long)stats.fire_skew_max_us,
+                 stats.frame_skew_avg_us, (long)stats.frame_skew_max_us);
+    }
+#else
+    sync_trigger_clock_t clock;
+    if (sync_trigger_get_clock(&clock) == ESP_OK) {
+        ESP_LOGI(TAG, "Sync: clock %s, residual %.0f us over %d beacons, drift %.1f ppm, %lu of %lu triggers missed",
+                 clock.synced ? "locked" : "unlocked", clock.residual_us, clock.samples, clock.drift_ppm,
+                 (unsigned long)clock.triggers_missed, (unsigned long)clock.triggers);
+    }
+#endif
+}
+#endif
+
+static void log_manifest_summary(void)
+{
+    time_t now = time(NULL);
+    manifest_iter_t iter;
+    if (manifest_query_range(now - MANIFEST_SUMMARY_S, now + 1, &iter) != ESP_OK) {
+        return;
+    }
+    
+    manifest_record_t page[MANIFEST_SUMMARY_PAGE];
+    uint32_t frames = 0;
+    uint32_t references = 0;
+    uint32_t segments = 0;
+    uint64_t bytes = 0;
+    int count;
+    for (int offset = 0; (count = manifest_iter_get_page(&iter, offset, MANIFEST_SUMMARY_PAGE, page)) > 0;
+         offset += count) {
+        for (int i = 0; i < count; i++) {
+            if (page[i].flags & MANIFEST_FLAG_AUDIO) {
+                segments++;
+            } else if (page[i].flags & MANIFEST_FLAG_REFERENCE) {
+                references++;
+            } else {
+                frames++;
+            }
+            bytes += page[i].file_size;
+        }
+    }
+    ESP_LOGI(TAG, "Manifest, last hour: %lu frames stored, %lu referenced, %lu audio segments, %llu KB",
+             (unsigned long)frames, (unsigned long)references, (unsigned long)segments,
+             (unsigned long long)(bytes / 1024));
+}
 
 static void timelapse_capture_task(void *pvParameters)
 {
@@ -36,11 +269,17 @@ static void timelapse_capture_task(void *pvParameters)
     char date_path[64];
     char full_path[128];
     TickType_t last_sync_time = 0;
+    char kept_dir[64] = "";
+    char kept_name[64] = "";
+    uint32_t writes = 0;
+    uint64_t write_sum_us = 0;
+    uint32_t black_frames = 0;
     
     while (1) {
         TickType_t current_time = xTaskGetTickCount();
         
-        if ((current_time - last_sync_time) > pdMS_TO_TICKS(SYNC_TIME_HOURS * 60 * 60 * 1000)) {
+        // ESP-NOW holds the radio on the trigger channel; NTP would take it away
+        if (!s_sync_ready && (current_time - last_sync_time) > pdMS_TO_TICKS(SYNC_TIME_HOURS * 60 * 60 * 1000)) {
             ESP_LOGI(TAG, "Attempting time resync...");
             esp_err_t ret = time_sync_connect_wifi();
             if (ret == ESP_OK) {
@@ -73,67 +312,179 @@ static void timelapse_capture_task(void *pvParameters)
             ESP_LOGI(TAG, "Starting 3-second timelapse capture with audio (no time sync)...");
         }
         
-        char audio_filename[64];
-        char audio_full_path[128];
-        
-        if (time_sync_is_time_set()) {
-            char timestamp[32];
-            time_sync_format_timestamp(timestamp, sizeof(timestamp), "%H%M%S");
-            snprintf(audio_filename, sizeof(audio_filename), "audio_%s_%04d.wav", timestamp, video_index);
-        } else {
-            snprintf(audio_filename, sizeof(audio_filename), "audio_%04d.wav", video_index);
+        camera_stream_config_t stream_config = {
+            .core_id = CAMERA_GRAB_CORE,
+            .task_priority = CAMERA_GRAB_PRIO,
+            .queue_depth = CAMERA_QUEUE_DEPTH
+        };
+        if (camera_module_stream_start(&stream_config) != ESP_OK) {
+            ESP_LOGW(TAG, "Capture stream unavailable, grabbing frames inline");
         }
         
-        snprintf(audio_full_path, sizeof(audio_full_path), "%s/%s", date_path, audio_filename);
-        
-        esp_err_t audio_ret = audio_recorder_start_recording();
-        if (audio_ret != ESP_OK) {
-            ESP_LOGW(TAG, "Failed to start audio recording: %s", esp_err_to_name(audio_ret));
+#if SYNC_CAPTURE
+        bool sync_pending = false;
+        int64_t trigger_us = 0;
+        sync_trigger_event_t sync_event;
+        if (s_sync_ready) {
+            if (!wait_for_trigger(&sync_event)) {
+                camera_module_stream_stop();
+                continue;
+            }
+            trigger_us = esp_timer_get_time();
+            sync_pending = true;
         }
+#endif
         
-        TickType_t capture_start = xTaskGetTickCount();
         int frame_count = 0;
-        size_t total_audio_bytes = 0;
-        int16_t *audio_buffer = malloc(AUDIO_BUFFER_SIZE);
-        int16_t *audio_storage = malloc(AUDIO_SAMPLE_RATE * 2 * 4);
-        size_t audio_storage_size = 0;
+        int frames_stored = 0;
         
-        if (!audio_buffer || !audio_storage) {
-            ESP_LOGE(TAG, "Failed to allocate audio buffers");
+#if !AUDIO_ACTIVATED
+        // The session's audio segment starts on the sample taken now
+        if (audio_segments_mark(video_index, esp_timer_get_time()) != ESP_OK) {
+            ESP_LOGW(TAG, "Audio segment not marked for session %d", video_index);
         }
+#endif
         
-        while ((xTaskGetTickCount() - capture_start) < pdMS_TO_TICKS(CAPTURE_DURATION_MS)) {
+        // Every slot gets a frame; the first one's SD save runs long and the
+        // following slots catch up so the burst still ends on time
+        capture_pacer_config_t pacer_config = {
+            .frame_count = BURST_FRAMES,
+            .duration_ms = CAPTURE_DURATION_MS,
+            .policy = CAPTURE_PACER_CATCH_UP
+        };
+        if (capture_pacer_start(&pacer_config) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to start capture pacer");
+        }
+        
+        burst_select_begin();
+        capture_pacer_tick_t tick;
+        while (capture_pacer_next(&tick)) {
             camera_fb_t *fb = camera_module_capture();
             if (!fb) {
                 ESP_LOGE(TAG, "Camera capture failed");
-                vTaskDelay(pdMS_TO_TICKS(100));
                 continue;
             }
             
-            if (frame_count == 0) {
-                if (time_sync_is_time_set()) {
-                    char timestamp[32];
-                    time_sync_format_timestamp(timestamp, sizeof(timestamp), "%H%M%S");
-                    snprintf(filename, sizeof(filename), "clip_%s_%04d.jpg", timestamp, video_index);
-                } else {
-                    snprintf(filename, sizeof(filename), "clip_%04d_frame_%03d.jpg", video_index, frame_count);
-                }
-                
-                snprintf(full_path, sizeof(full_path), "%s/%s", date_path, filename);
-                
+#if SYNC_CAPTURE
+            // Frames queued before the trigger were exposed before the shared instant
+            while (fb && sync_pending && fb_time_us(fb) < trigger_us) {
+                camera_module_return_fb(fb);
+                fb = camera_module_capture();
+            }
+            if (!fb) {
+                continue;
+            }
+            if (sync_pending) {
+                sync_trigger_report(&sync_event, fb_time_us(fb));
+                ESP_LOGI(TAG, "Trigger %lu: deadline %+ld us, first frame %+lld us after it",
+                         (unsigned long)sync_event.id, (long)sync_event.fire_error_us,
+                         (long long)(fb_time_us(fb) - trigger_us));
+                sync_pending = false;
+            }
+#endif
+            
+            if (burst_select_offer(fb, NULL) != ESP_OK) {
+                ESP_LOGW(TAG, "Frame %d could not be scored", frame_count);
+            }
+            
+            camera_module_return_fb(fb);
+            frame_count++;
+        }
+        
+        capture_pacer_log_stats();
+        camera_module_stream_stop();
+#if SYNC_CAPTURE
+        if (s_sync_ready) {
+            log_sync_stats();
+        }
+#endif
+        
+        // Best first; the best frame steers the exposure. A black one counts
+        // too: skipping it would leave a session that starts dark, or goes
+        // dark, stuck at an exposure too short to ever see anything.
+        bool observed = false;
+        for (int rank = 0; rank < burst_select_count(); rank++) {
+            burst_select_frame_t held;
+            if (burst_select_get(rank, &held) != ESP_OK) {
+                break;
+            }
+            camera_fb_t *fb = &held.fb;
+            luma_stats_t luma = {0};
+            bool have_luma = luma_meter_measure(fb, &luma) == ESP_OK;
+            if (have_luma && !observed) {
+                luma_deflicker_observe(&luma);
+                observed = true;
+            }
+            if (have_luma && luma_meter_is_black(&luma, LUMA_BLACK_P95)) {
+                black_frames++;
+                ESP_LOGW(TAG, "Frame %d is black (p95 %d, scan %lu us), not stored",
+                         held.index, luma.p95, (unsigned long)luma.scan_us);
+                continue;
+            }
+            ESP_LOGI(TAG, "Frame %d of %d ranked %d: sharpness %.3f, exposure %.2f, mean %d",
+                     held.index, frame_count, rank + 1, held.score.sharpness, held.score.exposure,
+                     held.score.mean);
+            
+            // Frames after the best one carry their rank
+            char rank_suffix[8] = "";
+            if (frames_stored > 0) {
+                snprintf(rank_suffix, sizeof(rank_suffix), "_r%d", frames_stored + 1);
+            }
+            if (time_sync_is_time_set()) {
+                char timestamp[32];
+                time_sync_format_timestamp(timestamp, sizeof(timestamp), "%H%M%S");
+                snprintf(filename, sizeof(filename), "clip_%s_%04d%s.jpg", timestamp, video_index, rank_suffix);
+            } else {
+                snprintf(filename, sizeof(filename), "clip_%04d_frame_%03d.jpg", video_index, held.index);
+            }
+            
+            snprintf(full_path, sizeof(full_path), "%s/%s", date_path, filename);
+            
+            char relative_path[64];
+            if (time_sync_is_time_set()) {
+                time_sync_format_timestamp(relative_path, sizeof(relative_path), "%Y/%m/%d");
+            } else {
+                snprintf(relative_path, sizeof(relative_path), "no_time");
+            }
+            
+            // The luma meter already scanned this JPEG; hash its DC map
+            // rather than scanning it again
+            frame_dedup_result_t dedup = {0};
+            const uint8_t *map;
+            uint16_t map_w, map_h;
+            if (have_luma && luma_meter_get_map(&map, &map_w, &map_h) == ESP_OK) {
+                ret = frame_dedup_check_map(map, map_w, map_h, fb->len, &dedup);
+            } else {
+                ret = frame_dedup_check(fb, &dedup);
+            }
+            if (ret != ESP_OK) {
+                frame_dedup_reset();
+            }
+            
+            if (dedup.duplicate) {
+                ESP_LOGI(TAG, "Frame repeats %s/%s (distance %d, hash %lu us), not written",
+                         kept_dir, kept_name, dedup.distance, (unsigned long)dedup.hash_us);
+                manifest_add_reference(kept_dir, kept_name, CAPTURE_DURATION_MS);
+                frames_stored++;
+            } else {
+                int64_t write_start = esp_timer_get_time();
                 ret = sdcard_module_save_jpeg(fb->buf, fb->len, full_path);
                 if (ret == ESP_OK) {
+                    write_sum_us += esp_timer_get_time() - write_start;
+                    writes++;
+                    snprintf(kept_dir, sizeof(kept_dir), "%s", relative_path);
+                    snprintf(kept_name, sizeof(kept_name), "%s", filename);
                     ESP_LOGI(TAG, "Saved frame: %s (size: %zu bytes)", full_path, fb->len);
+                    frames_stored++;
                     
-                    char relative_path[64];
-                    if (time_sync_is_time_set()) {
-                        time_sync_format_timestamp(relative_path, sizeof(relative_path), "%Y/%m/%d");
-                    } else {
-                        snprintf(relative_path, sizeof(relative_path), "no_time");
-                    }
-                    
-                    manifest_add_video(relative_path, filename, fb->len, CAPTURE_DURATION_MS);
-                    manifest_save_to_sd();
+                    manifest_luma_t record_luma = {
+                        .mean = luma.mean,
+                        .p5 = luma.p5,
+                        .p50 = luma.p50,
+                        .p95 = luma.p95
+                    };
+                    manifest_add_video_luma(relative_path, filename, fb->len, CAPTURE_DURATION_MS,
+                                            have_luma ? &record_luma : NULL);
                     
                     uint64_t free_bytes, total_bytes;
                     if (sdcard_module_get_free_space(&free_bytes, &total_bytes) == ESP_OK) {
@@ -142,56 +493,85 @@ static void timelapse_capture_task(void *pvParameters)
                     }
                 } else {
                     ESP_LOGE(TAG, "Failed to save frame to SD card");
+                    frame_dedup_reset();
                 }
             }
             
-            camera_module_return_fb(fb);
-            frame_count++;
-            
-            if (audio_buffer && audio_storage && audio_ret == ESP_OK) {
-                size_t bytes_read = 0;
-                esp_err_t read_ret = audio_recorder_read_samples(audio_buffer, AUDIO_BUFFER_SIZE, &bytes_read);
-                if (read_ret == ESP_OK && bytes_read > 0) {
-                    if (audio_storage_size + bytes_read < AUDIO_SAMPLE_RATE * 2 * 4) {
-                        memcpy((uint8_t*)audio_storage + audio_storage_size, audio_buffer, bytes_read);
-                        audio_storage_size += bytes_read;
-                        total_audio_bytes += bytes_read;
-                    }
+            frame_dedup_stats_t dedup_stats;
+            if (dedup.hash_us && frame_dedup_get_stats(&dedup_stats) == ESP_OK &&
+                dedup_stats.frames % DEDUP_STATS_SESSIONS == 0) {
+                ESP_LOGI(TAG, "Dedup: %lu of %lu frames referenced, %llu KB saved, hash avg %lu us (max %lu), write avg %llu us",
+                         (unsigned long)dedup_stats.duplicates, (unsigned long)dedup_stats.frames,
+                         dedup_stats.bytes_saved / 1024, (unsigned long)dedup_stats.hash_avg_us,
+                         (unsigned long)dedup_stats.hash_max_us, writes ? write_sum_us / writes : 0);
+                
+                luma_deflicker_stats_t deflicker;
+                if (luma_deflicker_get_stats(&deflicker) == ESP_OK) {
+                    ESP_LOGI(TAG, "Luma: last %d (p5 %d, p95 %d, scan %lu us), flicker rms %.1f, exposure %u, %lu black frames skipped",
+                             luma.mean, luma.p5, luma.p95, (unsigned long)luma.scan_us, deflicker.flicker_rms,
+                             deflicker.exposure, (unsigned long)black_frames);
+                }
+                
+                burst_select_stats_t select_stats;
+                if (burst_select_get_stats(&select_stats) == ESP_OK) {
+                    ESP_LOGI(TAG, "Select: %lu frames scored, avg %lu us (max %lu), copy avg %lu us, first frame ranked %.1f on average",
+                             (unsigned long)select_stats.frames, (unsigned long)select_stats.score_avg_us,
+                             (unsigned long)select_stats.score_max_us, (unsigned long)select_stats.copy_avg_us,
+                             select_stats.first_rank_avg);
                 }
             }
-            
-            vTaskDelay(pdMS_TO_TICKS(100));
         }
         
-        audio_recorder_stop_recording();
+        if (frames_stored == 0) {
+            ESP_LOGW(TAG, "Every frame of the session was black, nothing stored");
+        }
+        manifest_save_if_due(MANIFEST_SAVE_MS);
         
-        if (audio_storage && audio_storage_size > 0) {
-            wav_header_t wav_header;
-            audio_recorder_create_wav_header(&wav_header, AUDIO_SAMPLE_RATE, 1, audio_storage_size);
-            
-            esp_err_t wav_ret = sdcard_module_write_file(audio_full_path, &wav_header, sizeof(wav_header));
-            if (wav_ret == ESP_OK) {
-                wav_ret = sdcard_module_append_file(audio_full_path, audio_storage, audio_storage_size);
-                if (wav_ret == ESP_OK) {
-                    ESP_LOGI(TAG, "Saved audio file: %s (%zu bytes)", audio_full_path, audio_storage_size);
-                } else {
-                    ESP_LOGE(TAG, "Failed to append audio data");
-                }
-            } else {
-                ESP_LOGE(TAG, "Failed to save audio file header");
-            }
+        audio_recorder_stats_t audio_stats;
+#if !AUDIO_ACTIVATED
+        audio_segments_stats_t segment_stats;
+        if (audio_segments_get_stats(&segment_stats) == ESP_OK && audio_recorder_get_stats(&audio_stats) == ESP_OK) {
+            ESP_LOGI(TAG, "Audio: %llu samples captured, %llu in %lu segments (%lu failed), %llu samples lost, %lu late marks, block wait max %lu us",
+                     (unsigned long long)audio_stats.samples, (unsigned long long)segment_stats.samples,
+                     (unsigned long)segment_stats.segments, (unsigned long)segment_stats.failed,
+                     (unsigned long long)segment_stats.samples_lost, (unsigned long)segment_stats.late_marks,
+                     (unsigned long)audio_stats.read_max_us);
         }
+#endif
         
-        if (audio_buffer) {
-            free(audio_buffer);
+#if AUDIO_ACTIVATED
+        audio_activation_stats_t activation_stats;
+        if (audio_activation_get_stats(&activation_stats) == ESP_OK && activation_stats.samples > 0 &&
+            audio_recorder_get_stats(&audio_stats) == ESP_OK) {
+            ESP_LOGI(TAG, "Sound-activated audio: %lu segments, sound %llu%% of the time, stored %lu.%lu%%, %llu KB written, %llu KB saved, detector %llu us per block",
+                     (unsigned long)activation_stats.segments,
+                     (unsigned long long)(activation_stats.active_samples * 100 / activation_stats.samples),
+                     (unsigned long)(activation_stats.duty_permille / 10), (unsigned long)(activation_stats.duty_permille % 10),
+                     (unsigned long long)(activation_stats.stored_bytes / 1024),
+                     (unsigned long long)(activation_stats.saved_bytes / 1024),
+                     (unsigned long long)(audio_stats.blocks ? audio_stats.vad_us / audio_stats.blocks : 0));
         }
-        if (audio_storage) {
-            free(audio_storage);
+#endif
+        
+        camera_stream_stats_t stream_stats;
+        if (camera_module_get_stream_stats(&stream_stats) == ESP_OK && stream_stats.frames_captured > 0) {
+            ESP_LOGI(TAG, "Stream: %.1f fps, %lu dropped, latency avg %lu us max %lu us",
+                     stream_stats.fps, (unsigned long)stream_stats.frames_dropped,
+                     (unsigned long)stream_stats.latency_avg_us, (unsigned long)stream_stats.latency_max_us);
         }
         
         video_index++;
-        ESP_LOGI(TAG, "Completed 3-second capture session with %d frames and %zu audio bytes", frame_count, total_audio_bytes);
+        ESP_LOGI(TAG, "Completed 3-second capture session with %d frames", frame_count);
+        if (video_index % MANIFEST_SUMMARY_SESSIONS == 0) {
+            log_manifest_summary();
+        }
         
+#ifdef CONFIG_SYNC_TRIGGER_ROLE_FOLLOWER
+        // The leader's triggers pace the followers
+        if (s_sync_ready) {
+            continue;
+        }
+#endif
         vTaskDelay(pdMS_TO_TICKS(CAPTURE_INTERVAL_MS - CAPTURE_DURATION_MS));
     }
 }
@@ -241,7 +621,8 @@ void app_main(void)
         .frame_size = FRAMESIZE_VGA,
         .pixel_format = PIXFORMAT_JPEG,
         .jpeg_quality = 12,
-        .fb_count = 2
+        .fb_count = 3,
+        .grab_latest = true
     };
     
     ESP_LOGI(TAG, "Initializing camera...");
@@ -274,25 +655,136 @@ void app_main(void)
     ESP_LOGI(TAG, "Creating timelapse_data directory...");
     sdcard_module_create_dir("timelapse_data");
     
+    // Before audio: closed segments go straight into the manifest
+    ESP_LOGI(TAG, "Initializing manifest manager...");
+    ret = manifest_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Manifest init failed");
+    }
+    
     ESP_LOGI(TAG, "Initializing audio recorder...");
     audio_config_t audio_config = {
         .pdm_clk_gpio = AUDIO_PDM_CLK_GPIO,
         .pdm_data_gpio = AUDIO_PDM_DATA_GPIO,
         .sample_rate = AUDIO_SAMPLE_RATE,
-        .buffer_count = 4,
-        .buffer_len = AUDIO_BUFFER_SIZE
+        .buffer_count = AUDIO_BUFFER_COUNT,
+        .buffer_len = AUDIO_BUFFER_SIZE,
+        .ring_ms = AUDIO_RING_MS,
+        .task_core = AUDIO_TASK_CORE,
+        .task_priority = AUDIO_TASK_PRIO,
+        .vad = {
+            .enabled = AUDIO_ACTIVATED
+        }
     };
     
     ret = audio_recorder_init(&audio_config);
     if (ret != ESP_OK) {
         ESP_LOGW(TAG, "Audio recorder init failed: %s", esp_err_to_name(ret));
     }
+#if AUDIO_ACTIVATED
+    if (ret == ESP_OK) {
+        audio_activation_config_t activation_config = {
+            .preroll_ms = AUDIO_PREROLL_MS,
+            .hold_ms = AUDIO_HOLD_MS,
+            .wav = {
+                .sample_rate = AUDIO_SAMPLE_RATE,
+                .channels = 1,
+                .chunk_bytes = AUDIO_WAV_CHUNK,
+                .checkpoint_ms = AUDIO_CHECKPOINT_MS,
+                .format = AUDIO_FORMAT,
+                .agc = { .enabled = AUDIO_AGC }
+            },
+            .make_path = audio_segment_path,
+            .task_core = AUDIO_TASK_CORE,
+            .task_priority = AUDIO_SEGMENT_PRIO
+        };
+        ret = audio_recorder_start_recording();
+        if (ret == ESP_OK) {
+            ret = audio_activation_start(&activation_config);
+        }
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Sound-activated audio unavailable: %s", esp_err_to_name(ret));
+        }
+    }
+#else
+    if (ret == ESP_OK) {
+        // The channel stays up from here on, so sessions have no startup transient
+        audio_segments_config_t segments_config = {
+            .segment_ms = AUDIO_SEGMENT_MS,
+            .wav = {
+                .sample_rate = AUDIO_SAMPLE_RATE,
+                .channels = 1,
+                .chunk_bytes = AUDIO_WAV_CHUNK,
+                .checkpoint_ms = AUDIO_CHECKPOINT_MS,
+                .format = AUDIO_FORMAT,
+                .agc = { .enabled = AUDIO_AGC }
+            },
+            .make_path = audio_clip_path,
+            .on_closed = audio_clip_closed,
+            .task_core = AUDIO_TASK_CORE,
+            .task_priority = AUDIO_SEGMENT_PRIO
+        };
+        ret = audio_recorder_start_recording();
+        if (ret == ESP_OK) {
+            ret = audio_segments_start(&segments_config);
+        }
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Segmented audio unavailable: %s", esp_err_to_name(ret));
+        }
+    }
+#endif
     
-    ESP_LOGI(TAG, "Initializing manifest manager...");
-    ret = manifest_init();
+    frame_dedup_config_t dedup_config = {
+        .max_distance = DEDUP_MAX_DISTANCE,
+        .max_luma_delta = DEDUP_MAX_LUMA_DELTA,
+        .keyframe_interval = DEDUP_KEYFRAME_EVERY
+    };
+    ret = frame_dedup_init(&dedup_config);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Manifest init failed");
+        ESP_LOGE(TAG, "Frame dedup init failed");
+    }
+    
+    luma_deflicker_config_t deflicker_config = {
+        .target_mean = DEFLICKER_TARGET,
+        .rate = DEFLICKER_RATE,
+        .deadband = DEFLICKER_DEADBAND,
+        .min_exposure = 1,
+        .max_exposure = DEFLICKER_MAX_EXPOSURE,
+        .initial_exposure = DEFLICKER_MAX_EXPOSURE / 4
+    };
+    ret = luma_deflicker_start(&deflicker_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Deflicker unavailable, exposure stays automatic");
+    }
+    
+    burst_select_config_t select_config = {
+        .keep = BURST_KEEP,
+        .pool_bytes = BURST_KEEP * BURST_SLOT_BYTES,
+        .target_mean = DEFLICKER_TARGET,
+        .exposure_weight = BURST_EXPOSURE_WEIGHT
+    };
+    ret = burst_select_init(&select_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Burst select init failed, no frames will be stored");
+    }
+    
+#if SYNC_CAPTURE
+    sync_trigger_config_t sync_config = {
+#ifdef CONFIG_SYNC_TRIGGER_ROLE_LEADER
+        .role = SYNC_TRIGGER_ROLE_LEADER,
+#else
+        .role = SYNC_TRIGGER_ROLE_FOLLOWER,
+#endif
+        .channel = CONFIG_SYNC_TRIGGER_CHANNEL,
+        .beacon_ms = CONFIG_SYNC_TRIGGER_BEACON_MS
+    };
+    ret = sync_trigger_init(&sync_config);
+    if (ret == ESP_OK) {
+        s_sync_ready = true;
+    } else {
+        ESP_LOGW(TAG, "Sync trigger unavailable (%s), capturing on this camera's own schedule", esp_err_to_name(ret));
     }
+#endif
     
     ESP_LOGI(TAG, "Starting timelapse capture task...");
     xTaskCreate(timelapse_capture_task, "timelapse_task", 8192, NULL, 5, NULL);
@@ -0,0 +1,241 @@
+#include "audio_agc.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+#include <string.h>
+
+#define ONE             (1 << 16)           // log2 units and gains are Q16
+#define FRAME_LOG2      6                   // AUDIO_AGC_FRAME is 1 << FRAME_LOG2
+#define FULL_SCALE_LOG2 (15 * ONE)
+#define SILENT          (-32 * ONE)
+#define LOG2_STEP       (ONE >> 8)
+#define DB_PER_LOG2     6.0206f
+
+// log2(1 + i / 256) and 2^(i / 256), Q16; filled on the first init
+static uint16_t s_log2_frac[256];
+static uint32_t s_exp2_frac[256];
+static bool s_tables = false;
+
+static void make_tables(void)
+{
+    for (int i = 0; i < 256; i++) {
+        s_log2_frac[i] = (uint16_t)lrintf(log2f(1.0f + i / 256.0f) * ONE);
+        s_exp2_frac[i] = (uint32_t)lrintf(exp2f(i / 256.0f) * ONE);
+    }
+    s_tables = true;
+}
+
+// Truncates the mantissa, so it errs low by under 0.03 dB
+static int32_t log2_q16(uint64_t v)
+{
+    int msb = 63 - __builtin_clzll(v);
+    uint32_t index = msb >= 8 ? (uint32_t)(v >> (msb - 8)) & 0xFF : (uint32_t)(v << (8 - msb)) & 0xFF;
+    return msb * ONE + s_log2_frac[index];
+}
+
+// Linear Q16 of a gain, truncated so it errs low
+static uint32_t exp2_q16(int32_t log2)
+{
+    int32_t whole = log2 >> 16;
+    uint32_t frac = s_exp2_frac[(log2 & 0xFFFF) >> 8];
+    return whole >= 0 ? frac << whole : frac >> -whole;
+}
+
+static int32_t from_db(int db)
+{
+    return (int32_t)lrintf(db * ONE / DB_PER_LOG2);
+}
+
+float audio_agc_db(int32_t log2_q16)
+{
+    return log2_q16 * DB_PER_LOG2 / ONE;
+}
+
+// Share of the gap a one-pole with time constant ms closes in a frame, Q16
+static int32_t frame_coefficient(uint32_t ms, uint32_t sample_rate)
+{
+    float frames = (float)ms * sample_rate / 1000.0f / AUDIO_AGC_FRAME;
+    return (int32_t)lrintf((1.0f - expf(-1.0f / frames)) * ONE);
+}
+
+esp_err_t audio_agc_init(audio_agc_t *agc, const audio_agc_config_t *config, uint32_t sample_rate)
+{
+    if (!agc || !config || sample_rate == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_tables) {
+        make_tables();
+    }
+
+    memset(agc, 0, sizeof(*agc));
+    int target = config->target_dbfs ? config->target_dbfs : AUDIO_AGC_TARGET_DBFS_DEFAULT;
+    int max_gain = config->max_gain_db ? config->max_gain_db : AUDIO_AGC_MAX_GAIN_DB_DEFAULT;
+    int ceiling = config->ceiling_dbfs ? config->ceiling_dbfs : AUDIO_AGC_CEILING_DBFS_DEFAULT;
+    int gate = config->gate_dbfs ? config->gate_dbfs : AUDIO_AGC_GATE_DBFS_DEFAULT;
+    uint32_t attack_ms = config->attack_ms ? config->attack_ms : AUDIO_AGC_ATTACK_MS_DEFAULT;
+    uint32_t release_ms = config->release_ms ? config->release_ms : AUDIO_AGC_RELEASE_MS_DEFAULT;
+    uint32_t lookahead_ms = config->lookahead_ms ? config->lookahead_ms : AUDIO_AGC_LOOKAHEAD_MS_DEFAULT;
+    if (target > 0 || ceiling > 0 || max_gain > AUDIO_AGC_MAX_GAIN_DB_LIMIT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    agc->target = from_db(target);
+    agc->max_gain = from_db(max_gain);
+    agc->ceiling = from_db(ceiling);
+    agc->gate = from_db(gate);
+    agc->attack = frame_coefficient(attack_ms, sample_rate);
+    agc->release = frame_coefficient(release_ms, sample_rate);
+    agc->limit_rise = (int32_t)((int64_t)ONE * AUDIO_AGC_FRAME * 1000 / ((int64_t)AUDIO_AGC_LIMIT_RELEASE_MS * sample_rate));
+
+    // A frame ahead at least: the ramp down to a peak takes a frame
+    uint32_t lookahead = (uint32_t)((uint64_t)lookahead_ms * sample_rate / 1000);
+    agc->lookahead_frames = (lookahead + AUDIO_AGC_FRAME - 1) / AUDIO_AGC_FRAME;
+    if (agc->lookahead_frames == 0) {
+        agc->lookahead_frames = 1;
+    }
+    // Frames held, and the one being gathered
+    agc->slots = agc->lookahead_frames + 2;
+    agc->delay = heap_caps_malloc(agc->slots * AUDIO_AGC_FRAME * sizeof(int16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    agc->allow = heap_caps_malloc(agc->slots * sizeof(int32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!agc->delay || !agc->allow) {
+        audio_agc_deinit(agc);
+        return ESP_ERR_NO_MEM;
+    }
+    agc->gain_q16 = ONE;
+    agc->gain_min = INT32_MAX;
+    agc->gain_max = INT32_MIN;
+    return ESP_OK;
+}
+
+void audio_agc_deinit(audio_agc_t *agc)
+{
+    if (!agc) {
+        return;
+    }
+    heap_caps_free(agc->delay);
+    heap_caps_free(agc->allow);
+    agc->delay = NULL;
+    agc->allow = NULL;
+}
+
+// Measures the frame just gathered and moves the AGC gain for it
+static void push_frame(audio_agc_t *agc)
+{
+    uint32_t slot = (agc->oldest + agc->held) % agc->slots;
+    const int16_t *x = agc->delay + slot * AUDIO_AGC_FRAME;
+    uint64_t energy = 0;
+    uint32_t peak = 0;
+    for (int i = 0; i < AUDIO_AGC_FRAME; i++) {
+        int32_t s = x[i];
+        uint32_t magnitude = s < 0 ? -s : s;
+        energy += magnitude * magnitude;
+        if (magnitude > peak) {
+            peak = magnitude;
+        }
+    }
+
+    // One table step under, for the peak's truncated log
+    agc->allow[slot] = peak ? agc->ceiling - (log2_q16(peak) - FULL_SCALE_LOG2) - LOG2_STEP : INT32_MAX;
+    int32_t level = energy ? (log2_q16(energy) - FRAME_LOG2 * ONE) / 2 - FULL_SCALE_LOG2 : SILENT;
+    if (level >= agc->gate) {
+        int32_t want = agc->target - level;
+        if (want > agc->max_gain) {
+            want = agc->max_gain;
+        } else if (want < -agc->max_gain) {
+            want = -agc->max_gain;
+        }
+        int32_t rate = want < agc->agc ? agc->attack : agc->release;
+        agc->agc += (int32_t)(((int64_t)(want - agc->agc) * rate) >> 16);
+    }
+    agc->held++;
+    agc->frames++;
+}
+
+// Sends the oldest frame out. Its gain ends at the least any frame held
+// allows, so the ramp down to a peak is done by the time it leaves; the
+// gain at either end of a frame is within what the frame allows, and so
+// is every step of the straight ramp between them.
+static void emit_frame(audio_agc_t *agc, int16_t *out)
+{
+    int32_t allow = INT32_MAX;
+    for (uint32_t i = 0; i < agc->held; i++) {
+        int32_t a = agc->allow[(agc->oldest + i) % agc->slots];
+        if (a < allow) {
+            allow = a;
+        }
+    }
+    int32_t gain = agc->agc < allow ? agc->agc : allow;
+    if (allow < agc->agc) {
+        agc->limited++;
+    }
+    if (agc->frames > agc->held && gain > agc->gain + agc->limit_rise) {
+        gain = agc->gain + agc->limit_rise;
+    }
+
+    uint32_t end = exp2_q16(gain);
+    // The first frame out starts where it ends
+    int32_t start = agc->frames > agc->held ? (int32_t)agc->gain_q16 : (int32_t)end;
+    int32_t diff = (int32_t)end - start;
+    const int16_t *x = agc->delay + agc->oldest * AUDIO_AGC_FRAME;
+    for (int i = 0; i < AUDIO_AGC_FRAME; i++) {
+        int32_t g = start + ((diff * (i + 1)) >> FRAME_LOG2);
+        int32_t y = (int32_t)(((int64_t)x[i] * g + (ONE >> 1)) >> 16);
+        out[i] = y > INT16_MAX ? INT16_MAX : y < INT16_MIN ? INT16_MIN : (int16_t)y;
+    }
+
+    agc->gain = gain;
+    agc->gain_q16 = end;
+    if (gain < agc->gain_min) {
+        agc->gain_min = gain;
+    }
+    if (gain > agc->gain_max) {
+        agc->gain_max = gain;
+    }
+    agc->oldest = (agc->oldest + 1) % agc->slots;
+    agc->held--;
+}
+
+size_t audio_agc_process(audio_agc_t *agc, const int16_t *in, size_t count, int16_t *out)
+{
+    size_t produced = 0;
+    while (count > 0) {
+        uint32_t slot = (agc->oldest + agc->held) % agc->slots;
+        size_t take = AUDIO_AGC_FRAME - agc->fill;
+        if (take > count) {
+            take = count;
+        }
+        memcpy(agc->delay + slot * AUDIO_AGC_FRAME + agc->fill, in, take * sizeof(int16_t));
+        agc->fill += take;
+        in += take;
+        count -= take;
+        if (agc->fill == AUDIO_AGC_FRAME) {
+            agc->fill = 0;
+            push_frame(agc);
+            if (agc->held > agc->lookahead_frames) {
+                emit_frame(agc, out + produced);
+                produced += AUDIO_AGC_FRAME;
+            }
+        }
+    }
+    return produced;
+}
+
+size_t audio_agc_drain(audio_agc_t *agc, int16_t *out)
+{
+    if (agc->fill > 0) {
+        // Silence makes up the last frame; only its audio comes out
+        uint32_t slot = (agc->oldest + agc->held) % agc->slots;
+        memset(agc->delay + slot * AUDIO_AGC_FRAME + agc->fill, 0, (AUDIO_AGC_FRAME - agc->fill) * sizeof(int16_t));
+        agc->last_real = agc->fill;
+        agc->fill = 0;
+        push_frame(agc);
+    }
+    if (agc->held == 0) {
+        return 0;
+    }
+    size_t count = agc->held == 1 && agc->last_real ? agc->last_real : AUDIO_AGC_FRAME;
+    emit_frame(agc, out);
+    if (agc->held == 0) {
+        agc->last_real = 0;
+    }
+    return count;
+}
\ No newline at end of file
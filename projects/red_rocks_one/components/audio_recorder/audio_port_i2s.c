@@ -0,0 +1,115 @@
+#include "audio_port.h"
+#include "driver/i2s_pdm.h"
+#include "driver/i2s_std.h"
+#include "esp_log.h"
+#include "esp_attr.h"
+#include "freertos/FreeRTOS.h"
+#include <stdatomic.h>
+
+static const char *TAG = "audio_port";
+
+static i2s_chan_handle_t s_rx_handle = NULL;
+static atomic_uint s_overflows;
+
+static bool IRAM_ATTR on_recv_q_ovf(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    atomic_fetch_add_explicit(&s_overflows, 1, memory_order_relaxed);
+    return false;
+}
+
+esp_err_t audio_port_init(const audio_config_t *config)
+{
+    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
+    chan_cfg.auto_clear = true;
+    chan_cfg.dma_desc_num = config->buffer_count;
+    chan_cfg.dma_frame_num = config->buffer_len / sizeof(int16_t);
+
+    esp_err_t ret = i2s_new_channel(&chan_cfg, NULL, &s_rx_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create I2S channel: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (config->mode == AUDIO_MIC_STD) {
+        i2s_data_bit_width_t width = config->std_slot_bits == 16 ? I2S_DATA_BIT_WIDTH_16BIT : I2S_DATA_BIT_WIDTH_32BIT;
+        i2s_std_config_t std_rx_cfg = {
+            .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(config->sample_rate),
+            .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(width, I2S_SLOT_MODE_MONO),
+            .gpio_cfg = {
+                .mclk = I2S_GPIO_UNUSED,
+                .bclk = config->std_bclk_gpio,
+                .ws = config->std_ws_gpio,
+                .dout = I2S_GPIO_UNUSED,
+                .din = config->std_din_gpio,
+                .invert_flags = {
+                    .mclk_inv = false,
+                    .bclk_inv = false,
+                    .ws_inv = false,
+                },
+            },
+        };
+        // L/R tied low: the microphone talks in the left slot
+        std_rx_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;
+        ret = i2s_channel_init_std_mode(s_rx_handle, &std_rx_cfg);
+    } else {
+        i2s_pdm_rx_config_t pdm_rx_cfg = {
+            .clk_cfg = I2S_PDM_RX_CLK_DEFAULT_CONFIG(config->sample_rate),
+            .slot_cfg = I2S_PDM_RX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+            .gpio_cfg = {
+                .clk = config->pdm_clk_gpio,
+                .din = config->pdm_data_gpio,
+                .invert_flags = {
+                    .clk_inv = false,
+                },
+            },
+        };
+        ret = i2s_channel_init_pdm_rx_mode(s_rx_handle, &pdm_rx_cfg);
+    }
+    if (ret == ESP_OK) {
+        i2s_event_callbacks_t callbacks = {
+            .on_recv_q_ovf = on_recv_q_ovf,
+        };
+        ret = i2s_channel_register_event_callback(s_rx_handle, &callbacks, NULL);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize %s RX mode: %s", config->mode == AUDIO_MIC_STD ? "STD" : "PDM",
+                 esp_err_to_name(ret));
+        i2s_del_channel(s_rx_handle);
+        s_rx_handle = NULL;
+        return ret;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t audio_port_enable(void)
+{
+    if (!s_rx_handle) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    atomic_store(&s_overflows, 0);
+    return i2s_channel_enable(s_rx_handle);
+}
+
+esp_err_t audio_port_disable(void)
+{
+    return s_rx_handle ? i2s_channel_disable(s_rx_handle) : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t audio_port_read(void *dest, size_t bytes, size_t *bytes_read, uint32_t timeout_ms)
+{
+    return i2s_channel_read(s_rx_handle, dest, bytes, bytes_read, pdMS_TO_TICKS(timeout_ms));
+}
+
+uint32_t audio_port_dma_overflows(void)
+{
+    return atomic_load_explicit(&s_overflows, memory_order_relaxed);
+}
+
+void audio_port_deinit(void)
+{
+    if (s_rx_handle) {
+        i2s_del_channel(s_rx_handle);
+        s_rx_handle = NULL;
+    }
+}
\ No newline at end of file
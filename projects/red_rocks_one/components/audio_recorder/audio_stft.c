@@ -0,0 +1,220 @@
+#include "audio_stft.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+#include <string.h>
+
+#define STFT_SIZE_MIN   64
+#define STFT_SIZE_MAX   4096
+
+static void *alloc_internal(size_t size)
+{
+    return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void audio_stft_deinit(audio_stft_t *stft)
+{
+    if (!stft) {
+        return;
+    }
+    for (uint32_t i = 0; i < stft->held_count; i++) {
+        audio_recorder_block_release(&stft->held[i]);
+    }
+    stft->held_count = 0;
+    heap_caps_free(stft->window);
+    heap_caps_free(stft->twiddle);
+    heap_caps_free(stft->work);
+    stft->window = NULL;
+    stft->twiddle = NULL;
+    stft->work = NULL;
+}
+
+esp_err_t audio_stft_init(audio_stft_t *stft, const audio_stft_config_t *config)
+{
+    if (!stft || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t n = config->fft_size ? config->fft_size : AUDIO_STFT_SIZE_DEFAULT;
+    uint32_t hop = config->hop ? config->hop : n / 2;
+    if (n < STFT_SIZE_MIN || n > STFT_SIZE_MAX || (n & (n - 1)) != 0 || hop > n) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    audio_recorder_stats_t recorder;
+    esp_err_t ret = audio_recorder_get_stats(&recorder);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // A frame starting at a block's last sample spans the most blocks. Held
+    // that long, they may all need a spare as the capture task comes round;
+    // with none left over it would wait, and the DMA overflow under every
+    // consumer.
+    uint32_t span = (n - 2) / recorder.block_samples + 2;
+    if (span > AUDIO_STFT_MAX_BLOCKS || span >= recorder.ref_blocks) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    memset(stft, 0, sizeof(*stft));
+    stft->fft_size = n;
+    stft->hop = hop;
+    stft->window = alloc_internal(n * sizeof(float));
+    stft->twiddle = alloc_internal(n * sizeof(float));
+    stft->work = alloc_internal(n * sizeof(float));
+    if (!stft->window || !stft->twiddle || !stft->work) {
+        audio_stft_deinit(stft);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Periodic Hann, with the int16 full scale folded in
+    for (uint32_t i = 0; i < n; i++) {
+        stft->window[i] = (0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / n)) / 32768.0f;
+    }
+    for (uint32_t k = 0; k < n / 2; k++) {
+        stft->twiddle[k] = cosf(2.0f * (float)M_PI * k / n);
+        stft->twiddle[n / 2 + k] = sinf(2.0f * (float)M_PI * k / n);
+    }
+    return audio_recorder_reader_init(&stft->reader);
+}
+
+// In-place radix-2 FFT of m = fft_size / 2 interleaved complex values
+static void fft_half(const audio_stft_t *stft, float *a)
+{
+    uint32_t n = stft->fft_size;
+    uint32_t m = n / 2;
+    const float *cos_k = stft->twiddle;
+    const float *sin_k = stft->twiddle + m;
+
+    for (uint32_t i = 1, j = 0; i < m; i++) {
+        uint32_t bit = m >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+        if (i < j) {
+            float re = a[2 * i], im = a[2 * i + 1];
+            a[2 * i] = a[2 * j];
+            a[2 * i + 1] = a[2 * j + 1];
+            a[2 * j] = re;
+            a[2 * j + 1] = im;
+        }
+    }
+
+    for (uint32_t len = 2; len <= m; len <<= 1) {
+        uint32_t half = len / 2;
+        uint32_t step = n / len;
+        for (uint32_t i = 0; i < m; i += len) {
+            for (uint32_t k = 0; k < half; k++) {
+                float wr = cos_k[k * step], wi = -sin_k[k * step];
+                float *u = a + 2 * (i + k);
+                float *v = a + 2 * (i + k + half);
+                float vr = v[0] * wr - v[1] * wi;
+                float vi = v[0] * wi + v[1] * wr;
+                v[0] = u[0] - vr;
+                v[1] = u[1] - vi;
+                u[0] += vr;
+                u[1] += vi;
+            }
+        }
+    }
+}
+
+// The real frame went in as even and odd samples paired into complex
+// values; this pulls the two half spectra apart into the full one
+static void power_spectrum(const audio_stft_t *stft, const float *z, float *power)
+{
+    uint32_t n = stft->fft_size;
+    uint32_t m = n / 2;
+    const float *cos_k = stft->twiddle;
+    const float *sin_k = stft->twiddle + m;
+    // Hann sums to n / 2; a sine of amplitude 1 gives n / 4 in its bin
+    float scale = 16.0f / ((float)n * (float)n);
+
+    power[0] = (z[0] + z[1]) * (z[0] + z[1]) * scale;
+    power[m] = (z[0] - z[1]) * (z[0] - z[1]) * scale;
+    for (uint32_t k = 1; k < m; k++) {
+        float ar = z[2 * k], ai = z[2 * k + 1];
+        float br = z[2 * (m - k)], bi = -z[2 * (m - k) + 1];
+        float er = (ar + br) * 0.5f, ei = (ai + bi) * 0.5f;
+        float or_ = (ai - bi) * 0.5f, oi = -(ar - br) * 0.5f;
+        float wr = cos_k[k], wi = -sin_k[k];
+        float xr = er + or_ * wr - oi * wi;
+        float xi = ei + or_ * wi + oi * wr;
+        power[k] = (xr * xr + xi * xi) * scale;
+    }
+}
+
+static void release_held(audio_stft_t *stft)
+{
+    for (uint32_t i = 0; i < stft->held_count; i++) {
+        audio_recorder_block_release(&stft->held[i]);
+    }
+    stft->held_count = 0;
+    stft->frame_offset = 0;
+}
+
+static uint32_t held_samples(const audio_stft_t *stft)
+{
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < stft->held_count; i++) {
+        total += stft->held[i].count;
+    }
+    return total - stft->frame_offset;
+}
+
+esp_err_t audio_stft_next(audio_stft_t *stft, float *power, audio_block_info_t *info, uint32_t timeout_ms)
+{
+    if (!stft || !stft->work || !power) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    while (held_samples(stft) < stft->fft_size) {
+        if (stft->held_count == AUDIO_STFT_MAX_BLOCKS) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        audio_block_ref_t ref;
+        esp_err_t ret = audio_recorder_reader_acquire(&stft->reader, &ref, SIZE_MAX, timeout_ms);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        if (stft->held_count > 0) {
+            const audio_block_ref_t *last = &stft->held[stft->held_count - 1];
+            if (ref.info.first_sample != last->info.first_sample + last->count) {
+                release_held(stft);
+                stft->gaps++;
+            }
+        }
+        stft->held[stft->held_count++] = ref;
+    }
+
+    // Windowed straight out of the held blocks
+    float *x = stft->work;
+    uint32_t b = 0;
+    uint32_t pos = stft->frame_offset;
+    for (uint32_t i = 0; i < stft->fft_size; i++) {
+        if (pos == stft->held[b].count) {
+            b++;
+            pos = 0;
+        }
+        x[i] = stft->held[b].samples[pos++] * stft->window[i];
+    }
+    if (info) {
+        info->first_sample = stft->held[0].info.first_sample + stft->frame_offset;
+        info->time_us = stft->held[0].info.time_us +
+                        (int64_t)stft->frame_offset * 1000000 / audio_recorder_sample_rate();
+    }
+
+    int64_t start = esp_timer_get_time();
+    fft_half(stft, x);
+    power_spectrum(stft, x, power);
+    stft->fft_us += esp_timer_get_time() - start;
+    stft->frames++;
+
+    // Blocks the next frame starts past are done with
+    stft->frame_offset += stft->hop;
+    while (stft->held_count > 0 && stft->frame_offset >= stft->held[0].count) {
+        stft->frame_offset -= stft->held[0].count;
+        audio_recorder_block_release(&stft->held[0]);
+        memmove(&stft->held[0], &stft->held[1], (stft->held_count - 1) * sizeof(stft->held[0]));
+        stft->held_count--;
+    }
+    return ESP_OK;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "audio_vad.h"
+#include <math.h>
+#include <string.h>
+
+#define FLOOR_RISE_DB_PER_S 1.0f    // a steady sound stops counting after about on_db seconds
+#define FLOOR_FALL          0.5f    // share of the gap a quieter block closes
+#define LEVEL_MIN_DB        (-100.0f)
+#define FULL_SCALE_ENERGY   (32768.0f * 32768.0f)
+
+void audio_vad_init(audio_vad_t *vad, const audio_vad_config_t *config, uint32_t sample_rate,
+                    uint32_t block_samples)
+{
+    memset(vad, 0, sizeof(*vad));
+    vad->config = *config;
+    audio_vad_config_t *c = &vad->config;
+    if (c->on_db == 0) {
+        c->on_db = AUDIO_VAD_ON_DB_DEFAULT;
+    }
+    if (c->off_db == 0) {
+        c->off_db = AUDIO_VAD_OFF_DB_DEFAULT;
+    }
+    if (c->off_db > c->on_db) {
+        c->off_db = c->on_db;
+    }
+    if (c->zcr_per_mille == 0) {
+        c->zcr_per_mille = AUDIO_VAD_ZCR_DEFAULT;
+    }
+    if (c->hangover_ms == 0) {
+        c->hangover_ms = AUDIO_VAD_HANGOVER_MS_DEFAULT;
+    }
+    if (c->min_dbfs == 0) {
+        c->min_dbfs = AUDIO_VAD_MIN_DBFS_DEFAULT;
+    }
+
+    uint64_t hangover_samples = (uint64_t)c->hangover_ms * sample_rate / 1000;
+    vad->hangover_blocks = (uint32_t)((hangover_samples + block_samples - 1) / block_samples);
+    vad->rise_db = FLOOR_RISE_DB_PER_S * block_samples / sample_rate;
+    vad->state.level_db = LEVEL_MIN_DB;
+    vad->state.floor_db = LEVEL_MIN_DB;
+}
+
+void audio_vad_process(audio_vad_t *vad, const int16_t *block, uint32_t count, uint64_t first_sample)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // One pass; the last block's mean stands in for the DC so the energy
+    // and the crossings are of the signal alone
+    int32_t dc = vad->dc;
+    int64_t sum = 0;
+    uint64_t energy = 0;
+    uint32_t crossings = 0;
+    bool positive = block[0] >= dc;
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t s = block[i] - dc;
+        uint32_t magnitude = s < 0 ? -s : s;
+        sum += block[i];
+        energy += magnitude * magnitude;
+        bool now = s >= 0;
+        crossings += now != positive;
+        positive = now;
+    }
+    vad->dc = (int32_t)(sum / (int32_t)count);
+
+    audio_vad_state_t *st = &vad->state;
+    float mean = (float)energy / count;
+    float level = mean > 0 ? 10.0f * log10f(mean / FULL_SCALE_ENERGY) : LEVEL_MIN_DB;
+    uint32_t zcr = crossings * 1000 / count;
+    if (!vad->primed) {
+        st->floor_db = level;
+        vad->primed = true;
+    }
+
+    const audio_vad_config_t *c = &vad->config;
+    float over = level - st->floor_db;
+    bool audible = level >= c->min_dbfs;
+    bool keep = audible && over >= c->off_db;
+    bool start = audible && (over >= c->on_db || (keep && zcr >= c->zcr_per_mille));
+
+    if (st->active) {
+        if (keep) {
+            vad->hang = vad->hangover_blocks;
+        } else if (vad->hang > 0) {
+            vad->hang--;
+        } else {
+            st->active = false;
+            st->release_sample = first_sample;
+        }
+    } else if (start) {
+        st->active = true;
+        st->onsets++;
+        st->onset_sample = first_sample;
+        vad->hang = vad->hangover_blocks;
+    }
+
+    if (level < st->floor_db) {
+        st->floor_db += (level - st->floor_db) * FLOOR_FALL;
+    } else {
+        st->floor_db = fminf(st->floor_db + vad->rise_db, level);
+    }
+    st->level_db = level;
+    st->samples += count;
+    if (st->active) {
+        st->active_samples += count;
+    }
+}
\ No newline at end of file
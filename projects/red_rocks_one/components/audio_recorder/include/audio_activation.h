@@ -0,0 +1,59 @@
+#pragma once
+
+#include "audio_wav.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sound-activated recording on top of a running recorder with the activity
+// detector enabled. A task of its own watches the detector; at an onset it
+// seeks a reader back preroll_ms and opens a WAV segment from there, so
+// the sound that set it off is whole. Onsets within hold_ms of the end of
+// activity (plus the preroll) extend the segment; otherwise it closes
+// hold_ms after activity ended. The ring must hold the preroll and a poll.
+#define AUDIO_ACTIVATION_PREROLL_MS_DEFAULT 1000
+#define AUDIO_ACTIVATION_HOLD_MS_DEFAULT    2000
+#define AUDIO_ACTIVATION_POLL_MS_DEFAULT    100
+
+// Names a segment starting at start; runs on the activation task
+typedef void (*audio_activation_path_fn)(char *path, size_t size, const audio_block_info_t *start, void *ctx);
+
+typedef struct {
+    uint32_t preroll_ms;        // 0 = AUDIO_ACTIVATION_PREROLL_MS_DEFAULT
+    uint32_t hold_ms;           // 0 = AUDIO_ACTIVATION_HOLD_MS_DEFAULT
+    uint32_t poll_ms;           // 0 = AUDIO_ACTIVATION_POLL_MS_DEFAULT
+    audio_wav_config_t wav;
+    audio_activation_path_fn make_path;
+    void *ctx;
+    int task_core;
+    int task_priority;
+} audio_activation_config_t;
+
+typedef struct {
+    uint32_t segments;          // files written
+    uint32_t failed;            // segments that could not be opened or finished
+    uint32_t onsets;            // detector onsets, merged ones included
+    uint64_t samples;           // recorded while activation ran
+    uint64_t active_samples;    // judged active by the detector
+    uint64_t stored_samples;    // written to segments, preroll and hold included
+    uint64_t stored_bytes;
+    uint64_t saved_bytes;       // continuous recording in the same format, less stored_bytes
+    uint32_t duty_permille;     // stored_samples per 1000 recorded
+} audio_activation_stats_t;
+
+// ESP_ERR_TIMEOUT if the task of the last run is still closing its file
+esp_err_t audio_activation_start(const audio_activation_config_t *config);
+
+// Closes an open segment with what has arrived. On ESP_ERR_TIMEOUT
+// activation is stopped but the task is still finishing; the next start
+// waits for it
+esp_err_t audio_activation_stop(void);
+
+esp_err_t audio_activation_get_stats(audio_activation_stats_t *stats);
+
+bool audio_activation_in_segment(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Table-driven encoders for recorded audio, mono 16-bit in.
+//
+// G.711 mu-law: one byte per sample (2:1), WAV format tag 7. The segment of
+// each sample comes from a 256-entry table on its top bits.
+//
+// IMA ADPCM: four bits per sample (about 4:1), WAV format tag 0x11. Audio
+// is cut into blocks of block_align bytes: a 4-byte header holding the
+// block's first sample and the step index, then (block_align - 4) * 2
+// samples as nibbles, low nibble first. Each block restarts the predictor
+// from its header, so a damaged block does not spread.
+#define AUDIO_CODEC_MULAW_TAG       0x0007
+#define AUDIO_CODEC_ADPCM_TAG       0x0011
+#define AUDIO_CODEC_ADPCM_HEADER    4
+
+typedef struct {
+    int16_t predictor;
+    uint8_t index;              // into the step table, carried from block to block
+} audio_adpcm_state_t;
+
+void audio_codec_mulaw_encode(const int16_t *in, uint8_t *out, size_t count);
+
+// Samples held by one mono block
+static inline size_t audio_codec_adpcm_block_samples(uint16_t block_align)
+{
+    return (size_t)(block_align - AUDIO_CODEC_ADPCM_HEADER) * 2 + 1;
+}
+
+// Encodes count samples, at most a block's worth, into one block of
+// block_align bytes; a short block is padded with its last sample
+void audio_codec_adpcm_encode_block(audio_adpcm_state_t *state, const int16_t *in, size_t count,
+                                    uint8_t *out, uint16_t block_align);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
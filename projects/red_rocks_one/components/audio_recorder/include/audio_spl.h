@@ -0,0 +1,62 @@
+#pragma once
+
+#include "audio_recorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sound level of the recording, worked out on the ring blocks themselves
+// through a reader of its own. Each interval gives the equivalent
+// continuous level (Leq) and the loudest and quietest fast (125 ms) levels
+// within it, DC removed, plus the sample peak. Levels are dBFS plus
+// calibration_db, which for dB SPL is 94 less the microphone's dBFS at
+// 94 dB SPL, after the recorder's std_gain_shift.
+#define AUDIO_SPL_INTERVAL_MS_DEFAULT   1000
+#define AUDIO_SPL_FAST_MS               125
+
+typedef struct {
+    uint32_t interval_ms;       // 0 = AUDIO_SPL_INTERVAL_MS_DEFAULT
+    float calibration_db;
+} audio_spl_config_t;
+
+typedef struct {
+    audio_block_info_t start;   // first sample of the interval
+    uint32_t samples;
+    float leq_db;
+    float max_db;               // loudest fast level
+    float min_db;               // quietest fast level
+    float peak_db;
+    uint32_t overruns;          // the reader was lapped during the interval
+} audio_spl_result_t;
+
+typedef struct {
+    audio_reader_t reader;
+    audio_spl_config_t config;
+    uint32_t interval_samples;
+    uint32_t fast_samples;
+    // The interval so far
+    audio_spl_result_t result;
+    uint64_t energy;
+    int64_t sum;
+    uint32_t count;
+    int32_t peak;
+    uint64_t fast_energy;
+    int64_t fast_sum;
+    uint32_t fast_count;
+    double fast_max;
+    double fast_min;
+    uint32_t overruns_seen;
+} audio_spl_t;
+
+// Starts at the newest sample of an initialized recorder
+esp_err_t audio_spl_init(audio_spl_t *spl, const audio_spl_config_t *config);
+
+// Works through what has arrived, waiting up to timeout_ms for the first
+// block; ESP_OK with the result as soon as an interval completes,
+// ESP_ERR_TIMEOUT once caught up without completing one
+esp_err_t audio_spl_process(audio_spl_t *spl, audio_spl_result_t *result, uint32_t timeout_ms);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "audio_recorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Short-time spectra of the recording through a reader of its own. Frames
+// of fft_size samples, hop apart, are windowed (Hann) straight out of the
+// ring: the blocks a frame spans are held by reference until the frames
+// move past them, so overlap costs no copy of the history. A full-scale
+// sine on a bin comes out at 1.0 there. A lapped reader starts afresh at
+// the oldest block, the frames skipping the gap. A frame may not span as
+// many blocks as the recorder has spares (ref_blocks): give it more, or
+// larger blocks, for long frames or several analysers at once.
+#define AUDIO_STFT_SIZE_DEFAULT     512
+#define AUDIO_STFT_MAX_BLOCKS       8       // blocks a frame may span, a partial one at each end included
+
+typedef struct {
+    uint16_t fft_size;          // power of two from 64, 0 = AUDIO_STFT_SIZE_DEFAULT
+    uint16_t hop;               // 0 = fft_size / 2
+} audio_stft_config_t;
+
+typedef struct {
+    audio_reader_t reader;
+    uint16_t fft_size;
+    uint16_t hop;
+    float *window;
+    float *twiddle;             // cos then sin of 2 pi k / fft_size, fft_size / 2 of each
+    float *work;                // fft_size / 2 complex values
+    audio_block_ref_t held[AUDIO_STFT_MAX_BLOCKS];
+    uint32_t held_count;
+    uint32_t frame_offset;      // where the next frame starts in held[0]
+    uint32_t frames;
+    uint32_t gaps;              // frames restarted after the reader was lapped
+    uint64_t fft_us;
+} audio_stft_t;
+
+// Starts at the newest sample of an initialized recorder; ESP_ERR_INVALID_SIZE
+// when a frame spans as many blocks as the recorder has spares
+esp_err_t audio_stft_init(audio_stft_t *stft, const audio_stft_config_t *config);
+
+// Power of the next frame into fft_size / 2 + 1 bins, waiting up to
+// timeout_ms for the audio; info, when given, places its first sample
+esp_err_t audio_stft_next(audio_stft_t *stft, float *power, audio_block_info_t *info, uint32_t timeout_ms);
+
+// Releases the blocks held
+void audio_stft_deinit(audio_stft_t *stft);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "audio_recorder.h"
+#include "audio_codec.h"
+#include "audio_agc.h"
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Streams a WAV file to the SD card while it is recorded. Open writes the
+// header with zero sizes; samples collect in one chunk-sized buffer that
+// goes to the card whenever it fills, the first one short by the header so
+// every later write starts on a chunk boundary. Every checkpoint the sizes
+// in the header are patched and the file synced, so a clip cut off by a
+// power loss plays up to its last checkpoint. Close writes the rest and
+// the final sizes. RAM use is the chunk, however long the clip runs.
+//
+// Mono clips can be stored encoded, mu-law at half and IMA ADPCM at a
+// quarter of the PCM size; samples are then staged, encoded and the
+// bytes chunked the same way. Encoded files carry a fact chunk with the
+// sample count, patched with the sizes.
+//
+// Mono clips can also pass through the gain control and limiter of
+// audio_agc.h on the way in; the samples it holds back for its look-ahead
+// are drained into the file at close.
+#define AUDIO_WAV_CHUNK_DEFAULT     4096
+#define AUDIO_WAV_HEADER_MAX        60
+
+typedef enum {
+    AUDIO_WAV_PCM16 = 0,
+    AUDIO_WAV_MULAW,
+    AUDIO_WAV_IMA_ADPCM,
+} audio_wav_format_t;
+
+typedef struct {
+    uint32_t sample_rate;
+    uint16_t channels;
+    size_t chunk_bytes;         // bytes per SD write, 0 = AUDIO_WAV_CHUNK_DEFAULT; best a cluster multiple
+    uint32_t checkpoint_ms;     // audio between header patches, 0 = only at close
+    audio_wav_format_t format;
+    uint16_t block_align;       // ADPCM block bytes, 0 = 256 per 11 kHz of sample rate
+    audio_agc_config_t agc;     // off unless agc.enabled
+} audio_wav_config_t;
+
+typedef struct {
+    uint32_t samples;
+    uint32_t data_bytes;
+    uint32_t chunks;
+    uint32_t checkpoints;
+    uint32_t write_max_us;
+    uint32_t checkpoint_max_us;
+    uint64_t encode_us;
+    uint64_t agc_us;
+} audio_wav_stats_t;
+
+typedef struct {
+    FILE *file;
+    uint8_t *chunk;
+    size_t chunk_bytes;
+    size_t fill;                // bytes waiting in the chunk
+    size_t fill_target;         // where the current chunk is written out
+    size_t header_bytes;
+    int16_t *pcm;               // ADPCM samples waiting for a whole block
+    size_t pcm_samples;         // samples per ADPCM block
+    size_t pcm_fill;
+    uint8_t *block;             // one encoded ADPCM block
+    audio_adpcm_state_t adpcm;
+    audio_agc_t agc;
+    int16_t *agc_out;           // AGC output of one slice, null with the AGC off
+    uint32_t checkpoint_bytes;
+    uint32_t next_checkpoint;
+    audio_wav_config_t config;
+    audio_wav_stats_t stats;
+} audio_wav_writer_t;
+
+esp_err_t audio_wav_open(audio_wav_writer_t *writer, const char *path, const audio_wav_config_t *config);
+
+esp_err_t audio_wav_write(audio_wav_writer_t *writer, const int16_t *samples, size_t count);
+
+// Moves whatever the reader has into the chunk, without waiting. The ring
+// blocks are taken by reference and copied or encoded into the chunk from
+// where they lie; count, when given, is the number of samples taken
+esp_err_t audio_wav_write_from(audio_wav_writer_t *writer, audio_reader_t *reader, size_t *count);
+
+// As audio_wav_write_from, stopping short of end_sample
+esp_err_t audio_wav_write_until(audio_wav_writer_t *writer, audio_reader_t *reader, uint64_t end_sample,
+                                size_t *count);
+
+// Bytes of data a second of audio takes in the configured format
+uint32_t audio_wav_byte_rate(const audio_wav_config_t *config);
+
+// Most samples a file of the configured format holds in bytes, header included
+uint32_t audio_wav_samples_within(const audio_wav_config_t *config, uint32_t bytes);
+
+// Finishes the file as audio_wav_close does and goes on in a new one at
+// path, in the same format. The encoder and gain control carry on where
+// they were, so the two files play back to back as one. closed, when
+// given, gets the finished file's stats, and the result is how that file
+// went; when the new one cannot be created the writer is left closed, with
+// file NULL.
+esp_err_t audio_wav_rotate(audio_wav_writer_t *writer, const char *path, audio_wav_stats_t *closed);
+
+// Writes the rest, patches the sizes and closes; the writer can be opened again
+esp_err_t audio_wav_close(audio_wav_writer_t *writer);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+#include "unity.h"
+#include "audio_codec.h"
+#include "audio_test_util.h"
+#include "audio_wav.h"
+#include "sdcard_module.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs on the linux target. The firmware only encodes; the decoders here
+// follow G.711 and the IMA ADPCM reference, so a round trip through them
+// is what any player would hear.
+
+#define TEST_RATE       16000
+#define TEST_SAMPLES    (2 * TEST_RATE)
+
+static const int16_t s_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t s_index_shift[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static int16_t mulaw_decode(uint8_t code)
+{
+    code = ~code;
+    int magnitude = ((((code & 0x0F) << 3) + 0x84) << ((code >> 4) & 0x07)) - 0x84;
+    return (int16_t)((code & 0x80) ? -magnitude : magnitude);
+}
+
+static void adpcm_decode_block(const uint8_t *in, uint16_t block_align, int16_t *out)
+{
+    size_t samples = audio_codec_adpcm_block_samples(block_align);
+    int predictor = (int16_t)(in[0] | (in[1] << 8));
+    int index = in[2];
+    out[0] = (int16_t)predictor;
+    for (size_t i = 1; i < samples; i++) {
+        uint8_t byte = in[AUDIO_CODEC_ADPCM_HEADER + (i - 1) / 2];
+        uint8_t nibble = (i & 1) ? byte & 0x0F : byte >> 4;
+        int step = s_steps[index];
+        int delta = step >> 3;
+        if (nibble & 4) {
+            delta += step;
+        }
+        if (nibble & 2) {
+            delta += step >> 1;
+        }
+        if (nibble & 1) {
+            delta += step >> 2;
+        }
+        predictor += (nibble & 8) ? -delta : delta;
+        predictor = predictor > INT16_MAX ? INT16_MAX : predictor < INT16_MIN ? INT16_MIN : predictor;
+        index += s_index_shift[nibble & 7];
+        index = index < 0 ? 0 : index > 88 ? 88 : index;
+        out[i] = (int16_t)predictor;
+    }
+}
+
+// Voiced tones under a syllable envelope with a noise floor
+static int16_t *make_signal(void)
+{
+    int16_t *pcm = malloc(TEST_SAMPLES * sizeof(int16_t));
+    TEST_ASSERT_NOT_NULL(pcm);
+    uint32_t rng = 1;
+    for (int i = 0; i < TEST_SAMPLES; i++) {
+        double t = (double)i / TEST_RATE;
+        double envelope = 0.55 + 0.45 * sin(2 * M_PI * 3.0 * t);
+        double voice = 0.5 * sin(2 * M_PI * 180 * t) + 0.3 * sin(2 * M_PI * 720 * t) + 0.15 * sin(2 * M_PI * 2300 * t);
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        double noise = ((rng & 0xFFFF) / 65536.0 - 0.5) * 0.02;
+        pcm[i] = (int16_t)lrint(16000 * (envelope * voice + noise));
+    }
+    return pcm;
+}
+
+static double snr_db(const int16_t *ref, const int16_t *test, size_t count)
+{
+    double signal = 0, error = 0;
+    for (size_t i = 0; i < count; i++) {
+        double d = (double)ref[i] - test[i];
+        signal += (double)ref[i] * ref[i];
+        error += d * d;
+    }
+    return 10 * log10(signal / (error + 1e-9));
+}
+
+// Writes the signal in pieces of random size, as the capture task would
+static void write_wav(const char *path, const audio_wav_config_t *config, const int16_t *pcm, size_t count)
+{
+    sdcard_config_t sd = {0};
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_init(&sd));
+    audio_wav_writer_t writer;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_wav_open(&writer, path, config));
+    srand(7);
+    for (size_t offset = 0; offset < count;) {
+        size_t piece = 1 + rand() % 700;
+        piece = piece > count - offset ? count - offset : piece;
+        TEST_ASSERT_EQUAL(ESP_OK, audio_wav_write(&writer, pcm + offset, piece));
+        offset += piece;
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, audio_wav_close(&writer));
+    TEST_ASSERT_EQUAL(count, writer.stats.samples);
+}
+
+TEST_CASE("mu-law stays within half a step everywhere", "[audio][codec]")
+{
+    for (int x = INT16_MIN; x <= INT16_MAX; x++) {
+        int16_t in = (int16_t)x;
+        uint8_t code;
+        audio_codec_mulaw_encode(&in, &code, 1);
+        int out = mulaw_decode(code);
+        // Steps double per segment, from 8 at the bottom; past the clip
+        // level everything lands on the top code
+        int segment = (~code >> 4) & 0x07;
+        int bound = abs(x) > 32635 ? abs(x) - 32124 : 4 << segment;
+        TEST_ASSERT_LESS_OR_EQUAL(bound, abs(out - x));
+        if (x != 0) {
+            TEST_ASSERT_TRUE(out == 0 || (out < 0) == (x < 0));
+        }
+    }
+}
+
+TEST_CASE("mu-law round trip", "[audio][codec]")
+{
+    int16_t *pcm = make_signal();
+    uint8_t *codes = malloc(TEST_SAMPLES);
+    int16_t *out = malloc(TEST_SAMPLES * sizeof(int16_t));
+    audio_codec_mulaw_encode(pcm, codes, TEST_SAMPLES);
+    for (int i = 0; i < TEST_SAMPLES; i++) {
+        out[i] = mulaw_decode(codes[i]);
+    }
+    TEST_ASSERT_GREATER_THAN(35.0, snr_db(pcm, out, TEST_SAMPLES));
+    free(pcm);
+    free(codes);
+    free(out);
+}
+
+TEST_CASE("IMA ADPCM round trip", "[audio][codec]")
+{
+    int16_t *pcm = make_signal();
+    const uint16_t aligns[] = { 256, 512, 1024 };
+    for (int a = 0; a < 3; a++) {
+        uint16_t align = aligns[a];
+        size_t per_block = audio_codec_adpcm_block_samples(align);
+        size_t blocks = (TEST_SAMPLES + per_block - 1) / per_block;
+        uint8_t *encoded = malloc(blocks * align);
+        int16_t *out = malloc(blocks * per_block * sizeof(int16_t));
+
+        audio_adpcm_state_t state = {0};
+        for (size_t b = 0; b < blocks; b++) {
+            size_t left = TEST_SAMPLES - b * per_block;
+            audio_codec_adpcm_encode_block(&state, pcm + b * per_block, left < per_block ? left : per_block,
+                                           encoded + b * align, align);
+            // Each block opens on its own first sample, whole
+            TEST_ASSERT_EQUAL(pcm[b * per_block], (int16_t)audio_test_u16(encoded + b * align));
+            TEST_ASSERT_LESS_OR_EQUAL(88, encoded[b * align + 2]);
+            TEST_ASSERT_EQUAL(0, encoded[b * align + 3]);
+            adpcm_decode_block(encoded + b * align, align, out + b * per_block);
+        }
+        TEST_ASSERT_GREATER_THAN(24.0, snr_db(pcm, out, TEST_SAMPLES));
+
+        // The padded tail holds the last sample
+        size_t last = TEST_SAMPLES - 1;
+        for (size_t i = TEST_SAMPLES; i < blocks * per_block; i++) {
+            TEST_ASSERT_INT_WITHIN(2 * s_steps[encoded[(blocks - 1) * align + 2]] + 64, pcm[last], out[i]);
+        }
+        free(encoded);
+        free(out);
+    }
+    TEST_ASSERT_EQUAL(505, audio_codec_adpcm_block_samples(256));
+    free(pcm);
+}
+
+TEST_CASE("ADPCM WAV holds whole blocks and the exact sample count", "[audio][codec][wav]")
+{
+    int16_t *pcm = make_signal();
+    audio_wav_config_t config = {
+        .sample_rate = TEST_RATE,
+        .channels = 1,
+        .checkpoint_ms = 500,
+        .format = AUDIO_WAV_IMA_ADPCM,
+    };
+    write_wav("codec_adpcm.wav", &config, pcm, TEST_SAMPLES);
+
+    size_t len;
+    uint8_t *wav = audio_test_read_card("codec_adpcm.wav", &len);
+    TEST_ASSERT_EQUAL_MEMORY("RIFF", wav, 4);
+    TEST_ASSERT_EQUAL(len - 8, audio_test_u32(wav + 4));
+    TEST_ASSERT_EQUAL_MEMORY("WAVEfmt ", wav + 8, 8);
+    TEST_ASSERT_EQUAL(20, audio_test_u32(wav + 16));
+    TEST_ASSERT_EQUAL(AUDIO_CODEC_ADPCM_TAG, audio_test_u16(wav + 20));
+    TEST_ASSERT_EQUAL(1, audio_test_u16(wav + 22));
+    TEST_ASSERT_EQUAL(TEST_RATE, audio_test_u32(wav + 24));
+    uint16_t align = audio_test_u16(wav + 32);
+    TEST_ASSERT_EQUAL(256, align);      // 256 bytes per 11 kHz, rounded
+    TEST_ASSERT_EQUAL(4, audio_test_u16(wav + 34));
+    TEST_ASSERT_EQUAL(2, audio_test_u16(wav + 36));
+    size_t per_block = audio_test_u16(wav + 38);
+    TEST_ASSERT_EQUAL(audio_codec_adpcm_block_samples(align), per_block);
+    TEST_ASSERT_EQUAL(TEST_RATE * align / per_block, audio_test_u32(wav + 28));
+    TEST_ASSERT_EQUAL_MEMORY("fact", wav + 40, 4);
+    TEST_ASSERT_EQUAL(TEST_SAMPLES, audio_test_u32(wav + 48));
+    TEST_ASSERT_EQUAL_MEMORY("data", wav + 52, 4);
+
+    size_t blocks = (TEST_SAMPLES + per_block - 1) / per_block;
+    uint32_t data_bytes = audio_test_u32(wav + 56);
+    TEST_ASSERT_EQUAL(blocks * align, data_bytes);
+    TEST_ASSERT_EQUAL(60 + data_bytes, len);
+
+    // Blocks written in odd pieces decode as if encoded in one go
+    int16_t *out = malloc(blocks * per_block * sizeof(int16_t));
+    for (size_t b = 0; b < blocks; b++) {
+        adpcm_decode_block(wav + 60 + b * align, align, out + b * per_block);
+    }
+    TEST_ASSERT_GREATER_THAN(24.0, snr_db(pcm, out, TEST_SAMPLES));
+    free(out);
+    free(wav);
+    free(pcm);
+}
+
+TEST_CASE("mu-law WAV matches the encoder byte for byte", "[audio][codec][wav]")
+{
+    int16_t *pcm = make_signal();
+    audio_wav_config_t config = {
+        .sample_rate = TEST_RATE,
+        .channels = 1,
+        .checkpoint_ms = 500,
+        .format = AUDIO_WAV_MULAW,
+    };
+    write_wav("codec_mulaw.wav", &config, pcm, TEST_SAMPLES);
+
+    size_t len;
+    uint8_t *wav = audio_test_read_card("codec_mulaw.wav", &len);
+    TEST_ASSERT_EQUAL(58 + TEST_SAMPLES, len);
+    TEST_ASSERT_EQUAL(len - 8, audio_test_u32(wav + 4));
+    TEST_ASSERT_EQUAL(18, audio_test_u32(wav + 16));
+    TEST_ASSERT_EQUAL(AUDIO_CODEC_MULAW_TAG, audio_test_u16(wav + 20));
+    TEST_ASSERT_EQUAL(TEST_RATE, audio_test_u32(wav + 28));
+    TEST_ASSERT_EQUAL(1, audio_test_u16(wav + 32));
+    TEST_ASSERT_EQUAL(8, audio_test_u16(wav + 34));
+    TEST_ASSERT_EQUAL(0, audio_test_u16(wav + 36));
+    TEST_ASSERT_EQUAL_MEMORY("fact", wav + 38, 4);
+    TEST_ASSERT_EQUAL(TEST_SAMPLES, audio_test_u32(wav + 46));
+    TEST_ASSERT_EQUAL_MEMORY("data", wav + 50, 4);
+    TEST_ASSERT_EQUAL(TEST_SAMPLES, audio_test_u32(wav + 54));
+
+    uint8_t *codes = malloc(TEST_SAMPLES);
+    audio_codec_mulaw_encode(pcm, codes, TEST_SAMPLES);
+    TEST_ASSERT_EQUAL_MEMORY(codes, wav + 58, TEST_SAMPLES);
+    free(codes);
+    free(wav);
+    free(pcm);
+}
\ No newline at end of file
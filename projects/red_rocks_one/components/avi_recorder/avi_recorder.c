@@ -234,6 +234,28 @@ esp_err_t avi_recorder_add_frame(const uint8_t* jpeg_data, size_t jpeg_size)
     return ESP_OK;
 }
 
+esp_err_t avi_recorder_add_empty_frame(void)
+{
+    if (!s_recording_state.recording) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    avi_chunk_header_t chunk_header;
+    memcpy(chunk_header.chunk_id, "00dc", 4);
+    chunk_header.chunk_size = 0;
+    
+    esp_err_t ret = sdcard_module_append_file(s_recording_state.filename, 
+                                             &chunk_header, sizeof(chunk_header));
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to write empty frame chunk");
+        return ret;
+    }
+    
+    s_recording_state.frame_count++;
+    s_recording_state.total_bytes += sizeof(chunk_header);
+    return ESP_OK;
+}
+
 esp_err_t avi_recorder_stop(void)
 {
     if (!s_recording_state.recording) {
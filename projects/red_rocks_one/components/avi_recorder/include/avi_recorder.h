@@ -108,6 +108,9 @@ typedef struct {
 esp_err_t avi_recorder_init(uint32_t width, uint32_t height, uint32_t fps);
 esp_err_t avi_recorder_start(const char* filename);
 esp_err_t avi_recorder_add_frame(const uint8_t* jpeg_data, size_t jpeg_size);
+// Zero-length frame chunk: keeps the timeline when a slot had no capture,
+// players hold the previous picture
+esp_err_t avi_recorder_add_empty_frame(void);
 esp_err_t avi_recorder_stop(void);
 esp_err_t avi_recorder_deinit(void);
 bool avi_recorder_is_recording(void);
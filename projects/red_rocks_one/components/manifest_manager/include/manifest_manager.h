@@ -1,35 +1,177 @@
 #pragma once
 
 #include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <time.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Brightness of a capture from its JPEG DC terms, 0..255
+typedef struct {
+    uint8_t mean;
+    uint8_t p5;
+    uint8_t p50;
+    uint8_t p95;
+} manifest_luma_t;
+
+// Frame offset against the session's reference frame in pixels, from
+// phase correlation; shift by -dx, -dy to stabilise
+typedef struct {
+    int16_t dx;
+    int16_t dy;
+} manifest_align_t;
+
+// Where an audio segment starts: the index of its first sample since the
+// recorder started, and the millisecond past the row's timestamp that
+// sample was taken
+typedef struct {
+    uint64_t start_sample;
+    uint16_t start_ms;
+} manifest_audio_t;
+
 typedef struct {
     char filename[64];
     char full_path[128];
     time_t timestamp;
     size_t file_size;
     int duration_ms;
+    bool reference;
+    bool has_luma;
+    manifest_luma_t luma;
+    bool has_align;
+    manifest_align_t align;
+    bool has_audio;
+    manifest_audio_t audio;
 } video_entry_t;
 
+// Compact in-memory form of a manifest row (40 bytes vs ~216 for
+// video_entry_t). The YYYY/MM/DD directory is interned in a string table
+// and the filename packed six bits a character, which holds every name
+// the apps write (clip_HHMMSS_NNNN_rN.jpg, audio_HHMMSS_sNNNN.wav, ...).
+// Use manifest_record_get_filename() and manifest_record_get_path() to
+// rebuild them on demand.
+#define MANIFEST_NAME_LEN   25      // characters from 0-9, a-z, '_', '.', '-'
+#define MANIFEST_NAME_BYTES 19
+
+// The row has no file of its own: the capture repeated the file it names
+// and was not written. Its file_size is 0.
+#define MANIFEST_FLAG_REFERENCE 0x01
+// luma holds the capture's brightness statistics
+#define MANIFEST_FLAG_LUMA      0x02
+// align holds the capture's offset against the reference frame
+#define MANIFEST_FLAG_ALIGN     0x04
+// The row is an audio segment stamped with the time of its first sample;
+// audio places that sample, in the bytes luma and align take otherwise
+#define MANIFEST_FLAG_AUDIO     0x08
+// duration_10ms counts whole seconds: the row lasts longer than 655 s
+#define MANIFEST_FLAG_DURATION_S 0x10
+
+typedef struct {
+    uint32_t timestamp;
+    uint32_t file_size;
+    uint16_t duration_10ms;             // read through manifest_record_get_duration_ms()
+    uint16_t dir_id;
+    union {
+        struct {
+            manifest_luma_t luma;
+            manifest_align_t align;
+        };
+        struct {
+            uint32_t start_sample;      // low 32 bits
+            uint16_t start_sample_high; // the next 16
+            uint16_t start_ms;
+        } audio;
+    };
+    uint8_t flags;
+    uint8_t name[MANIFEST_NAME_BYTES];  // empty for a longer name, kept whole in the string table
+} manifest_record_t;
+
+// Time-range query over the manifest. Entries are kept sorted by
+// timestamp, so a query resolves to one contiguous run of the index.
+// Rows are copied out under the manifest lock, and the iterator follows
+// adds, loads and the cleanup job: rows retired since the last call are
+// skipped, and after rows move it carries on from the last row returned.
+typedef struct {
+    time_t start;
+    time_t end;
+    int first;
+    int last;
+    int position;
+    uint32_t generation;
+    uint32_t timestamp;         // of the last row returned
+    int same;                   // rows returned with that timestamp
+    int returned;
+} manifest_iter_t;
+
 esp_err_t manifest_init(void);
 
 esp_err_t manifest_add_video(const char *relative_path, const char *filename, 
                            size_t file_size, int duration_ms);
 
+// As manifest_add_video, with the capture's brightness statistics
+esp_err_t manifest_add_video_luma(const char *relative_path, const char *filename,
+                                  size_t file_size, int duration_ms, const manifest_luma_t *luma);
+
+// As manifest_add_video, with whichever of brightness and alignment are known (NULL = none)
+esp_err_t manifest_add_video_meta(const char *relative_path, const char *filename, size_t file_size,
+                                  int duration_ms, const manifest_luma_t *luma, const manifest_align_t *align);
+
+// Records an audio segment whose first sample was taken at start plus
+// audio->start_ms; the row sorts by that time
+esp_err_t manifest_add_audio(const char *relative_path, const char *filename, size_t file_size,
+                             int duration_ms, time_t start, const manifest_audio_t *audio);
+
+// Records a capture that repeated relative_path/filename (a file already in
+// the manifest) instead of writing a new one
+esp_err_t manifest_add_reference(const char *relative_path, const char *filename, int duration_ms);
+
+// Rewrites the JSON on the card when rows changed since the last save.
+// Rows are copied out a page at a time, so adds only wait for a copy,
+// never for the card.
 esp_err_t manifest_save_to_sd(void);
 
+// As manifest_save_to_sd, at most once per interval_ms; for callers that
+// add rows often and can lose the last interval's on a power cut
+esp_err_t manifest_save_if_due(uint32_t interval_ms);
+
+// Streams the JSON in 4 KB chunks into the PSRAM index, then replays the
+// journal. Time grows with the row count: every row is parsed, about
+// 1.8 MB of JSON per 10k rows, so at 100k+ rows the card's read rate
+// sets the boot time. Logs the time taken per 10k entries.
 esp_err_t manifest_load_from_sd(void);
 
 int manifest_get_video_count(void);
 
 esp_err_t manifest_get_video_entry(int index, video_entry_t *entry);
 
+// Starts (or re-arms) the background job that deletes files older than
+// max_days in time-bounded batches and tombstones them in the journal.
 esp_err_t manifest_cleanup_old_entries(int max_days);
 
+esp_err_t manifest_query_range(time_t start, time_t end, manifest_iter_t *iter);
+
+// Rows in the span that are still in the manifest
+int manifest_iter_count(manifest_iter_t *iter);
+
+// ESP_ERR_NOT_FOUND past the end of the span
+esp_err_t manifest_iter_next(manifest_iter_t *iter, manifest_record_t *record);
+
+// Copies up to limit rows starting offset rows into the span; returns how many
+int manifest_iter_get_page(manifest_iter_t *iter, int offset, int limit, manifest_record_t *records);
+
+esp_err_t manifest_record_get_filename(const manifest_record_t *record, char *buffer, size_t buffer_size);
+
+esp_err_t manifest_record_get_path(const manifest_record_t *record, char *buffer, size_t buffer_size);
+
+int manifest_record_get_duration_ms(const manifest_record_t *record);
+
+// ESP_ERR_NOT_FOUND unless the row is an audio segment
+esp_err_t manifest_record_get_audio(const manifest_record_t *record, manifest_audio_t *audio);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -1,29 +1,645 @@
 #include "manifest_manager.h"
 #include "sdcard_module.h"
 #include "esp_log.h"
-#include "cJSON.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
 
 static const char *TAG = "manifest";
 static const char *MANIFEST_FILE = "timelapse_data/manifest.json";
+static const char *MANIFEST_TMP_FILE = "timelapse_data/manifest.tmp";
+static const char *MANIFEST_JOURNAL_FILE = "timelapse_data/manifest.journal";
+static const char *MANIFEST_DATA_DIR = "timelapse_data";
 
-static video_entry_t *s_video_entries = NULL;
+#define MANIFEST_VERSION        2
+#define MANIFEST_CHUNK_SIZE     4096
+#define MANIFEST_MIN_CAPACITY   16
+#define MANIFEST_MAX_DEPTH      16
+#define MANIFEST_MAX_STRINGS    (UINT16_MAX - 1)
+#define MANIFEST_NO_STRING      UINT16_MAX
+#define MANIFEST_SAVE_PAGE      32          // rows copied out per lock hold while saving
+
+// Background cleanup: files are deleted in small batches, each slice bounded
+// in time and run with the manifest lock released, so captures never queue
+// behind a large expiry backlog.
+#define CLEANUP_BATCH_SIZE      16
+#define CLEANUP_SLICE_BUDGET_US 20000
+#define CLEANUP_SLICE_PAUSE_MS  50
+#define CLEANUP_RECHECK_MS      (60 * 60 * 1000)
+#define CLEANUP_TASK_STACK      4096
+#define CLEANUP_TASK_PRIORITY   2
+
+// Live rows are s_record_base[s_head .. s_head + s_video_count). Expiry is
+// oldest-first, so cleanup just advances s_head; the dead prefix is reclaimed
+// lazily when the array would otherwise have to grow.
+static manifest_record_t *s_record_base = NULL;
+static manifest_record_t *s_records = NULL;
+static int s_head = 0;
 static int s_video_count = 0;
 static int s_video_capacity = 0;
+// Bumped whenever rows move in s_record_base, so iterators know to seek again
+static uint32_t s_generation = 0;
+// Bumped on every add and retire; a save records the value it wrote, so
+// saves with nothing new skip the card
+static uint32_t s_changes = 0;
+static uint32_t s_saved_changes = 0;
+static int64_t s_saved_us = 0;
+
+static SemaphoreHandle_t s_lock = NULL;
+// Serialises writes to the manifest's files. A save and the cleanup job's
+// tombstones take it, never the capture path, so s_lock is only held to
+// copy rows in or out and never across card I/O.
+static SemaphoreHandle_t s_io_lock = NULL;
+static TaskHandle_t s_cleanup_task = NULL;
+static int s_retention_days = 0;
+
+// Interned directory strings referenced by manifest_record_t.dir_id. One
+// string per capture day, so this stays tiny next to the record array.
+static char **s_strings = NULL;
+static int s_string_count = 0;
+static int s_string_capacity = 0;
+// Open-addressed hash of s_strings, so interning costs the same at any size
+static uint16_t *s_string_index = NULL;
+static uint32_t s_string_slots = 0;
+
+// The latest reference row to each file that has any, keyed by the file's
+// dir_id and packed name, so the cleanup job can tell whether a file is
+// still referenced without scanning the manifest. Entries go when their
+// file's row is retired; a reference retired first leaves latest as it
+// was, which only keeps the file a little longer.
+typedef struct {
+    uint32_t latest;
+    uint16_t dir_id;                    // MANIFEST_NO_STRING for an empty slot
+    uint8_t name[MANIFEST_NAME_BYTES];
+} manifest_ref_t;
+
+static manifest_ref_t *s_refs = NULL;
+static uint32_t s_ref_slots = 0;
+static uint32_t s_ref_count = 0;
+
+// Incremental parser state. The manifest is fed through in fixed-size chunks,
+// so nothing here may assume a token is complete within one buffer.
+typedef enum {
+    FIELD_FILENAME  = 1 << 0,
+    FIELD_PATH      = 1 << 1,
+    FIELD_TIMESTAMP = 1 << 2,
+    FIELD_SIZE      = 1 << 3,
+    FIELD_DURATION  = 1 << 4,
+    FIELD_ALL       = 0x1F,     // "ref", "luma", "align" and the audio fields are optional
+} manifest_field_t;
+
+typedef struct {
+    int depth;
+    uint32_t object_mask;       // bit n set when level n is an object
+    int videos_depth;           // depth of the "videos" array, 0 if not entered
+    bool in_string;
+    bool escape;
+    bool in_number;
+    bool expect_key;
+    bool value_is_key;
+    char key[24];
+    char token[sizeof(((video_entry_t *)0)->full_path)];
+    size_t token_len;
+    video_entry_t pending;
+    uint32_t pending_fields;
+    int array_count;            // values read from the entry's "luma" or "align" array
+    int skipped;
+} manifest_parser_t;
+
+static void manifest_lock(void)
+{
+    if (s_lock) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+    }
+}
+
+static void manifest_unlock(void)
+{
+    if (s_lock) {
+        xSemaphoreGive(s_lock);
+    }
+}
+
+static void manifest_compact(void)
+{
+    if (s_head == 0) {
+        return;
+    }
+    memmove(s_record_base, s_records, s_video_count * sizeof(manifest_record_t));
+    s_head = 0;
+    s_records = s_record_base;
+    s_generation++;
+}
+
+static esp_err_t manifest_reserve(int capacity)
+{
+    if (s_head + capacity <= s_video_capacity) {
+        return ESP_OK;
+    }
+    
+    manifest_compact();
+    if (capacity <= s_video_capacity) {
+        return ESP_OK;
+    }
+    
+    // PSRAM first: 100k entries do not fit in internal RAM
+    manifest_record_t *new_records = heap_caps_realloc(s_record_base, capacity * sizeof(manifest_record_t),
+                                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!new_records) {
+        new_records = realloc(s_record_base, capacity * sizeof(manifest_record_t));
+    }
+    if (!new_records) {
+        ESP_LOGE(TAG, "Failed to expand manifest capacity to %d entries", capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    s_record_base = new_records;
+    s_records = new_records;
+    s_video_capacity = capacity;
+    s_generation++;
+    return ESP_OK;
+}
+
+static esp_err_t manifest_grow(void)
+{
+    if (s_head + s_video_count < s_video_capacity) {
+        return ESP_OK;
+    }
+    
+    // Reclaim the expired prefix only once it is at least half the live size,
+    // which keeps the memmove cost amortized O(1) per append.
+    if (s_head > 0 && s_head >= s_video_count / 2) {
+        manifest_compact();
+        return ESP_OK;
+    }
+    
+    return manifest_reserve(s_video_capacity ? s_video_capacity * 2 : MANIFEST_MIN_CAPACITY);
+}
+
+static uint32_t manifest_hash(const char *str)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (; *str; str++) {
+        hash = (hash ^ (uint8_t)*str) * 16777619u;
+    }
+    return hash;
+}
+
+// Slot holding str, or the empty slot where it would go
+static uint32_t manifest_hash_slot(const char *str)
+{
+    uint32_t mask = s_string_slots - 1;
+    uint32_t slot = manifest_hash(str) & mask;
+    while (s_string_index[slot] != MANIFEST_NO_STRING && strcmp(s_strings[s_string_index[slot]], str) != 0) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+static esp_err_t manifest_rehash(uint32_t slots)
+{
+    uint16_t *index = malloc(slots * sizeof(uint16_t));
+    if (!index) {
+        return ESP_ERR_NO_MEM;
+    }
+    free(s_string_index);
+    s_string_index = index;
+    s_string_slots = slots;
+    memset(s_string_index, 0xFF, slots * sizeof(uint16_t));
+    for (int i = 0; i < s_string_count; i++) {
+        s_string_index[manifest_hash_slot(s_strings[i])] = i;
+    }
+    return ESP_OK;
+}
+
+static int manifest_intern(const char *str)
+{
+    if (s_string_slots > 0) {
+        uint16_t id = s_string_index[manifest_hash_slot(str)];
+        if (id != MANIFEST_NO_STRING) {
+            return id;
+        }
+    }
+    
+    if (s_string_count >= MANIFEST_MAX_STRINGS) {
+        return -1;
+    }
+    
+    if (s_string_count >= s_string_capacity) {
+        int capacity = s_string_capacity ? s_string_capacity * 2 : 16;
+        char **new_strings = realloc(s_strings, capacity * sizeof(char *));
+        if (!new_strings) {
+            return -1;
+        }
+        s_strings = new_strings;
+        s_string_capacity = capacity;
+    }
+    
+    // Kept at most half full so probes stay short
+    if ((uint32_t)(s_string_count + 1) * 2 > s_string_slots &&
+        manifest_rehash(s_string_slots ? s_string_slots * 2 : 32) != ESP_OK) {
+        return -1;
+    }
+    
+    char *copy = strdup(str);
+    if (!copy) {
+        return -1;
+    }
+    
+    s_strings[s_string_count] = copy;
+    s_string_index[manifest_hash_slot(copy)] = s_string_count;
+    return s_string_count++;
+}
+
+static void manifest_clear_strings(void)
+{
+    for (int i = 0; i < s_string_count; i++) {
+        free(s_strings[i]);
+    }
+    s_string_count = 0;
+    if (s_string_index) {
+        memset(s_string_index, 0xFF, s_string_slots * sizeof(uint16_t));
+    }
+}
+
+static uint32_t manifest_ref_hash(const manifest_record_t *record)
+{
+    // FNV-1a over the key
+    uint32_t hash = (2166136261u ^ (record->dir_id & 0xFF)) * 16777619u;
+    hash = (hash ^ (record->dir_id >> 8)) * 16777619u;
+    for (int i = 0; i < MANIFEST_NAME_BYTES; i++) {
+        hash = (hash ^ record->name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Slot holding the record's file, or the empty slot where it would go
+static uint32_t manifest_ref_slot(const manifest_record_t *record)
+{
+    uint32_t mask = s_ref_slots - 1;
+    uint32_t slot = manifest_ref_hash(record) & mask;
+    while (s_refs[slot].dir_id != MANIFEST_NO_STRING &&
+           (s_refs[slot].dir_id != record->dir_id || memcmp(s_refs[slot].name, record->name, MANIFEST_NAME_BYTES) != 0)) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+static esp_err_t manifest_ref_rehash(uint32_t slots)
+{
+    manifest_ref_t *refs = heap_caps_malloc(slots * sizeof(manifest_ref_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!refs) {
+        refs = malloc(slots * sizeof(manifest_ref_t));
+    }
+    if (!refs) {
+        return ESP_ERR_NO_MEM;
+    }
+    manifest_ref_t *old = s_refs;
+    uint32_t old_slots = s_ref_slots;
+    s_refs = refs;
+    s_ref_slots = slots;
+    for (uint32_t i = 0; i < slots; i++) {
+        s_refs[i].dir_id = MANIFEST_NO_STRING;
+    }
+    for (uint32_t i = 0; i < old_slots; i++) {
+        if (old[i].dir_id != MANIFEST_NO_STRING) {
+            manifest_record_t key = { .dir_id = old[i].dir_id };
+            memcpy(key.name, old[i].name, MANIFEST_NAME_BYTES);
+            s_refs[manifest_ref_slot(&key)] = old[i];
+        }
+    }
+    free(old);
+    return ESP_OK;
+}
+
+// Notes a reference row against the file it repeats
+static esp_err_t manifest_ref_add(const manifest_record_t *ref)
+{
+    // Kept at most half full so probes stay short
+    if ((s_ref_count + 1) * 2 > s_ref_slots &&
+        manifest_ref_rehash(s_ref_slots ? s_ref_slots * 2 : 64) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
+    manifest_ref_t *entry = &s_refs[manifest_ref_slot(ref)];
+    if (entry->dir_id == MANIFEST_NO_STRING) {
+        entry->dir_id = ref->dir_id;
+        memcpy(entry->name, ref->name, MANIFEST_NAME_BYTES);
+        entry->latest = ref->timestamp;
+        s_ref_count++;
+    } else if (ref->timestamp > entry->latest) {
+        entry->latest = ref->timestamp;
+    }
+    return ESP_OK;
+}
+
+static const manifest_ref_t *manifest_ref_find(const manifest_record_t *file)
+{
+    if (s_ref_count == 0) {
+        return NULL;
+    }
+    const manifest_ref_t *entry = &s_refs[manifest_ref_slot(file)];
+    return entry->dir_id != MANIFEST_NO_STRING ? entry : NULL;
+}
+
+// Drops a retired file's entry, shifting back the entries probed past it
+static void manifest_ref_forget(const manifest_record_t *file)
+{
+    if (s_ref_count == 0 || (file->flags & MANIFEST_FLAG_REFERENCE)) {
+        return;
+    }
+    uint32_t mask = s_ref_slots - 1;
+    uint32_t hole = manifest_ref_slot(file);
+    if (s_refs[hole].dir_id == MANIFEST_NO_STRING) {
+        return;
+    }
+    for (uint32_t slot = (hole + 1) & mask; s_refs[slot].dir_id != MANIFEST_NO_STRING; slot = (slot + 1) & mask) {
+        manifest_record_t key = { .dir_id = s_refs[slot].dir_id };
+        memcpy(key.name, s_refs[slot].name, MANIFEST_NAME_BYTES);
+        uint32_t home = manifest_ref_hash(&key) & mask;
+        // Moves back unless its home lies cyclically in (hole, slot]
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            s_refs[hole] = s_refs[slot];
+            hole = slot;
+        }
+    }
+    s_refs[hole].dir_id = MANIFEST_NO_STRING;
+    s_ref_count--;
+}
+
+static void manifest_clear_refs(void)
+{
+    for (uint32_t i = 0; i < s_ref_slots; i++) {
+        s_refs[i].dir_id = MANIFEST_NO_STRING;
+    }
+    s_ref_count = 0;
+}
+
+// Names are packed six bits a character: end, 0-9, a-z, '_', '.', '-'
+static int manifest_name_code(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return 1 + (c - '0');
+    }
+    if (c >= 'a' && c <= 'z') {
+        return 11 + (c - 'a');
+    }
+    switch (c) {
+        case '_': return 37;
+        case '.': return 38;
+        case '-': return 39;
+        default: return -1;
+    }
+}
+
+static char manifest_name_char(int code)
+{
+    static const char chars[] = "0123456789abcdefghijklmnopqrstuvwxyz_.-";
+    return (code >= 1 && code <= 39) ? chars[code - 1] : '\0';
+}
+
+static bool manifest_pack_name(uint8_t *packed, const char *name)
+{
+    memset(packed, 0, MANIFEST_NAME_BYTES);
+    size_t len = strlen(name);
+    if (len == 0 || len > MANIFEST_NAME_LEN) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        int code = manifest_name_code(name[i]);
+        if (code < 0) {
+            memset(packed, 0, MANIFEST_NAME_BYTES);
+            return false;
+        }
+        size_t byte = i * 6 / 8;
+        int shift = i * 6 % 8;
+        packed[byte] |= (uint8_t)(code << shift);
+        if (shift > 2) {
+            packed[byte + 1] |= (uint8_t)(code >> (8 - shift));
+        }
+    }
+    return true;
+}
+
+static void manifest_unpack_name(const uint8_t *packed, char *name)
+{
+    size_t i;
+    for (i = 0; i < MANIFEST_NAME_LEN; i++) {
+        size_t byte = i * 6 / 8;
+        int shift = i * 6 % 8;
+        int code = packed[byte] >> shift;
+        if (shift > 2) {
+            code |= packed[byte + 1] << (8 - shift);
+        }
+        name[i] = manifest_name_char(code & 0x3F);
+        if (name[i] == '\0') {
+            return;
+        }
+    }
+    name[i] = '\0';
+}
+
+static esp_err_t manifest_fill_record(manifest_record_t *record, const char *dir, const char *filename,
+                                      time_t timestamp, size_t file_size, int duration_ms, uint8_t flags,
+                                      const manifest_luma_t *luma, const manifest_align_t *align,
+                                      const manifest_audio_t *audio)
+{
+    int dir_id;
+    
+    if (manifest_pack_name(record->name, filename)) {
+        dir_id = manifest_intern(dir);
+    } else {
+        // A name the packing cannot hold: intern the whole path and leave name empty
+        char full_path[sizeof(((video_entry_t *)0)->full_path)];
+        snprintf(full_path, sizeof(full_path), "%s/%s", dir, filename);
+        dir_id = manifest_intern(full_path);
+    }
+    
+    if (dir_id < 0) {
+        ESP_LOGE(TAG, "Failed to intern manifest path for %s", filename);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    if (duration_ms < 0) {
+        duration_ms = 0;
+    }
+    
+    record->timestamp = (uint32_t)timestamp;
+    record->file_size = (uint32_t)file_size;
+    record->dir_id = (uint16_t)dir_id;
+    record->flags = flags;
+    if (duration_ms / 10 <= UINT16_MAX) {
+        record->duration_10ms = (uint16_t)(duration_ms / 10);
+    } else {
+        // Past 655 s: whole seconds, up to 18 h
+        record->flags |= MANIFEST_FLAG_DURATION_S;
+        int seconds = (duration_ms + 500) / 1000;
+        if (seconds > UINT16_MAX) {
+            ESP_LOGW(TAG, "Duration of %s (%d s) clamped to %d s", filename, seconds, UINT16_MAX);
+            seconds = UINT16_MAX;
+        }
+        record->duration_10ms = (uint16_t)seconds;
+    }
+    if (luma) {
+        record->flags |= MANIFEST_FLAG_LUMA;
+        record->luma = *luma;
+    } else {
+        memset(&record->luma, 0, sizeof(record->luma));
+    }
+    if (align) {
+        record->flags |= MANIFEST_FLAG_ALIGN;
+        record->align = *align;
+    } else {
+        memset(&record->align, 0, sizeof(record->align));
+    }
+    if (audio) {
+        record->flags = (record->flags & ~(MANIFEST_FLAG_LUMA | MANIFEST_FLAG_ALIGN)) | MANIFEST_FLAG_AUDIO;
+        record->audio.start_sample = (uint32_t)audio->start_sample;
+        record->audio.start_sample_high = (uint16_t)(audio->start_sample >> 32);
+        record->audio.start_ms = audio->start_ms;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t format_filename(const manifest_record_t *record, char *buffer, size_t buffer_size)
+{
+    if (!record || !buffer || record->dir_id >= s_string_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char name[MANIFEST_NAME_LEN + 1];
+    manifest_unpack_name(record->name, name);
+    const char *filename = name;
+    if (name[0] == '\0') {
+        const char *slash = strrchr(s_strings[record->dir_id], '/');
+        filename = slash ? slash + 1 : s_strings[record->dir_id];
+    }
+    
+    int len = snprintf(buffer, buffer_size, "%s", filename);
+    return (len >= 0 && (size_t)len < buffer_size) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+static esp_err_t format_path(const manifest_record_t *record, char *buffer, size_t buffer_size)
+{
+    if (!record || !buffer || record->dir_id >= s_string_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char name[MANIFEST_NAME_LEN + 1];
+    manifest_unpack_name(record->name, name);
+    int len;
+    if (name[0] != '\0') {
+        len = snprintf(buffer, buffer_size, "%s/%s", s_strings[record->dir_id], name);
+    } else {
+        len = snprintf(buffer, buffer_size, "%s", s_strings[record->dir_id]);
+    }
+    
+    return (len >= 0 && (size_t)len < buffer_size) ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+// The string table may be reallocated or reloaded by another task
+esp_err_t manifest_record_get_filename(const manifest_record_t *record, char *buffer, size_t buffer_size)
+{
+    manifest_lock();
+    esp_err_t ret = format_filename(record, buffer, buffer_size);
+    manifest_unlock();
+    return ret;
+}
+
+esp_err_t manifest_record_get_path(const manifest_record_t *record, char *buffer, size_t buffer_size)
+{
+    manifest_lock();
+    esp_err_t ret = format_path(record, buffer, buffer_size);
+    manifest_unlock();
+    return ret;
+}
+
+int manifest_record_get_duration_ms(const manifest_record_t *record)
+{
+    if (!record) {
+        return 0;
+    }
+    return (record->flags & MANIFEST_FLAG_DURATION_S) ? record->duration_10ms * 1000 : record->duration_10ms * 10;
+}
+
+esp_err_t manifest_record_get_audio(const manifest_record_t *record, manifest_audio_t *audio)
+{
+    if (!record || !audio) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!(record->flags & MANIFEST_FLAG_AUDIO)) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    audio->start_sample = record->audio.start_sample | ((uint64_t)record->audio.start_sample_high << 32);
+    audio->start_ms = record->audio.start_ms;
+    return ESP_OK;
+}
+
+// First index whose timestamp is >= ts, or s_video_count if none
+static int manifest_lower_bound(time_t ts)
+{
+    int lo = 0;
+    int hi = s_video_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if ((time_t)s_records[mid].timestamp < ts) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static int compare_timestamp(const void *a, const void *b)
+{
+    uint32_t ta = ((const manifest_record_t *)a)->timestamp;
+    uint32_t tb = ((const manifest_record_t *)b)->timestamp;
+    return (ta > tb) - (ta < tb);
+}
+
+static void manifest_ensure_sorted(void)
+{
+    for (int i = 1; i < s_video_count; i++) {
+        if (s_records[i].timestamp < s_records[i - 1].timestamp) {
+            ESP_LOGW(TAG, "Manifest not in time order, sorting %d entries", s_video_count);
+            qsort(s_records, s_video_count, sizeof(manifest_record_t), compare_timestamp);
+            return;
+        }
+    }
+}
 
 esp_err_t manifest_init(void)
 {
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+        if (!s_lock) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (!s_io_lock) {
+        s_io_lock = xSemaphoreCreateMutex();
+        if (!s_io_lock) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    
     s_video_count = 0;
-    s_video_capacity = 16;
-    s_video_entries = malloc(s_video_capacity * sizeof(video_entry_t));
+    s_saved_us = 0;
+    manifest_clear_refs();
     
-    if (!s_video_entries) {
+    esp_err_t ret = manifest_reserve(MANIFEST_MIN_CAPACITY);
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to allocate memory for manifest");
-        return ESP_ERR_NO_MEM;
+        return ret;
     }
     
-    esp_err_t ret = manifest_load_from_sd();
+    ret = manifest_load_from_sd();
     if (ret != ESP_OK) {
         ESP_LOGI(TAG, "No existing manifest found, starting fresh");
     }
@@ -31,150 +647,614 @@ esp_err_t manifest_init(void)
     return ESP_OK;
 }
 
-esp_err_t manifest_add_video(const char *relative_path, const char *filename, 
-                           size_t file_size, int duration_ms)
+// Stamped now, unless timestamp is given
+static esp_err_t manifest_add_record(const char *relative_path, const char *filename,
+                                     size_t file_size, int duration_ms, uint8_t flags, time_t timestamp,
+                                     const manifest_luma_t *luma, const manifest_align_t *align,
+                                     const manifest_audio_t *audio)
 {
     if (!relative_path || !filename) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (s_video_count >= s_video_capacity) {
-        s_video_capacity *= 2;
-        video_entry_t *new_entries = realloc(s_video_entries, 
-                                           s_video_capacity * sizeof(video_entry_t));
-        if (!new_entries) {
-            ESP_LOGE(TAG, "Failed to expand manifest capacity");
-            return ESP_ERR_NO_MEM;
-        }
-        s_video_entries = new_entries;
+    manifest_lock();
+    
+    esp_err_t ret = manifest_grow();
+    if (ret != ESP_OK) {
+        manifest_unlock();
+        return ret;
     }
     
-    video_entry_t *entry = &s_video_entries[s_video_count];
-    strncpy(entry->filename, filename, sizeof(entry->filename) - 1);
-    entry->filename[sizeof(entry->filename) - 1] = '\0';
+    time_t now = timestamp;
+    if (!timestamp) {
+        time(&now);
+    }
     
-    snprintf(entry->full_path, sizeof(entry->full_path), "%s/%s", relative_path, filename);
+    manifest_record_t record;
+    ret = manifest_fill_record(&record, relative_path, filename, now, file_size, duration_ms, flags,
+                               luma, align, audio);
+    if (ret == ESP_OK && (record.flags & MANIFEST_FLAG_REFERENCE)) {
+        ret = manifest_ref_add(&record);
+    }
+    if (ret != ESP_OK) {
+        manifest_unlock();
+        return ret;
+    }
     
-    time(&entry->timestamp);
-    entry->file_size = file_size;
-    entry->duration_ms = duration_ms;
+    // Captures arrive in time order; only a clock step (e.g. first NTP sync)
+    // or an audio segment stamped with its start lands an entry earlier than
+    // the tail and needs the slow path.
+    int index = s_video_count;
+    if (s_video_count > 0 && now < (time_t)s_records[s_video_count - 1].timestamp) {
+        index = manifest_lower_bound(now + 1);
+        memmove(&s_records[index + 1], &s_records[index],
+                (s_video_count - index) * sizeof(manifest_record_t));
+        s_generation++;
+        if (!timestamp) {
+            ESP_LOGW(TAG, "Out-of-order entry inserted at %d of %d", index, s_video_count);
+        }
+    }
     
+    s_records[index] = record;
     s_video_count++;
+    s_changes++;
     
-    ESP_LOGI(TAG, "Added video to manifest: %s (size: %zu bytes, duration: %d ms)", 
-             entry->full_path, file_size, duration_ms);
+    manifest_unlock();
     
     return ESP_OK;
 }
 
+esp_err_t manifest_add_video(const char *relative_path, const char *filename,
+                           size_t file_size, int duration_ms)
+{
+    esp_err_t ret = manifest_add_record(relative_path, filename, file_size, duration_ms, 0, 0, NULL, NULL, NULL);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Added video to manifest: %s/%s (size: %zu bytes, duration: %d ms)",
+                 relative_path, filename, file_size, duration_ms);
+    }
+    return ret;
+}
+
+esp_err_t manifest_add_video_luma(const char *relative_path, const char *filename,
+                                  size_t file_size, int duration_ms, const manifest_luma_t *luma)
+{
+    return manifest_add_video_meta(relative_path, filename, file_size, duration_ms, luma, NULL);
+}
+
+esp_err_t manifest_add_video_meta(const char *relative_path, const char *filename, size_t file_size,
+                                  int duration_ms, const manifest_luma_t *luma, const manifest_align_t *align)
+{
+    esp_err_t ret = manifest_add_record(relative_path, filename, file_size, duration_ms, 0, 0, luma, align, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    char meta[48] = "";
+    int len = 0;
+    if (luma) {
+        len += snprintf(meta + len, sizeof(meta) - len, ", luma %d/%d/%d/%d",
+                        luma->mean, luma->p5, luma->p50, luma->p95);
+    }
+    if (align) {
+        snprintf(meta + len, sizeof(meta) - len, ", offset %+d,%+d", align->dx, align->dy);
+    }
+    ESP_LOGI(TAG, "Added video to manifest: %s/%s (size: %zu bytes, duration: %d ms%s)",
+             relative_path, filename, file_size, duration_ms, meta);
+    return ret;
+}
+
+esp_err_t manifest_add_audio(const char *relative_path, const char *filename, size_t file_size,
+                             int duration_ms, time_t start, const manifest_audio_t *audio)
+{
+    if (!audio || start <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = manifest_add_record(relative_path, filename, file_size, duration_ms, 0, start, NULL, NULL, audio);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Added audio to manifest: %s/%s (size: %zu bytes, duration: %d ms, first sample %llu)",
+                 relative_path, filename, file_size, duration_ms, (unsigned long long)audio->start_sample);
+    }
+    return ret;
+}
+
+esp_err_t manifest_add_reference(const char *relative_path, const char *filename, int duration_ms)
+{
+    esp_err_t ret = manifest_add_record(relative_path, filename, 0, duration_ms, MANIFEST_FLAG_REFERENCE, 0,
+                                        NULL, NULL, NULL);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Added reference to manifest: %s/%s (duration: %d ms)",
+                 relative_path, filename, duration_ms);
+    }
+    return ret;
+}
+
+static void write_json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+        }
+        fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+typedef struct {
+    manifest_record_t record;
+    char path[sizeof(((video_entry_t *)0)->full_path)];
+    char filename[sizeof(((video_entry_t *)0)->filename)];
+} save_row_t;
+
+static void manifest_iter_sync(manifest_iter_t *iter);
+static void manifest_iter_take(manifest_iter_t *iter, manifest_record_t *record);
+
+// Copies the next rows of a save out under the lock, with the names they
+// need from the string table, so the card is written with it released
+static int manifest_save_page(manifest_iter_t *iter, save_row_t *rows, int limit)
+{
+    manifest_lock();
+    manifest_iter_sync(iter);
+    int count = 0;
+    while (count < limit && iter->position < iter->last) {
+        save_row_t *row = &rows[count++];
+        manifest_iter_take(iter, &row->record);
+        format_path(&row->record, row->path, sizeof(row->path));
+        format_filename(&row->record, row->filename, sizeof(row->filename));
+    }
+    manifest_unlock();
+    return count;
+}
+
+static void write_row(FILE *f, const save_row_t *row)
+{
+    const manifest_record_t *record = &row->record;
+    fputs("{\"filename\": ", f);
+    write_json_string(f, row->filename);
+    fputs(", \"path\": ", f);
+    write_json_string(f, row->path);
+    fprintf(f, ", \"timestamp\": %lu, \"size\": %lu, \"duration_ms\": %d%s",
+            (unsigned long)record->timestamp, (unsigned long)record->file_size,
+            manifest_record_get_duration_ms(record),
+            (record->flags & MANIFEST_FLAG_REFERENCE) ? ", \"ref\": 1" : "");
+    if (record->flags & MANIFEST_FLAG_LUMA) {
+        // mean, 5th, 50th and 95th percentile
+        fprintf(f, ", \"luma\": [%d, %d, %d, %d]", record->luma.mean, record->luma.p5,
+                record->luma.p50, record->luma.p95);
+    }
+    if (record->flags & MANIFEST_FLAG_ALIGN) {
+        fprintf(f, ", \"align\": [%d, %d]", record->align.dx, record->align.dy);
+    }
+    manifest_audio_t audio;
+    if (manifest_record_get_audio(record, &audio) == ESP_OK) {
+        fprintf(f, ", \"start_sample\": %llu, \"start_ms\": %u",
+                (unsigned long long)audio.start_sample, audio.start_ms);
+    }
+    fputc('}', f);
+}
+
 esp_err_t manifest_save_to_sd(void)
 {
-    cJSON *root = cJSON_CreateObject();
-    cJSON *videos_array = cJSON_CreateArray();
+    if (!s_io_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
-    if (!root || !videos_array) {
-        if (root) cJSON_Delete(root);
-        if (videos_array) cJSON_Delete(videos_array);
-        return ESP_ERR_NO_MEM;
+    // Held until the journal is gone: tombstones appended meanwhile would be
+    // dropped with it. Adds carry on; a row added mid-save either makes it
+    // into this file or leaves the manifest dirty for the next one.
+    xSemaphoreTake(s_io_lock, portMAX_DELAY);
+    
+    manifest_iter_t iter;
+    memset(&iter, 0, sizeof(iter));
+    iter.end = (time_t)UINT32_MAX;
+    manifest_lock();
+    uint32_t changes = s_changes;
+    iter.generation = s_generation - 1;
+    manifest_iter_sync(&iter);
+    int total = iter.last - iter.first;
+    manifest_unlock();
+    
+    if (changes == s_saved_changes) {
+        xSemaphoreGive(s_io_lock);
+        return ESP_OK;
     }
     
-    cJSON_AddItemToObject(root, "videos", videos_array);
-    cJSON_AddNumberToObject(root, "total_count", s_video_count);
-    cJSON_AddNumberToObject(root, "created_timestamp", time(NULL));
+    // Streamed straight to the card: building a cJSON tree for every entry
+    // costs several hundred bytes of heap per row.
+    FILE *f = sdcard_module_open_file(MANIFEST_TMP_FILE, "w");
+    save_row_t *rows = malloc(MANIFEST_SAVE_PAGE * sizeof(save_row_t));
+    if (!f || !rows) {
+        ESP_LOGE(TAG, "Failed to save manifest to SD card");
+        if (f) {
+            fclose(f);
+        }
+        free(rows);
+        xSemaphoreGive(s_io_lock);
+        return f ? ESP_ERR_NO_MEM : ESP_FAIL;
+    }
     
-    for (int i = 0; i < s_video_count; i++) {
-        cJSON *video_obj = cJSON_CreateObject();
-        if (!video_obj) continue;
-        
-        cJSON_AddStringToObject(video_obj, "filename", s_video_entries[i].filename);
-        cJSON_AddStringToObject(video_obj, "path", s_video_entries[i].full_path);
-        cJSON_AddNumberToObject(video_obj, "timestamp", s_video_entries[i].timestamp);
-        cJSON_AddNumberToObject(video_obj, "size", s_video_entries[i].file_size);
-        cJSON_AddNumberToObject(video_obj, "duration_ms", s_video_entries[i].duration_ms);
-        
-        cJSON_AddItemToArray(videos_array, video_obj);
+    char *io_buffer = malloc(MANIFEST_CHUNK_SIZE);
+    if (io_buffer) {
+        setvbuf(f, io_buffer, _IOFBF, MANIFEST_CHUNK_SIZE);
     }
     
-    char *json_string = cJSON_Print(root);
-    cJSON_Delete(root);
+    // total_count precedes the array so the loader can size its index up front
+    fprintf(f, "{\n\"version\": %d,\n\"total_count\": %d,\n\"created_timestamp\": %lld,\n\"videos\": [\n",
+            MANIFEST_VERSION, total, (long long)time(NULL));
     
-    if (!json_string) {
-        ESP_LOGE(TAG, "Failed to generate JSON");
-        return ESP_ERR_NO_MEM;
+    int saved_count = 0;
+    int count;
+    while ((count = manifest_save_page(&iter, rows, MANIFEST_SAVE_PAGE)) > 0) {
+        for (int i = 0; i < count; i++) {
+            fputs(saved_count++ ? ",\n" : "", f);
+            write_row(f, &rows[i]);
+        }
     }
     
-    esp_err_t ret = sdcard_module_write_file(MANIFEST_FILE, json_string, strlen(json_string));
-    free(json_string);
+    fputs(saved_count ? "\n]\n}\n" : "]\n}\n", f);
     
+    bool write_ok = !ferror(f);
+    fclose(f);
+    free(io_buffer);
+    free(rows);
+    
+    esp_err_t ret = write_ok ? sdcard_module_rename_file(MANIFEST_TMP_FILE, MANIFEST_FILE) : ESP_FAIL;
     if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Manifest saved with %d video entries", s_video_count);
+        // Tombstones are folded into the snapshot now
+        sdcard_module_delete_file(MANIFEST_JOURNAL_FILE);
+        manifest_lock();
+        s_saved_changes = changes;
+        s_saved_us = esp_timer_get_time();
+        manifest_unlock();
+    }
+    xSemaphoreGive(s_io_lock);
+    
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Manifest saved with %d video entries", saved_count);
     } else {
         ESP_LOGE(TAG, "Failed to save manifest to SD card");
+        sdcard_module_delete_file(MANIFEST_TMP_FILE);
     }
     
     return ret;
 }
 
-esp_err_t manifest_load_from_sd(void)
+esp_err_t manifest_save_if_due(uint32_t interval_ms)
 {
-    size_t file_size = 32768;
-    char *buffer = malloc(file_size);
-    if (!buffer) {
-        return ESP_ERR_NO_MEM;
+    manifest_lock();
+    bool due = s_saved_us == 0 || esp_timer_get_time() - s_saved_us >= (int64_t)interval_ms * 1000;
+    manifest_unlock();
+    return due ? manifest_save_to_sd() : ESP_OK;
+}
+
+static void parser_on_scalar(manifest_parser_t *p, bool is_string)
+{
+    p->token[p->token_len] = '\0';
+    
+    if (p->depth == 1) {
+        if (!is_string && strcmp(p->key, "total_count") == 0) {
+            int total = atoi(p->token);
+            if (total > 0 && manifest_reserve(total) == ESP_OK) {
+                ESP_LOGI(TAG, "Reserved manifest index for %d entries", total);
+            }
+        }
+        return;
     }
     
-    esp_err_t ret = sdcard_module_read_file(MANIFEST_FILE, buffer, &file_size);
-    if (ret != ESP_OK) {
-        free(buffer);
-        return ret;
+    video_entry_t *e = &p->pending;
+    if (p->videos_depth && p->depth == p->videos_depth + 2 && !is_string && strcmp(p->key, "luma") == 0) {
+        uint8_t *fields[] = { &e->luma.mean, &e->luma.p5, &e->luma.p50, &e->luma.p95 };
+        if (p->array_count < 4) {
+            *fields[p->array_count++] = (uint8_t)strtol(p->token, NULL, 10);
+            e->has_luma = p->array_count == 4;
+        }
+        return;
+    }
+    if (p->videos_depth && p->depth == p->videos_depth + 2 && !is_string && strcmp(p->key, "align") == 0) {
+        int16_t *fields[] = { &e->align.dx, &e->align.dy };
+        if (p->array_count < 2) {
+            *fields[p->array_count++] = (int16_t)strtol(p->token, NULL, 10);
+            e->has_align = p->array_count == 2;
+        }
+        return;
     }
     
-    cJSON *root = cJSON_Parse(buffer);
-    free(buffer);
+    if (p->videos_depth == 0 || p->depth != p->videos_depth + 1) {
+        return;
+    }
     
-    if (!root) {
-        ESP_LOGE(TAG, "Failed to parse manifest JSON");
+    if (is_string && strcmp(p->key, "filename") == 0) {
+        strncpy(e->filename, p->token, sizeof(e->filename) - 1);
+        p->pending_fields |= FIELD_FILENAME;
+    } else if (is_string && strcmp(p->key, "path") == 0) {
+        strncpy(e->full_path, p->token, sizeof(e->full_path) - 1);
+        p->pending_fields |= FIELD_PATH;
+    } else if (!is_string && strcmp(p->key, "timestamp") == 0) {
+        e->timestamp = (time_t)strtoll(p->token, NULL, 10);
+        p->pending_fields |= FIELD_TIMESTAMP;
+    } else if (!is_string && strcmp(p->key, "size") == 0) {
+        e->file_size = (size_t)strtoull(p->token, NULL, 10);
+        p->pending_fields |= FIELD_SIZE;
+    } else if (!is_string && strcmp(p->key, "duration_ms") == 0) {
+        e->duration_ms = (int)strtol(p->token, NULL, 10);
+        p->pending_fields |= FIELD_DURATION;
+    } else if (!is_string && strcmp(p->key, "ref") == 0) {
+        e->reference = strtol(p->token, NULL, 10) != 0;
+    } else if (!is_string && strcmp(p->key, "start_sample") == 0) {
+        e->audio.start_sample = strtoull(p->token, NULL, 10);
+        e->has_audio = true;
+    } else if (!is_string && strcmp(p->key, "start_ms") == 0) {
+        e->audio.start_ms = (uint16_t)strtoul(p->token, NULL, 10);
+    }
+}
+
+static esp_err_t manifest_add_parsed(const video_entry_t *entry)
+{
+    // "path" is "<dir>/<filename>"; split at the last slash to intern the directory
+    const char *slash = strrchr(entry->full_path, '/');
+    if (!slash) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    cJSON *videos_array = cJSON_GetObjectItem(root, "videos");
-    if (!cJSON_IsArray(videos_array)) {
-        cJSON_Delete(root);
-        return ESP_ERR_INVALID_ARG;
+    char dir[sizeof(entry->full_path)];
+    size_t dir_len = slash - entry->full_path;
+    memcpy(dir, entry->full_path, dir_len);
+    dir[dir_len] = '\0';
+    
+    return manifest_fill_record(&s_records[s_video_count], dir, slash + 1,
+                                entry->timestamp, entry->file_size, entry->duration_ms,
+                                entry->reference ? MANIFEST_FLAG_REFERENCE : 0,
+                                entry->has_luma ? &entry->luma : NULL,
+                                entry->has_align ? &entry->align : NULL,
+                                entry->has_audio ? &entry->audio : NULL);
+}
+
+static void parser_open(manifest_parser_t *p, bool is_object)
+{
+    if (p->depth == 1 && !is_object && strcmp(p->key, "videos") == 0) {
+        p->videos_depth = 2;
+    }
+    if (p->videos_depth && p->depth == p->videos_depth + 1 && !is_object) {
+        p->array_count = 0;
     }
     
-    int array_size = cJSON_GetArraySize(videos_array);
-    s_video_count = 0;
+    p->depth++;
+    if (p->depth < MANIFEST_MAX_DEPTH) {
+        if (is_object) {
+            p->object_mask |= (1u << p->depth);
+        } else {
+            p->object_mask &= ~(1u << p->depth);
+        }
+    }
+    p->expect_key = is_object;
     
-    for (int i = 0; i < array_size && s_video_count < s_video_capacity; i++) {
-        cJSON *video_obj = cJSON_GetArrayItem(videos_array, i);
-        if (!cJSON_IsObject(video_obj)) continue;
-        
-        cJSON *filename = cJSON_GetObjectItem(video_obj, "filename");
-        cJSON *path = cJSON_GetObjectItem(video_obj, "path");
-        cJSON *timestamp = cJSON_GetObjectItem(video_obj, "timestamp");
-        cJSON *size = cJSON_GetObjectItem(video_obj, "size");
-        cJSON *duration = cJSON_GetObjectItem(video_obj, "duration_ms");
+    if (is_object && p->videos_depth && p->depth == p->videos_depth + 1) {
+        memset(&p->pending, 0, sizeof(p->pending));
+        p->pending_fields = 0;
+    }
+}
+
+static void parser_close(manifest_parser_t *p)
+{
+    if (p->videos_depth && p->depth == p->videos_depth + 1) {
+        if (p->pending_fields == FIELD_ALL && manifest_grow() == ESP_OK &&
+            manifest_add_parsed(&p->pending) == ESP_OK) {
+            s_video_count++;
+        } else {
+            p->skipped++;
+        }
+    } else if (p->videos_depth && p->depth == p->videos_depth) {
+        p->videos_depth = 0;
+    }
+    
+    if (p->depth > 0) {
+        p->depth--;
+    }
+    p->expect_key = false;
+}
+
+static void parser_feed(manifest_parser_t *p, const char *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        char c = data[i];
         
-        if (!cJSON_IsString(filename) || !cJSON_IsString(path) || 
-            !cJSON_IsNumber(timestamp) || !cJSON_IsNumber(size) ||
-            !cJSON_IsNumber(duration)) {
+        if (p->in_string) {
+            if (p->escape) {
+                p->escape = false;
+            } else if (c == '\\') {
+                p->escape = true;
+                continue;
+            } else if (c == '"') {
+                p->in_string = false;
+                p->token[p->token_len] = '\0';
+                if (p->value_is_key) {
+                    strncpy(p->key, p->token, sizeof(p->key) - 1);
+                    p->key[sizeof(p->key) - 1] = '\0';
+                } else {
+                    parser_on_scalar(p, true);
+                }
+                continue;
+            }
+            if (p->token_len < sizeof(p->token) - 1) {
+                p->token[p->token_len++] = c;
+            }
             continue;
         }
         
-        video_entry_t *entry = &s_video_entries[s_video_count];
-        strncpy(entry->filename, filename->valuestring, sizeof(entry->filename) - 1);
-        strncpy(entry->full_path, path->valuestring, sizeof(entry->full_path) - 1);
-        entry->timestamp = (time_t)timestamp->valuedouble;
-        entry->file_size = (size_t)size->valuedouble;
-        entry->duration_ms = (int)duration->valuedouble;
+        if (p->in_number) {
+            if ((c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' || c == 'e' || c == 'E') {
+                if (p->token_len < sizeof(p->token) - 1) {
+                    p->token[p->token_len++] = c;
+                }
+                continue;
+            }
+            p->in_number = false;
+            parser_on_scalar(p, false);
+        }
         
-        s_video_count++;
+        switch (c) {
+            case '"':
+                p->in_string = true;
+                p->value_is_key = p->expect_key;
+                p->token_len = 0;
+                break;
+            case ':':
+                p->expect_key = false;
+                break;
+            case ',':
+                p->expect_key = p->depth < MANIFEST_MAX_DEPTH && (p->object_mask & (1u << p->depth));
+                break;
+            case '{':
+                parser_open(p, true);
+                break;
+            case '[':
+                parser_open(p, false);
+                break;
+            case '}':
+            case ']':
+                parser_close(p);
+                break;
+            default:
+                if ((c >= '0' && c <= '9') || c == '-') {
+                    p->in_number = true;
+                    p->token_len = 0;
+                    p->token[p->token_len++] = c;
+                }
+                break;
+        }
+    }
+}
+
+static bool manifest_record_matches(const manifest_record_t *record, const char *path)
+{
+    char record_path[sizeof(((video_entry_t *)0)->full_path)];
+    return format_path(record, record_path, sizeof(record_path)) == ESP_OK &&
+           strcmp(record_path, path) == 0;
+}
+
+static bool manifest_remove(uint32_t timestamp, const char *path)
+{
+    for (int i = manifest_lower_bound(timestamp);
+         i < s_video_count && s_records[i].timestamp == timestamp; i++) {
+        if (!manifest_record_matches(&s_records[i], path)) {
+            continue;
+        }
+        manifest_ref_forget(&s_records[i]);
+        if (i == 0) {
+            s_head++;
+            s_records++;
+        } else {
+            memmove(&s_records[i], &s_records[i + 1], (s_video_count - i - 1) * sizeof(manifest_record_t));
+            s_generation++;
+        }
+        s_video_count--;
+        s_changes++;
+        return true;
+    }
+    return false;
+}
+
+// Journal lines are "D <timestamp> <path>", one per file the cleanup job has
+// deleted since the last snapshot. A torn final line simply fails to match.
+static int manifest_replay_journal(void)
+{
+    FILE *f = sdcard_module_open_file(MANIFEST_JOURNAL_FILE, "r");
+    if (!f) {
+        return 0;
     }
     
-    cJSON_Delete(root);
-    ESP_LOGI(TAG, "Loaded %d video entries from manifest", s_video_count);
-    return ESP_OK;
+    char line[sizeof(((video_entry_t *)0)->full_path) + 32];
+    char path[sizeof(((video_entry_t *)0)->full_path)];
+    unsigned long timestamp;
+    int applied = 0;
+    
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "D %lu %127s", &timestamp, path) == 2 &&
+            manifest_remove((uint32_t)timestamp, path)) {
+            applied++;
+        }
+    }
+    
+    fclose(f);
+    return applied;
+}
+
+esp_err_t manifest_load_from_sd(void)
+{
+    FILE *f = sdcard_module_open_file(MANIFEST_FILE, "r");
+    if (!f) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    char *chunk = malloc(MANIFEST_CHUNK_SIZE);
+    manifest_parser_t *parser = calloc(1, sizeof(manifest_parser_t));
+    if (!chunk || !parser) {
+        free(chunk);
+        free(parser);
+        fclose(f);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    manifest_lock();
+    
+    int64_t start_us = esp_timer_get_time();
+    s_video_count = 0;
+    s_head = 0;
+    s_records = s_record_base;
+    s_generation++;
+    manifest_clear_strings();
+    manifest_clear_refs();
+    
+    size_t bytes_read;
+    size_t total_bytes = 0;
+    while ((bytes_read = fread(chunk, 1, MANIFEST_CHUNK_SIZE, f)) > 0) {
+        parser_feed(parser, chunk, bytes_read);
+        total_bytes += bytes_read;
+        // Let the idle task feed the watchdog on very large manifests
+        if ((total_bytes % (64 * MANIFEST_CHUNK_SIZE)) == 0) {
+            vTaskDelay(1);
+        }
+    }
+    
+    bool complete = parser->depth == 0 && total_bytes > 0;
+    int skipped = parser->skipped;
+    fclose(f);
+    free(chunk);
+    free(parser);
+    
+    manifest_ensure_sorted();
+    // The card holds these rows; only the journal's removals are new
+    s_saved_changes = s_changes;
+    int replayed = manifest_replay_journal();
+    int ref_failed = 0;
+    for (int i = 0; i < s_video_count; i++) {
+        if ((s_records[i].flags & MANIFEST_FLAG_REFERENCE) && manifest_ref_add(&s_records[i]) != ESP_OK) {
+            ref_failed++;
+        }
+    }
+    int loaded_count = s_video_count;
+    
+    manifest_unlock();
+    
+    if (replayed > 0) {
+        ESP_LOGI(TAG, "Applied %d journal tombstones", replayed);
+    }
+    if (ref_failed > 0) {
+        ESP_LOGE(TAG, "No memory to index %d references; their files may expire early", ref_failed);
+    }
+    if (!complete) {
+        ESP_LOGW(TAG, "Manifest truncated after %zu bytes, kept %d entries", total_bytes, loaded_count);
+    }
+    if (skipped > 0) {
+        ESP_LOGW(TAG, "Skipped %d malformed manifest entries", skipped);
+    }
+    
+    int64_t elapsed_ms = (esp_timer_get_time() - start_us) / 1000;
+    ESP_LOGI(TAG, "Loaded %d video entries from manifest in %lld ms (%lld ms per 10k entries)",
+             loaded_count, (long long)elapsed_ms,
+             loaded_count ? (long long)(elapsed_ms * 10000) / loaded_count : 0LL);
+    
+    return (loaded_count > 0 || complete) ? ESP_OK : ESP_ERR_INVALID_RESPONSE;
 }
 
 int manifest_get_video_count(void)
@@ -184,33 +1264,306 @@ int manifest_get_video_count(void)
 
 esp_err_t manifest_get_video_entry(int index, video_entry_t *entry)
 {
-    if (!entry || index < 0 || index >= s_video_count) {
+    if (!entry) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    manifest_lock();
+    if (index < 0 || index >= s_video_count) {
+        manifest_unlock();
         return ESP_ERR_INVALID_ARG;
     }
     
-    memcpy(entry, &s_video_entries[index], sizeof(video_entry_t));
+    const manifest_record_t *record = &s_records[index];
+    memset(entry, 0, sizeof(*entry));
+    format_filename(record, entry->filename, sizeof(entry->filename));
+    format_path(record, entry->full_path, sizeof(entry->full_path));
+    entry->timestamp = record->timestamp;
+    entry->file_size = record->file_size;
+    entry->duration_ms = manifest_record_get_duration_ms(record);
+    entry->reference = (record->flags & MANIFEST_FLAG_REFERENCE) != 0;
+    entry->has_luma = (record->flags & MANIFEST_FLAG_LUMA) != 0;
+    entry->has_align = (record->flags & MANIFEST_FLAG_ALIGN) != 0;
+    entry->has_audio = manifest_record_get_audio(record, &entry->audio) == ESP_OK;
+    if (!entry->has_audio) {
+        entry->luma = record->luma;
+        entry->align = record->align;
+    }
+    manifest_unlock();
     return ESP_OK;
 }
 
+typedef struct {
+    uint32_t timestamp;
+    bool reference;
+    char path[sizeof(((video_entry_t *)0)->full_path)];
+} cleanup_item_t;
+
+// Reference rows name the file they repeat, and that file stays on the card
+// until the last of them has expired as well. Audio rows are stamped with
+// their first sample, so they and other captures can sort between a file
+// and its references: the reference table gives each file's latest.
+// Returns how many of the first count rows can go.
+static int manifest_unreferenced_prefix(int count, time_t cutoff)
+{
+    for (int j = 0; j < count; j++) {
+        const manifest_record_t *kept = &s_records[j];
+        if (kept->flags & MANIFEST_FLAG_REFERENCE) {
+            continue;
+        }
+        const manifest_ref_t *ref = manifest_ref_find(kept);
+        if (ref && (time_t)ref->latest >= cutoff) {
+            return j;
+        }
+    }
+    return count;
+}
+
+// One bounded slice: snapshot a batch of expired head rows under the lock,
+// delete their files unlocked, then tombstone and retire what was deleted.
+// Returns the number of rows retired, or -1 on a storage error.
+static int manifest_cleanup_slice(time_t cutoff, cleanup_item_t *batch)
+{
+    manifest_lock();
+    int batch_count = 0;
+    while (batch_count < CLEANUP_BATCH_SIZE && batch_count < s_video_count &&
+           (time_t)s_records[batch_count].timestamp < cutoff) {
+        batch_count++;
+    }
+    batch_count = manifest_unreferenced_prefix(batch_count, cutoff);
+    for (int i = 0; i < batch_count; i++) {
+        batch[i].timestamp = s_records[i].timestamp;
+        batch[i].reference = (s_records[i].flags & MANIFEST_FLAG_REFERENCE) != 0;
+        format_path(&s_records[i], batch[i].path, sizeof(batch[i].path));
+    }
+    manifest_unlock();
+    
+    if (batch_count == 0) {
+        return 0;
+    }
+    
+    int64_t deadline = esp_timer_get_time() + CLEANUP_SLICE_BUDGET_US;
+    int deleted = 0;
+    char file_path[sizeof(batch[0].path) + 16];
+    while (deleted < batch_count) {
+        if (batch[deleted].reference) {
+            // Nothing on the card; the file went with the row it repeats
+            deleted++;
+            continue;
+        }
+        snprintf(file_path, sizeof(file_path), "%s/%s", MANIFEST_DATA_DIR, batch[deleted].path);
+        esp_err_t ret = sdcard_module_delete_file(file_path);
+        if (ret != ESP_OK && ret != ESP_ERR_NOT_FOUND) {
+            break;
+        }
+        deleted++;
+        if (esp_timer_get_time() > deadline) {
+            break;
+        }
+    }
+    
+    if (deleted == 0) {
+        return -1;
+    }
+    
+    // Tombstones and the rows they retire change together under the I/O
+    // lock, so a save sees either both or neither; the manifest lock is
+    // only taken to retire the rows
+    xSemaphoreTake(s_io_lock, portMAX_DELAY);
+    FILE *journal = sdcard_module_open_file(MANIFEST_JOURNAL_FILE, "a");
+    if (journal) {
+        for (int i = 0; i < deleted; i++) {
+            fprintf(journal, "D %lu %s\n", (unsigned long)batch[i].timestamp, batch[i].path);
+        }
+        fclose(journal);
+    } else {
+        ESP_LOGW(TAG, "Failed to append cleanup tombstones");
+    }
+    
+    manifest_lock();
+    int retired = 0;
+    for (int i = 0; i < deleted; i++) {
+        // Normally the batch is still the head; fall back to a search if an
+        // out-of-order insert landed in front of it meanwhile.
+        if (s_video_count > 0 && s_records[0].timestamp == batch[i].timestamp &&
+            manifest_record_matches(&s_records[0], batch[i].path)) {
+            manifest_ref_forget(&s_records[0]);
+            s_head++;
+            s_records++;
+            s_video_count--;
+            s_changes++;
+            retired++;
+        } else if (manifest_remove(batch[i].timestamp, batch[i].path)) {
+            retired++;
+        }
+    }
+    manifest_unlock();
+    xSemaphoreGive(s_io_lock);
+    
+    return retired;
+}
+
+static void manifest_cleanup_task(void *pvParameters)
+{
+    cleanup_item_t *batch = malloc(CLEANUP_BATCH_SIZE * sizeof(cleanup_item_t));
+    if (!batch) {
+        ESP_LOGE(TAG, "Failed to allocate cleanup batch");
+        s_cleanup_task = NULL;
+        vTaskDelete(NULL);
+        return;
+    }
+    
+    while (1) {
+        time_t now;
+        time(&now);
+        time_t cutoff = now - ((time_t)s_retention_days * 24 * 60 * 60);
+        
+        int total = 0;
+        int64_t start_us = esp_timer_get_time();
+        int retired;
+        while ((retired = manifest_cleanup_slice(cutoff, batch)) > 0) {
+            total += retired;
+            vTaskDelay(pdMS_TO_TICKS(CLEANUP_SLICE_PAUSE_MS));
+        }
+        
+        if (total > 0) {
+            ESP_LOGI(TAG, "Cleanup removed %d expired entries in %lld ms, %d remaining",
+                     total, (long long)((esp_timer_get_time() - start_us) / 1000), s_video_count);
+        }
+        if (retired < 0) {
+            ESP_LOGW(TAG, "Cleanup paused after a storage error");
+        }
+        
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CLEANUP_RECHECK_MS));
+    }
+}
+
 esp_err_t manifest_cleanup_old_entries(int max_days)
 {
-    time_t now;
-    time(&now);
-    time_t cutoff = now - (max_days * 24 * 60 * 60);
+    if (max_days < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    int new_count = 0;
-    for (int i = 0; i < s_video_count; i++) {
-        if (s_video_entries[i].timestamp >= cutoff) {
-            if (new_count != i) {
-                memcpy(&s_video_entries[new_count], &s_video_entries[i], sizeof(video_entry_t));
+    s_retention_days = max_days;
+    
+    if (s_cleanup_task) {
+        xTaskNotifyGive(s_cleanup_task);
+        return ESP_OK;
+    }
+    
+    if (xTaskCreate(manifest_cleanup_task, "manifest_cleanup", CLEANUP_TASK_STACK, NULL,
+                    CLEANUP_TASK_PRIORITY, &s_cleanup_task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to start manifest cleanup task");
+        s_cleanup_task = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    
+    ESP_LOGI(TAG, "Manifest cleanup running in background, retention %d days", max_days);
+    return ESP_OK;
+}
+
+// Brings the iterator's span up to date under the lock: rows may have been
+// retired, inserted or moved since it was last used. After a move the
+// position is found again from the last row handed out.
+static void manifest_iter_sync(manifest_iter_t *iter)
+{
+    if (iter->generation != s_generation) {
+        iter->first = s_head + manifest_lower_bound(iter->start);
+        iter->last = s_head + manifest_lower_bound(iter->end);
+        iter->position = iter->first;
+        if (iter->returned > 0) {
+            iter->position = s_head + manifest_lower_bound(iter->timestamp);
+            for (int same = iter->same; same > 0 && iter->position < iter->last &&
+                 s_record_base[iter->position].timestamp == iter->timestamp; same--) {
+                iter->position++;
             }
-            new_count++;
-        } else {
-            ESP_LOGI(TAG, "Removing old entry: %s", s_video_entries[i].full_path);
         }
+        iter->generation = s_generation;
+        return;
+    }
+    // Rows the cleanup job retired since are skipped
+    if (iter->first < s_head) {
+        iter->first = s_head;
+    }
+    if (iter->position < s_head) {
+        iter->position = s_head;
+    }
+    iter->last = s_head + manifest_lower_bound(iter->end);
+}
+
+// Copies the row at the iterator's position and moves past it
+static void manifest_iter_take(manifest_iter_t *iter, manifest_record_t *record)
+{
+    *record = s_record_base[iter->position++];
+    iter->same = (iter->returned > 0 && record->timestamp == iter->timestamp) ? iter->same + 1 : 1;
+    iter->timestamp = record->timestamp;
+    iter->returned++;
+}
+
+esp_err_t manifest_query_range(time_t start, time_t end, manifest_iter_t *iter)
+{
+    if (!iter || end < start) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    memset(iter, 0, sizeof(*iter));
+    iter->start = start;
+    iter->end = end;
+    manifest_lock();
+    iter->generation = s_generation - 1;
+    manifest_iter_sync(iter);
+    int count = iter->last - iter->first;
+    manifest_unlock();
+    
+    return count > 0 ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+int manifest_iter_count(manifest_iter_t *iter)
+{
+    if (!iter) {
+        return 0;
     }
     
-    s_video_count = new_count;
-    ESP_LOGI(TAG, "Cleaned up manifest, %d entries remaining", s_video_count);
+    manifest_lock();
+    manifest_iter_sync(iter);
+    int count = iter->last - iter->first;
+    manifest_unlock();
+    return count;
+}
+
+esp_err_t manifest_iter_next(manifest_iter_t *iter, manifest_record_t *record)
+{
+    if (!iter || !record) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    manifest_lock();
+    manifest_iter_sync(iter);
+    if (iter->position >= iter->last) {
+        manifest_unlock();
+        return ESP_ERR_NOT_FOUND;
+    }
+    manifest_iter_take(iter, record);
+    manifest_unlock();
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+int manifest_iter_get_page(manifest_iter_t *iter, int offset, int limit, manifest_record_t *records)
+{
+    if (!iter || !records || offset < 0 || limit <= 0) {
+        return 0;
+    }
+    
+    manifest_lock();
+    manifest_iter_sync(iter);
+    int begin = iter->first + offset;
+    int count = begin < iter->last ? iter->last - begin : 0;
+    if (count > limit) {
+        count = limit;
+    }
+    if (count > 0) {
+        memcpy(records, &s_record_base[begin], count * sizeof(manifest_record_t));
+    }
+    manifest_unlock();
+    return count;
+}
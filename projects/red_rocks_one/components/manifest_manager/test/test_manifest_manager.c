@@ -0,0 +1,411 @@
+#include "unity.h"
+#include "manifest_manager.h"
+#include "sdcard_module.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <string.h>
+#include <stdio.h>
+
+// Runs on the linux target, where sdcard_module keeps the card in ./sdcard
+
+static void manifest_fresh(void)
+{
+    sdcard_config_t sd_config = {0};
+    if (!sdcard_module_is_mounted()) {
+        TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_init(&sd_config));
+    }
+    sdcard_module_create_dir("timelapse_data");
+    sdcard_module_delete_file("timelapse_data/manifest.json");
+    sdcard_module_delete_file("timelapse_data/manifest.journal");
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_init());
+    TEST_ASSERT_EQUAL(0, manifest_get_video_count());
+}
+
+TEST_CASE("records are 40 bytes", "[manifest]")
+{
+    TEST_ASSERT_EQUAL(40, sizeof(manifest_record_t));
+}
+
+TEST_CASE("names the apps write round-trip packed", "[manifest]")
+{
+    static const char *names[] = {
+        "clip_143052_0001.jpg", "clip_143052_0001_r2.jpg", "clip_0001_frame_029.jpg",
+        "clip_235959_12345_r10.jpg", "audio_143050_0001.wav", "audio_143050_s0012.wav",
+        "night_020000_0042.jpg", "video_0007.avi", "sound-0001.wav",
+    };
+    int count = sizeof(names) / sizeof(names[0]);
+    manifest_fresh();
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", names[i], 1000 + i, 3000));
+    }
+    
+    video_entry_t entry;
+    char path[128];
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_get_video_entry(i, &entry));
+        TEST_ASSERT_EQUAL_STRING(names[i], entry.filename);
+        snprintf(path, sizeof(path), "2024/01/15/%s", names[i]);
+        TEST_ASSERT_EQUAL_STRING(path, entry.full_path);
+    }
+}
+
+TEST_CASE("names the packing cannot hold keep their full path", "[manifest]")
+{
+    manifest_fresh();
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/07/01", "redrock_20240701_143052_005.jpg", 1, 0));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/07/01", "Clip_0001.JPG", 2, 0));
+    
+    video_entry_t entry;
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_get_video_entry(0, &entry));
+    TEST_ASSERT_EQUAL_STRING("redrock_20240701_143052_005.jpg", entry.filename);
+    TEST_ASSERT_EQUAL_STRING("2024/07/01/redrock_20240701_143052_005.jpg", entry.full_path);
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_get_video_entry(1, &entry));
+    TEST_ASSERT_EQUAL_STRING("2024/07/01/Clip_0001.JPG", entry.full_path);
+}
+
+TEST_CASE("long durations keep their length across a reload", "[manifest]")
+{
+    // A minute's segment, an hour's clip and a day, past what the row holds
+    static const int durations[] = { 3000, 60000, 655350, 700000, 3600000, 86400000 };
+    static const int expect[] = { 3000, 60000, 655350, 700000, 3600000, 65535000 };
+    int count = sizeof(durations) / sizeof(durations[0]);
+    char name[32];
+    manifest_fresh();
+    for (int i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "video_%04d.avi", i);
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", name, 1000, durations[i]));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    
+    video_entry_t entry;
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_get_video_entry(i, &entry));
+        TEST_ASSERT_EQUAL(expect[i], entry.duration_ms);
+    }
+}
+
+TEST_CASE("directories intern across a reload", "[manifest]")
+{
+    char dir[16];
+    char name[32];
+    manifest_fresh();
+    // A year of days, four captures each
+    for (int day = 0; day < 365; day++) {
+        snprintf(dir, sizeof(dir), "2024/%02d/%02d", day / 31 + 1, day % 31 + 1);
+        for (int i = 0; i < 4; i++) {
+            snprintf(name, sizeof(name), "clip_120000_%04d.jpg", day * 4 + i);
+            TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video(dir, name, 100, 3000));
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    TEST_ASSERT_EQUAL(365 * 4, manifest_get_video_count());
+    
+    video_entry_t entry;
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_get_video_entry(365 * 4 - 1, &entry));
+    TEST_ASSERT_EQUAL_STRING("2024/12/24/clip_120000_1459.jpg", entry.full_path);
+}
+
+// Audio rows a second apart from start; days back, the cleanup job expires them
+static void add_expired(int count, time_t start)
+{
+    char name[32];
+    manifest_audio_t audio = { .start_sample = 0 };
+    for (int i = 0; i < count; i++) {
+        snprintf(name, sizeof(name), "audio_000000_s%04d.wav", i);
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_add_audio("2024/01/01", name, 100, 1000, start + i, &audio));
+    }
+}
+
+static bool wait_for_count(int count)
+{
+    for (int i = 0; i < 500 && manifest_get_video_count() != count; i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return manifest_get_video_count() == count;
+}
+
+TEST_CASE("iterator carries on across cleanup and compaction", "[manifest]")
+{
+    time_t now = time(NULL);
+    char name[32];
+    manifest_fresh();
+    add_expired(64, now - 10 * 24 * 60 * 60);
+    for (int i = 0; i < 64; i++) {
+        snprintf(name, sizeof(name), "clip_120000_%04d.jpg", i);
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", name, 100, 3000));
+    }
+    
+    manifest_iter_t iter;
+    manifest_record_t record;
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_query_range(0, now + 3600, &iter));
+    TEST_ASSERT_EQUAL(128, manifest_iter_count(&iter));
+    for (int i = 0; i < 40; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_iter_next(&iter, &record));
+    }
+    
+    // Retires the expired head, then the next add compacts the rest down
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_cleanup_old_entries(1));
+    TEST_ASSERT_TRUE(wait_for_count(64));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", "clip_120001_0064.jpg", 100, 3000));
+    
+    int seen = 0;
+    while (manifest_iter_next(&iter, &record) == ESP_OK) {
+        TEST_ASSERT_GREATER_OR_EQUAL(now, record.timestamp);
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_record_get_filename(&record, name, sizeof(name)));
+        TEST_ASSERT_EQUAL(0, strncmp(name, "clip_", 5));
+        seen++;
+    }
+    TEST_ASSERT_EQUAL(65, seen);
+}
+
+TEST_CASE("iterator resumes after the last row returned when rows move", "[manifest]")
+{
+    // Ahead of the clock, so a cleanup job left running cannot touch them
+    time_t start = time(NULL) + 3600;
+    manifest_fresh();
+    add_expired(100, start);
+    
+    manifest_iter_t iter;
+    manifest_record_t record;
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_query_range(start, start + 100, &iter));
+    for (int i = 0; i < 50; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_iter_next(&iter, &record));
+    }
+    // Lands in front of the iterator and shifts every row after it
+    manifest_audio_t audio = { .start_sample = 0 };
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_audio("2024/01/01", "audio_early.wav", 1, 1, start + 10, &audio));
+    
+    time_t expect = start + 50;
+    while (manifest_iter_next(&iter, &record) == ESP_OK) {
+        TEST_ASSERT_EQUAL(expect++, record.timestamp);
+    }
+    TEST_ASSERT_EQUAL(start + 100, expect);
+}
+
+// A row every 10 s for 100k rows, about 11.5 days; ahead of the clock,
+// out of the cleanup job's reach
+static time_t add_100k(void)
+{
+    char dir[16];
+    char name[32];
+    manifest_audio_t audio = { .start_sample = 0 };
+    time_t start = time(NULL) + 3600;
+    esp_log_level_set("manifest", ESP_LOG_WARN);
+    for (int i = 0; i < 100000; i++) {
+        time_t t = start + i * 10;
+        struct tm tm;
+        gmtime_r(&t, &tm);
+        strftime(dir, sizeof(dir), "%Y/%m/%d", &tm);
+        snprintf(name, sizeof(name), "clip_%02d%02d%02d_%04d.jpg", tm.tm_hour, tm.tm_min, tm.tm_sec, i % 10000);
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_add_audio(dir, name, 25000, 3000, t, &audio));
+    }
+    esp_log_level_set("manifest", ESP_LOG_INFO);
+    return start;
+}
+
+TEST_CASE("hour queries at 100k entries", "[manifest][perf]")
+{
+    manifest_fresh();
+    time_t start = add_100k();
+    TEST_ASSERT_EQUAL(100000, manifest_get_video_count());
+    
+    manifest_iter_t iter;
+    manifest_record_t page[16];
+    int64_t query_us = 0;
+    int64_t read_us = 0;
+    int rows = 0;
+    srand(1);
+    for (int q = 0; q < 1000; q++) {
+        time_t from = start + (rand() % 99000) * 10;
+        int64_t t0 = esp_timer_get_time();
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_query_range(from, from + 3600, &iter));
+        int64_t t1 = esp_timer_get_time();
+        int count;
+        for (int offset = 0; (count = manifest_iter_get_page(&iter, offset, 16, page)) > 0; offset += count) {
+            rows += count;
+        }
+        read_us += esp_timer_get_time() - t1;
+        query_us += t1 - t0;
+    }
+    TEST_ASSERT_EQUAL(1000 * 360, rows);
+    printf("Query avg %.2f us, paging 360 rows avg %.1f us\n", query_us / 1000.0, read_us / 1000.0);
+}
+
+TEST_CASE("load time at 100k entries", "[manifest][perf]")
+{
+    manifest_fresh();
+    add_100k();
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    
+    int64_t t0 = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    int64_t load_us = esp_timer_get_time() - t0;
+    TEST_ASSERT_EQUAL(100000, manifest_get_video_count());
+    printf("Loaded 100k entries in %lld ms, %lld ms per 10k\n", (long long)(load_us / 1000),
+           (long long)(load_us / 10000));
+}
+
+static bool card_has(const char *path)
+{
+    FILE *f = sdcard_module_open_file(path, "r");
+    if (f) {
+        fclose(f);
+    }
+    return f != NULL;
+}
+
+TEST_CASE("cleanup keeps files referenced since the load", "[manifest]")
+{
+    // Twenty expired frames, each repeated once the next second
+    time_t old = time(NULL) - 10 * 24 * 60 * 60;
+    char json[8192];
+    int len = snprintf(json, sizeof(json), "{\"version\": 2, \"total_count\": 40, \"videos\": [\n");
+    char path[64];
+    manifest_fresh();
+    sdcard_module_create_dir("timelapse_data/2024/01/01");
+    for (int i = 0; i < 20; i++) {
+        snprintf(path, sizeof(path), "timelapse_data/2024/01/01/clip_000000_%04d.jpg", i);
+        TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_write_file(path, "x", 1));
+        len += snprintf(json + len, sizeof(json) - len,
+                        "{\"filename\": \"clip_000000_%04d.jpg\", \"path\": \"2024/01/01/clip_000000_%04d.jpg\", \"timestamp\": %lld, \"size\": 100, \"duration_ms\": 3000},\n"
+                        "{\"filename\": \"clip_000000_%04d.jpg\", \"path\": \"2024/01/01/clip_000000_%04d.jpg\", \"timestamp\": %lld, \"size\": 0, \"duration_ms\": 3000, \"ref\": 1}%s\n",
+                        i, i, (long long)(old + 2 * i), i, i, (long long)(old + 2 * i + 1), i < 19 ? "," : "");
+    }
+    snprintf(json + len, sizeof(json) - len, "]}\n");
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_write_file("timelapse_data/manifest.json", json, strlen(json)));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    TEST_ASSERT_EQUAL(40, manifest_get_video_count());
+    
+    // Frame 12 repeats today, so it and every row after it stay
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_reference("2024/01/01", "clip_000000_0012.jpg", 3000));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_cleanup_old_entries(1));
+    TEST_ASSERT_TRUE(wait_for_count(41 - 24));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ASSERT_EQUAL(41 - 24, manifest_get_video_count());
+    TEST_ASSERT_FALSE(card_has("timelapse_data/2024/01/01/clip_000000_0011.jpg"));
+    TEST_ASSERT_TRUE(card_has("timelapse_data/2024/01/01/clip_000000_0012.jpg"));
+    
+    // A reload indexes the references again from the rows
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_cleanup_old_entries(1));
+    vTaskDelay(pdMS_TO_TICKS(200));
+    TEST_ASSERT_EQUAL(41 - 24, manifest_get_video_count());
+    TEST_ASSERT_TRUE(card_has("timelapse_data/2024/01/01/clip_000000_0012.jpg"));
+}
+
+static void save_task(void *arg)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    xSemaphoreGive((SemaphoreHandle_t)arg);
+    vTaskDelete(NULL);
+}
+
+TEST_CASE("adds carry on while a save writes the card", "[manifest]")
+{
+    manifest_fresh();
+    add_100k();
+    SemaphoreHandle_t done = xSemaphoreCreateBinary();
+    int64_t start = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(save_task, "save", 4096, done, 5, NULL));
+    
+    // Stamped now, so they land before the rows ahead of the clock and shift them
+    char name[32];
+    int64_t add_max_us = 0;
+    int adds = 0;
+    while (xSemaphoreTake(done, 0) != pdTRUE) {
+        snprintf(name, sizeof(name), "clip_120000_%04d.jpg", adds++);
+        int64_t t0 = esp_timer_get_time();
+        TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", name, 100, 3000));
+        int64_t add_us = esp_timer_get_time() - t0;
+        if (add_us > add_max_us) {
+            add_max_us = add_us;
+        }
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    int64_t save_us = esp_timer_get_time() - start;
+    printf("Save of 100k rows took %lld ms, %d adds meanwhile, slowest %lld us\n",
+           (long long)(save_us / 1000), adds, (long long)add_max_us);
+    TEST_ASSERT_GREATER_THAN(10, adds);
+    TEST_ASSERT_LESS_THAN(save_us / 10, add_max_us);
+    vSemaphoreDelete(done);
+    
+    // Rows the first save missed leave the manifest dirty for the next
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    TEST_ASSERT_EQUAL(100000 + adds, manifest_get_video_count());
+}
+
+TEST_CASE("saves skip the card when nothing changed", "[manifest]")
+{
+    manifest_fresh();
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", "clip_120000_0001.jpg", 100, 3000));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_if_due(60000));
+    TEST_ASSERT_TRUE(card_has("timelapse_data/manifest.json"));
+    
+    sdcard_module_delete_file("timelapse_data/manifest.json");
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_to_sd());
+    TEST_ASSERT_FALSE(card_has("timelapse_data/manifest.json"));
+    
+    // Changed, but saved too recently
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_add_video("2024/01/15", "clip_120000_0002.jpg", 100, 3000));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_if_due(60000));
+    TEST_ASSERT_FALSE(card_has("timelapse_data/manifest.json"));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_save_if_due(0));
+    TEST_ASSERT_TRUE(card_has("timelapse_data/manifest.json"));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    TEST_ASSERT_EQUAL(2, manifest_get_video_count());
+}
+
+TEST_CASE("cleanup keeps a file referenced past an audio row", "[manifest]")
+{
+    // Audio rows are stamped with their first sample, so one can sort between a
+    // stored frame and the references to it
+    static const char *files[] = {
+        "timelapse_data/2024/01/01/clip_000000_0001.jpg",
+        "timelapse_data/2024/01/01/audio_000000_0001.wav",
+        "timelapse_data/2024/01/01/clip_000000_0002.jpg",
+        "timelapse_data/2024/01/01/audio_000000_0002.wav",
+    };
+    time_t old = time(NULL) - 10 * 24 * 60 * 60;
+    char json[1024];
+    snprintf(json, sizeof(json),
+             "{\"version\": 2, \"total_count\": 6, \"videos\": [\n"
+             "{\"filename\": \"clip_000000_0001.jpg\", \"path\": \"2024/01/01/clip_000000_0001.jpg\", \"timestamp\": %lld, \"size\": 100, \"duration_ms\": 3000},\n"
+             "{\"filename\": \"audio_000000_0001.wav\", \"path\": \"2024/01/01/audio_000000_0001.wav\", \"timestamp\": %lld, \"size\": 100, \"duration_ms\": 10000, \"start_sample\": 0, \"start_ms\": 0},\n"
+             "{\"filename\": \"clip_000000_0001.jpg\", \"path\": \"2024/01/01/clip_000000_0001.jpg\", \"timestamp\": %lld, \"size\": 0, \"duration_ms\": 3000, \"ref\": 1},\n"
+             "{\"filename\": \"clip_000000_0002.jpg\", \"path\": \"2024/01/01/clip_000000_0002.jpg\", \"timestamp\": %lld, \"size\": 100, \"duration_ms\": 3000},\n"
+             "{\"filename\": \"audio_000000_0002.wav\", \"path\": \"2024/01/01/audio_000000_0002.wav\", \"timestamp\": %lld, \"size\": 100, \"duration_ms\": 10000, \"start_sample\": 160000, \"start_ms\": 0},\n"
+             "{\"filename\": \"clip_000000_0002.jpg\", \"path\": \"2024/01/01/clip_000000_0002.jpg\", \"timestamp\": %lld, \"size\": 0, \"duration_ms\": 3000, \"ref\": 1}\n"
+             "]}\n",
+             (long long)old, (long long)old + 1, (long long)old + 2, (long long)old + 3, (long long)old + 4,
+             (long long)time(NULL));
+    manifest_fresh();
+    sdcard_module_create_dir("timelapse_data/2024/01/01");
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_write_file(files[i], "x", 1));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_write_file("timelapse_data/manifest.json", json, strlen(json)));
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_load_from_sd());
+    TEST_ASSERT_EQUAL(6, manifest_get_video_count());
+    
+    // The first frame's references have all expired; the second's last has not
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_cleanup_old_entries(1));
+    TEST_ASSERT_TRUE(wait_for_count(3));
+    vTaskDelay(pdMS_TO_TICKS(100));
+    TEST_ASSERT_EQUAL(3, manifest_get_video_count());
+    TEST_ASSERT_FALSE(card_has(files[0]));
+    TEST_ASSERT_FALSE(card_has(files[1]));
+    TEST_ASSERT_TRUE(card_has(files[2]));
+    TEST_ASSERT_TRUE(card_has(files[3]));
+    
+    video_entry_t entry;
+    TEST_ASSERT_EQUAL(ESP_OK, manifest_get_video_entry(0, &entry));
+    TEST_ASSERT_EQUAL_STRING("clip_000000_0002.jpg", entry.filename);
+    TEST_ASSERT_FALSE(entry.reference);
+}
\ No newline at end of file
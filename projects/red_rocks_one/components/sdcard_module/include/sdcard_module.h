@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -17,6 +18,15 @@ typedef struct {
     int max_files;
 } sdcard_config_t;
 
+// Per write call, open and close included, since the last latency reset
+typedef struct {
+    uint32_t bytes_per_sec;     // sdcard_module_get_write_throughput()
+    uint32_t writes;
+    uint32_t latency_avg_us;    // over the throughput window
+    uint32_t latency_p95_us;    // rounded up to a power of two
+    uint32_t latency_max_us;
+} sdcard_write_stats_t;
+
 esp_err_t sdcard_module_init(const sdcard_config_t *config);
 
 esp_err_t sdcard_module_deinit(void);
@@ -29,10 +39,26 @@ esp_err_t sdcard_module_read_file(const char *path, void *buffer, size_t *size);
 
 esp_err_t sdcard_module_delete_file(const char *path);
 
+esp_err_t sdcard_module_rename_file(const char *from, const char *to);
+
+FILE *sdcard_module_open_file(const char *path, const char *mode);
+
 esp_err_t sdcard_module_create_dir(const char *path);
 
 esp_err_t sdcard_module_get_free_space(uint64_t *free_bytes, uint64_t *total_bytes);
 
+// Bytes per second achieved by recent writes, 0 until something was written
+uint32_t sdcard_module_get_write_throughput(void);
+
+esp_err_t sdcard_module_get_write_stats(sdcard_write_stats_t *stats);
+
+// Starts a new latency distribution; throughput keeps its window
+void sdcard_module_reset_write_latency(void);
+
+// Identifies the inserted card from its CID register (manufacturer, OEM,
+// name, revision, serial, date)
+esp_err_t sdcard_module_get_card_id(char *id, size_t len);
+
 bool sdcard_module_is_mounted(void);
 
 esp_err_t sdcard_module_save_jpeg(const uint8_t *data, size_t size, const char *filename);
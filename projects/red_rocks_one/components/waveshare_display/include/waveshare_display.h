@@ -114,6 +114,20 @@ esp_err_t waveshare_display_draw_qr(uint16_t x, uint16_t y,
                                    const uint8_t* qr_data, 
                                    uint8_t size);
 
+/**
+ * @brief Draw an RGB565 bitmap
+ * 
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param width Bitmap width in pixels
+ * @param height Bitmap height in pixels
+ * @param pixels width * height RGB565 values, row-major
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t waveshare_display_draw_bitmap(uint16_t x, uint16_t y, 
+                                       uint16_t width, uint16_t height, 
+                                       const uint16_t* pixels);
+
 /**
  * @brief Draw button with text
  * 
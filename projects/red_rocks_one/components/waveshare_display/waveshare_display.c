@@ -215,6 +215,24 @@ esp_err_t waveshare_display_draw_qr(uint16_t x, uint16_t y,
     return waveshare_display_fill_rect(&qr_rect, COLOR_WHITE);
 }
 
+esp_err_t waveshare_display_draw_bitmap(uint16_t x, uint16_t y, 
+                                       uint16_t width, uint16_t height, 
+                                       const uint16_t* pixels) {
+    if (!is_initialized || !lcd_panel || !pixels) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Clip to the panel; rows are contiguous so only the height can be cut
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || x + width > DISPLAY_WIDTH) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (y + height > DISPLAY_HEIGHT) {
+        height = DISPLAY_HEIGHT - y;
+    }
+    
+    return esp_lcd_panel_draw_bitmap(lcd_panel, x, y, x + width, y + height, pixels);
+}
+
 esp_err_t waveshare_display_draw_button(const display_rect_t* rect, 
                                        const char* text, 
                                        bool pressed) {
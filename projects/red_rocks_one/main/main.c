@@ -10,6 +10,9 @@
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "nvs_flash.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "img_converters.h"
 
 // Red Rocks components
 #include "camera_module.h"
@@ -17,6 +20,7 @@
 #include "time_sync.h"
 #include "qr_generator.h"
 #include "waveshare_display.h"
+#include "jpeg_scan.h"
 
 static const char *TAG = "red_rocks_photobooth";
 
@@ -29,6 +33,13 @@ static const char *TAG = "red_rocks_photobooth";
 #define WIFI_PASSWORD      "Concert2024"
 #define HTTP_SERVER_PORT   80
 
+// Previews and gallery thumbnails come from the JPEG's DC terms (1/8 scale,
+// 200x150 for UXGA) without a full decode
+#define THUMB_SCALE        JPEG_SCAN_SCALE_1_8
+#define THUMB_MAX_WIDTH    (DISPLAY_WIDTH - 40)
+#define THUMB_MAX_HEIGHT   (UI_BUTTON_HEIGHT + UI_QR_HEIGHT)
+#define THUMB_JPEG_QUALITY 80
+
 // UI state machine
 typedef enum {
     STATE_IDLE,
@@ -55,6 +66,10 @@ static photobooth_context_t g_photobooth = {
 static httpd_handle_t g_server = NULL;
 static QueueHandle_t ui_queue = NULL;
 
+static uint16_t *g_preview = NULL;
+static uint16_t g_preview_w = 0;
+static uint16_t g_preview_h = 0;
+
 // HTTP server for photo downloads
 static esp_err_t photo_download_handler(httpd_req_t *req) {
     // Extract filename from URL path
@@ -96,10 +111,46 @@ static esp_err_t photo_download_handler(httpd_req_t *req) {
     }
 }
 
+// Gallery thumbnails are small, but stream them anyway to keep the stack flat
+static esp_err_t thumb_download_handler(httpd_req_t *req) {
+    const char* filename_start = strrchr(req->uri, '/');
+    if (!filename_start || strstr(filename_start, "..")) {
+        httpd_resp_send_404(req);
+        return ESP_FAIL;
+    }
+    filename_start++;
+    
+    char filepath[128];
+    snprintf(filepath, sizeof(filepath), "/photos/thumbs/%s", filename_start);
+    
+    FILE *f = sdcard_module_open_file(filepath, "rb");
+    if (!f) {
+        httpd_resp_send_404(req);
+        return ESP_FAIL;
+    }
+    
+    httpd_resp_set_type(req, "image/jpeg");
+    httpd_resp_set_hdr(req, "Cache-Control", "max-age=3600");
+    
+    char chunk[1024];
+    size_t n;
+    esp_err_t ret = ESP_OK;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0 && ret == ESP_OK) {
+        ret = httpd_resp_send_chunk(req, chunk, n);
+    }
+    fclose(f);
+    
+    if (ret == ESP_OK) {
+        ret = httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return ret;
+}
+
 static esp_err_t setup_http_server(void) {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = HTTP_SERVER_PORT;
     config.max_open_sockets = 10;
+    config.uri_match_fn = httpd_uri_match_wildcard;
     
     if (httpd_start(&g_server, &config) == ESP_OK) {
         // Register photo download handler
@@ -111,6 +162,14 @@ static esp_err_t setup_http_server(void) {
         };
         httpd_register_uri_handler(g_server, &photo_uri);
         
+        httpd_uri_t thumb_uri = {
+            .uri = "/thumb/*",
+            .method = HTTP_GET,
+            .handler = thumb_download_handler,
+            .user_ctx = NULL
+        };
+        httpd_register_uri_handler(g_server, &thumb_uri);
+        
         ESP_LOGI(TAG, "HTTP server started on port %d", HTTP_SERVER_PORT);
         return ESP_OK;
     }
@@ -152,6 +211,68 @@ static esp_err_t setup_wifi_hotspot(void) {
     return ESP_OK;
 }
 
+// Builds the on-screen preview and the gallery thumbnail from the frame
+// while it is still in memory. The preview stays in native RGB565 for the
+// panel; the JPEG encoder wants camera byte order, so swap around it.
+static void make_thumbnail(const camera_fb_t *fb, const char *filename) {
+    int64_t start = esp_timer_get_time();
+    
+    jpeg_scan_info_t info;
+    if (jpeg_scan_get_info(fb->buf, fb->len, &info) != ESP_OK) {
+        ESP_LOGW(TAG, "Photo is not a baseline JPEG, no thumbnail");
+        return;
+    }
+    
+    uint16_t w, h;
+    jpeg_scan_thumbnail_dims(&info, THUMB_SCALE, &w, &h);
+    if (w > THUMB_MAX_WIDTH || h > THUMB_MAX_HEIGHT) {
+        ESP_LOGW(TAG, "Thumbnail %dx%d does not fit the preview area", w, h);
+        return;
+    }
+    
+    size_t size = (size_t)w * h * sizeof(uint16_t);
+    if (!g_preview) {
+        g_preview = heap_caps_malloc((size_t)THUMB_MAX_WIDTH * THUMB_MAX_HEIGHT * sizeof(uint16_t), MALLOC_CAP_SPIRAM);
+        if (!g_preview) {
+            ESP_LOGE(TAG, "Failed to allocate preview buffer");
+            return;
+        }
+    }
+    
+    g_preview_w = 0;
+    esp_err_t ret = jpeg_scan_thumbnail_to_buffer(fb->buf, fb->len, THUMB_SCALE, JPEG_SCAN_PIXEL_RGB565,
+                                                  (uint8_t *)g_preview, size, &w, &h);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Thumbnail decode failed: %s", esp_err_to_name(ret));
+        return;
+    }
+    int64_t decoded = esp_timer_get_time();
+    
+    for (size_t i = 0; i < (size_t)w * h; i++) {
+        g_preview[i] = __builtin_bswap16(g_preview[i]);
+    }
+    uint8_t *jpg = NULL;
+    size_t jpg_len = 0;
+    bool encoded = fmt2jpg((uint8_t *)g_preview, size, w, h, PIXFORMAT_RGB565, THUMB_JPEG_QUALITY, &jpg, &jpg_len);
+    for (size_t i = 0; i < (size_t)w * h; i++) {
+        g_preview[i] = __builtin_bswap16(g_preview[i]);
+    }
+    g_preview_w = w;
+    g_preview_h = h;
+    
+    if (encoded) {
+        char thumbpath[128];
+        snprintf(thumbpath, sizeof(thumbpath), "/photos/thumbs/%s", filename);
+        if (sdcard_module_write_file(thumbpath, jpg, jpg_len) != ESP_OK) {
+            ESP_LOGW(TAG, "Failed to save thumbnail: %s", thumbpath);
+        }
+        free(jpg);
+    }
+    
+    ESP_LOGI(TAG, "Thumbnail %dx%d: decode %lld ms, total %lld ms", w, h,
+             (long long)(decoded - start) / 1000, (long long)(esp_timer_get_time() - start) / 1000);
+}
+
 static esp_err_t take_photo(void) {
     ESP_LOGI(TAG, "Taking photo...");
     
@@ -177,6 +298,9 @@ static esp_err_t take_photo(void) {
     snprintf(filepath, sizeof(filepath), "/photos/%s", g_photobooth.current_photo_filename);
     
     esp_err_t ret = sdcard_module_write_file(filepath, fb->buf, fb->len);
+    if (ret == ESP_OK) {
+        make_thumbnail(fb, g_photobooth.current_photo_filename);
+    }
     
     // Return frame buffer
     esp_camera_fb_return(fb);
@@ -224,8 +348,14 @@ static void update_display(void) {
         case STATE_PROCESSING:
             waveshare_display_fill(COLOR_BLACK);
             waveshare_display_draw_header();
-            waveshare_display_draw_capture_button(false);
-            waveshare_display_draw_qr_area(NULL);
+            if (g_preview_w > 0) {
+                // Show the shot where the button and QR area normally sit
+                waveshare_display_draw_bitmap((DISPLAY_WIDTH - g_preview_w) / 2, UI_HEADER_HEIGHT,
+                                              g_preview_w, g_preview_h, g_preview);
+            } else {
+                waveshare_display_draw_capture_button(false);
+                waveshare_display_draw_qr_area(NULL);
+            }
             waveshare_display_draw_footer("Creating your QR code...");
             break;
             
@@ -397,6 +527,7 @@ void app_main(void) {
     
     // Create photos directory
     sdcard_module_create_directory("/photos");
+    sdcard_module_create_dir("/photos/thumbs");
     
     // Initialize QR generator
     ESP_LOGI(TAG, "Initializing QR generator...");
@@ -0,0 +1,854 @@
+#include "esp_camera.h"
+#include "camera_sim.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+static const char *TAG = "camera_sim";
+
+#define SIM_MAX_FB          8
+#define SIM_TASK_STACK      4096
+#define SIM_TASK_PRIO       10
+#define SIM_GET_TIMEOUT_MS  4000    // esp32-camera gives up after the same time
+#define SIM_STOP_TIMEOUT_MS 1000
+
+#ifdef CONFIG_CAMERA_SIM_LOOP
+#define SIM_LOOP_DEFAULT    true
+#else
+#define SIM_LOOP_DEFAULT    false
+#endif
+
+typedef enum {
+    BUF_FREE,
+    BUF_WRITING,
+    BUF_READY,
+    BUF_TAKEN,
+} sim_buffer_state_t;
+
+typedef struct {
+    camera_fb_t fb;
+    size_t capacity;
+    sim_buffer_state_t state;
+    uint32_t sequence;
+} sim_buffer_t;
+
+static const struct {
+    uint16_t width;
+    uint16_t height;
+} s_resolution[FRAMESIZE_INVALID] = {
+    {96, 96}, {160, 120}, {176, 144}, {240, 176}, {240, 240}, {320, 240}, {400, 296},
+    {480, 320}, {640, 480}, {800, 600}, {1024, 768}, {1280, 720}, {1280, 1024}, {1600, 1200},
+};
+
+static camera_sim_config_t s_sim_config = {
+    .loop = SIM_LOOP_DEFAULT,
+    .fps = CONFIG_CAMERA_SIM_FPS,
+    .entropy = CONFIG_CAMERA_SIM_ENTROPY,
+    .seed = 1,
+};
+static char s_source_dir[256] = CONFIG_CAMERA_SIM_SOURCE_DIR;
+
+static camera_config_t s_config;
+static bool s_initialized = false;
+static sim_buffer_t s_buffers[SIM_MAX_FB];
+static int s_fb_count = 0;
+static uint16_t s_width = 0;
+static uint16_t s_height = 0;
+static int64_t s_period_us = 0;
+static uint32_t s_sequence = 0;
+
+static SemaphoreHandle_t s_lock = NULL;
+static SemaphoreHandle_t s_frame_ready = NULL;
+static SemaphoreHandle_t s_sensor_stopped = NULL;
+static TaskHandle_t s_sensor_task = NULL;
+static volatile bool s_running = false;
+
+static char **s_files = NULL;
+static int s_file_count = 0;
+static int s_file_index = 0;
+
+static int s_quality = 12;
+static int s_brightness = 0;
+static uint32_t s_rng = 1;
+
+static sensor_t s_sensor;
+static camera_sim_stats_t s_stats;
+static uint64_t s_produce_sum_us = 0;
+
+// ---------------------------------------------------------------------------
+// Synthetic JPEG: baseline, YCbCr 4:2:2 like the OV2640, every component on
+// the Annex K luminance Huffman tables. Coefficients are generated already
+// quantised, so there is no DCT on the way out.
+
+static const uint8_t s_dc_bits[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+static const uint8_t s_dc_vals[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+static const uint8_t s_ac_bits[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d};
+static const uint8_t s_ac_vals[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+typedef struct {
+    uint16_t code[256];
+    uint8_t len[256];
+} huff_table_t;
+
+static huff_table_t s_dc_huff;
+static huff_table_t s_ac_huff;
+
+typedef struct {
+    uint8_t *out;
+    size_t pos;
+    size_t cap;
+    uint32_t acc;
+    int nbits;
+} bit_writer_t;
+
+static uint32_t sim_rand(void)
+{
+    // xorshift32
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static void build_huff(huff_table_t *table, const uint8_t *bits, const uint8_t *vals)
+{
+    uint16_t code = 0;
+    int k = 0;
+    for (int len = 1; len <= 16; len++) {
+        for (int i = 0; i < bits[len - 1]; i++) {
+            table->code[vals[k]] = code++;
+            table->len[vals[k]] = len;
+            k++;
+        }
+        code <<= 1;
+    }
+}
+
+static inline void put_byte(bit_writer_t *bw, uint8_t b)
+{
+    if (bw->pos < bw->cap) {
+        bw->out[bw->pos] = b;
+    }
+    bw->pos++;
+}
+
+static inline void put_bits(bit_writer_t *bw, uint32_t bits, int n)
+{
+    bw->acc = (bw->acc << n) | (bits & ((1u << n) - 1));
+    bw->nbits += n;
+    while (bw->nbits >= 8) {
+        uint8_t b = (uint8_t)(bw->acc >> (bw->nbits - 8));
+        put_byte(bw, b);
+        if (b == 0xFF) {
+            put_byte(bw, 0x00);
+        }
+        bw->nbits -= 8;
+    }
+}
+
+static inline int bit_size(int v)
+{
+    v = v < 0 ? -v : v;
+    return v ? 32 - __builtin_clz((unsigned)v) : 0;
+}
+
+static inline void put_huff(bit_writer_t *bw, const huff_table_t *table, uint8_t symbol)
+{
+    put_bits(bw, table->code[symbol], table->len[symbol]);
+}
+
+// ac[] is in zigzag order, last is the highest non-zero index (0 = none)
+static void encode_block(bit_writer_t *bw, int *prev_dc, int dc, const int16_t *ac, int last)
+{
+    int diff = dc - *prev_dc;
+    *prev_dc = dc;
+    int s = bit_size(diff);
+    put_huff(bw, &s_dc_huff, s);
+    if (s) {
+        put_bits(bw, diff < 0 ? diff - 1 : diff, s);
+    }
+
+    int run = 0;
+    for (int k = 1; k <= last; k++) {
+        int v = ac[k];
+        if (!v) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            put_huff(bw, &s_ac_huff, 0xF0);
+            run -= 16;
+        }
+        s = bit_size(v);
+        put_huff(bw, &s_ac_huff, (run << 4) | s);
+        put_bits(bw, v < 0 ? v - 1 : v, s);
+        run = 0;
+    }
+    if (last < 63) {
+        put_huff(bw, &s_ac_huff, 0x00);
+    }
+}
+
+static size_t write_headers(uint8_t *p, uint16_t width, uint16_t height, const uint8_t *qt)
+{
+    uint8_t *start = p;
+    *p++ = 0xFF; *p++ = 0xD8;
+
+    *p++ = 0xFF; *p++ = 0xDB; *p++ = 0; *p++ = 67; *p++ = 0x00;
+    memcpy(p, qt, 64);
+    p += 64;
+
+    *p++ = 0xFF; *p++ = 0xC0; *p++ = 0; *p++ = 17; *p++ = 8;
+    *p++ = height >> 8; *p++ = height & 0xFF;
+    *p++ = width >> 8; *p++ = width & 0xFF;
+    *p++ = 3;
+    *p++ = 1; *p++ = 0x21; *p++ = 0;
+    *p++ = 2; *p++ = 0x11; *p++ = 0;
+    *p++ = 3; *p++ = 0x11; *p++ = 0;
+
+    *p++ = 0xFF; *p++ = 0xC4; *p++ = 0; *p++ = 2 + 17 + 12 + 17 + 162;
+    *p++ = 0x00;
+    memcpy(p, s_dc_bits, 16);
+    p += 16;
+    memcpy(p, s_dc_vals, 12);
+    p += 12;
+    *p++ = 0x10;
+    memcpy(p, s_ac_bits, 16);
+    p += 16;
+    memcpy(p, s_ac_vals, 162);
+    p += 162;
+
+    *p++ = 0xFF; *p++ = 0xDA; *p++ = 0; *p++ = 12; *p++ = 3;
+    *p++ = 1; *p++ = 0x00;
+    *p++ = 2; *p++ = 0x00;
+    *p++ = 3; *p++ = 0x00;
+    *p++ = 0; *p++ = 63; *p++ = 0;
+    return p - start;
+}
+
+// Scene luma for 8x8 block (bx, by): diagonal gradient plus a bright block
+// that moves one cell per frame, so motion and exposure code has work to do
+static int scene_luma(int bx, int by, int blocks_w, int blocks_h, uint32_t frame)
+{
+    int size_w = blocks_w / 6 > 0 ? blocks_w / 6 : 1;
+    int size_h = blocks_h / 6 > 0 ? blocks_h / 6 : 1;
+    int x0 = frame % blocks_w;
+    int y0 = blocks_h / 3;
+    int luma;
+    if (bx >= x0 && bx < x0 + size_w && by >= y0 && by < y0 + size_h) {
+        luma = 224;
+    } else {
+        luma = 32 + (bx + by) * 160 / (blocks_w + blocks_h);
+    }
+    luma += s_brightness * 16;
+    return luma < 0 ? 0 : (luma > 255 ? 255 : luma);
+}
+
+static bool synth_jpeg(sim_buffer_t *buf, uint32_t frame)
+{
+    // Sensor quality 0..63 scales a rising table; higher numbers zero more
+    // coefficients and shrink the frame, as on the OV2640
+    uint8_t qt[64];
+    int scale16 = 16 + 2 * s_quality;
+    for (int k = 0; k < 64; k++) {
+        int q = ((8 + k) * scale16 + 8) / 16;
+        qt[k] = q < 1 ? 1 : (q > 255 ? 255 : q);
+    }
+
+    bit_writer_t bw = {
+        .out = buf->fb.buf,
+        .cap = buf->capacity,
+    };
+    bw.pos = write_headers(bw.out, s_width, s_height, qt);
+
+    const int mcu_w = (s_width + 15) / 16;
+    const int mcu_h = (s_height + 7) / 8;
+    const int blocks_w = mcu_w * 2;
+    const int entropy = s_sim_config.entropy;
+    const int last_band = entropy * 62 / 100 + 1;
+    const int amplitude = 16 + 4 * entropy;
+    int prev_dc[3] = {0, 0, 0};
+    int16_t ac[64];
+    int16_t no_ac[64] = {0};
+
+    for (int my = 0; my < mcu_h; my++) {
+        for (int mx = 0; mx < mcu_w; mx++) {
+            for (int b = 0; b < 2; b++) {
+                int dc = (scene_luma(mx * 2 + b, my, blocks_w, mcu_h, frame) - 128) * 8 / qt[0];
+                int last = 0;
+                if (entropy) {
+                    for (int k = 1; k <= last_band && k < 64; k++) {
+                        ac[k] = 0;
+                        // Fewer, smaller terms towards high frequencies
+                        if ((int)(sim_rand() % 100) < entropy * (64 - k) / 64) {
+                            int v = (int)(sim_rand() % amplitude) / qt[k];
+                            ac[k] = (sim_rand() & 1) ? v : -v;
+                            if (v) {
+                                last = k;
+                            }
+                        }
+                    }
+                }
+                encode_block(&bw, &prev_dc[0], dc, ac, last);
+            }
+            encode_block(&bw, &prev_dc[1], 0, no_ac, 0);
+            encode_block(&bw, &prev_dc[2], 0, no_ac, 0);
+        }
+    }
+
+    if (bw.nbits > 0) {
+        put_bits(&bw, 0x7F, 8 - bw.nbits);
+    }
+    put_byte(&bw, 0xFF);
+    put_byte(&bw, 0xD9);
+
+    if (bw.pos > bw.cap) {
+        ESP_LOGW(TAG, "Synthetic frame needs %zu bytes, buffer holds %zu", bw.pos, bw.cap);
+        return false;
+    }
+    buf->fb.len = bw.pos;
+    buf->fb.width = s_width;
+    buf->fb.height = s_height;
+    return true;
+}
+
+static bool synth_raw(sim_buffer_t *buf, uint32_t frame)
+{
+    const int blocks_w = (s_width + 7) / 8;
+    const int blocks_h = (s_height + 7) / 8;
+    const int noise = s_sim_config.entropy + 1;
+    uint8_t *out = buf->fb.buf;
+
+    for (int y = 0; y < s_height; y++) {
+        for (int x = 0; x < s_width; x++) {
+            int luma = scene_luma(x / 8, y / 8, blocks_w, blocks_h, frame);
+            luma += (int)(sim_rand() % noise) - noise / 2;
+            luma = luma < 0 ? 0 : (luma > 255 ? 255 : luma);
+            if (s_config.pixel_format == PIXFORMAT_GRAYSCALE) {
+                *out++ = luma;
+            } else {
+                // The driver hands RGB565 over big-endian
+                uint16_t px = ((luma >> 3) << 11) | ((luma >> 2) << 5) | (luma >> 3);
+                *out++ = px >> 8;
+                *out++ = px & 0xFF;
+            }
+        }
+    }
+    buf->fb.len = out - buf->fb.buf;
+    buf->fb.width = s_width;
+    buf->fb.height = s_height;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Replay
+
+static bool jpeg_dimensions(const uint8_t *data, size_t len, uint16_t *width, uint16_t *height)
+{
+    size_t pos = 2;
+    while (pos + 9 < len) {
+        if (data[pos] != 0xFF) {
+            return false;
+        }
+        uint8_t marker = data[pos + 1];
+        size_t seg_len = (data[pos + 2] << 8) | data[pos + 3];
+        if (marker == 0xC0 || marker == 0xC1 || marker == 0xC2) {
+            *height = (data[pos + 5] << 8) | data[pos + 6];
+            *width = (data[pos + 7] << 8) | data[pos + 8];
+            return true;
+        }
+        pos += 2 + seg_len;
+    }
+    return false;
+}
+
+static int compare_names(const void *a, const void *b)
+{
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+static void free_file_list(void)
+{
+    for (int i = 0; i < s_file_count; i++) {
+        free(s_files[i]);
+    }
+    free(s_files);
+    s_files = NULL;
+    s_file_count = 0;
+    s_file_index = 0;
+}
+
+static esp_err_t scan_source_dir(size_t *max_size)
+{
+    DIR *dir = opendir(s_source_dir);
+    if (!dir) {
+        ESP_LOGE(TAG, "Cannot open replay directory %s", s_source_dir);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    int capacity = 0;
+    *max_size = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        const char *ext = strrchr(entry->d_name, '.');
+        if (!ext || (strcasecmp(ext, ".jpg") != 0 && strcasecmp(ext, ".jpeg") != 0)) {
+            continue;
+        }
+
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", s_source_dir, entry->d_name);
+        struct stat st;
+        if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+
+        if (s_file_count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            char **grown = realloc(s_files, capacity * sizeof(char *));
+            if (!grown) {
+                closedir(dir);
+                free_file_list();
+                return ESP_ERR_NO_MEM;
+            }
+            s_files = grown;
+        }
+        s_files[s_file_count] = strdup(path);
+        if (!s_files[s_file_count]) {
+            closedir(dir);
+            free_file_list();
+            return ESP_ERR_NO_MEM;
+        }
+        s_file_count++;
+        if ((size_t)st.st_size > *max_size) {
+            *max_size = st.st_size;
+        }
+    }
+    closedir(dir);
+
+    if (s_file_count == 0) {
+        ESP_LOGE(TAG, "No JPEG files in %s", s_source_dir);
+        return ESP_ERR_NOT_FOUND;
+    }
+    qsort(s_files, s_file_count, sizeof(char *), compare_names);
+    return ESP_OK;
+}
+
+static bool replay_next(sim_buffer_t *buf)
+{
+    if (s_file_index >= s_file_count) {
+        if (!s_sim_config.loop) {
+            return false;
+        }
+        s_file_index = 0;
+    }
+
+    const char *path = s_files[s_file_index++];
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        ESP_LOGW(TAG, "Cannot read %s", path);
+        return false;
+    }
+    buf->fb.len = fread(buf->fb.buf, 1, buf->capacity, f);
+    fclose(f);
+
+    uint16_t width = s_width;
+    uint16_t height = s_height;
+    jpeg_dimensions(buf->fb.buf, buf->fb.len, &width, &height);
+    buf->fb.width = width;
+    buf->fb.height = height;
+    return buf->fb.len > 0;
+}
+
+// ---------------------------------------------------------------------------
+// Sensor
+
+static sim_buffer_t *claim_buffer(void)
+{
+    sim_buffer_t *claimed = NULL;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < s_fb_count; i++) {
+        if (s_buffers[i].state == BUF_FREE) {
+            claimed = &s_buffers[i];
+            break;
+        }
+    }
+    if (!claimed && s_config.grab_mode == CAMERA_GRAB_LATEST) {
+        for (int i = 0; i < s_fb_count; i++) {
+            if (s_buffers[i].state == BUF_READY &&
+                (!claimed || s_buffers[i].sequence < claimed->sequence)) {
+                claimed = &s_buffers[i];
+            }
+        }
+        if (claimed) {
+            s_stats.frames_overwritten++;
+        }
+    }
+    if (claimed) {
+        claimed->state = BUF_WRITING;
+    } else {
+        s_stats.frames_lost++;
+    }
+    xSemaphoreGive(s_lock);
+    return claimed;
+}
+
+static void sensor_task(void *pvParameters)
+{
+    int64_t start = esp_timer_get_time();
+    bool exhausted = false;
+
+    for (uint32_t frame = 1; s_running; frame++) {
+        // Absolute VSYNC times, so the rate does not drift with load
+        int64_t vsync = start + (int64_t)frame * s_period_us;
+        int64_t now = esp_timer_get_time();
+        if (vsync > now) {
+            vTaskDelay(pdMS_TO_TICKS((vsync - now + 999) / 1000));
+        }
+        if (!s_running || exhausted) {
+            continue;
+        }
+
+        sim_buffer_t *buf = claim_buffer();
+        if (!buf) {
+            continue;
+        }
+
+        int64_t produce_start = esp_timer_get_time();
+        bool ok;
+        if (s_file_count > 0) {
+            ok = replay_next(buf);
+            exhausted = !ok && !s_sim_config.loop && s_file_index >= s_file_count;
+        } else if (s_config.pixel_format == PIXFORMAT_JPEG) {
+            ok = synth_jpeg(buf, frame);
+        } else {
+            ok = synth_raw(buf, frame);
+        }
+        int64_t produce_end = esp_timer_get_time();
+
+        int64_t frame_start = vsync - s_period_us;
+        buf->fb.timestamp.tv_sec = frame_start / 1000000;
+        buf->fb.timestamp.tv_usec = frame_start % 1000000;
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        if (ok) {
+            buf->sequence = ++s_sequence;
+            buf->state = BUF_READY;
+            s_stats.frames_produced++;
+            s_produce_sum_us += produce_end - produce_start;
+        } else {
+            buf->state = BUF_FREE;
+        }
+        xSemaphoreGive(s_lock);
+
+        if (ok) {
+            xSemaphoreGive(s_frame_ready);
+        } else if (exhausted) {
+            ESP_LOGI(TAG, "Replay finished after %d files", s_file_count);
+        }
+    }
+
+    xSemaphoreGive(s_sensor_stopped);
+    vTaskDelete(NULL);
+}
+
+static int sensor_set_pixformat(sensor_t *sensor, pixformat_t pixformat)
+{
+    return pixformat == s_config.pixel_format ? 0 : -1;
+}
+
+static int sensor_set_framesize(sensor_t *sensor, framesize_t framesize)
+{
+    return framesize == s_config.frame_size ? 0 : -1;
+}
+
+static int sensor_set_quality(sensor_t *sensor, int quality)
+{
+    if (quality < 0 || quality > 63) {
+        return -1;
+    }
+    s_quality = quality;
+    return 0;
+}
+
+static int sensor_set_brightness(sensor_t *sensor, int level)
+{
+    if (level < -2 || level > 2) {
+        return -1;
+    }
+    s_brightness = level;
+    return 0;
+}
+
+static int sensor_set_level(sensor_t *sensor, int level)
+{
+    return (level < -2 || level > 2) ? -1 : 0;
+}
+
+static int sensor_set_exposure_ctrl(sensor_t *sensor, int enable)
+{
+    return (enable == 0 || enable == 1) ? 0 : -1;
+}
+
+static int sensor_set_aec_value(sensor_t *sensor, int value)
+{
+    return (value < 0 || value > 1200) ? -1 : 0;
+}
+
+static void free_buffers(void)
+{
+    for (int i = 0; i < SIM_MAX_FB; i++) {
+        free(s_buffers[i].fb.buf);
+    }
+    memset(s_buffers, 0, sizeof(s_buffers));
+    s_fb_count = 0;
+}
+
+static void delete_sync(void)
+{
+    if (s_lock) {
+        vSemaphoreDelete(s_lock);
+        s_lock = NULL;
+    }
+    if (s_frame_ready) {
+        vSemaphoreDelete(s_frame_ready);
+        s_frame_ready = NULL;
+    }
+    if (s_sensor_stopped) {
+        vSemaphoreDelete(s_sensor_stopped);
+        s_sensor_stopped = NULL;
+    }
+}
+
+esp_err_t camera_sim_configure(const camera_sim_config_t *config)
+{
+    if (!config || config->fps < 0 || config->entropy > 100) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_sim_config = *config;
+    s_sim_config.source_dir = NULL;
+    snprintf(s_source_dir, sizeof(s_source_dir), "%s", config->source_dir ? config->source_dir : "");
+    return ESP_OK;
+}
+
+esp_err_t camera_sim_get_stats(camera_sim_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    if (s_stats.frames_produced) {
+        stats->produce_avg_us = (uint32_t)(s_produce_sum_us / s_stats.frames_produced);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_init(const camera_config_t *config)
+{
+    if (!config || config->frame_size >= FRAMESIZE_INVALID) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_config = *config;
+    s_width = s_resolution[config->frame_size].width;
+    s_height = s_resolution[config->frame_size].height;
+    s_quality = config->jpeg_quality;
+    s_rng = s_sim_config.seed ? s_sim_config.seed : 1;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_produce_sum_us = 0;
+    s_sequence = 0;
+
+    size_t capacity;
+    if (s_source_dir[0]) {
+        if (config->pixel_format != PIXFORMAT_JPEG) {
+            ESP_LOGE(TAG, "Replay needs PIXFORMAT_JPEG");
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        esp_err_t ret = scan_source_dir(&capacity);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    } else if (config->pixel_format == PIXFORMAT_JPEG) {
+        capacity = (size_t)s_width * s_height * 2;
+    } else if (config->pixel_format == PIXFORMAT_GRAYSCALE) {
+        capacity = (size_t)s_width * s_height;
+    } else if (config->pixel_format == PIXFORMAT_RGB565) {
+        capacity = (size_t)s_width * s_height * 2;
+    } else {
+        ESP_LOGE(TAG, "Pixel format %d not simulated", config->pixel_format);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    build_huff(&s_dc_huff, s_dc_bits, s_dc_vals);
+    build_huff(&s_ac_huff, s_ac_bits, s_ac_vals);
+
+    s_fb_count = config->fb_count < 1 ? 1 : (config->fb_count > SIM_MAX_FB ? SIM_MAX_FB : (int)config->fb_count);
+    for (int i = 0; i < s_fb_count; i++) {
+        s_buffers[i].fb.buf = malloc(capacity);
+        if (!s_buffers[i].fb.buf) {
+            free_buffers();
+            free_file_list();
+            return ESP_ERR_NO_MEM;
+        }
+        s_buffers[i].fb.format = config->pixel_format;
+        s_buffers[i].capacity = capacity;
+        s_buffers[i].state = BUF_FREE;
+    }
+
+    s_lock = xSemaphoreCreateMutex();
+    s_frame_ready = xSemaphoreCreateBinary();
+    s_sensor_stopped = xSemaphoreCreateBinary();
+    if (!s_lock || !s_frame_ready || !s_sensor_stopped) {
+        delete_sync();
+        free_buffers();
+        free_file_list();
+        return ESP_ERR_NO_MEM;
+    }
+
+    float fps = s_sim_config.fps > 0 ? s_sim_config.fps : (config->frame_size > FRAMESIZE_SVGA ? 15.0f : 30.0f);
+    s_period_us = (int64_t)(1000000.0f / fps);
+
+    s_sensor = (sensor_t) {
+        .set_pixformat = sensor_set_pixformat,
+        .set_framesize = sensor_set_framesize,
+        .set_quality = sensor_set_quality,
+        .set_brightness = sensor_set_brightness,
+        .set_contrast = sensor_set_level,
+        .set_saturation = sensor_set_level,
+        .set_exposure_ctrl = sensor_set_exposure_ctrl,
+        .set_aec_value = sensor_set_aec_value,
+    };
+
+    s_running = true;
+    if (xTaskCreate(sensor_task, "camera_sim", SIM_TASK_STACK, NULL, SIM_TASK_PRIO, &s_sensor_task) != pdPASS) {
+        s_running = false;
+        delete_sync();
+        free_buffers();
+        free_file_list();
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_initialized = true;
+    if (s_file_count > 0) {
+        ESP_LOGI(TAG, "Replaying %d JPEGs from %s at %.1f fps, %d buffers",
+                 s_file_count, s_source_dir, fps, s_fb_count);
+    } else {
+        ESP_LOGI(TAG, "Synthetic %dx%d frames at %.1f fps, entropy %d, %d buffers",
+                 s_width, s_height, fps, s_sim_config.entropy, s_fb_count);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_deinit(void)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_running = false;
+    if (xSemaphoreTake(s_sensor_stopped, pdMS_TO_TICKS(SIM_STOP_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGW(TAG, "Sensor task did not stop");
+        return ESP_ERR_TIMEOUT;
+    }
+    s_sensor_task = NULL;
+
+    delete_sync();
+    free_buffers();
+    free_file_list();
+    s_initialized = false;
+    return ESP_OK;
+}
+
+camera_fb_t* esp_camera_fb_get(void)
+{
+    if (!s_initialized) {
+        return NULL;
+    }
+
+    int64_t deadline = esp_timer_get_time() + (int64_t)SIM_GET_TIMEOUT_MS * 1000;
+    while (1) {
+        sim_buffer_t *picked = NULL;
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        for (int i = 0; i < s_fb_count; i++) {
+            sim_buffer_t *buf = &s_buffers[i];
+            if (buf->state != BUF_READY) {
+                continue;
+            }
+            // WHEN_EMPTY hands out the oldest queued frame, LATEST the newest
+            bool better = !picked ||
+                (s_config.grab_mode == CAMERA_GRAB_LATEST ? buf->sequence > picked->sequence
+                                                          : buf->sequence < picked->sequence);
+            if (better) {
+                picked = buf;
+            }
+        }
+        if (picked) {
+            picked->state = BUF_TAKEN;
+            // Older frames are stale once a newer one went out; the driver drops them
+            for (int i = 0; s_config.grab_mode == CAMERA_GRAB_LATEST && i < s_fb_count; i++) {
+                if (s_buffers[i].state == BUF_READY) {
+                    s_buffers[i].state = BUF_FREE;
+                }
+            }
+        }
+        xSemaphoreGive(s_lock);
+
+        if (picked) {
+            return &picked->fb;
+        }
+
+        int64_t remaining = deadline - esp_timer_get_time();
+        if (remaining <= 0 ||
+            xSemaphoreTake(s_frame_ready, pdMS_TO_TICKS(remaining / 1000 + 1)) != pdTRUE) {
+            s_stats.get_timeouts++;
+            ESP_LOGW(TAG, "Failed to get the frame on time!");
+            return NULL;
+        }
+    }
+}
+
+void esp_camera_fb_return(camera_fb_t *fb)
+{
+    if (!fb || !s_initialized) {
+        return;
+    }
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    for (int i = 0; i < s_fb_count; i++) {
+        if (&s_buffers[i].fb == fb) {
+            s_buffers[i].state = BUF_FREE;
+            break;
+        }
+    }
+    xSemaphoreGive(s_lock);
+}
+
+sensor_t* esp_camera_sensor_get(void)
+{
+    return s_initialized ? &s_sensor : NULL;
+}
\ No newline at end of file
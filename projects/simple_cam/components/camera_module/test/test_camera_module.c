@@ -0,0 +1,222 @@
+#include "unity.h"
+#include "camera_module.h"
+#include "camera_sim.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <string.h>
+
+// Runs on the linux target against the simulated sensor, whose synthetic
+// JPEGs shrink with the quality number the way the OV2640's do
+
+#define RC_TEST_FRAMES      160
+#define RC_TEST_SETTLED     60      // trailing frames the mean is taken over
+
+static void camera_start_at(float fps)
+{
+    camera_sim_config_t sim = {
+        .fps = fps,
+        .entropy = 40,
+        .seed = 7,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_sim_configure(&sim));
+
+    camera_config_params_t params = {
+        .frame_size = FRAMESIZE_QVGA,
+        .pixel_format = PIXFORMAT_JPEG,
+        .jpeg_quality = 12,
+        .fb_count = 3,
+        .grab_latest = false,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_init(&params));
+}
+
+static void camera_start(void)
+{
+    camera_start_at(120.0f);
+}
+
+static size_t frame_size_at(int quality)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_set_quality(quality));
+    size_t sum = 0;
+    for (int i = 0; i < 8; i++) {
+        camera_fb_t *fb = camera_module_capture();
+        TEST_ASSERT_NOT_NULL(fb);
+        // The first frames may have been exposed at the old setting
+        if (i >= 4) {
+            sum += fb->len;
+        }
+        camera_module_return_fb(fb);
+    }
+    return sum / 4;
+}
+
+// Streams frames through the controller; returns the mean size of the tail
+static uint32_t stream_mean(int frames, int tail, uint32_t *adjustments)
+{
+    camera_rate_control_stats_t stats;
+    uint64_t sum = 0;
+    uint32_t start_adjustments = 0;
+    for (int i = 0; i < frames; i++) {
+        camera_frame_t *frame = camera_module_stream_acquire(pdMS_TO_TICKS(1000));
+        TEST_ASSERT_NOT_NULL(frame);
+        if (i == frames - tail) {
+            camera_module_get_rate_control_stats(&stats);
+            start_adjustments = stats.adjustments;
+        }
+        if (i >= frames - tail) {
+            sum += frame->fb->len;
+        }
+        camera_module_frame_release(frame);
+    }
+    camera_module_get_rate_control_stats(&stats);
+    *adjustments = stats.adjustments - start_adjustments;
+    return (uint32_t)(sum / tail);
+}
+
+TEST_CASE("rate control target divides the write budget", "[camera][rate]")
+{
+    TEST_ASSERT_EQUAL(50000, camera_module_rate_control_target(1000000, 10.0f, 0.5f));
+    TEST_ASSERT_EQUAL(0, camera_module_rate_control_target(0, 10.0f, 0.5f));
+    TEST_ASSERT_EQUAL(0, camera_module_rate_control_target(1000000, 0.0f, 0.5f));
+}
+
+TEST_CASE("rate control settles on the frame budget", "[camera][rate]")
+{
+    camera_start();
+    size_t coarse = frame_size_at(40);
+    size_t fine = frame_size_at(12);
+    TEST_ASSERT_GREATER_THAN(coarse, fine);
+
+    // A budget between the two settings, starting from the larger frames
+    uint32_t target = (uint32_t)((coarse + fine) / 2);
+    camera_rate_control_config_t rc = {
+        .target_frame_bytes = target,
+        .min_quality = 4,
+        .max_quality = 50,
+        .kp = 4.0f,
+        .ki = 1.5f,
+        .deadband = 0.05f,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_rate_control_start(&rc));
+    camera_stream_config_t stream = { .core_id = 1, .task_priority = 5, .queue_depth = 2 };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_start(&stream));
+
+    uint32_t adjustments;
+    uint32_t mean = stream_mean(RC_TEST_FRAMES, RC_TEST_SETTLED, &adjustments);
+    TEST_ASSERT_UINT32_WITHIN(target / 10, target, mean);
+    // Hysteresis keeps a settled loop from reprogramming the sensor every frame
+    TEST_ASSERT_LESS_THAN(RC_TEST_SETTLED / 4, adjustments);
+
+    camera_rate_control_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_get_rate_control_stats(&stats));
+    TEST_ASSERT_TRUE(stats.enabled);
+    TEST_ASSERT_GREATER_THAN(12, stats.quality);
+    TEST_ASSERT_LESS_THAN(40, stats.quality);
+
+    // Halving the budget pushes the quality number up until it fits again
+    int settled_quality = stats.quality;
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_rate_control_set_target(target / 2));
+    mean = stream_mean(RC_TEST_FRAMES, RC_TEST_SETTLED, &adjustments);
+    camera_module_get_rate_control_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(settled_quality, stats.quality);
+    if (stats.quality < rc.max_quality) {
+        TEST_ASSERT_UINT32_WITHIN(target / 20, target / 2, mean);
+    }
+
+    camera_module_rate_control_stop();
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_deinit());
+}
+
+TEST_CASE("rate control holds the clamps", "[camera][rate]")
+{
+    camera_start();
+    camera_rate_control_config_t rc = {
+        .target_frame_bytes = 64,   // far below anything the sensor makes
+        .min_quality = 10,
+        .max_quality = 20,
+        .kp = 4.0f,
+        .ki = 1.5f,
+        .deadband = 0.05f,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_rate_control_start(&rc));
+    camera_stream_config_t stream = { .core_id = 1, .task_priority = 5, .queue_depth = 2 };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_start(&stream));
+
+    uint32_t adjustments;
+    stream_mean(60, 20, &adjustments);
+    camera_rate_control_stats_t stats;
+    camera_module_get_rate_control_stats(&stats);
+    TEST_ASSERT_EQUAL(20, stats.quality);
+    TEST_ASSERT_EQUAL(0, adjustments);
+
+    // With a budget far above the frames it walks back down to the other clamp
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_rate_control_set_target(1 << 24));
+    stream_mean(120, 20, &adjustments);
+    camera_module_get_rate_control_stats(&stats);
+    TEST_ASSERT_EQUAL(10, stats.quality);
+
+    camera_module_rate_control_stop();
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_deinit());
+}
+
+TEST_CASE("sensor setters run alongside the rate controller", "[camera][rate]")
+{
+    camera_start();
+    camera_rate_control_config_t rc = {
+        .target_frame_bytes = 1000,
+        .min_quality = 4,
+        .max_quality = 50,
+        .kp = 4.0f,
+        .ki = 1.5f,
+        .deadband = 0.05f,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_rate_control_start(&rc));
+    camera_stream_config_t stream = { .core_id = 1, .task_priority = 5, .queue_depth = 2 };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_start(&stream));
+
+    for (int i = 0; i < 60; i++) {
+        camera_frame_t *frame = camera_module_stream_acquire(pdMS_TO_TICKS(1000));
+        TEST_ASSERT_NOT_NULL(frame);
+        camera_module_frame_release(frame);
+        TEST_ASSERT_EQUAL(ESP_OK, camera_module_set_manual_exposure(i & 1, 300 + i));
+        TEST_ASSERT_EQUAL(ESP_OK, camera_module_set_brightness(i % 3 - 1));
+    }
+
+    camera_rate_control_stats_t stats;
+    camera_module_get_rate_control_stats(&stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.adjustments);
+
+    camera_module_rate_control_stop();
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_deinit());
+}
+
+TEST_CASE("a stream whose grab task outlives the stop holds the camera until it exits", "[camera][stream]")
+{
+    // One frame every five seconds: the grab task sits in the driver until
+    // its get times out after four
+    camera_start_at(0.2f);
+    camera_stream_config_t stream = { .core_id = 1, .task_priority = 5, .queue_depth = 2 };
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_start(&stream));
+    vTaskDelay(pdMS_TO_TICKS(50));
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, camera_module_stream_stop());
+    TEST_ASSERT_FALSE(camera_module_stream_is_running());
+
+    // Neither a new stream nor the driver's teardown may go ahead meanwhile
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, camera_module_stream_start(&stream));
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, camera_module_deinit());
+    TEST_ASSERT_NULL(camera_module_capture());
+
+    // Once it has gone, a stop reaps it and the camera comes down cleanly
+    vTaskDelay(pdMS_TO_TICKS(1500));
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_stop());
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_deinit());
+
+    camera_start();
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_start(&stream));
+    camera_frame_t *frame = camera_module_stream_acquire(pdMS_TO_TICKS(1000));
+    TEST_ASSERT_NOT_NULL(frame);
+    camera_module_frame_release(frame);
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_stream_stop());
+    TEST_ASSERT_EQUAL(ESP_OK, camera_module_deinit());
+}
\ No newline at end of file
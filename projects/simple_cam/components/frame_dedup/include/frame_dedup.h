@@ -0,0 +1,76 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_camera.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Near-duplicate detection with a 64-bit perceptual hash. The luma grid (the
+// JPEG DC terms, or box averages of a grayscale frame) is averaged down to
+// 32x32, the lowest 8x8 DCT frequencies of that are taken, and each becomes
+// one bit: set when above their median. Frames are compared against the last
+// frame that was kept, not the previous one, so slow drift still ends in a
+// new keyframe.
+typedef struct {
+    uint8_t max_distance;       // Hamming distance (of 64 bits) still counted as the same scene
+    uint8_t max_luma_delta;     // mean brightness change still counted, catches flat frames
+    uint16_t keyframe_interval; // keep a full frame at least every N frames, 0 = no limit
+} frame_dedup_config_t;
+
+typedef struct {
+    uint64_t hash;
+    uint8_t mean_luma;
+    int distance;               // to the last kept frame, -1 if there is none
+    bool duplicate;             // store a reference to the kept frame instead of this one
+    uint32_t hash_us;
+} frame_dedup_result_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t kept;
+    uint32_t duplicates;
+    uint32_t keyframes_forced;  // kept only because the keyframe interval ran out
+    uint64_t bytes_saved;       // JPEG bytes not written
+    uint32_t hash_avg_us;
+    uint32_t hash_max_us;
+} frame_dedup_stats_t;
+
+esp_err_t frame_dedup_init(const frame_dedup_config_t *config);
+
+void frame_dedup_deinit(void);
+
+// A JPEG frame is scanned for its DC map, a grayscale frame is averaged
+// from its pixels
+esp_err_t frame_dedup_hash(const camera_fb_t *fb, uint64_t *hash, uint8_t *mean_luma);
+
+// Hashes a DC map the caller already has (one byte per 8x8 block, width
+// bytes per row), so the JPEG is not scanned a second time
+esp_err_t frame_dedup_hash_map(const uint8_t *map, uint16_t width, uint16_t height,
+                               uint64_t *hash, uint8_t *mean_luma);
+
+// Hashes the frame and decides whether it repeats the last kept frame. A
+// frame that is not a duplicate becomes the new kept frame.
+esp_err_t frame_dedup_check(const camera_fb_t *fb, frame_dedup_result_t *result);
+
+// frame_dedup_check for a frame whose DC map is at hand; frame_bytes counts
+// toward bytes_saved when it is a duplicate
+esp_err_t frame_dedup_check_map(const uint8_t *map, uint16_t width, uint16_t height, size_t frame_bytes,
+                                frame_dedup_result_t *result);
+
+// Forgets the kept frame, e.g. after its write failed
+void frame_dedup_reset(void);
+
+esp_err_t frame_dedup_get_stats(frame_dedup_stats_t *stats);
+
+static inline int frame_dedup_distance(uint64_t a, uint64_t b)
+{
+    return __builtin_popcountll(a ^ b);
+}
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
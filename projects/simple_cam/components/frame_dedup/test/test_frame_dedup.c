@@ -0,0 +1,184 @@
+#include "unity.h"
+#include "frame_dedup.h"
+#include "frame_test_util.h"
+#include <string.h>
+#include <math.h>
+
+// Same thresholds burst_cam and simple_cam run with
+#define TEST_MAX_DISTANCE   5
+#define TEST_MAX_LUMA       6
+
+#define FRAME_W     320
+#define FRAME_H     240
+
+static camera_fb_t *s_fb;
+
+// A night scene: smooth shapes, a lit building edge, sensor noise, and an
+// optional bright object at object_x
+static void draw_scene(int offset, int noise_amplitude, int object_x)
+{
+    for (int y = 0; y < FRAME_H; y++) {
+        for (int x = 0; x < FRAME_W; x++) {
+            float v = 70.0f + 35.0f * sinf(x / 23.0f) * cosf(y / 31.0f) + 0.1f * y;
+            if (x > 200 && y > 60) {
+                v += 45.0f;
+            }
+            if (object_x >= 0 && x >= object_x && x < object_x + 48 && y >= 100 && y < 160) {
+                v = 240.0f;
+            }
+            s_fb->buf[y * FRAME_W + x] = frame_test_clamp8((int)v + offset + frame_test_noise(noise_amplitude));
+        }
+    }
+}
+
+static void dedup_start(uint16_t keyframe_interval)
+{
+    frame_dedup_config_t config = {
+        .max_distance = TEST_MAX_DISTANCE,
+        .max_luma_delta = TEST_MAX_LUMA,
+        .keyframe_interval = keyframe_interval,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_init(&config));
+    s_fb = frame_test_gray(FRAME_W, FRAME_H);
+}
+
+TEST_CASE("an identical frame hashes the same", "[dedup]")
+{
+    dedup_start(0);
+    draw_scene(0, 0, -1);
+    uint64_t first;
+    uint64_t second;
+    uint8_t luma;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_hash(s_fb, &first, &luma));
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_hash(s_fb, &second, &luma));
+    TEST_ASSERT_TRUE(first == second);
+    // Median split: about half the bits are set
+    TEST_ASSERT_INT_WITHIN(4, 32, __builtin_popcountll(first));
+    frame_dedup_deinit();
+}
+
+TEST_CASE("a DC map from the caller hashes like the frame it came from", "[dedup]")
+{
+    // What the luma meter leaves behind: one mean per 8x8 block
+    static uint8_t map[(FRAME_W / 8) * (FRAME_H / 8)];
+    dedup_start(0);
+    draw_scene(0, 0, -1);
+    for (int by = 0; by < FRAME_H / 8; by++) {
+        for (int bx = 0; bx < FRAME_W / 8; bx++) {
+            uint32_t sum = 0;
+            for (int y = by * 8; y < by * 8 + 8; y++) {
+                for (int x = bx * 8; x < bx * 8 + 8; x++) {
+                    sum += s_fb->buf[y * FRAME_W + x];
+                }
+            }
+            map[by * (FRAME_W / 8) + bx] = (uint8_t)((sum + 32) / 64);
+        }
+    }
+
+    frame_dedup_result_t result;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check_map(map, FRAME_W / 8, FRAME_H / 8, 1000, &result));
+    TEST_ASSERT_TRUE(result.duplicate);
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_MAX_DISTANCE, result.distance);
+
+    frame_dedup_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_get_stats(&stats));
+    TEST_ASSERT_EQUAL(1000, stats.bytes_saved);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, frame_dedup_check_map(map, 0, FRAME_H / 8, 1000, &result));
+    TEST_ASSERT_FALSE(result.duplicate);
+    frame_dedup_deinit();
+}
+
+TEST_CASE("sensor noise stays under the duplicate distance", "[dedup]")
+{
+    dedup_start(0);
+    frame_dedup_result_t result;
+    draw_scene(0, 12, -1);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+    TEST_ASSERT_FALSE(result.duplicate);
+    TEST_ASSERT_EQUAL(-1, result.distance);
+
+    int max_distance = 0;
+    for (int i = 0; i < 30; i++) {
+        draw_scene(0, 12, -1);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+        max_distance = result.distance > max_distance ? result.distance : max_distance;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_MAX_DISTANCE, max_distance);
+
+    frame_dedup_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_get_stats(&stats));
+    TEST_ASSERT_EQUAL(31, stats.frames);
+    TEST_ASSERT_EQUAL(1, stats.kept);
+    TEST_ASSERT_EQUAL(30, stats.duplicates);
+    TEST_ASSERT_EQUAL(30ULL * s_fb->len, stats.bytes_saved);
+    frame_dedup_deinit();
+}
+
+TEST_CASE("a passing object is kept", "[dedup]")
+{
+    dedup_start(0);
+    frame_dedup_result_t result;
+    draw_scene(0, 12, -1);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+
+    for (int object_x = 20; object_x < 260; object_x += 60) {
+        draw_scene(0, 12, object_x);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+        TEST_ASSERT_FALSE(result.duplicate);
+        TEST_ASSERT_GREATER_THAN(2 * TEST_MAX_DISTANCE, result.distance);
+    }
+    frame_dedup_deinit();
+}
+
+TEST_CASE("a brightness change on a flat frame is kept", "[dedup]")
+{
+    dedup_start(0);
+    frame_dedup_result_t result;
+    memset(s_fb->buf, 40, s_fb->len);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+    TEST_ASSERT_EQUAL(40, result.mean_luma);
+
+    memset(s_fb->buf, 40 + TEST_MAX_LUMA, s_fb->len);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+    TEST_ASSERT_TRUE(result.duplicate);
+
+    memset(s_fb->buf, 41 + TEST_MAX_LUMA, s_fb->len);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+    TEST_ASSERT_FALSE(result.duplicate);
+    frame_dedup_deinit();
+}
+
+TEST_CASE("the keyframe interval forces a full frame", "[dedup]")
+{
+    dedup_start(4);
+    frame_dedup_result_t result;
+    bool expected[] = { false, true, true, true, false, true, true, true, false };
+    for (int i = 0; i < sizeof(expected); i++) {
+        draw_scene(0, 0, -1);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+        TEST_ASSERT_EQUAL(expected[i], result.duplicate);
+    }
+
+    frame_dedup_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_get_stats(&stats));
+    TEST_ASSERT_EQUAL(2, stats.keyframes_forced);
+    frame_dedup_deinit();
+}
+
+TEST_CASE("slow drift is measured against the kept frame", "[dedup]")
+{
+    dedup_start(0);
+    frame_dedup_result_t result;
+    int kept = 0;
+    // One level a frame never differs enough from the previous frame, but
+    // does from the frame that was kept
+    for (int offset = 0; offset <= 3 * TEST_MAX_LUMA; offset++) {
+        draw_scene(offset, 0, -1);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_dedup_check(s_fb, &result));
+        kept += !result.duplicate;
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL(3, kept);
+    frame_dedup_deinit();
+}
\ No newline at end of file
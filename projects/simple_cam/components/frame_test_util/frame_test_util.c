@@ -0,0 +1,29 @@
+#include "frame_test_util.h"
+#include "unity.h"
+
+static uint8_t s_pixels[FRAME_TEST_MAX_PIXELS];
+static camera_fb_t s_fb = {
+    .buf = s_pixels,
+    .format = PIXFORMAT_GRAYSCALE,
+};
+static uint32_t s_seed = 1;
+
+camera_fb_t *frame_test_gray(uint16_t width, uint16_t height)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(s_pixels), (size_t)width * height);
+    s_fb.width = width;
+    s_fb.height = height;
+    s_fb.len = (size_t)width * height;
+    return &s_fb;
+}
+
+int frame_test_noise(int amplitude)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return (int)((s_seed >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+uint8_t frame_test_clamp8(int v)
+{
+    return v < 0 ? 0 : v > 255 ? 255 : (uint8_t)v;
+}
\ No newline at end of file
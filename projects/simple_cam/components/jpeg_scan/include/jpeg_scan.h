@@ -0,0 +1,95 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Entropy-only scan of a baseline JPEG: Huffman-decodes every block but
+// skips dequantisation and the IDCT, which is enough to recover each 8x8
+// luma block's DC term (its mean brightness) at a fraction of a full decode.
+// Progressive and arithmetic-coded files return ESP_ERR_NOT_SUPPORTED.
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t blocks_w;          // luma 8x8 blocks across, ceil(width / 8)
+    uint16_t blocks_h;
+} jpeg_scan_info_t;
+
+// Optional AC energy maps share the DC map's layout, one uint16_t per block:
+// the dequantised |AC| summed over the low band (zigzag 1..5, the block's
+// broad gradients) and over the rest (edges and fine detail). Blur and
+// shake empty the high band first. Asking for either reads every
+// coefficient's value instead of skipping past it.
+#define JPEG_SCAN_AC_LOW_END    5
+
+typedef struct {
+    uint8_t *luma_dc;           // blocks_w * blocks_h block means, row-major
+    size_t luma_dc_size;
+    size_t luma_dc_stride;      // bytes between rows, 0 = blocks_w
+    uint16_t *luma_ac_low;      // optional, saturating
+    uint16_t *luma_ac_high;     // optional, saturating
+} jpeg_scan_output_t;
+
+// Thumbnails come straight from the coefficients: 1/8 scale uses the DC
+// term of every block, 1/4 scale adds the first horizontal, vertical and
+// diagonal AC terms to split each block into 2x2. Lines are handed out one
+// MCU row at a time, so memory stays bounded by a single MCU row.
+typedef enum {
+    JPEG_SCAN_SCALE_1_8 = 1,
+    JPEG_SCAN_SCALE_1_4 = 2,
+} jpeg_scan_scale_t;
+
+typedef enum {
+    JPEG_SCAN_PIXEL_GRAY8,
+    JPEG_SCAN_PIXEL_RGB565,     // native uint16_t, as the display buffers use
+    JPEG_SCAN_PIXEL_RGB565_BE,  // high byte first, as esp32-camera's converters expect
+    JPEG_SCAN_PIXEL_RGB888,
+} jpeg_scan_pixel_t;
+
+// Receives `rows` finished thumbnail lines starting at line `y`
+typedef esp_err_t (*jpeg_scan_rows_cb_t)(const uint8_t *pixels, int y, int rows, int width, void *ctx);
+
+typedef struct {
+    jpeg_scan_scale_t scale;
+    jpeg_scan_pixel_t format;
+    jpeg_scan_rows_cb_t on_rows;
+    void *ctx;
+} jpeg_scan_thumb_config_t;
+
+esp_err_t jpeg_scan_get_info(const uint8_t *jpeg, size_t len, jpeg_scan_info_t *info);
+
+esp_err_t jpeg_scan_decode(const uint8_t *jpeg, size_t len, jpeg_scan_output_t *out, jpeg_scan_info_t *info);
+
+// A whole-frame DC map kept between frames. The buffer grows to the largest
+// frame seen and is reused after that; blocks_w and blocks_h describe the
+// last decode and are 0 when it failed.
+typedef struct {
+    uint8_t *luma_dc;           // blocks_w * blocks_h block means, row-major
+    size_t size;                // bytes allocated
+    uint16_t blocks_w;
+    uint16_t blocks_h;
+} jpeg_scan_dc_map_t;
+
+esp_err_t jpeg_scan_dc_map(const uint8_t *jpeg, size_t len, jpeg_scan_dc_map_t *map);
+
+void jpeg_scan_dc_map_free(jpeg_scan_dc_map_t *map);
+
+void jpeg_scan_thumbnail_dims(const jpeg_scan_info_t *info, jpeg_scan_scale_t scale, uint16_t *width, uint16_t *height);
+
+size_t jpeg_scan_pixel_size(jpeg_scan_pixel_t format);
+
+esp_err_t jpeg_scan_thumbnail(const uint8_t *jpeg, size_t len, const jpeg_scan_thumb_config_t *config,
+                              uint16_t *thumb_w, uint16_t *thumb_h);
+
+// Collects the whole thumbnail into buf (thumb_w * thumb_h * pixel size bytes)
+esp_err_t jpeg_scan_thumbnail_to_buffer(const uint8_t *jpeg, size_t len, jpeg_scan_scale_t scale,
+                                        jpeg_scan_pixel_t format, uint8_t *buf, size_t size,
+                                        uint16_t *thumb_w, uint16_t *thumb_h);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
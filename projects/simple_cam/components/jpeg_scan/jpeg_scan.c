@@ -0,0 +1,951 @@
+#include "jpeg_scan.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+static const char *TAG = "jpeg_scan";
+
+#define HUFF_LOOKAHEAD      9
+#define MAX_COMPONENTS      3
+
+typedef struct {
+    uint16_t lookup[1 << HUFF_LOOKAHEAD];   // (length << 8) | symbol, 0 = take the slow path
+    uint16_t skip[1 << HUFF_LOOKAHEAD];     // AC only: (code + extra bits << 8) | coefficients advanced
+    int32_t maxcode[18];
+    int32_t valoffset[18];
+    uint8_t values[256];
+    bool defined;
+} huff_table_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t h;
+    uint8_t v;
+    uint8_t tq;
+    uint8_t td;
+    uint8_t ta;
+    int dc_pred;
+} jpeg_component_t;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t bits;              // MSB-aligned bit buffer
+    int count;
+    bool marker;                // ran into a marker, now feeding zeros
+} bit_reader_t;
+
+typedef struct {
+    const jpeg_scan_thumb_config_t *config;
+    int ppb;                    // thumbnail pixels per block edge
+    int width;
+    int height;
+    int row_w;                  // luma line width padded to whole MCUs
+    int mcu_lines;              // thumbnail lines produced per MCU row
+    uint8_t *luma;              // row_w * mcu_lines
+    uint8_t *chroma[MAX_COMPONENTS - 1];
+    int chroma_w[MAX_COMPONENTS - 1];
+    uint8_t *pixels;            // converted lines handed to the callback
+} thumb_state_t;
+
+typedef struct {
+    huff_table_t dc_tables[2];
+    huff_table_t ac_tables[2];
+    uint16_t qt[4][64];         // zigzag order, as stored in DQT
+    jpeg_component_t comps[MAX_COMPONENTS];
+    int comp_count;
+    int scan_order[MAX_COMPONENTS];
+    int scan_count;
+    int width;
+    int height;
+    int hmax;
+    int vmax;
+    int restart_interval;
+    bool have_frame;
+} jpeg_decoder_t;
+
+static inline uint16_t read_be16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static esp_err_t build_huff_table(huff_table_t *t, const uint8_t *counts, const uint8_t *values, int total, bool ac)
+{
+    memset(t, 0, sizeof(*t));
+    memcpy(t->values, values, total);
+
+    int code = 0;
+    int k = 0;
+    for (int len = 1; len <= 16; len++) {
+        int n = counts[len - 1];
+        if (n == 0) {
+            t->maxcode[len] = -1;
+        } else {
+            t->valoffset[len] = k - code;
+            for (int i = 0; i < n; i++, k++, code++) {
+                if (len <= HUFF_LOOKAHEAD) {
+                    int shift = HUFF_LOOKAHEAD - len;
+                    for (int fill = 0; fill < (1 << shift); fill++) {
+                        t->lookup[(code << shift) | fill] = (uint16_t)((len << 8) | values[k]);
+                    }
+
+                    // Fold the magnitude bits into one step when skipping AC terms
+                    int r = values[k] >> 4;
+                    int s = values[k] & 0x0F;
+                    int total_len = len + s;
+                    if (ac && total_len <= HUFF_LOOKAHEAD) {
+                        int advance = s ? r + 1 : (r == 15 ? 16 : 64);
+                        for (int fill = 0; fill < (1 << shift); fill++) {
+                            t->skip[(code << shift) | fill] = (uint16_t)((total_len << 8) | advance);
+                        }
+                    }
+                }
+            }
+            t->maxcode[len] = code - 1;
+        }
+        if (code > (1 << len)) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        code <<= 1;
+    }
+    t->maxcode[17] = INT32_MAX;
+    t->defined = true;
+    return ESP_OK;
+}
+
+static inline void br_fill(bit_reader_t *br)
+{
+    while (br->count <= 24) {
+        uint32_t byte = 0;
+        if (!br->marker && br->p < br->end) {
+            byte = *br->p;
+            if (byte == 0xFF) {
+                uint8_t next = (br->p + 1 < br->end) ? br->p[1] : 0xD9;
+                if (next == 0x00) {
+                    br->p += 2;
+                } else {
+                    // Leave p on the marker so a restart can consume it
+                    br->marker = true;
+                    byte = 0;
+                }
+            } else {
+                br->p++;
+            }
+        }
+        br->bits |= byte << (24 - br->count);
+        br->count += 8;
+    }
+}
+
+static inline uint32_t br_get(bit_reader_t *br, int n)
+{
+    br_fill(br);
+    uint32_t v = br->bits >> (32 - n);
+    br->bits <<= n;
+    br->count -= n;
+    return v;
+}
+
+static inline int br_receive_extend(bit_reader_t *br, int s)
+{
+    if (s == 0) {
+        return 0;
+    }
+    int v = (int)br_get(br, s);
+    return v < (1 << (s - 1)) ? v - (1 << s) + 1 : v;
+}
+
+static inline int huff_decode(bit_reader_t *br, const huff_table_t *t)
+{
+    br_fill(br);
+    uint16_t entry = t->lookup[br->bits >> (32 - HUFF_LOOKAHEAD)];
+    if (entry) {
+        int len = entry >> 8;
+        br->bits <<= len;
+        br->count -= len;
+        return entry & 0xFF;
+    }
+
+    for (int len = HUFF_LOOKAHEAD + 1; len <= 16; len++) {
+        int32_t code = (int32_t)(br->bits >> (32 - len));
+        if (code <= t->maxcode[len]) {
+            br->bits <<= len;
+            br->count -= len;
+            return t->values[code + t->valoffset[len]];
+        }
+    }
+    return -1;
+}
+
+static bool br_restart(bit_reader_t *br)
+{
+    br->bits = 0;
+    br->count = 0;
+    br->marker = false;
+
+    while (br->p + 1 < br->end) {
+        if (br->p[0] == 0xFF && br->p[1] >= 0xD0 && br->p[1] <= 0xD7) {
+            br->p += 2;
+            return true;
+        }
+        br->p++;
+    }
+    return false;
+}
+
+static inline bool skip_ac(bit_reader_t *br, const huff_table_t *ac, int k)
+{
+    while (k < 64) {
+        br_fill(br);
+        uint16_t entry = ac->skip[br->bits >> (32 - HUFF_LOOKAHEAD)];
+        if (entry) {
+            int len = entry >> 8;
+            br->bits <<= len;
+            br->count -= len;
+            k += entry & 0xFF;
+            continue;
+        }
+
+        int rs = huff_decode(br, ac);
+        if (rs < 0) {
+            return false;
+        }
+        int r = rs >> 4;
+        int s = rs & 0x0F;
+        if (s) {
+            k += r + 1;
+            br_get(br, s);
+        } else if (r == 15) {
+            k += 16;
+        } else {
+            break;
+        }
+    }
+    return true;
+}
+
+// Decodes one block and returns its DC difference. When low_ac is given it
+// receives the zigzag 1, 2 and 4 terms (horizontal, vertical, diagonal);
+// everything else is consumed unread.
+static inline int decode_block(bit_reader_t *br, const huff_table_t *dc, const huff_table_t *ac,
+                               int *low_ac, bool *error)
+{
+    int s = huff_decode(br, dc);
+    if (s < 0 || s > 11) {
+        *error = true;
+        return 0;
+    }
+    int diff = br_receive_extend(br, s);
+
+    int k = 1;
+    if (low_ac) {
+        low_ac[0] = low_ac[1] = low_ac[2] = 0;
+        while (k <= 4) {
+            int rs = huff_decode(br, ac);
+            if (rs < 0) {
+                *error = true;
+                return 0;
+            }
+            int r = rs >> 4;
+            s = rs & 0x0F;
+            if (s) {
+                k += r;
+                int v = br_receive_extend(br, s);
+                if (k == 1) {
+                    low_ac[0] = v;
+                } else if (k == 2) {
+                    low_ac[1] = v;
+                } else if (k == 4) {
+                    low_ac[2] = v;
+                }
+                k++;
+            } else if (r == 15) {
+                k += 16;
+            } else {
+                return diff;
+            }
+        }
+    }
+
+    if (!skip_ac(br, ac, k)) {
+        *error = true;
+    }
+    return diff;
+}
+
+// decode_block for the energy maps: every AC value is read and its
+// dequantised magnitude added to the low or the high band
+static inline int decode_block_energy(bit_reader_t *br, const huff_table_t *dc, const huff_table_t *ac,
+                                      const uint16_t *q, uint32_t *low, uint32_t *high, bool *error)
+{
+    int s = huff_decode(br, dc);
+    if (s < 0 || s > 11) {
+        *error = true;
+        return 0;
+    }
+    int diff = br_receive_extend(br, s);
+
+    uint32_t lo = 0;
+    uint32_t hi = 0;
+    for (int k = 1; k < 64; k++) {
+        int rs = huff_decode(br, ac);
+        if (rs < 0) {
+            *error = true;
+            return 0;
+        }
+        int r = rs >> 4;
+        s = rs & 0x0F;
+        if (s) {
+            k += r;
+            if (k > 63) {
+                *error = true;
+                return 0;
+            }
+            int v = br_receive_extend(br, s);
+            uint32_t m = (uint32_t)(v < 0 ? -v : v) * q[k];
+            if (k <= JPEG_SCAN_AC_LOW_END) {
+                lo += m;
+            } else {
+                hi += m;
+            }
+        } else if (r == 15) {
+            k += 15;
+        } else {
+            break;
+        }
+    }
+    *low = lo;
+    *high = hi;
+    return diff;
+}
+
+static inline uint16_t sat_u16(uint32_t v)
+{
+    return v > UINT16_MAX ? UINT16_MAX : (uint16_t)v;
+}
+
+static inline uint8_t clamp_u8(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : (uint8_t)v);
+}
+
+static inline uint8_t dc_to_mean(int dc, uint16_t q)
+{
+    // DC is 8x the block mean of the level-shifted samples
+    return clamp_u8(((dc * q) >> 3) + 128);
+}
+
+// 2x2 split of a block from DC + the three lowest AC terms. The mean of
+// cos((2x+1)*pi/16) over half a block is 0.6407; with the IDCT's 1/4 and
+// C(0) = 1/sqrt(2) that gives 29/256 per first-order term and 26/256 for
+// the diagonal one. Higher terms average out or nearly so.
+static inline void block_quadrants(int dc, const int *low_ac, const uint16_t *q, uint8_t *out, int stride)
+{
+    int base = dc * q[0] * 32 + 128 * 256;
+    int h = low_ac[0] * q[1] * 29;
+    int v = low_ac[1] * q[2] * 29;
+    int d = low_ac[2] * q[4] * 26;
+    out[0] = clamp_u8((base + h + v + d) >> 8);
+    out[1] = clamp_u8((base - h + v - d) >> 8);
+    out[stride] = clamp_u8((base + h - v - d) >> 8);
+    out[stride + 1] = clamp_u8((base - h - v + d) >> 8);
+}
+
+static void emit_pixel(uint8_t *dst, jpeg_scan_pixel_t format, int y, int cb, int cr)
+{
+    if (format == JPEG_SCAN_PIXEL_GRAY8) {
+        dst[0] = (uint8_t)y;
+        return;
+    }
+
+    // JFIF YCbCr -> RGB, 8.8 fixed point
+    cb -= 128;
+    cr -= 128;
+    uint8_t r = clamp_u8(y + ((359 * cr) >> 8));
+    uint8_t g = clamp_u8(y - ((88 * cb + 183 * cr) >> 8));
+    uint8_t b = clamp_u8(y + ((454 * cb) >> 8));
+
+    if (format == JPEG_SCAN_PIXEL_RGB888) {
+        dst[0] = r;
+        dst[1] = g;
+        dst[2] = b;
+        return;
+    }
+
+    uint16_t rgb565 = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    if (format == JPEG_SCAN_PIXEL_RGB565_BE) {
+        dst[0] = rgb565 >> 8;
+        dst[1] = rgb565 & 0xFF;
+    } else {
+        memcpy(dst, &rgb565, sizeof(rgb565));
+    }
+}
+
+static esp_err_t thumb_flush_row(const jpeg_decoder_t *dec, thumb_state_t *t, int mcu_row)
+{
+    int y0 = mcu_row * t->mcu_lines;
+    if (y0 >= t->height) {
+        return ESP_OK;
+    }
+    int rows = t->mcu_lines < t->height - y0 ? t->mcu_lines : t->height - y0;
+    size_t bpp = jpeg_scan_pixel_size(t->config->format);
+    int mcu_w = dec->hmax * t->ppb;
+
+    for (int ty = 0; ty < rows; ty++) {
+        const uint8_t *luma = t->luma + ty * t->row_w;
+        uint8_t *dst = t->pixels + (size_t)ty * t->width * bpp;
+        for (int tx = 0; tx < t->width; tx++, dst += bpp) {
+            int cb = 128;
+            int cr = 128;
+            if (t->chroma[0]) {
+                // Nearest chroma block; chroma never carries more than DC here
+                const jpeg_component_t *c1 = &dec->comps[1];
+                const jpeg_component_t *c2 = &dec->comps[2];
+                cb = t->chroma[0][(ty * c1->v / t->mcu_lines) * t->chroma_w[0] + tx * c1->h / mcu_w];
+                cr = t->chroma[1][(ty * c2->v / t->mcu_lines) * t->chroma_w[1] + tx * c2->h / mcu_w];
+            }
+            emit_pixel(dst, t->config->format, luma[tx], cb, cr);
+        }
+    }
+    return t->config->on_rows(t->pixels, y0, rows, t->width, t->config->ctx);
+}
+
+static esp_err_t decode_scan(jpeg_decoder_t *dec, const uint8_t *data, const uint8_t *end,
+                             jpeg_scan_output_t *out, const jpeg_scan_info_t *info, thumb_state_t *thumb)
+{
+    bit_reader_t br = { .p = data, .end = end };
+    size_t stride = (out && out->luma_dc_stride) ? out->luma_dc_stride : info->blocks_w;
+    bool error = false;
+    int low_ac[3];
+
+    for (int i = 0; i < dec->scan_count; i++) {
+        jpeg_component_t *c = &dec->comps[dec->scan_order[i]];
+        if (!dec->dc_tables[c->td].defined || !dec->ac_tables[c->ta].defined) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        c->dc_pred = 0;
+    }
+
+    // Luma is always the first frame component in JFIF
+    jpeg_component_t *luma = &dec->comps[0];
+    const uint16_t *q = dec->qt[luma->tq];
+    bool want_ac = thumb && thumb->ppb == 2;
+    bool want_energy = out && (out->luma_ac_low || out->luma_ac_high);
+
+    int mcus_x;
+    int mcus_y;
+    if (dec->scan_count == 1) {
+        // Non-interleaved scan: plain raster of 8x8 blocks
+        mcus_x = info->blocks_w;
+        mcus_y = info->blocks_h;
+    } else {
+        mcus_x = (dec->width + dec->hmax * 8 - 1) / (dec->hmax * 8);
+        mcus_y = (dec->height + dec->vmax * 8 - 1) / (dec->vmax * 8);
+    }
+
+    int mcus_to_restart = dec->restart_interval;
+    for (int my = 0; my < mcus_y; my++) {
+        for (int mx = 0; mx < mcus_x; mx++) {
+            if (dec->restart_interval) {
+                if (mcus_to_restart == 0) {
+                    if (!br_restart(&br)) {
+                        return ESP_ERR_INVALID_SIZE;
+                    }
+                    for (int i = 0; i < dec->scan_count; i++) {
+                        dec->comps[dec->scan_order[i]].dc_pred = 0;
+                    }
+                    mcus_to_restart = dec->restart_interval;
+                }
+                mcus_to_restart--;
+            }
+
+            for (int i = 0; i < dec->scan_count; i++) {
+                jpeg_component_t *c = &dec->comps[dec->scan_order[i]];
+                int bh = dec->scan_count == 1 ? 1 : c->h;
+                int bv = dec->scan_count == 1 ? 1 : c->v;
+                for (int by = 0; by < bv; by++) {
+                    for (int bx = 0; bx < bh; bx++) {
+                        bool is_luma = c == luma;
+                        uint32_t low = 0;
+                        uint32_t high = 0;
+                        if (is_luma && want_energy) {
+                            c->dc_pred += decode_block_energy(&br, &dec->dc_tables[c->td], &dec->ac_tables[c->ta],
+                                                              q, &low, &high, &error);
+                        } else {
+                            c->dc_pred += decode_block(&br, &dec->dc_tables[c->td], &dec->ac_tables[c->ta],
+                                                       (is_luma && want_ac) ? low_ac : NULL, &error);
+                        }
+                        if (error) {
+                            return ESP_ERR_INVALID_SIZE;
+                        }
+
+                        int x = mx * bh + bx;
+                        int y = my * bv + by;
+                        if (!is_luma) {
+                            if (thumb && thumb->chroma[0]) {
+                                int ci = dec->scan_order[i] - 1;
+                                thumb->chroma[ci][by * thumb->chroma_w[ci] + x] =
+                                    dc_to_mean(c->dc_pred, dec->qt[c->tq][0]);
+                            }
+                            continue;
+                        }
+                        if (out && x < info->blocks_w && y < info->blocks_h) {
+                            out->luma_dc[y * stride + x] = dc_to_mean(c->dc_pred, q[0]);
+                            if (out->luma_ac_low) {
+                                out->luma_ac_low[y * stride + x] = sat_u16(low);
+                            }
+                            if (out->luma_ac_high) {
+                                out->luma_ac_high[y * stride + x] = sat_u16(high);
+                            }
+                        }
+                        if (thumb) {
+                            uint8_t *dst = thumb->luma + by * thumb->ppb * thumb->row_w + x * thumb->ppb;
+                            if (want_ac) {
+                                block_quadrants(c->dc_pred, low_ac, q, dst, thumb->row_w);
+                            } else {
+                                *dst = dc_to_mean(c->dc_pred, q[0]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (thumb) {
+            esp_err_t ret = thumb_flush_row(dec, thumb, my);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t parse_sof(jpeg_decoder_t *dec, const uint8_t *seg, int len)
+{
+    if (len < 6 || seg[0] != 8) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    dec->height = read_be16(seg + 1);
+    dec->width = read_be16(seg + 3);
+    dec->comp_count = seg[5];
+    if (dec->comp_count < 1 || dec->comp_count > MAX_COMPONENTS || len < 6 + dec->comp_count * 3 ||
+        dec->width == 0 || dec->height == 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    dec->hmax = 1;
+    dec->vmax = 1;
+    for (int i = 0; i < dec->comp_count; i++) {
+        jpeg_component_t *c = &dec->comps[i];
+        c->id = seg[6 + i * 3];
+        c->h = seg[7 + i * 3] >> 4;
+        c->v = seg[7 + i * 3] & 0x0F;
+        c->tq = seg[8 + i * 3] & 0x03;
+        if (c->h < 1 || c->h > 4 || c->v < 1 || c->v > 4) {
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        dec->hmax = c->h > dec->hmax ? c->h : dec->hmax;
+        dec->vmax = c->v > dec->vmax ? c->v : dec->vmax;
+    }
+    dec->have_frame = true;
+    return ESP_OK;
+}
+
+static esp_err_t parse_dht(jpeg_decoder_t *dec, const uint8_t *seg, int len)
+{
+    while (len >= 17) {
+        int tc = seg[0] >> 4;
+        int th = seg[0] & 0x0F;
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            total += seg[1 + i];
+        }
+        if (tc > 1 || th > 1 || total > 256 || len < 17 + total) {
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        huff_table_t *t = tc ? &dec->ac_tables[th] : &dec->dc_tables[th];
+        esp_err_t ret = build_huff_table(t, seg + 1, seg + 17, total, tc == 1);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        seg += 17 + total;
+        len -= 17 + total;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t parse_dqt(jpeg_decoder_t *dec, const uint8_t *seg, int len)
+{
+    while (len > 0) {
+        int pq = seg[0] >> 4;
+        int tq = seg[0] & 0x03;
+        int size = 1 + (pq ? 128 : 64);
+        if (len < size) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        for (int i = 0; i < 64; i++) {
+            dec->qt[tq][i] = pq ? read_be16(seg + 1 + i * 2) : seg[1 + i];
+        }
+        seg += size;
+        len -= size;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t parse_sos(jpeg_decoder_t *dec, const uint8_t *seg, int len)
+{
+    int ns = seg[0];
+    if (!dec->have_frame || ns < 1 || ns > dec->comp_count || len < 1 + ns * 2 + 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    dec->scan_count = ns;
+    for (int i = 0; i < ns; i++) {
+        int id = seg[1 + i * 2];
+        int tables = seg[2 + i * 2];
+        int index = -1;
+        for (int c = 0; c < dec->comp_count; c++) {
+            if (dec->comps[c].id == id) {
+                index = c;
+                break;
+            }
+        }
+        if (index < 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        dec->comps[index].td = (tables >> 4) & 0x01;
+        dec->comps[index].ta = tables & 0x01;
+        dec->scan_order[i] = index;
+    }
+
+    // A scan that does not carry luma is useless here
+    if (dec->scan_order[0] != 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    return ESP_OK;
+}
+
+// Walks marker segments up to SOS (or just SOF when sos_out is NULL)
+static esp_err_t parse_headers(jpeg_decoder_t *dec, const uint8_t *jpeg, size_t len, const uint8_t **sos_out)
+{
+    if (!jpeg || len < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const uint8_t *p = jpeg + 2;
+    const uint8_t *end = jpeg + len;
+    while (p + 4 <= end) {
+        if (p[0] != 0xFF) {
+            p++;
+            continue;
+        }
+        uint8_t marker = p[1];
+        if (marker == 0xFF) {
+            p++;
+            continue;
+        }
+        if (marker == 0xD8 || marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            p += 2;
+            continue;
+        }
+        if (marker == 0xD9) {
+            break;
+        }
+
+        int seg_len = read_be16(p + 2);
+        const uint8_t *seg = p + 4;
+        if (seg_len < 2 || seg + seg_len - 2 > end) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+        seg_len -= 2;
+
+        esp_err_t ret = ESP_OK;
+        switch (marker) {
+        case 0xC0:
+        case 0xC1:
+            ret = parse_sof(dec, seg, seg_len);
+            if (ret == ESP_OK && !sos_out) {
+                return ESP_OK;
+            }
+            break;
+        case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+        case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+            return ESP_ERR_NOT_SUPPORTED;
+        case 0xC4:
+            ret = parse_dht(dec, seg, seg_len);
+            break;
+        case 0xDB:
+            ret = parse_dqt(dec, seg, seg_len);
+            break;
+        case 0xDD:
+            dec->restart_interval = seg_len >= 2 ? read_be16(seg) : 0;
+            break;
+        case 0xDA:
+            if (!sos_out) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            ret = parse_sos(dec, seg, seg_len);
+            if (ret == ESP_OK) {
+                *sos_out = seg + seg_len;
+            }
+            return ret;
+        default:
+            break;
+        }
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        p = seg + seg_len;
+    }
+    return ESP_ERR_INVALID_SIZE;
+}
+
+static void fill_info(const jpeg_decoder_t *dec, jpeg_scan_info_t *info)
+{
+    info->width = dec->width;
+    info->height = dec->height;
+    info->blocks_w = (dec->width + 7) / 8;
+    info->blocks_h = (dec->height + 7) / 8;
+}
+
+esp_err_t jpeg_scan_get_info(const uint8_t *jpeg, size_t len, jpeg_scan_info_t *info)
+{
+    if (!info) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    jpeg_decoder_t dec = {0};
+    // Only the frame header is parsed, so the Huffman tables stay untouched
+    esp_err_t ret = parse_headers(&dec, jpeg, len, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    fill_info(&dec, info);
+    return ESP_OK;
+}
+
+esp_err_t jpeg_scan_decode(const uint8_t *jpeg, size_t len, jpeg_scan_output_t *out, jpeg_scan_info_t *info)
+{
+    if (!out || !out->luma_dc) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // ~5 KB of Huffman tables; keep them off the caller's stack
+    jpeg_decoder_t *dec = calloc(1, sizeof(jpeg_decoder_t));
+    if (!dec) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    const uint8_t *data = NULL;
+    esp_err_t ret = parse_headers(dec, jpeg, len, &data);
+    if (ret != ESP_OK) {
+        ESP_LOGD(TAG, "Header parse failed: %s", esp_err_to_name(ret));
+        free(dec);
+        return ret;
+    }
+
+    jpeg_scan_info_t local;
+    jpeg_scan_info_t *frame = info ? info : &local;
+    fill_info(dec, frame);
+
+    size_t stride = out->luma_dc_stride ? out->luma_dc_stride : frame->blocks_w;
+    if (stride < frame->blocks_w || out->luma_dc_size < stride * (frame->blocks_h - 1) + frame->blocks_w) {
+        free(dec);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    ret = decode_scan(dec, data, jpeg + len, out, frame, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGD(TAG, "Entropy decode failed at %dx%d", frame->width, frame->height);
+    }
+    free(dec);
+    return ret;
+}
+
+esp_err_t jpeg_scan_dc_map(const uint8_t *jpeg, size_t len, jpeg_scan_dc_map_t *map)
+{
+    if (!map) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    map->blocks_w = map->blocks_h = 0;
+    jpeg_scan_info_t info;
+    esp_err_t ret = jpeg_scan_get_info(jpeg, len, &info);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    size_t size = (size_t)info.blocks_w * info.blocks_h;
+    if (!map->luma_dc || size > map->size) {
+        heap_caps_free(map->luma_dc);
+        map->luma_dc = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!map->luma_dc) {
+            map->luma_dc = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        }
+        map->size = map->luma_dc ? size : 0;
+        if (!map->luma_dc) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    jpeg_scan_output_t out = {
+        .luma_dc = map->luma_dc,
+        .luma_dc_size = map->size,
+        .luma_dc_stride = 0,
+    };
+    ret = jpeg_scan_decode(jpeg, len, &out, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    map->blocks_w = info.blocks_w;
+    map->blocks_h = info.blocks_h;
+    return ESP_OK;
+}
+
+void jpeg_scan_dc_map_free(jpeg_scan_dc_map_t *map)
+{
+    heap_caps_free(map->luma_dc);
+    memset(map, 0, sizeof(*map));
+}
+
+void jpeg_scan_thumbnail_dims(const jpeg_scan_info_t *info, jpeg_scan_scale_t scale, uint16_t *width, uint16_t *height)
+{
+    *width = (info->width * scale + 7) / 8;
+    *height = (info->height * scale + 7) / 8;
+}
+
+size_t jpeg_scan_pixel_size(jpeg_scan_pixel_t format)
+{
+    switch (format) {
+    case JPEG_SCAN_PIXEL_GRAY8:
+        return 1;
+    case JPEG_SCAN_PIXEL_RGB888:
+        return 3;
+    default:
+        return 2;
+    }
+}
+
+esp_err_t jpeg_scan_thumbnail(const uint8_t *jpeg, size_t len, const jpeg_scan_thumb_config_t *config,
+                              uint16_t *thumb_w, uint16_t *thumb_h)
+{
+    if (!config || !config->on_rows ||
+        (config->scale != JPEG_SCAN_SCALE_1_8 && config->scale != JPEG_SCAN_SCALE_1_4)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    jpeg_decoder_t *dec = calloc(1, sizeof(jpeg_decoder_t));
+    if (!dec) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    const uint8_t *data = NULL;
+    esp_err_t ret = parse_headers(dec, jpeg, len, &data);
+    if (ret != ESP_OK) {
+        free(dec);
+        return ret;
+    }
+
+    jpeg_scan_info_t info;
+    fill_info(dec, &info);
+
+    // Everything below is sized by one MCU row of the thumbnail
+    thumb_state_t thumb = {
+        .config = config,
+        .ppb = config->scale,
+    };
+    uint16_t w;
+    uint16_t h;
+    jpeg_scan_thumbnail_dims(&info, config->scale, &w, &h);
+    thumb.width = w;
+    thumb.height = h;
+
+    bool interleaved = dec->scan_count > 1;
+    int mcus_x = interleaved ? (dec->width + dec->hmax * 8 - 1) / (dec->hmax * 8) : info.blocks_w;
+    int hmax = interleaved ? dec->hmax : 1;
+    int vmax = interleaved ? dec->vmax : 1;
+    thumb.row_w = mcus_x * hmax * thumb.ppb;
+    thumb.mcu_lines = vmax * thumb.ppb;
+
+    size_t bpp = jpeg_scan_pixel_size(config->format);
+    thumb.luma = calloc(1, (size_t)thumb.row_w * thumb.mcu_lines);
+    thumb.pixels = malloc((size_t)thumb.width * thumb.mcu_lines * bpp);
+    bool ok = thumb.luma && thumb.pixels;
+
+    // Colour needs all three components in this scan; otherwise it is grey
+    if (ok && interleaved && dec->scan_count == 3 && config->format != JPEG_SCAN_PIXEL_GRAY8) {
+        for (int ci = 0; ci < 2; ci++) {
+            const jpeg_component_t *c = &dec->comps[ci + 1];
+            thumb.chroma_w[ci] = mcus_x * c->h;
+            thumb.chroma[ci] = calloc(1, (size_t)thumb.chroma_w[ci] * c->v);
+            ok = ok && thumb.chroma[ci];
+        }
+    }
+
+    if (!ok) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        ret = decode_scan(dec, data, jpeg + len, NULL, &info, &thumb);
+    }
+
+    free(thumb.luma);
+    free(thumb.pixels);
+    free(thumb.chroma[0]);
+    free(thumb.chroma[1]);
+    free(dec);
+
+    if (ret == ESP_OK) {
+        if (thumb_w) {
+            *thumb_w = w;
+        }
+        if (thumb_h) {
+            *thumb_h = h;
+        }
+    }
+    return ret;
+}
+
+typedef struct {
+    uint8_t *buf;
+    size_t size;
+    size_t bpp;
+} thumb_buffer_t;
+
+static esp_err_t copy_rows(const uint8_t *pixels, int y, int rows, int width, void *ctx)
+{
+    thumb_buffer_t *tb = ctx;
+    size_t line = (size_t)width * tb->bpp;
+    size_t offset = (size_t)y * line;
+    if (offset + rows * line > tb->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(tb->buf + offset, pixels, rows * line);
+    return ESP_OK;
+}
+
+esp_err_t jpeg_scan_thumbnail_to_buffer(const uint8_t *jpeg, size_t len, jpeg_scan_scale_t scale,
+                                        jpeg_scan_pixel_t format, uint8_t *buf, size_t size,
+                                        uint16_t *thumb_w, uint16_t *thumb_h)
+{
+    if (!buf) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    thumb_buffer_t tb = {
+        .buf = buf,
+        .size = size,
+        .bpp = jpeg_scan_pixel_size(format),
+    };
+    jpeg_scan_thumb_config_t config = {
+        .scale = scale,
+        .format = format,
+        .on_rows = copy_rows,
+        .ctx = &tb,
+    };
+    return jpeg_scan_thumbnail(jpeg, len, &config, thumb_w, thumb_h);
+}
\ No newline at end of file
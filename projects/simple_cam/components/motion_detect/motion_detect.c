@@ -0,0 +1,313 @@
+#include "motion_detect.h"
+#include "jpeg_scan.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "motion_detect";
+
+#define LANE_HIGH   0x80808080u
+#define LANE_LOW    0x7F7F7F7Fu
+#define LANE_ONE    0x01010101u
+
+static motion_detect_config_t s_config;
+static bool s_initialized = false;
+
+// Grids are padded to a whole number of 32-bit words per row; padding cells
+// are masked out so they never count as motion.
+static uint8_t *s_current = NULL;
+static uint8_t *s_background = NULL;
+static uint8_t *s_mask = NULL;
+static uint16_t s_grid_w = 0;
+static uint16_t s_grid_h = 0;
+static uint16_t s_stride = 0;
+static uint16_t s_frame_w = 0;
+static uint16_t s_frame_h = 0;
+static uint32_t s_zone_cells = 0;
+static bool s_have_background = false;
+
+static motion_detect_stats_t s_stats;
+static uint64_t s_decode_sum_us = 0;
+static uint64_t s_eval_sum_us = 0;
+
+// Per-byte |a - b|. The first line is a lane-wise subtract with the borrow
+// kept out of the neighbouring byte; lanes that went negative are negated.
+static inline uint32_t swar_absdiff(uint32_t a, uint32_t b)
+{
+    uint32_t d = ((a | LANE_HIGH) - (b & LANE_LOW)) ^ ((a ^ ~b) & LANE_HIGH);
+    uint32_t neg = ((~a & b) | (~(a ^ b) & d)) & LANE_HIGH;
+    uint32_t flip = (neg >> 7) * 0xFFu;
+    return (d ^ flip) + (neg >> 7);
+}
+
+// High bit set in every lane whose value exceeds the threshold (< 128)
+static inline uint32_t swar_above(uint32_t d, uint32_t threshold_plus_one)
+{
+    return (((d | LANE_HIGH) - threshold_plus_one) | d) & LANE_HIGH;
+}
+
+// Lane-wise floor((a + b) / 2)
+static inline uint32_t swar_average(uint32_t a, uint32_t b)
+{
+    return (a & b) + (((a ^ b) >> 1) & LANE_LOW);
+}
+
+static void free_grids(void)
+{
+    heap_caps_free(s_current);
+    heap_caps_free(s_background);
+    heap_caps_free(s_mask);
+    s_current = NULL;
+    s_background = NULL;
+    s_mask = NULL;
+    s_grid_w = 0;
+    s_grid_h = 0;
+    s_have_background = false;
+}
+
+static uint8_t *alloc_grid(size_t size)
+{
+    uint8_t *grid = heap_caps_calloc(1, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!grid) {
+        grid = heap_caps_calloc(1, size, MALLOC_CAP_8BIT);
+    }
+    return grid;
+}
+
+static void build_mask(void)
+{
+    s_zone_cells = 0;
+    for (int y = 0; y < s_grid_h; y++) {
+        // Cell centres in percent of the frame
+        int py = (y * 8 + 4) * 100 / s_frame_h;
+        for (int x = 0; x < s_grid_w; x++) {
+            int px = (x * 8 + 4) * 100 / s_frame_w;
+            bool inside = s_config.zone_count == 0;
+            for (int z = 0; z < s_config.zone_count; z++) {
+                const motion_zone_t *zone = &s_config.zones[z];
+                if (px >= zone->x0 && px < zone->x1 && py >= zone->y0 && py < zone->y1) {
+                    inside = !zone->exclude;
+                }
+            }
+            s_mask[y * s_stride + x] = inside ? 0xFF : 0x00;
+            s_zone_cells += inside;
+        }
+    }
+}
+
+static esp_err_t ensure_grid(uint16_t frame_w, uint16_t frame_h)
+{
+    uint16_t grid_w = (frame_w + 7) / 8;
+    uint16_t grid_h = (frame_h + 7) / 8;
+    if (s_current && grid_w == s_grid_w && grid_h == s_grid_h) {
+        return ESP_OK;
+    }
+
+    free_grids();
+    s_stride = (grid_w + 3) & ~3;
+    size_t size = (size_t)s_stride * grid_h;
+    s_current = alloc_grid(size);
+    s_background = alloc_grid(size);
+    s_mask = alloc_grid(size);
+    if (!s_current || !s_background || !s_mask) {
+        free_grids();
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_grid_w = grid_w;
+    s_grid_h = grid_h;
+    s_frame_w = frame_w;
+    s_frame_h = frame_h;
+    build_mask();
+
+    ESP_LOGI(TAG, "Motion grid %dx%d for %dx%d frames, %lu cells in zone",
+             grid_w, grid_h, frame_w, frame_h, (unsigned long)s_zone_cells);
+    return ESP_OK;
+}
+
+static void grid_from_grayscale(const camera_fb_t *fb)
+{
+    for (int gy = 0; gy < s_grid_h; gy++) {
+        int y0 = gy * 8;
+        int y1 = y0 + 8 < (int)fb->height ? y0 + 8 : (int)fb->height;
+        for (int gx = 0; gx < s_grid_w; gx++) {
+            int x0 = gx * 8;
+            int x1 = x0 + 8 < (int)fb->width ? x0 + 8 : (int)fb->width;
+            uint32_t sum = 0;
+            for (int y = y0; y < y1; y++) {
+                const uint8_t *src = fb->buf + (size_t)y * fb->width;
+                for (int x = x0; x < x1; x++) {
+                    sum += src[x];
+                }
+            }
+            s_current[gy * s_stride + gx] = (uint8_t)(sum / ((y1 - y0) * (x1 - x0)));
+        }
+    }
+}
+
+esp_err_t motion_detect_init(const motion_detect_config_t *config)
+{
+    if (!config || config->cell_threshold == 0 || config->cell_threshold > 127 ||
+        config->zone_count < 0 || config->zone_count > MOTION_MAX_ZONES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_config = *config;
+    if (s_config.learn_shift < 1) {
+        s_config.learn_shift = 1;
+    } else if (s_config.learn_shift > 4) {
+        s_config.learn_shift = 4;
+    }
+
+    free_grids();
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_decode_sum_us = 0;
+    s_eval_sum_us = 0;
+    s_initialized = true;
+
+    ESP_LOGI(TAG, "Motion detect initialized: threshold %d, sensitivity %.1f%%, %d zones",
+             config->cell_threshold, config->min_changed_fraction * 100.0f, config->zone_count);
+    return ESP_OK;
+}
+
+void motion_detect_deinit(void)
+{
+    free_grids();
+    s_initialized = false;
+}
+
+void motion_detect_reset(void)
+{
+    s_have_background = false;
+}
+
+esp_err_t motion_detect_process(const camera_fb_t *fb, motion_result_t *result)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!fb || !result) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(result, 0, sizeof(*result));
+    int64_t start = esp_timer_get_time();
+
+    esp_err_t ret;
+    if (fb->format == PIXFORMAT_JPEG) {
+        jpeg_scan_info_t info;
+        ret = jpeg_scan_get_info(fb->buf, fb->len, &info);
+        if (ret == ESP_OK) {
+            ret = ensure_grid(info.width, info.height);
+        }
+        if (ret == ESP_OK) {
+            jpeg_scan_output_t out = {
+                .luma_dc = s_current,
+                .luma_dc_size = (size_t)s_stride * s_grid_h,
+                .luma_dc_stride = s_stride,
+            };
+            ret = jpeg_scan_decode(fb->buf, fb->len, &out, NULL);
+        }
+    } else if (fb->format == PIXFORMAT_GRAYSCALE) {
+        ret = ensure_grid(fb->width, fb->height);
+        if (ret == ESP_OK) {
+            grid_from_grayscale(fb);
+        }
+    } else {
+        ret = ESP_ERR_NOT_SUPPORTED;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Cannot build motion grid: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    int64_t decoded = esp_timer_get_time();
+
+    if (!s_have_background) {
+        memcpy(s_background, s_current, (size_t)s_stride * s_grid_h);
+        s_have_background = true;
+        result->eval_us = (uint32_t)(decoded - start);
+        return ESP_OK;
+    }
+
+    const uint32_t threshold = (uint32_t)(s_config.cell_threshold + 1) * LANE_ONE;
+    const int words = s_stride / 4;
+    uint32_t changed = 0;
+    int min_x = s_grid_w;
+    int max_x = -1;
+    int min_y = s_grid_h;
+    int max_y = -1;
+
+    for (int y = 0; y < s_grid_h; y++) {
+        const uint32_t *cur = (const uint32_t *)(s_current + y * s_stride);
+        uint32_t *bg = (uint32_t *)(s_background + y * s_stride);
+        const uint32_t *mask = (const uint32_t *)(s_mask + y * s_stride);
+
+        for (int w = 0; w < words; w++) {
+            uint32_t c = cur[w];
+            uint32_t b = bg[w];
+            uint32_t over = swar_above(swar_absdiff(c, b), threshold) & mask[w];
+
+            // Background drifts towards the frame by 1/2^learn_shift
+            uint32_t t = c;
+            for (int i = 0; i < s_config.learn_shift; i++) {
+                t = swar_average(b, t);
+            }
+            bg[w] = t;
+
+            if (over) {
+                changed += __builtin_popcount(over);
+                // Little-endian: the lowest byte is the leftmost cell
+                int first = w * 4 + __builtin_ctz(over) / 8;
+                int last = w * 4 + (31 - __builtin_clz(over)) / 8;
+                min_x = first < min_x ? first : min_x;
+                max_x = last > max_x ? last : max_x;
+                min_y = y < min_y ? y : min_y;
+                max_y = y;
+            }
+        }
+    }
+
+    int64_t end = esp_timer_get_time();
+    result->changed_cells = changed;
+    result->score = s_zone_cells ? (float)changed / s_zone_cells : 0.0f;
+    result->eval_us = (uint32_t)(end - start);
+
+    if (result->score > s_config.global_change_fraction) {
+        // Exposure jump or a camera bump; not worth a capture
+        memcpy(s_background, s_current, (size_t)s_stride * s_grid_h);
+        s_stats.rebaselines++;
+        ESP_LOGD(TAG, "Global change (%.0f%% of cells), rebaselined", result->score * 100.0f);
+    } else if (changed && result->score >= s_config.min_changed_fraction) {
+        result->motion = true;
+        result->x = min_x * 8;
+        result->y = min_y * 8;
+        result->width = ((max_x + 1) * 8 < s_frame_w ? (max_x + 1) * 8 : s_frame_w) - result->x;
+        result->height = ((max_y + 1) * 8 < s_frame_h ? (max_y + 1) * 8 : s_frame_h) - result->y;
+        s_stats.motion_frames++;
+    }
+
+    s_stats.frames_evaluated++;
+    s_decode_sum_us += decoded - start;
+    s_eval_sum_us += result->eval_us;
+    if (result->eval_us > s_stats.eval_max_us) {
+        s_stats.eval_max_us = result->eval_us;
+    }
+    return ESP_OK;
+}
+
+esp_err_t motion_detect_get_stats(motion_detect_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    if (s_stats.frames_evaluated) {
+        stats->decode_avg_us = (uint32_t)(s_decode_sum_us / s_stats.frames_evaluated);
+        stats->eval_avg_us = (uint32_t)(s_eval_sum_us / s_stats.frames_evaluated);
+    }
+    return ESP_OK;
+}
\ No newline at end of file
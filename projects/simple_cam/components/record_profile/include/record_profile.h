@@ -0,0 +1,78 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_camera.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Recording profile chosen from what the inserted card can write. At start
+// a short benchmark writes frame-sized chunks through sdcard_module, the
+// same open-append-close path the recorders use, and the bytes per second
+// it sustained are cached in NVS under the card's CID, so a known card
+// skips the benchmark. The first profile, best first, whose frame bytes
+// times frame rate fits under margin * throughput is used. While recording
+// the card's write stats are checked after every session: a profile the
+// card stops keeping up with is dropped to the first one that fits, at
+// least one step, and one that has had room to spare for a while steps
+// back up. The cache follows both.
+#define RECORD_PROFILE_MAX          8
+
+typedef struct {
+    const char *name;
+    framesize_t frame_size;
+    uint16_t width;
+    uint16_t height;
+    uint8_t fps;                // frames per second written at this profile
+    uint8_t jpeg_quality;       // sensor quality, lower is better
+    uint32_t frame_bytes;       // expected JPEG size at this size and quality
+} record_profile_t;
+
+typedef struct {
+    const record_profile_t *profiles;   // best first: resolution, then fps, then quality
+    uint8_t profile_count;
+    float margin;               // share of the throughput a profile may use, e.g. 0.6
+    uint32_t bench_bytes;       // benchmark length, e.g. 512 KB
+    const char *bench_path;     // scratch file on the card, removed afterwards
+    bool file_per_frame;        // photos: every benchmark frame is a new file
+    uint8_t promote_checks;     // sessions with room to spare before stepping up
+} record_profile_config_t;
+
+typedef struct {
+    uint8_t index;              // into the profile table
+    bool from_cache;            // throughput came from NVS, no benchmark ran
+    uint32_t bytes_per_sec;     // throughput the choice is based on
+    uint32_t bench_latency_max_us;
+    uint32_t bench_us;          // benchmark duration, 0 when cached
+    uint32_t demotions;
+    uint32_t promotions;
+    float frame_scale;          // observed frame bytes over the table's
+    char card_id[48];
+} record_profile_state_t;
+
+// Benchmarks the card (or reads its cached result) and picks a profile;
+// the SD card must be mounted and NVS initialized. If the card cannot be
+// measured the least demanding profile is used and the error returned.
+esp_err_t record_profile_init(const record_profile_config_t *config);
+
+// NULL before record_profile_init()
+const record_profile_t *record_profile_get(void);
+
+// Feeds a written frame's size so the table's estimate follows the scene
+void record_profile_observe_frame(size_t frame_len);
+
+// Checks the card's write stats since the last call; returns true and
+// updates the cache when the profile changed
+bool record_profile_update(void);
+
+// Runs the benchmark again and re-picks, replacing the cached entry
+esp_err_t record_profile_recalibrate(void);
+
+esp_err_t record_profile_get_state(record_profile_state_t *state);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -1,21 +1,69 @@
 #include "sdcard_module.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_LINUX
+#include <sys/statvfs.h>
+#else
 #include "esp_vfs_fat.h"
 #include "driver/sdspi_host.h"
 #include "driver/spi_common.h"
 #include "sdmmc_cmd.h"
+#endif
 #include <string.h>
+#include <errno.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 static const char *TAG = "sdcard_module";
 
+#if CONFIG_IDF_TARGET_LINUX
+// Host builds store into a directory under the working directory
+#define MOUNT_POINT "sdcard"
+#else
 #define MOUNT_POINT "/sdcard"
 
 static sdmmc_card_t *card = NULL;
+#endif
 static bool sdcard_mounted = false;
 static sdcard_config_t current_config;
 
+// Write throughput as seen by callers, open/close included. Halved once the
+// window passes two seconds of busy time so it follows the card's state.
+#define WRITE_STATS_WINDOW_US   2000000
+
+// Per-call latency goes into log2 buckets from 64 us up, for a cheap p95
+#define WRITE_LATENCY_BUCKETS   16
+#define WRITE_LATENCY_MIN_SHIFT 6
+
+static uint64_t s_write_bytes = 0;
+static int64_t s_write_busy_us = 0;
+static uint32_t s_write_calls = 0;
+static uint32_t s_latency_buckets[WRITE_LATENCY_BUCKETS];
+static uint32_t s_latency_max_us = 0;
+
+static void sdcard_record_write(size_t bytes, int64_t start_us)
+{
+    int64_t latency_us = esp_timer_get_time() - start_us;
+    s_write_bytes += bytes;
+    s_write_busy_us += latency_us;
+    s_write_calls++;
+    if (s_write_busy_us > WRITE_STATS_WINDOW_US) {
+        s_write_bytes /= 2;
+        s_write_busy_us /= 2;
+        s_write_calls = (s_write_calls + 1) / 2;
+    }
+
+    int bucket = 0;
+    while (bucket < WRITE_LATENCY_BUCKETS - 1 && (latency_us >> (WRITE_LATENCY_MIN_SHIFT + bucket)) > 0) {
+        bucket++;
+    }
+    s_latency_buckets[bucket]++;
+    if (latency_us > s_latency_max_us) {
+        s_latency_max_us = (uint32_t)latency_us;
+    }
+}
+
 esp_err_t sdcard_module_init(const sdcard_config_t *config)
 {
     if (sdcard_mounted) {
@@ -27,6 +75,15 @@ esp_err_t sdcard_module_init(const sdcard_config_t *config)
 
     memcpy(&current_config, config, sizeof(sdcard_config_t));
 
+#if CONFIG_IDF_TARGET_LINUX
+    if (mkdir(MOUNT_POINT, 0777) != 0 && errno != EEXIST) {
+        ESP_LOGE(TAG, "Failed to create %s: %s", MOUNT_POINT, strerror(errno));
+        return ESP_FAIL;
+    }
+    sdcard_mounted = true;
+    ESP_LOGI(TAG, "Host storage at ./%s", MOUNT_POINT);
+    return ESP_OK;
+#else
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
         .format_if_mount_failed = false,
         .max_files = config->max_files,
@@ -78,6 +135,7 @@ esp_err_t sdcard_module_init(const sdcard_config_t *config)
     sdmmc_card_print_info(stdout, card);
 
     return ESP_OK;
+#endif
 }
 
 esp_err_t sdcard_module_deinit(void)
@@ -87,6 +145,7 @@ esp_err_t sdcard_module_deinit(void)
         return ESP_OK;
     }
 
+#if !CONFIG_IDF_TARGET_LINUX
     esp_err_t ret = esp_vfs_fat_sdcard_unmount(MOUNT_POINT, card);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to unmount filesystem (%s)", esp_err_to_name(ret));
@@ -95,9 +154,10 @@ esp_err_t sdcard_module_deinit(void)
 
     sdmmc_host_t host = SDSPI_HOST_DEFAULT();
     spi_bus_free(host.slot);
+    card = NULL;
+#endif
 
     sdcard_mounted = false;
-    card = NULL;
     ESP_LOGI(TAG, "SD card unmounted");
 
     return ESP_OK;
@@ -114,6 +174,7 @@ esp_err_t sdcard_module_write_file(const char *path, const void *data, size_t si
     snprintf(filepath, sizeof(filepath), "%s/%s", MOUNT_POINT, path);
 
     ESP_LOGI(TAG, "Writing file %s", filepath);
+    int64_t start_us = esp_timer_get_time();
     FILE *f = fopen(filepath, "wb");
     if (f == NULL) {
         ESP_LOGE(TAG, "Failed to open file for writing");
@@ -122,6 +183,7 @@ esp_err_t sdcard_module_write_file(const char *path, const void *data, size_t si
 
     size_t written = fwrite(data, 1, size, f);
     fclose(f);
+    sdcard_record_write(written, start_us);
 
     if (written != size) {
         ESP_LOGE(TAG, "File write failed");
@@ -142,6 +204,7 @@ esp_err_t sdcard_module_append_file(const char *path, const void *data, size_t s
     char filepath[256];
     snprintf(filepath, sizeof(filepath), "%s/%s", MOUNT_POINT, path);
 
+    int64_t start_us = esp_timer_get_time();
     FILE *f = fopen(filepath, "a");
     if (f == NULL) {
         ESP_LOGE(TAG, "Failed to open file for appending");
@@ -150,6 +213,7 @@ esp_err_t sdcard_module_append_file(const char *path, const void *data, size_t s
 
     size_t written = fwrite(data, 1, size, f);
     fclose(f);
+    sdcard_record_write(written, start_us);
 
     if (written != size) {
         ESP_LOGE(TAG, "File append failed");
@@ -193,6 +257,9 @@ esp_err_t sdcard_module_delete_file(const char *path)
     snprintf(filepath, sizeof(filepath), "%s/%s", MOUNT_POINT, path);
 
     if (unlink(filepath) != 0) {
+        if (errno == ENOENT) {
+            return ESP_ERR_NOT_FOUND;
+        }
         ESP_LOGE(TAG, "Failed to delete file");
         return ESP_FAIL;
     }
@@ -201,6 +268,47 @@ esp_err_t sdcard_module_delete_file(const char *path)
     return ESP_OK;
 }
 
+esp_err_t sdcard_module_rename_file(const char *from, const char *to)
+{
+    if (!sdcard_mounted) {
+        ESP_LOGE(TAG, "SD card not mounted");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    char from_path[256];
+    char to_path[256];
+    snprintf(from_path, sizeof(from_path), "%s/%s", MOUNT_POINT, from);
+    snprintf(to_path, sizeof(to_path), "%s/%s", MOUNT_POINT, to);
+
+    // FAT rename() refuses to overwrite an existing target
+    unlink(to_path);
+
+    if (rename(from_path, to_path) != 0) {
+        ESP_LOGE(TAG, "Failed to rename %s to %s", from_path, to_path);
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+FILE *sdcard_module_open_file(const char *path, const char *mode)
+{
+    if (!sdcard_mounted) {
+        ESP_LOGE(TAG, "SD card not mounted");
+        return NULL;
+    }
+
+    char filepath[256];
+    snprintf(filepath, sizeof(filepath), "%s/%s", MOUNT_POINT, path);
+
+    FILE *f = fopen(filepath, mode);
+    if (f == NULL) {
+        ESP_LOGD(TAG, "Failed to open %s (%s)", filepath, mode);
+    }
+
+    return f;
+}
+
 esp_err_t sdcard_module_create_dir(const char *path)
 {
     if (!sdcard_mounted) {
@@ -227,6 +335,15 @@ esp_err_t sdcard_module_get_free_space(uint64_t *free_bytes, uint64_t *total_byt
         return ESP_ERR_INVALID_STATE;
     }
 
+#if CONFIG_IDF_TARGET_LINUX
+    struct statvfs vfs;
+    if (statvfs(MOUNT_POINT, &vfs) != 0) {
+        ESP_LOGE(TAG, "Failed to get free space");
+        return ESP_FAIL;
+    }
+    *total_bytes = (uint64_t)vfs.f_blocks * vfs.f_frsize;
+    *free_bytes = (uint64_t)vfs.f_bavail * vfs.f_frsize;
+#else
     FATFS *fs;
     DWORD fre_clust, fre_sect, tot_sect;
 
@@ -240,7 +357,74 @@ esp_err_t sdcard_module_get_free_space(uint64_t *free_bytes, uint64_t *total_byt
 
     *total_bytes = tot_sect * 512;
     *free_bytes = fre_sect * 512;
+#endif
+
+    return ESP_OK;
+}
+
+uint32_t sdcard_module_get_write_throughput(void)
+{
+    if (s_write_busy_us <= 0) {
+        return 0;
+    }
+    return (uint32_t)(s_write_bytes * 1000000 / s_write_busy_us);
+}
+
+esp_err_t sdcard_module_get_write_stats(sdcard_write_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->bytes_per_sec = sdcard_module_get_write_throughput();
+    if (s_write_calls > 0) {
+        stats->latency_avg_us = (uint32_t)(s_write_busy_us / s_write_calls);
+    }
+    stats->latency_max_us = s_latency_max_us;
+
+    uint32_t count = 0;
+    for (int i = 0; i < WRITE_LATENCY_BUCKETS; i++) {
+        count += s_latency_buckets[i];
+    }
+    stats->writes = count;
+    // Upper edge of the bucket holding the 95th percentile
+    uint32_t seen = 0;
+    for (int i = 0; i < WRITE_LATENCY_BUCKETS && count > 0; i++) {
+        seen += s_latency_buckets[i];
+        if (seen * 100 >= count * 95) {
+            stats->latency_p95_us = 1u << (WRITE_LATENCY_MIN_SHIFT + i);
+            if (stats->latency_p95_us > s_latency_max_us) {
+                stats->latency_p95_us = s_latency_max_us;
+            }
+            break;
+        }
+    }
+    return ESP_OK;
+}
+
+void sdcard_module_reset_write_latency(void)
+{
+    memset(s_latency_buckets, 0, sizeof(s_latency_buckets));
+    s_latency_max_us = 0;
+}
+
+esp_err_t sdcard_module_get_card_id(char *id, size_t len)
+{
+    if (!id || len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!sdcard_mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
 
+#if CONFIG_IDF_TARGET_LINUX
+    snprintf(id, len, "host-%s", MOUNT_POINT);
+#else
+    const sdmmc_cid_t *cid = &card->cid;
+    snprintf(id, len, "%02x%04x-%.8s-%02x-%08lx-%d", cid->mfg_id, cid->oem_id, cid->name,
+             cid->revision, (unsigned long)cid->serial, cid->date);
+#endif
     return ESP_OK;
 }
 
@@ -261,6 +445,7 @@ esp_err_t sdcard_module_save_jpeg(const uint8_t *data, size_t size, const char *
 
     ESP_LOGI(TAG, "Saving JPEG to %s", filepath);
 
+    int64_t start_us = esp_timer_get_time();
     FILE *f = fopen(filepath, "wb");
     if (f == NULL) {
         ESP_LOGE(TAG, "Failed to open file for writing");
@@ -269,6 +454,7 @@ esp_err_t sdcard_module_save_jpeg(const uint8_t *data, size_t size, const char *
 
     size_t written = fwrite(data, 1, size, f);
     fclose(f);
+    sdcard_record_write(written, start_us);
 
     if (written != size) {
         ESP_LOGE(TAG, "Failed to write JPEG data");
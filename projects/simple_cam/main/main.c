@@ -4,9 +4,13 @@
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "camera_module.h"
 #include "sdcard_module.h"
+#include "motion_detect.h"
+#include "frame_dedup.h"
+#include "record_profile.h"
 
 static const char *TAG = "simple_camera";
 
@@ -18,14 +22,83 @@ static const char *TAG = "simple_camera";
 #define CAPTURE_INTERVAL_MS  5000
 #define MAX_FILES           5
 
+// Frames are checked for motion at the poll rate and only written when
+// something moved; a keepalive photo still goes out every few minutes
+#define MOTION_POLL_MS       1000
+#define MOTION_HOLD_MS       10000
+#define KEEPALIVE_MS         (10 * 60 * 1000)
+#define MOTION_STATS_FRAMES  60
+
+// Keepalive photos of an unchanged scene (the dark hours, mostly) are not
+// written again; a line in DEDUP_INDEX points them at the photo they repeat
+#define DEDUP_MAX_DISTANCE   5
+#define DEDUP_MAX_LUMA_DELTA 6
+#define DEDUP_KEYFRAME_EVERY 36
+#define DEDUP_STATS_FRAMES   12
+#define DEDUP_INDEX          "duplicates.txt"
+
+// Photo size and quality come from the card: the first profile whose
+// photos, one per motion poll, fit under PROFILE_MARGIN of the write
+// throughput measured at first boot (cached per card in NVS). The card's
+// write stats are checked every PROFILE_CHECK_PHOTOS photos and the
+// profile moves a step when it falls behind or has room to spare.
+#define PROFILE_MARGIN       0.5f
+#define PROFILE_BENCH_BYTES  (512 * 1024)
+#define PROFILE_BENCH_PATH   "bench.tmp"
+#define PROFILE_CHECK_PHOTOS 12
+#define PROFILE_PROMOTE_CHECKS 4
+
+static const record_profile_t s_photo_profiles[] = {
+    { "UXGA q10", FRAMESIZE_UXGA, 1600, 1200, 1, 10, 200 * 1024 },
+    { "UXGA q14", FRAMESIZE_UXGA, 1600, 1200, 1, 14, 150 * 1024 },
+    { "SXGA q10", FRAMESIZE_SXGA, 1280, 1024, 1, 10, 140 * 1024 },
+    { "XGA q10", FRAMESIZE_XGA, 1024, 768, 1, 10, 90 * 1024 },
+    { "SVGA q10", FRAMESIZE_SVGA, 800, 600, 1, 10, 60 * 1024 },
+};
+
+static camera_config_params_t s_camera_params = {
+    .frame_size = FRAMESIZE_UXGA,
+    .pixel_format = PIXFORMAT_JPEG,
+    .jpeg_quality = 10,
+    .fb_count = 2
+};
+
+// Restarts the camera at the current profile's size and quality
+static esp_err_t apply_profile(void)
+{
+    const record_profile_t *profile = record_profile_get();
+    if (s_camera_params.frame_size == profile->frame_size && s_camera_params.jpeg_quality == profile->jpeg_quality) {
+        return ESP_OK;
+    }
+    s_camera_params.frame_size = profile->frame_size;
+    s_camera_params.jpeg_quality = profile->jpeg_quality;
+    camera_module_deinit();
+    esp_err_t ret = camera_module_init(&s_camera_params);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Camera restart at %s failed: %s", profile->name, esp_err_to_name(ret));
+        return ret;
+    }
+    camera_module_set_brightness(0);
+    camera_module_set_contrast(0);
+    camera_module_set_saturation(0);
+    // Hashes of the old size are no reference for the new one
+    frame_dedup_reset();
+    return ESP_OK;
+}
+
 static void capture_task(void *pvParameters)
 {
     int photo_index = 0;
     char filename[64];
+    TickType_t last_motion = 0;
+    TickType_t last_save = 0;
+    bool motion_active = false;
+    uint32_t evaluated = 0;
+    char kept_name[64] = "";
+    uint32_t writes = 0;
+    uint64_t write_sum_us = 0;
     
     while (1) {
-        ESP_LOGI(TAG, "Taking picture...");
-        
         camera_fb_t *fb = camera_module_capture();
         if (!fb) {
             ESP_LOGE(TAG, "Camera capture failed");
@@ -33,13 +106,78 @@ static void capture_task(void *pvParameters)
             continue;
         }
         
+        TickType_t now = xTaskGetTickCount();
+        motion_result_t motion = {0};
+        if (motion_detect_process(fb, &motion) == ESP_OK && motion.motion) {
+            ESP_LOGI(TAG, "Motion: %.1f%% of zone, box %dx%d at (%d,%d), %lu us",
+                     motion.score * 100.0f, motion.width, motion.height, motion.x, motion.y,
+                     (unsigned long)motion.eval_us);
+            last_motion = now;
+            motion_active = true;
+        } else if (motion_active && (now - last_motion) > pdMS_TO_TICKS(MOTION_HOLD_MS)) {
+            motion_active = false;
+        }
+        
+        if (++evaluated % MOTION_STATS_FRAMES == 0) {
+            motion_detect_stats_t stats;
+            motion_detect_get_stats(&stats);
+            ESP_LOGI(TAG, "Motion detect: %lu frames, avg %lu us (decode %lu us), max %lu us",
+                     (unsigned long)stats.frames_evaluated, (unsigned long)stats.eval_avg_us,
+                     (unsigned long)stats.decode_avg_us, (unsigned long)stats.eval_max_us);
+        }
+        
+        // While motion holds, shoot at the normal interval; otherwise keepalive only
+        TickType_t save_every = pdMS_TO_TICKS(motion_active ? CAPTURE_INTERVAL_MS : KEEPALIVE_MS);
+        if (last_save != 0 && (now - last_save) < save_every && !motion.motion) {
+            camera_module_return_fb(fb);
+            vTaskDelay(pdMS_TO_TICKS(MOTION_POLL_MS));
+            continue;
+        }
+        last_save = now;
+        
+        ESP_LOGI(TAG, "Taking picture...");
         snprintf(filename, sizeof(filename), "photo_%04d.jpg", photo_index++);
         
+        // Motion shots are always written; only keepalives are deduplicated
+        frame_dedup_result_t dedup = {0};
+        if (motion_active || motion.motion || frame_dedup_check(fb, &dedup) != ESP_OK) {
+            frame_dedup_reset();
+        } else {
+            frame_dedup_stats_t dedup_stats;
+            frame_dedup_get_stats(&dedup_stats);
+            if (dedup_stats.frames % DEDUP_STATS_FRAMES == 0) {
+                ESP_LOGI(TAG, "Dedup: %lu of %lu keepalives referenced, %llu KB saved, hash avg %lu us (max %lu), write avg %llu us",
+                         (unsigned long)dedup_stats.duplicates, (unsigned long)dedup_stats.frames,
+                         dedup_stats.bytes_saved / 1024, (unsigned long)dedup_stats.hash_avg_us,
+                         (unsigned long)dedup_stats.hash_max_us, writes ? write_sum_us / writes : 0);
+            }
+            
+            if (dedup.duplicate) {
+                char line[160];
+                int n = snprintf(line, sizeof(line), "%s %s\n", filename, kept_name);
+                if (sdcard_module_append_file(DEDUP_INDEX, line, n) == ESP_OK) {
+                    ESP_LOGI(TAG, "Photo %s repeats %s (distance %d, hash %lu us), not written",
+                             filename, kept_name, dedup.distance, (unsigned long)dedup.hash_us);
+                    camera_module_return_fb(fb);
+                    vTaskDelay(pdMS_TO_TICKS(MOTION_POLL_MS));
+                    continue;
+                }
+                // Without the index line the photo is written after all
+                frame_dedup_reset();
+            }
+        }
+        
+        int64_t write_start = esp_timer_get_time();
         esp_err_t err = sdcard_module_save_jpeg(fb->buf, fb->len, filename);
         if (err != ESP_OK) {
             ESP_LOGE(TAG, "Failed to save photo to SD card");
+            frame_dedup_reset();
         } else {
+            write_sum_us += esp_timer_get_time() - write_start;
+            writes++;
+            snprintf(kept_name, sizeof(kept_name), "%s", filename);
             ESP_LOGI(TAG, "Photo saved: %s (size: %zu bytes)", filename, fb->len);
+            record_profile_observe_frame(fb->len);
             
             uint64_t free_bytes, total_bytes;
             if (sdcard_module_get_free_space(&free_bytes, &total_bytes) == ESP_OK) {
@@ -50,7 +188,11 @@ static void capture_task(void *pvParameters)
         
         camera_module_return_fb(fb);
         
-        vTaskDelay(pdMS_TO_TICKS(CAPTURE_INTERVAL_MS));
+        if (err == ESP_OK && writes % PROFILE_CHECK_PHOTOS == 0 && record_profile_update()) {
+            apply_profile();
+        }
+        
+        vTaskDelay(pdMS_TO_TICKS(MOTION_POLL_MS));
     }
 }
 
@@ -65,15 +207,8 @@ void app_main(void)
     }
     ESP_ERROR_CHECK(ret);
     
-    camera_config_params_t camera_params = {
-        .frame_size = FRAMESIZE_UXGA,
-        .pixel_format = PIXFORMAT_JPEG,
-        .jpeg_quality = 10,
-        .fb_count = 2
-    };
-    
     ESP_LOGI(TAG, "Initializing camera...");
-    ret = camera_module_init(&camera_params);
+    ret = camera_module_init(&s_camera_params);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Camera init failed");
         return;
@@ -99,8 +234,45 @@ void app_main(void)
         return;
     }
     
+    record_profile_config_t profile_config = {
+        .profiles = s_photo_profiles,
+        .profile_count = sizeof(s_photo_profiles) / sizeof(s_photo_profiles[0]),
+        .margin = PROFILE_MARGIN,
+        .bench_bytes = PROFILE_BENCH_BYTES,
+        .bench_path = PROFILE_BENCH_PATH,
+        .file_per_frame = true,
+        .promote_checks = PROFILE_PROMOTE_CHECKS
+    };
+    ret = record_profile_init(&profile_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Card calibration failed (%s)", esp_err_to_name(ret));
+    }
+    apply_profile();
+    
+    motion_detect_config_t motion_config = {
+        .cell_threshold = 12,
+        .min_changed_fraction = 0.002f,
+        .global_change_fraction = 0.6f,
+        .learn_shift = 3,
+        .zone_count = 0
+    };
+    ret = motion_detect_init(&motion_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Motion detect init failed");
+    }
+    
+    frame_dedup_config_t dedup_config = {
+        .max_distance = DEDUP_MAX_DISTANCE,
+        .max_luma_delta = DEDUP_MAX_LUMA_DELTA,
+        .keyframe_interval = DEDUP_KEYFRAME_EVERY
+    };
+    ret = frame_dedup_init(&dedup_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Frame dedup init failed");
+    }
+    
     ESP_LOGI(TAG, "Starting capture task...");
     xTaskCreate(capture_task, "capture_task", 4096, NULL, 5, NULL);
     
-    ESP_LOGI(TAG, "Camera system ready! Taking photos every %d seconds", CAPTURE_INTERVAL_MS / 1000);
+    ESP_LOGI(TAG, "Camera system ready! Saving photos on motion (checked every %d ms)", MOTION_POLL_MS);
 }
\ No newline at end of file
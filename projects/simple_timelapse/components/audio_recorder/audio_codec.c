@@ -0,0 +1,127 @@
+#include "audio_codec.h"
+
+// Segment of a biased magnitude, indexed by its bits 14..7
+static const uint8_t s_mulaw_segment[256] = {
+    0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+};
+
+static const int16_t s_adpcm_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t s_adpcm_index_shift[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+#define MULAW_BIAS  0x84
+#define MULAW_CLIP  32635
+
+void audio_codec_mulaw_encode(const int16_t *in, uint8_t *out, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        int sample = in[i];
+        uint8_t sign = 0;
+        if (sample < 0) {
+            sign = 0x80;
+            sample = -sample;
+        }
+        if (sample > MULAW_CLIP) {
+            sample = MULAW_CLIP;
+        }
+        sample += MULAW_BIAS;
+        uint8_t segment = s_mulaw_segment[sample >> 7];
+        uint8_t mantissa = (sample >> (segment + 3)) & 0x0F;
+        out[i] = ~(sign | (segment << 4) | mantissa);
+    }
+}
+
+// Picks the nibble whose step reconstruction lands nearest the sample and
+// moves the state exactly as a decoder will
+static inline uint8_t adpcm_encode_sample(int *predictor, int *index, int sample)
+{
+    int step = s_adpcm_steps[*index];
+    int diff = sample - *predictor;
+    uint8_t nibble = 0;
+    if (diff < 0) {
+        nibble = 8;
+        diff = -diff;
+    }
+
+    int delta = step >> 3;
+    if (diff >= step) {
+        nibble |= 4;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        nibble |= 2;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        nibble |= 1;
+        delta += step;
+    }
+
+    int next = (nibble & 8) ? *predictor - delta : *predictor + delta;
+    *predictor = next > INT16_MAX ? INT16_MAX : next < INT16_MIN ? INT16_MIN : next;
+    int shifted = *index + s_adpcm_index_shift[nibble];
+    *index = shifted < 0 ? 0 : shifted > 88 ? 88 : shifted;
+    return nibble;
+}
+
+void audio_codec_adpcm_encode_block(audio_adpcm_state_t *state, const int16_t *in, size_t count,
+                                    uint8_t *out, uint16_t block_align)
+{
+    size_t samples = audio_codec_adpcm_block_samples(block_align);
+    if (count > samples) {
+        count = samples;
+    }
+    int16_t last = count ? in[count - 1] : 0;
+    int16_t first = count ? in[0] : 0;
+
+    // The block starts from its own first sample, stored whole
+    int predictor = first;
+    int index = state->index;
+    out[0] = (uint8_t)first;
+    out[1] = (uint8_t)((uint16_t)first >> 8);
+    out[2] = (uint8_t)index;
+    out[3] = 0;
+
+    uint8_t *dest = out + AUDIO_CODEC_ADPCM_HEADER;
+    for (size_t i = 1; i < samples; i += 2) {
+        int low = i < count ? in[i] : last;
+        int high = i + 1 < count ? in[i + 1] : last;
+        uint8_t nibble = adpcm_encode_sample(&predictor, &index, low);
+        *dest++ = nibble | (adpcm_encode_sample(&predictor, &index, high) << 4);
+    }
+
+    state->predictor = (int16_t)predictor;
+    state->index = (uint8_t)index;
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "audio_segments.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "audio_segments";
+
+#define SEGMENTS_TASK_STACK         4096
+#define SEGMENTS_STOP_TIMEOUT_MS    2000
+
+typedef struct {
+    uint32_t clip;
+    uint64_t sample;
+} mark_t;
+
+static audio_segments_config_t s_config;
+static uint64_t s_duration_samples = 0;     // 0 = no limit
+static uint64_t s_size_samples = 0;
+
+static TaskHandle_t s_task = NULL;
+static SemaphoreHandle_t s_stopped = NULL;
+static SemaphoreHandle_t s_lock = NULL;
+static atomic_bool s_running = false;
+static bool s_stop_pending = false;         // the task outlived a stop's timeout
+
+// Marks wait here, oldest first, under s_lock
+static mark_t s_marks[AUDIO_SEGMENTS_MARKS];
+static uint32_t s_mark_count = 0;
+static audio_segments_stats_t s_stats;
+
+static bool peek_mark(mark_t *mark)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    bool found = s_mark_count > 0;
+    if (found) {
+        *mark = s_marks[0];
+    }
+    xSemaphoreGive(s_lock);
+    return found;
+}
+
+static void pop_mark(bool late)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_mark_count > 0) {
+        memmove(&s_marks[0], &s_marks[1], (s_mark_count - 1) * sizeof(mark_t));
+        s_mark_count--;
+    }
+    s_stats.marks++;
+    if (late) {
+        s_stats.late_marks++;
+    }
+    xSemaphoreGive(s_lock);
+}
+
+// Names the segment starting at the reader
+static void begin_segment(audio_segment_t *seg, audio_reader_t *reader, uint32_t index, uint32_t clip,
+                          audio_segment_cause_t cause)
+{
+    memset(seg, 0, sizeof(*seg));
+    seg->index = index;
+    seg->clip = clip;
+    seg->cause = cause;
+    // Seeking to where the reader is only places it in time
+    audio_recorder_reader_seek(reader, audio_recorder_reader_position(reader), &seg->start);
+    s_config.make_path(seg->path, sizeof(seg->path), seg, s_config.ctx);
+}
+
+static void end_segment(audio_segment_t *seg, const audio_wav_stats_t *ws, size_t header_bytes, esp_err_t ret)
+{
+    seg->samples = ws->samples;
+    seg->file_bytes = ws->data_bytes + header_bytes;
+    seg->ok = ret == ESP_OK;
+
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (seg->ok) {
+        s_stats.segments++;
+    } else {
+        s_stats.failed++;
+    }
+    xSemaphoreGive(s_lock);
+
+    ESP_LOGI(TAG, "Segment %s closed: samples %llu-%llu, %lu bytes", seg->path,
+             (unsigned long long)seg->start.first_sample,
+             (unsigned long long)(seg->start.first_sample + seg->samples), (unsigned long)seg->file_bytes);
+    if (s_config.on_closed) {
+        s_config.on_closed(seg, s_config.ctx);
+    }
+}
+
+static void publish_stats(const audio_reader_t *reader, uint64_t samples)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    s_stats.samples = samples;
+    s_stats.samples_lost = reader->samples_lost;
+    xSemaphoreGive(s_lock);
+}
+
+static void segments_task(void *pvParameters)
+{
+    static audio_reader_t reader;
+    static audio_wav_writer_t writer;
+    static audio_segment_t seg;
+    audio_recorder_reader_init(&reader);
+
+    bool open = false;
+    uint32_t index = 0;
+    uint32_t clip = AUDIO_SEGMENT_NO_CLIP;
+    audio_segment_cause_t cause = AUDIO_SEGMENT_STARTED;
+    uint64_t closed_samples = 0;    // in segments already closed
+
+    while (atomic_load(&s_running)) {
+        if (!open) {
+            begin_segment(&seg, &reader, index, clip, cause);
+            if (audio_wav_open(&writer, seg.path, &s_config.wav) != ESP_OK) {
+                // The ring keeps the audio for a while; try again next poll
+                ESP_LOGE(TAG, "Cannot open segment %s", seg.path);
+                xSemaphoreTake(s_lock, portMAX_DELAY);
+                s_stats.failed++;
+                xSemaphoreGive(s_lock);
+                cause = AUDIO_SEGMENT_REOPENED;
+                vTaskDelay(pdMS_TO_TICKS(s_config.poll_ms));
+                continue;
+            }
+            open = true;
+        }
+
+        // The nearest boundary ahead of the segment's start
+        uint64_t start = seg.start.first_sample;
+        uint64_t position = audio_recorder_reader_position(&reader);
+        uint64_t end = UINT64_MAX;
+        audio_segment_cause_t next = AUDIO_SEGMENT_DURATION;
+        if (s_duration_samples) {
+            end = start + s_duration_samples;
+        }
+        if (s_size_samples && start + s_size_samples < end) {
+            end = start + s_size_samples;
+            next = AUDIO_SEGMENT_SIZE;
+        }
+        mark_t mark;
+        bool marked = peek_mark(&mark);
+        uint64_t mark_at = marked && mark.sample > position ? mark.sample : position;
+        if (marked && mark_at == start) {
+            // Nothing written yet: the segment starts the clip where it is
+            seg.clip = clip = mark.clip;
+            seg.cause = AUDIO_SEGMENT_MARK;
+            pop_mark(mark.sample < start);
+            continue;
+        }
+        if (marked && mark_at <= end) {
+            end = mark_at;
+            next = AUDIO_SEGMENT_MARK;
+        }
+
+        audio_wav_write_until(&writer, &reader, end, NULL);
+        position = audio_recorder_reader_position(&reader);
+        if (position < end) {
+            publish_stats(&reader, closed_samples + writer.stats.samples);
+            vTaskDelay(pdMS_TO_TICKS(s_config.poll_ms));
+            continue;
+        }
+
+        // At the boundary: the next file starts on the sample this one ends before
+        if (next == AUDIO_SEGMENT_MARK) {
+            clip = mark.clip;
+            pop_mark(mark.sample < mark_at);
+        }
+        audio_segment_t done = seg;
+        size_t header_bytes = writer.header_bytes;
+        audio_wav_stats_t closed;
+        begin_segment(&seg, &reader, ++index, clip, next);
+        esp_err_t ret = audio_wav_rotate(&writer, seg.path, &closed);
+        closed_samples += closed.samples;
+        end_segment(&done, &closed, header_bytes, ret);
+        if (!writer.file) {
+            ESP_LOGE(TAG, "Cannot open segment %s", seg.path);
+            xSemaphoreTake(s_lock, portMAX_DELAY);
+            s_stats.failed++;
+            xSemaphoreGive(s_lock);
+            open = false;
+            cause = AUDIO_SEGMENT_REOPENED;
+        }
+        publish_stats(&reader, closed_samples + (open ? writer.stats.samples : 0));
+    }
+
+    if (open) {
+        audio_wav_write_from(&writer, &reader, NULL);
+        size_t header_bytes = writer.header_bytes;
+        esp_err_t ret = audio_wav_close(&writer);
+        closed_samples += writer.stats.samples;
+        end_segment(&seg, &writer.stats, header_bytes, ret);
+    }
+    publish_stats(&reader, closed_samples);
+    xSemaphoreGive(s_stopped);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t reap_task(void)
+{
+    if (xSemaphoreTake(s_stopped, pdMS_TO_TICKS(SEGMENTS_STOP_TIMEOUT_MS)) != pdTRUE) {
+        s_stop_pending = true;
+        return ESP_ERR_TIMEOUT;
+    }
+    s_stop_pending = false;
+    s_task = NULL;
+    return ESP_OK;
+}
+
+esp_err_t audio_segments_start(const audio_segments_config_t *config)
+{
+    if (!config || !config->make_path || config->wav.sample_rate == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (atomic_load(&s_running) || !audio_recorder_is_recording()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // The task's reader, writer and segment are static: a second one may
+    // not start while the last is still closing its file
+    if (s_stop_pending && reap_task() == ESP_ERR_TIMEOUT) {
+        ESP_LOGE(TAG, "Segment task of the last run still running");
+        return ESP_ERR_TIMEOUT;
+    }
+
+    s_config = *config;
+    if (s_config.poll_ms == 0) {
+        s_config.poll_ms = AUDIO_SEGMENTS_POLL_MS_DEFAULT;
+    }
+    s_duration_samples = (uint64_t)s_config.segment_ms * s_config.wav.sample_rate / 1000;
+    s_size_samples = s_config.max_bytes ? audio_wav_samples_within(&s_config.wav, s_config.max_bytes) : 0;
+    if (s_config.max_bytes && s_size_samples == 0) {
+        ESP_LOGE(TAG, "%lu bytes do not hold a sample", (unsigned long)s_config.max_bytes);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!s_stopped) {
+        s_stopped = xSemaphoreCreateBinary();
+        s_lock = xSemaphoreCreateMutex();
+        if (!s_stopped || !s_lock) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    s_mark_count = 0;
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    atomic_store(&s_running, true);
+    BaseType_t created = xTaskCreatePinnedToCore(segments_task, "audio_segments", SEGMENTS_TASK_STACK, NULL,
+                                                 s_config.task_priority, &s_task, s_config.task_core);
+    if (created != pdPASS) {
+        atomic_store(&s_running, false);
+        ESP_LOGE(TAG, "Failed to create segment task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Segmented recording: rotating every %lu ms, at %lu bytes and on marks",
+             (unsigned long)s_config.segment_ms, (unsigned long)s_config.max_bytes);
+    return ESP_OK;
+}
+
+esp_err_t audio_segments_stop(void)
+{
+    if (!atomic_load(&s_running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Stopped either way; a task that outlives the timeout is reaped by the
+    // next start
+    atomic_store(&s_running, false);
+    esp_err_t ret = reap_task();
+    if (ret == ESP_ERR_TIMEOUT) {
+        ESP_LOGW(TAG, "Segment task did not stop in time");
+    }
+    return ret;
+}
+
+esp_err_t audio_segments_mark(uint32_t clip, int64_t time_us)
+{
+    if (!atomic_load(&s_running)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    mark_t mark = { .clip = clip, .sample = audio_recorder_sample_at(time_us) };
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_mark_count < AUDIO_SEGMENTS_MARKS) {
+        s_marks[s_mark_count++] = mark;
+    } else {
+        s_stats.dropped_marks++;
+        ret = ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(s_lock);
+    return ret;
+}
+
+esp_err_t audio_segments_get_stats(audio_segments_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    *stats = s_stats;
+    xSemaphoreGive(s_lock);
+    return ESP_OK;
+}
\ No newline at end of file
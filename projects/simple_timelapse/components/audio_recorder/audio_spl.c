@@ -0,0 +1,131 @@
+#include "audio_spl.h"
+#include <math.h>
+#include <string.h>
+
+#define FULL_SCALE_SQ   (32768.0 * 32768.0)
+#define QUIET_SQ        1e-3    // mean square below any real signal, keeps the log finite
+
+static float level_db(double mean_square, float calibration_db)
+{
+    if (mean_square < QUIET_SQ) {
+        mean_square = QUIET_SQ;
+    }
+    return (float)(10.0 * log10(mean_square / FULL_SCALE_SQ)) + calibration_db;
+}
+
+static void start_interval(audio_spl_t *spl)
+{
+    memset(&spl->result, 0, sizeof(spl->result));
+    spl->energy = 0;
+    spl->count = 0;
+    spl->peak = 0;
+    spl->fast_max = 0;
+    spl->fast_min = INFINITY;
+}
+
+esp_err_t audio_spl_init(audio_spl_t *spl, const audio_spl_config_t *config)
+{
+    if (!spl || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uint32_t rate = audio_recorder_sample_rate();
+    if (rate == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    memset(spl, 0, sizeof(*spl));
+    spl->config = *config;
+    if (spl->config.interval_ms == 0) {
+        spl->config.interval_ms = AUDIO_SPL_INTERVAL_MS_DEFAULT;
+    }
+    // Whole fast periods to an interval
+    spl->fast_samples = rate * AUDIO_SPL_FAST_MS / 1000;
+    uint32_t fast_periods = (spl->config.interval_ms + AUDIO_SPL_FAST_MS / 2) / AUDIO_SPL_FAST_MS;
+    spl->interval_samples = (fast_periods ? fast_periods : 1) * spl->fast_samples;
+    start_interval(spl);
+    return audio_recorder_reader_init(&spl->reader);
+}
+
+static void close_fast(audio_spl_t *spl)
+{
+    double n = spl->fast_count;
+    double energy = (double)spl->fast_energy - (double)spl->fast_sum * (double)spl->fast_sum / n;
+    if (energy < 0) {
+        energy = 0;
+    }
+    double mean_square = energy / n;
+    if (mean_square > spl->fast_max) {
+        spl->fast_max = mean_square;
+    }
+    if (mean_square < spl->fast_min) {
+        spl->fast_min = mean_square;
+    }
+    spl->energy += (uint64_t)energy;
+    spl->count += spl->fast_count;
+    spl->fast_energy = 0;
+    spl->fast_sum = 0;
+    spl->fast_count = 0;
+}
+
+static void finish_interval(audio_spl_t *spl, audio_spl_result_t *result)
+{
+    float cal = spl->config.calibration_db;
+    spl->result.samples = spl->count;
+    spl->result.leq_db = level_db((double)spl->energy / spl->count, cal);
+    spl->result.max_db = level_db(spl->fast_max, cal);
+    spl->result.min_db = level_db(spl->fast_min, cal);
+    spl->result.peak_db = level_db((double)spl->peak * spl->peak, cal);
+    *result = spl->result;
+    start_interval(spl);
+}
+
+esp_err_t audio_spl_process(audio_spl_t *spl, audio_spl_result_t *result, uint32_t timeout_ms)
+{
+    if (!spl || !result) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    while (1) {
+        audio_block_ref_t ref;
+        esp_err_t ret = audio_recorder_reader_acquire(&spl->reader, &ref, spl->fast_samples - spl->fast_count,
+                                                      timeout_ms);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        timeout_ms = 0;
+
+        if (spl->reader.overruns != spl->overruns_seen) {
+            spl->result.overruns += spl->reader.overruns - spl->overruns_seen;
+            spl->overruns_seen = spl->reader.overruns;
+        }
+        if (spl->count == 0 && spl->fast_count == 0) {
+            spl->result.start = ref.info;
+        }
+
+        uint64_t energy = 0;
+        int64_t sum = 0;
+        int32_t peak = spl->peak;
+        for (size_t i = 0; i < ref.count; i++) {
+            int32_t x = ref.samples[i];
+            energy += (uint64_t)(x * x);
+            sum += x;
+            int32_t mag = x < 0 ? -x : x;
+            if (mag > peak) {
+                peak = mag;
+            }
+        }
+        spl->fast_count += ref.count;
+        audio_recorder_block_release(&ref);
+
+        spl->fast_energy += energy;
+        spl->fast_sum += sum;
+        spl->peak = peak;
+        if (spl->fast_count == spl->fast_samples) {
+            close_fast(spl);
+            if (spl->count >= spl->interval_samples) {
+                finish_interval(spl, result);
+                return ESP_OK;
+            }
+        }
+    }
+}
\ No newline at end of file
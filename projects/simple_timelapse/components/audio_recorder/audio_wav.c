@@ -0,0 +1,538 @@
+#include "audio_wav.h"
+#include "sdcard_module.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <string.h>
+#include <unistd.h>
+
+static const char *TAG = "audio_wav";
+
+// Samples the AGC takes at a time
+#define AGC_SLICE   256
+
+
+static uint8_t *put_u16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t value)
+{
+    p = put_u16(p, (uint16_t)value);
+    return put_u16(p, (uint16_t)(value >> 16));
+}
+
+static uint8_t *put_tag(uint8_t *p, const char *tag)
+{
+    memcpy(p, tag, 4);
+    return p + 4;
+}
+
+static uint16_t adpcm_block_align(const audio_wav_config_t *config)
+{
+    if (config->block_align) {
+        return config->block_align;
+    }
+    uint32_t scale = config->sample_rate / 11025;
+    return 256 * (scale ? scale : 1);
+}
+
+// Bytes and samples of one block: an ADPCM block, a mu-law byte or a PCM frame
+static void block_size(const audio_wav_config_t *config, uint32_t *bytes, uint32_t *samples)
+{
+    switch (config->format) {
+    case AUDIO_WAV_IMA_ADPCM:
+        *bytes = adpcm_block_align(config);
+        *samples = audio_codec_adpcm_block_samples(*bytes);
+        break;
+    case AUDIO_WAV_MULAW:
+        *bytes = 1;
+        *samples = 1;
+        break;
+    default:
+        *bytes = config->channels * sizeof(int16_t);
+        *samples = 1;
+        break;
+    }
+}
+
+uint32_t audio_wav_byte_rate(const audio_wav_config_t *config)
+{
+    if (!config) {
+        return 0;
+    }
+    uint32_t bytes, samples;
+    block_size(config, &bytes, &samples);
+    return (uint32_t)((uint64_t)config->sample_rate * bytes / samples);
+}
+
+static size_t header_size(audio_wav_format_t format)
+{
+    switch (format) {
+    case AUDIO_WAV_IMA_ADPCM:
+        return 60;      // fmt with cbSize and samples per block, fact
+    case AUDIO_WAV_MULAW:
+        return 58;      // fmt with cbSize, fact
+    default:
+        return sizeof(wav_header_t);
+    }
+}
+
+uint32_t audio_wav_samples_within(const audio_wav_config_t *config, uint32_t bytes)
+{
+    size_t header = config ? header_size(config->format) : 0;
+    if (!config || bytes <= header) {
+        return 0;
+    }
+    audio_wav_config_t sized = *config;
+    sized.block_align = config->format == AUDIO_WAV_IMA_ADPCM ? adpcm_block_align(config) : 0;
+    uint32_t block_bytes, samples;
+    block_size(&sized, &block_bytes, &samples);
+    return (bytes - header) / block_bytes * samples;
+}
+
+// Sizes cover whole blocks on the card; fact counts the samples they hold
+static size_t build_header(const audio_wav_writer_t *writer, uint8_t *out)
+{
+    const audio_wav_config_t *config = &writer->config;
+    uint32_t bytes, samples;
+    block_size(&writer->config, &bytes, &samples);
+    uint32_t data_bytes = writer->stats.data_bytes - writer->stats.data_bytes % bytes;
+    uint32_t frames = data_bytes / bytes * samples;
+    if (frames > writer->stats.samples) {
+        frames = writer->stats.samples;
+    }
+
+    uint16_t tag = 1, bits = 16, extra = 0;
+    if (config->format == AUDIO_WAV_MULAW) {
+        tag = AUDIO_CODEC_MULAW_TAG;
+        bits = 8;
+        extra = 2;
+    } else if (config->format == AUDIO_WAV_IMA_ADPCM) {
+        tag = AUDIO_CODEC_ADPCM_TAG;
+        bits = 4;
+        extra = 4;
+    }
+
+    uint8_t *p = out;
+    p = put_tag(p, "RIFF");
+    p = put_u32(p, (uint32_t)writer->header_bytes - 8 + data_bytes);
+    p = put_tag(p, "WAVE");
+    p = put_tag(p, "fmt ");
+    p = put_u32(p, 16 + extra);
+    p = put_u16(p, tag);
+    p = put_u16(p, config->channels);
+    p = put_u32(p, config->sample_rate);
+    p = put_u32(p, audio_wav_byte_rate(&writer->config));
+    p = put_u16(p, (uint16_t)bytes);
+    p = put_u16(p, bits);
+    if (extra) {
+        p = put_u16(p, extra - 2);
+        if (config->format == AUDIO_WAV_IMA_ADPCM) {
+            p = put_u16(p, (uint16_t)samples);
+        }
+        p = put_tag(p, "fact");
+        p = put_u32(p, 4);
+        p = put_u32(p, frames);
+    }
+    p = put_tag(p, "data");
+    p = put_u32(p, data_bytes);
+    return p - out;
+}
+
+static esp_err_t write_header(audio_wav_writer_t *writer)
+{
+    uint8_t header[AUDIO_WAV_HEADER_MAX];
+    size_t size = build_header(writer, header);
+    if (fseek(writer->file, 0, SEEK_SET) != 0 ||
+        fwrite(header, size, 1, writer->file) != 1 ||
+        fseek(writer->file, 0, SEEK_END) != 0) {
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+// Patches the sizes and pushes them, with the data written so far, to the card
+static esp_err_t checkpoint(audio_wav_writer_t *writer)
+{
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = write_header(writer);
+    if (ret == ESP_OK && (fflush(writer->file) != 0 || fsync(fileno(writer->file)) != 0)) {
+        ret = ESP_FAIL;
+    }
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    if (elapsed > writer->stats.checkpoint_max_us) {
+        writer->stats.checkpoint_max_us = elapsed;
+    }
+    writer->stats.checkpoints++;
+    return ret;
+}
+
+static esp_err_t flush_chunk(audio_wav_writer_t *writer)
+{
+    if (writer->fill == 0) {
+        return ESP_OK;
+    }
+
+    int64_t start = esp_timer_get_time();
+    size_t wanted = writer->fill;
+    size_t written = fwrite(writer->chunk, 1, wanted, writer->file);
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    if (elapsed > writer->stats.write_max_us) {
+        writer->stats.write_max_us = elapsed;
+    }
+    writer->stats.data_bytes += written;
+    writer->stats.chunks++;
+    writer->fill = 0;
+    writer->fill_target = writer->chunk_bytes;
+    if (written != wanted) {
+        ESP_LOGE(TAG, "Chunk write failed, %u of %u bytes", (unsigned)written, (unsigned)wanted);
+        return ESP_FAIL;
+    }
+
+    if (writer->checkpoint_bytes && writer->stats.data_bytes >= writer->next_checkpoint) {
+        writer->next_checkpoint = writer->stats.data_bytes + writer->checkpoint_bytes;
+        return checkpoint(writer);
+    }
+    return ESP_OK;
+}
+
+static void release(audio_wav_writer_t *writer)
+{
+    heap_caps_free(writer->chunk);
+    heap_caps_free(writer->pcm);
+    heap_caps_free(writer->block);
+    heap_caps_free(writer->agc_out);
+    audio_agc_deinit(&writer->agc);
+    writer->chunk = NULL;
+    writer->pcm = NULL;
+    writer->block = NULL;
+    writer->agc_out = NULL;
+}
+
+// Creates the file and writes a header with zero sizes
+static esp_err_t start_file(audio_wav_writer_t *writer, const char *path)
+{
+    memset(&writer->stats, 0, sizeof(writer->stats));
+    writer->fill = 0;
+    writer->next_checkpoint = writer->checkpoint_bytes;
+    writer->file = sdcard_module_open_file(path, "wb");
+    if (!writer->file) {
+        ESP_LOGE(TAG, "Cannot create %s", path);
+        return ESP_FAIL;
+    }
+    // The chunk is the buffer; stdio would only copy it again
+    setvbuf(writer->file, NULL, _IONBF, 0);
+
+    if (write_header(writer) != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot write the header of %s", path);
+        fclose(writer->file);
+        writer->file = NULL;
+        return ESP_FAIL;
+    }
+    writer->fill_target = writer->chunk_bytes - writer->header_bytes;
+    return ESP_OK;
+}
+
+esp_err_t audio_wav_open(audio_wav_writer_t *writer, const char *path, const audio_wav_config_t *config)
+{
+    if (!writer || !path || !config || config->sample_rate == 0 || config->channels == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->format != AUDIO_WAV_PCM16 && config->channels != 1) {
+        ESP_LOGE(TAG, "Encoded formats are mono only");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (config->agc.enabled && config->channels != 1) {
+        ESP_LOGE(TAG, "Gain control is mono only");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    memset(writer, 0, sizeof(*writer));
+    writer->config = *config;
+    if (config->format == AUDIO_WAV_IMA_ADPCM) {
+        writer->config.block_align = adpcm_block_align(config);
+    }
+    if (config->format == AUDIO_WAV_IMA_ADPCM && writer->config.block_align <= AUDIO_CODEC_ADPCM_HEADER) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    writer->header_bytes = header_size(config->format);
+    writer->chunk_bytes = config->chunk_bytes ? config->chunk_bytes : AUDIO_WAV_CHUNK_DEFAULT;
+    if (writer->chunk_bytes <= writer->header_bytes) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    writer->checkpoint_bytes = (uint32_t)((uint64_t)audio_wav_byte_rate(&writer->config) * config->checkpoint_ms / 1000);
+
+    // Internal RAM, so the card driver can DMA straight from it
+    writer->chunk = heap_caps_malloc(writer->chunk_bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (config->format == AUDIO_WAV_IMA_ADPCM) {
+        writer->pcm_samples = audio_codec_adpcm_block_samples(writer->config.block_align);
+        writer->block = heap_caps_malloc(writer->config.block_align, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (writer->pcm_samples) {
+        writer->pcm = heap_caps_malloc(writer->pcm_samples * sizeof(int16_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!writer->chunk || (writer->pcm_samples && !writer->pcm) ||
+        (config->format == AUDIO_WAV_IMA_ADPCM && !writer->block)) {
+        release(writer);
+        return ESP_ERR_NO_MEM;
+    }
+    if (config->agc.enabled) {
+        esp_err_t ret = audio_agc_init(&writer->agc, &config->agc, config->sample_rate);
+        if (ret == ESP_OK) {
+            writer->agc_out = heap_caps_malloc((AGC_SLICE + AUDIO_AGC_FRAME) * sizeof(int16_t),
+                                               MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            ret = writer->agc_out ? ESP_OK : ESP_ERR_NO_MEM;
+        }
+        if (ret != ESP_OK) {
+            release(writer);
+            return ret;
+        }
+    }
+
+    esp_err_t ret = start_file(writer, path);
+    if (ret != ESP_OK) {
+        release(writer);
+    }
+    return ret;
+}
+
+static esp_err_t append(audio_wav_writer_t *writer, const uint8_t *src, size_t bytes)
+{
+    while (bytes > 0) {
+        size_t take = writer->fill_target - writer->fill;
+        if (take > bytes) {
+            take = bytes;
+        }
+        memcpy(writer->chunk + writer->fill, src, take);
+        writer->fill += take;
+        src += take;
+        bytes -= take;
+        if (writer->fill == writer->fill_target) {
+            esp_err_t ret = flush_chunk(writer);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+// Encodes straight into the chunk
+static esp_err_t append_mulaw(audio_wav_writer_t *writer, const int16_t *samples, size_t count)
+{
+    while (count > 0) {
+        size_t take = writer->fill_target - writer->fill;
+        if (take > count) {
+            take = count;
+        }
+        int64_t start = esp_timer_get_time();
+        audio_codec_mulaw_encode(samples, writer->chunk + writer->fill, take);
+        writer->stats.encode_us += esp_timer_get_time() - start;
+        writer->fill += take;
+        samples += take;
+        count -= take;
+        if (writer->fill == writer->fill_target) {
+            esp_err_t ret = flush_chunk(writer);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+// Encodes one block, padding a short last one
+static esp_err_t append_adpcm_block(audio_wav_writer_t *writer, const int16_t *samples, size_t count)
+{
+    int64_t start = esp_timer_get_time();
+    audio_codec_adpcm_encode_block(&writer->adpcm, samples, count, writer->block, writer->config.block_align);
+    writer->stats.encode_us += esp_timer_get_time() - start;
+    return append(writer, writer->block, writer->config.block_align);
+}
+
+static esp_err_t append_staged(audio_wav_writer_t *writer)
+{
+    esp_err_t ret = append_adpcm_block(writer, writer->pcm, writer->pcm_fill);
+    writer->pcm_fill = 0;
+    return ret;
+}
+
+static esp_err_t encode_samples(audio_wav_writer_t *writer, const int16_t *samples, size_t count)
+{
+    switch (writer->config.format) {
+    case AUDIO_WAV_MULAW:
+        return append_mulaw(writer, samples, count);
+    case AUDIO_WAV_IMA_ADPCM:
+        while (count > 0) {
+            if (writer->pcm_fill == 0 && count >= writer->pcm_samples) {
+                // A whole block at hand is encoded where it lies
+                esp_err_t ret = append_adpcm_block(writer, samples, writer->pcm_samples);
+                if (ret != ESP_OK) {
+                    return ret;
+                }
+                samples += writer->pcm_samples;
+                count -= writer->pcm_samples;
+                continue;
+            }
+            size_t take = writer->pcm_samples - writer->pcm_fill;
+            if (take > count) {
+                take = count;
+            }
+            memcpy(writer->pcm + writer->pcm_fill, samples, take * sizeof(int16_t));
+            writer->pcm_fill += take;
+            samples += take;
+            count -= take;
+            if (writer->pcm_fill == writer->pcm_samples) {
+                esp_err_t ret = append_staged(writer);
+                if (ret != ESP_OK) {
+                    return ret;
+                }
+            }
+        }
+        return ESP_OK;
+    default:
+        return append(writer, (const uint8_t *)samples, count * sizeof(int16_t));
+    }
+}
+
+// Through the AGC, when on, a slice at a time
+static esp_err_t append_samples(audio_wav_writer_t *writer, const int16_t *samples, size_t count)
+{
+    if (!writer->agc_out) {
+        return encode_samples(writer, samples, count);
+    }
+    while (count > 0) {
+        size_t take = count < AGC_SLICE ? count : AGC_SLICE;
+        int64_t start = esp_timer_get_time();
+        size_t out = audio_agc_process(&writer->agc, samples, take, writer->agc_out);
+        writer->stats.agc_us += esp_timer_get_time() - start;
+        esp_err_t ret = encode_samples(writer, writer->agc_out, out);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        samples += take;
+        count -= take;
+    }
+    return ESP_OK;
+}
+
+esp_err_t audio_wav_write(audio_wav_writer_t *writer, const int16_t *samples, size_t count)
+{
+    if (!writer || !writer->file || (!samples && count)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    writer->stats.samples += count;
+    return append_samples(writer, samples, count);
+}
+
+// Encodes or copies from the ring block itself, never past limit samples
+static esp_err_t take_from(audio_wav_writer_t *writer, audio_reader_t *reader, uint64_t limit, size_t *got)
+{
+    *got = 0;
+    audio_block_ref_t ref;
+    esp_err_t ret = audio_recorder_reader_acquire(reader, &ref, limit > SIZE_MAX ? SIZE_MAX : (size_t)limit, 0);
+    if (ret != ESP_OK || ref.count == 0) {
+        return ret;
+    }
+    writer->stats.samples += ref.count;
+    *got = ref.count;
+    ret = append_samples(writer, ref.samples, ref.count);
+    audio_recorder_block_release(&ref);
+    return ret;
+}
+
+esp_err_t audio_wav_write_from(audio_wav_writer_t *writer, audio_reader_t *reader, size_t *count)
+{
+    return audio_wav_write_until(writer, reader, UINT64_MAX, count);
+}
+
+esp_err_t audio_wav_write_until(audio_wav_writer_t *writer, audio_reader_t *reader, uint64_t end_sample,
+                                size_t *count)
+{
+    if (!writer || !writer->file || !reader) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t total = 0;
+    esp_err_t ret = ESP_OK;
+    while (1) {
+        uint64_t position = audio_recorder_reader_position(reader);
+        uint64_t limit = end_sample > position ? end_sample - position : 0;
+        size_t got = 0;
+        esp_err_t read_ret = take_from(writer, reader, limit, &got);
+        total += got;
+        if (got == 0 || read_ret != ESP_OK) {
+            // A failed read only means nothing more to take
+            if (got) {
+                ret = read_ret;
+            }
+            break;
+        }
+    }
+    if (count) {
+        *count = total;
+    }
+    return ret;
+}
+
+// Writes what is held back, patches the sizes and closes the file
+static esp_err_t finish_file(audio_wav_writer_t *writer)
+{
+    esp_err_t ret = ESP_OK;
+    if (writer->agc_out) {
+        // The look-ahead still holds the last few milliseconds
+        size_t out;
+        while (ret == ESP_OK && (out = audio_agc_drain(&writer->agc, writer->agc_out)) > 0) {
+            ret = encode_samples(writer, writer->agc_out, out);
+        }
+    }
+    if (ret == ESP_OK && writer->config.format == AUDIO_WAV_IMA_ADPCM && writer->pcm_fill > 0) {
+        ret = append_staged(writer);
+    }
+    if (flush_chunk(writer) != ESP_OK) {
+        ret = ESP_FAIL;
+    }
+    if (write_header(writer) != ESP_OK) {
+        ret = ESP_FAIL;
+    }
+    if (fclose(writer->file) != 0) {
+        ret = ESP_FAIL;
+    }
+    writer->file = NULL;
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "WAV file not finished cleanly");
+    }
+    return ret;
+}
+
+esp_err_t audio_wav_rotate(audio_wav_writer_t *writer, const char *path, audio_wav_stats_t *closed)
+{
+    if (!writer || !writer->file || !path) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = finish_file(writer);
+    if (closed) {
+        *closed = writer->stats;
+    }
+    if (start_file(writer, path) != ESP_OK) {
+        release(writer);
+    }
+    return ret;
+}
+
+esp_err_t audio_wav_close(audio_wav_writer_t *writer)
+{
+    if (!writer || !writer->file) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = finish_file(writer);
+    release(writer);
+    return ret;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulated microphone for linux target builds. Samples come due in real
+// time at the configured rate from the moment the channel is enabled, and
+// the DMA holds buffer_count buffers of them: a reader that falls further
+// behind loses the oldest, as the I2S driver does, and the loss counts as
+// a DMA overflow. The ramp signal is the sample index itself, so a gap or
+// a repeat anywhere downstream shows as a step other than one.
+typedef enum {
+    AUDIO_PORT_SIM_RAMP = 0,
+    AUDIO_PORT_SIM_TONE,
+    AUDIO_PORT_SIM_FILE,
+} audio_port_sim_signal_t;
+
+typedef struct {
+    audio_port_sim_signal_t signal;
+    float tone_hz;
+    int16_t amplitude;
+    const char *path;           // raw 16-bit mono PCM at the sample rate, looped
+} audio_port_sim_config_t;
+
+// Takes effect at the next audio_recorder_init(), which starts the signal
+// from its first sample
+esp_err_t audio_port_sim_configure(const audio_port_sim_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
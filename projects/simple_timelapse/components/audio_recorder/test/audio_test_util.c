@@ -0,0 +1,79 @@
+#include "audio_test_util.h"
+#include "unity.h"
+#include "audio_port_sim.h"
+#include "sdcard_module.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+audio_config_t audio_test_config(void)
+{
+    audio_config_t config = {
+        .mode = AUDIO_MIC_PDM,
+        .pdm_clk_gpio = 1,
+        .pdm_data_gpio = 2,
+        .sample_rate = AUDIO_TEST_RATE,
+        .buffer_count = 8,
+        .buffer_len = AUDIO_TEST_BLOCK_BYTES,
+        .task_priority = 10,
+    };
+    return config;
+}
+
+void audio_test_recorder_start(uint32_t ring_ms)
+{
+    audio_port_sim_config_t sim = { .signal = AUDIO_PORT_SIM_RAMP };
+    TEST_ASSERT_EQUAL(ESP_OK, audio_port_sim_configure(&sim));
+    audio_config_t config = audio_test_config();
+    config.ring_ms = ring_ms;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_init(&config));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_start_recording());
+}
+
+uint16_t audio_test_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t audio_test_u32(const uint8_t *p)
+{
+    return audio_test_u16(p) | ((uint32_t)audio_test_u16(p + 2) << 16);
+}
+
+void audio_test_write_card(const char *path, const void *data, size_t len)
+{
+    FILE *f = sdcard_module_open_file(path, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    TEST_ASSERT_EQUAL(1, fwrite(data, len, 1, f));
+    fclose(f);
+}
+
+uint8_t *audio_test_read_card(const char *path, size_t *len)
+{
+    char full[64];
+    snprintf(full, sizeof(full), "%s/%s", AUDIO_TEST_CARD, path);
+    FILE *f = fopen(full, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    *len = (size_t)ftell(f);
+    rewind(f);
+    uint8_t *data = malloc(*len);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL(1, fread(data, *len, 1, f));
+    fclose(f);
+    return data;
+}
+
+const uint8_t *audio_test_wav_data(const uint8_t *wav, size_t len, uint32_t *data_bytes)
+{
+    // Chunks follow the 12-byte RIFF header, each padded to an even size
+    for (size_t at = 12; at + 8 <= len;) {
+        uint32_t size = audio_test_u32(wav + at + 4);
+        if (memcmp(wav + at, "data", 4) == 0) {
+            *data_bytes = size;
+            return wav + at + 8;
+        }
+        at += 8 + size + (size & 1);
+    }
+    return NULL;
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "audio_recorder.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// Shared by the component's tests; they run on the linux target with the
+// card mounted under ./sdcard
+
+#define AUDIO_TEST_RATE         16000
+#define AUDIO_TEST_BLOCK_BYTES  256     // 8 ms blocks
+#define AUDIO_TEST_CARD         "sdcard"
+
+// A PDM microphone at the test rate and block size, everything else default
+audio_config_t audio_test_config(void);
+
+// Starts the recorder on the simulated microphone's ramp, whose samples are
+// their own index; ring_ms 0 keeps the default ring
+void audio_test_recorder_start(uint32_t ring_ms);
+
+uint16_t audio_test_u16(const uint8_t *p);
+uint32_t audio_test_u32(const uint8_t *p);
+
+void audio_test_write_card(const char *path, const void *data, size_t len);
+
+// The whole file at path on the card, malloc'd
+uint8_t *audio_test_read_card(const char *path, size_t *len);
+
+// The data chunk of a WAV file, or NULL without one
+const uint8_t *audio_test_wav_data(const uint8_t *wav, size_t len, uint32_t *data_bytes);
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "unity.h"
+#include "audio_activation.h"
+#include "audio_port_sim.h"
+#include "audio_test_util.h"
+#include "sdcard_module.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs on the linux target. The simulated microphone loops a quiet hiss
+// with one burst of tone in it, so the detector's onset and release and
+// the segment around them are known to the sample.
+
+#define TEST_LOOP_SAMPLES   (3 * AUDIO_TEST_RATE)
+#define TEST_TONE_START     (AUDIO_TEST_RATE * 3 / 2)
+#define TEST_TONE_END       (TEST_TONE_START + AUDIO_TEST_RATE * 3 / 10)
+#define TEST_BLOCK_SAMPLES  (AUDIO_TEST_BLOCK_BYTES / sizeof(int16_t))
+#define TEST_HANGOVER_MS    300
+#define TEST_PREROLL_MS     500
+#define TEST_HOLD_MS        400
+#define TEST_SIGNAL_PATH    "activation.raw"
+
+typedef struct {
+    uint32_t named;
+    const char *first_path;     // the first segment's name, when not the usual one
+    uint32_t stall_ms;          // the first make_path sleeps this long
+    int64_t stalled_until;
+    uint64_t first_sample;
+    char path[64];
+} activation_ctx_t;
+
+static int16_t s_signal[TEST_LOOP_SAMPLES];
+
+static void recorder_start(void)
+{
+    sdcard_config_t sd = {0};
+    TEST_ASSERT_EQUAL(ESP_OK, sdcard_module_init(&sd));
+    uint32_t rng = 1;
+    for (int i = 0; i < TEST_LOOP_SAMPLES; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        int16_t hiss = (int16_t)(rng % 81) - 40;
+        bool tone = i >= TEST_TONE_START && i < TEST_TONE_END;
+        s_signal[i] = tone ? (int16_t)lrintf(8000 * sinf(2 * (float)M_PI * 1000 * i / AUDIO_TEST_RATE)) : hiss;
+    }
+    audio_test_write_card(TEST_SIGNAL_PATH, s_signal, sizeof(s_signal));
+
+    audio_port_sim_config_t sim = { .signal = AUDIO_PORT_SIM_FILE, .path = AUDIO_TEST_CARD "/" TEST_SIGNAL_PATH };
+    TEST_ASSERT_EQUAL(ESP_OK, audio_port_sim_configure(&sim));
+    audio_config_t config = audio_test_config();
+    config.vad.enabled = true;
+    config.vad.hangover_ms = TEST_HANGOVER_MS;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_init(&config));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_start_recording());
+}
+
+static void recorder_stop(void)
+{
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_deinit());
+}
+
+static void make_path(char *path, size_t size, const audio_block_info_t *start, void *ctx)
+{
+    activation_ctx_t *test = ctx;
+    if (test->named++ == 0) {
+        if (test->stall_ms) {
+            vTaskDelay(pdMS_TO_TICKS(test->stall_ms));
+            test->stalled_until = esp_timer_get_time();
+        }
+        if (test->first_path) {
+            snprintf(path, size, "%s", test->first_path);
+            return;
+        }
+    }
+    snprintf(path, size, "act_%llu.wav", (unsigned long long)start->first_sample);
+    snprintf(test->path, sizeof(test->path), "%s", path);
+    test->first_sample = start->first_sample;
+}
+
+static audio_activation_config_t activation_config(activation_ctx_t *test)
+{
+    audio_activation_config_t config = {
+        .preroll_ms = TEST_PREROLL_MS,
+        .hold_ms = TEST_HOLD_MS,
+        .poll_ms = 50,
+        .wav = { .sample_rate = AUDIO_TEST_RATE, .channels = 1 },
+        .make_path = make_path,
+        .ctx = test,
+        .task_priority = 5,
+    };
+    return config;
+}
+
+// The burst starts mid-block and ends on a block boundary
+static void check_vad(const audio_vad_state_t *vad)
+{
+    TEST_ASSERT_EQUAL(1, vad->onsets);
+    TEST_ASSERT_FALSE(vad->active);
+    TEST_ASSERT_EQUAL(TEST_TONE_START / TEST_BLOCK_SAMPLES * TEST_BLOCK_SAMPLES, vad->onset_sample);
+    uint64_t hangover = TEST_HANGOVER_MS * AUDIO_TEST_RATE / 1000;
+    TEST_ASSERT_GREATER_OR_EQUAL(TEST_TONE_END + hangover, vad->release_sample);
+    TEST_ASSERT_LESS_OR_EQUAL(TEST_TONE_END + hangover + 2 * TEST_BLOCK_SAMPLES, vad->release_sample);
+}
+
+// The segment runs from the preroll before the onset to the hold after
+// the release, sample for sample as the microphone heard it
+static void check_segment(const activation_ctx_t *test, const audio_vad_state_t *vad)
+{
+    uint64_t start = vad->onset_sample - TEST_PREROLL_MS * AUDIO_TEST_RATE / 1000;
+    uint64_t end = vad->release_sample + TEST_HOLD_MS * AUDIO_TEST_RATE / 1000;
+    TEST_ASSERT_EQUAL(start, test->first_sample);
+
+    size_t len;
+    uint8_t *wav = audio_test_read_card(test->path, &len);
+    uint32_t data_bytes;
+    const uint8_t *data = audio_test_wav_data(wav, len, &data_bytes);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL((end - start) * sizeof(int16_t), data_bytes);
+    for (uint64_t i = 0; i < end - start; i++) {
+        TEST_ASSERT_EQUAL_INT16(s_signal[(start + i) % TEST_LOOP_SAMPLES], (int16_t)audio_test_u16(data + 2 * i));
+    }
+    free(wav);
+}
+
+TEST_CASE("activity starts on the burst and ends a hangover after it", "[audio][vad]")
+{
+    recorder_start();
+    vTaskDelay(pdMS_TO_TICKS(2400));
+    audio_vad_state_t vad;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_vad(&vad));
+    check_vad(&vad);
+    uint64_t active = vad.release_sample - vad.onset_sample;
+    TEST_ASSERT_EQUAL(active, vad.active_samples);
+    recorder_stop();
+}
+
+TEST_CASE("a segment holds the preroll, the sound and the hold", "[audio][activation]")
+{
+    recorder_start();
+    static activation_ctx_t test;
+    memset(&test, 0, sizeof(test));
+    audio_activation_config_t config = activation_config(&test);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_start(&config));
+    vTaskDelay(pdMS_TO_TICKS(2800));
+    TEST_ASSERT_FALSE(audio_activation_in_segment());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_stop());
+
+    audio_vad_state_t vad;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_vad(&vad));
+    check_vad(&vad);
+    audio_activation_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_get_stats(&stats));
+    TEST_ASSERT_EQUAL(1, stats.segments);
+    TEST_ASSERT_EQUAL(0, stats.failed);
+    check_segment(&test, &vad);
+    recorder_stop();
+}
+
+TEST_CASE("an onset whose file would not open is recorded at the next poll", "[audio][activation]")
+{
+    recorder_start();
+    static activation_ctx_t test;
+    memset(&test, 0, sizeof(test));
+    test.first_path = "no_such_dir/act.wav";
+    audio_activation_config_t config = activation_config(&test);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_start(&config));
+    vTaskDelay(pdMS_TO_TICKS(2800));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_stop());
+
+    audio_vad_state_t vad;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_vad(&vad));
+    audio_activation_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_get_stats(&stats));
+    TEST_ASSERT_EQUAL(1, stats.failed);
+    TEST_ASSERT_EQUAL(1, stats.segments);
+    check_segment(&test, &vad);
+    recorder_stop();
+}
+
+TEST_CASE("an activation start after a timed-out stop waits for the last task", "[audio][activation]")
+{
+    recorder_start();
+    static activation_ctx_t test;
+    memset(&test, 0, sizeof(test));
+    test.stall_ms = 2500;
+    audio_activation_config_t config = activation_config(&test);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_start(&config));
+
+    // Stuck naming the burst's segment, the task outlives the stop
+    vTaskDelay(pdMS_TO_TICKS(1700));
+    TEST_ASSERT_EQUAL(1, test.named);
+    TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, audio_activation_stop());
+
+    // The next run only begins once the last task has gone
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_start(&config));
+    int64_t started = esp_timer_get_time();
+    TEST_ASSERT_NOT_EQUAL(0, test.stalled_until);
+    TEST_ASSERT_GREATER_OR_EQUAL(test.stalled_until, started);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_activation_stop());
+    recorder_stop();
+}
\ No newline at end of file
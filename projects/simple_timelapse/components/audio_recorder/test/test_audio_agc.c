@@ -0,0 +1,219 @@
+#include "unity.h"
+#include "audio_agc.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs on the linux target. Signals are made here so the levels are exact.
+
+#define TEST_RATE       16000
+#define CEILING_DBFS    (-1)
+
+typedef struct {
+    int16_t *pcm;
+    size_t count;
+} signal_t;
+
+static uint32_t s_rng = 1;
+
+static float noise(void)
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return (s_rng & 0xFFFF) / 65536.0f - 0.5f;
+}
+
+// A sine at the given RMS level, appended to the signal
+static void add_tone(signal_t *s, float seconds, float rms_dbfs, float hz)
+{
+    size_t n = (size_t)(seconds * TEST_RATE);
+    s->pcm = realloc(s->pcm, (s->count + n) * sizeof(int16_t));
+    TEST_ASSERT_NOT_NULL(s->pcm);
+    float amplitude = 32768.0f * powf(10.0f, rms_dbfs / 20.0f) * sqrtf(2.0f);
+    for (size_t i = 0; i < n; i++) {
+        float v = amplitude * sinf(2.0f * (float)M_PI * hz * (float)(s->count + i) / TEST_RATE);
+        s->pcm[s->count + i] = (int16_t)lrintf(fmaxf(-32768.0f, fminf(32767.0f, v)));
+    }
+    s->count += n;
+}
+
+static void add_hiss(signal_t *s, float seconds, float amplitude)
+{
+    size_t n = (size_t)(seconds * TEST_RATE);
+    s->pcm = realloc(s->pcm, (s->count + n) * sizeof(int16_t));
+    TEST_ASSERT_NOT_NULL(s->pcm);
+    for (size_t i = 0; i < n; i++) {
+        s->pcm[s->count + i] = (int16_t)lrintf(2.0f * amplitude * noise());
+    }
+    s->count += n;
+}
+
+// Runs the whole signal through in pieces of odd sizes and drains it
+static int16_t *run(audio_agc_t *agc, const signal_t *s)
+{
+    int16_t *out = malloc((s->count + AUDIO_AGC_FRAME) * sizeof(int16_t));
+    TEST_ASSERT_NOT_NULL(out);
+    size_t produced = 0;
+    srand(3);
+    for (size_t offset = 0; offset < s->count;) {
+        size_t piece = 1 + rand() % 500;
+        piece = piece > s->count - offset ? s->count - offset : piece;
+        produced += audio_agc_process(agc, s->pcm + offset, piece, out + produced);
+        offset += piece;
+        TEST_ASSERT_LESS_OR_EQUAL(offset, produced);
+    }
+    size_t drained;
+    while ((drained = audio_agc_drain(agc, out + produced)) > 0) {
+        produced += drained;
+        TEST_ASSERT_LESS_OR_EQUAL(s->count, produced);
+    }
+    TEST_ASSERT_EQUAL(s->count, produced);
+    return out;
+}
+
+static float rms_dbfs(const int16_t *pcm, size_t count)
+{
+    double energy = 0;
+    for (size_t i = 0; i < count; i++) {
+        energy += (double)pcm[i] * pcm[i];
+    }
+    return (float)(10.0 * log10(energy / count / (32768.0 * 32768.0) + 1e-20));
+}
+
+static void start(audio_agc_t *agc)
+{
+    audio_agc_config_t config = { .enabled = true };
+    TEST_ASSERT_EQUAL(ESP_OK, audio_agc_init(agc, &config, TEST_RATE));
+}
+
+TEST_CASE("agc output is the input, delayed and counted alike", "[audio][agc]")
+{
+    // At the target level the gain stays near 0 dB and the output must
+    // line up with the input sample for sample; at 440 Hz a slip of one
+    // sample would drop the correlation to 0.985
+    signal_t s = {0};
+    add_tone(&s, 0.5f, AUDIO_AGC_TARGET_DBFS_DEFAULT, 440.0f);
+    s.count -= 37;  // end mid frame
+    audio_agc_t agc;
+    start(&agc);
+    int16_t *out = run(&agc, &s);
+    double cross = 0, in_energy = 0, out_energy = 0;
+    for (size_t i = 0; i < s.count; i++) {
+        cross += (double)s.pcm[i] * out[i];
+        in_energy += (double)s.pcm[i] * s.pcm[i];
+        out_energy += (double)out[i] * out[i];
+    }
+    TEST_ASSERT_GREATER_THAN(0.9995, cross / sqrt(in_energy * out_energy));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, rms_dbfs(s.pcm, s.count), rms_dbfs(out, s.count));
+    TEST_ASSERT_EQUAL(0, audio_agc_drain(&agc, out));
+    audio_agc_deinit(&agc);
+    free(out);
+    free(s.pcm);
+}
+
+TEST_CASE("agc brings quiet and loud audio to the target", "[audio][agc]")
+{
+    const float levels[] = { -40.0f, -6.0f };
+    for (int l = 0; l < 2; l++) {
+        signal_t s = {0};
+        add_tone(&s, 12.0f, levels[l], 300.0f);
+        audio_agc_t agc;
+        start(&agc);
+        int16_t *out = run(&agc, &s);
+        // Settled: the last second sits on the target
+        TEST_ASSERT_FLOAT_WITHIN(1.0f, AUDIO_AGC_TARGET_DBFS_DEFAULT, rms_dbfs(out + s.count - TEST_RATE, TEST_RATE));
+        audio_agc_deinit(&agc);
+        free(out);
+        free(s.pcm);
+    }
+}
+
+TEST_CASE("agc cuts within the attack and boosts no further than max gain", "[audio][agc]")
+{
+    // A loud start is cut within a few attack constants
+    signal_t s = {0};
+    add_tone(&s, 1.0f, -3.0f, 300.0f);
+    audio_agc_t agc;
+    start(&agc);
+    int16_t *out = run(&agc, &s);
+    TEST_ASSERT_FLOAT_WITHIN(1.5f, AUDIO_AGC_TARGET_DBFS_DEFAULT, rms_dbfs(out + TEST_RATE / 2, TEST_RATE / 2));
+    audio_agc_deinit(&agc);
+    free(out);
+    free(s.pcm);
+
+    // Far under the target, above the gate: the boost stops at max gain
+    s = (signal_t){0};
+    add_tone(&s, 20.0f, -60.0f, 300.0f);
+    start(&agc);
+    out = run(&agc, &s);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, -60.0f + AUDIO_AGC_MAX_GAIN_DB_DEFAULT, rms_dbfs(out + s.count - TEST_RATE, TEST_RATE));
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, AUDIO_AGC_MAX_GAIN_DB_DEFAULT, audio_agc_db(agc.gain_max));
+    audio_agc_deinit(&agc);
+    free(out);
+    free(s.pcm);
+}
+
+TEST_CASE("agc gate holds the gain through silence", "[audio][agc]")
+{
+    // Settle on a quiet voice, then ten seconds of hiss under the gate
+    signal_t s = {0};
+    add_tone(&s, 10.0f, -35.0f, 300.0f);
+    audio_agc_t agc;
+    start(&agc);
+    int16_t *out = run(&agc, &s);
+    int32_t settled = agc.gain;
+    free(out);
+
+    signal_t hiss = {0};
+    add_hiss(&hiss, 10.0f, 8.0f);
+    TEST_ASSERT_LESS_THAN(AUDIO_AGC_GATE_DBFS_DEFAULT, rms_dbfs(hiss.pcm, hiss.count));
+    out = run(&agc, &hiss);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, audio_agc_db(settled), audio_agc_db(agc.gain));
+    // Hiss comes out no louder than the held gain makes it
+    TEST_ASSERT_LESS_THAN(rms_dbfs(hiss.pcm, hiss.count) + audio_agc_db(settled) + 0.5f, rms_dbfs(out, hiss.count));
+    audio_agc_deinit(&agc);
+    free(out);
+    free(hiss.pcm);
+    free(s.pcm);
+}
+
+TEST_CASE("agc limiter keeps every sample under the ceiling", "[audio][agc]")
+{
+    // A quiet tone pulls the gain up, then full-scale bursts and clipped
+    // square edges arrive with no warning but the look-ahead
+    signal_t s = {0};
+    add_tone(&s, 4.0f, -40.0f, 300.0f);
+    add_tone(&s, 0.05f, 0.0f, 1000.0f);
+    add_tone(&s, 1.0f, -40.0f, 300.0f);
+    add_hiss(&s, 0.02f, 32767.0f);
+    add_tone(&s, 1.0f, -40.0f, 300.0f);
+    add_tone(&s, 0.3f, 3.0f, 50.0f);    // clipped at the input
+    add_tone(&s, 1.0f, -30.0f, 300.0f);
+    audio_agc_t agc;
+    start(&agc);
+    int16_t *out = run(&agc, &s);
+
+    int ceiling = (int)(32768.0f * powf(10.0f, CEILING_DBFS / 20.0f));
+    int over_in = 0;
+    for (size_t i = 0; i < s.count; i++) {
+        over_in += abs(s.pcm[i]) > ceiling;
+        TEST_ASSERT_LESS_OR_EQUAL(ceiling, abs(out[i]));
+    }
+    TEST_ASSERT_GREATER_THAN(1000, over_in);
+    TEST_ASSERT_GREATER_THAN(0, agc.limited);
+    audio_agc_deinit(&agc);
+    free(out);
+    free(s.pcm);
+}
+
+TEST_CASE("agc refuses a gain past the limit", "[audio][agc]")
+{
+    audio_agc_t agc;
+    audio_agc_config_t config = { .enabled = true, .max_gain_db = AUDIO_AGC_MAX_GAIN_DB_LIMIT + 1 };
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_agc_init(&agc, &config, TEST_RATE));
+    config = (audio_agc_config_t){ .enabled = true, .ceiling_dbfs = 3 };
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_agc_init(&agc, &config, TEST_RATE));
+    config = (audio_agc_config_t){ .enabled = true };
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, audio_agc_init(&agc, &config, 0));
+}
\ No newline at end of file
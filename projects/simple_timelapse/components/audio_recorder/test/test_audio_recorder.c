@@ -0,0 +1,131 @@
+#include "unity.h"
+#include "audio_recorder.h"
+#include "audio_stft.h"
+#include "audio_test_util.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+// Runs on the linux target against the simulated microphone's ramp, whose
+// samples are their own index, so a lost or repeated wakeup shows as a gap
+
+#define TEST_READERS        3
+#define TEST_READ_MS        1500
+
+typedef struct {
+    SemaphoreHandle_t done;
+    uint64_t samples;
+    uint32_t gaps;
+    uint32_t timeouts;
+    uint32_t overruns;
+} reader_result_t;
+
+// Reads small pieces so it waits on nearly every block
+static void reader_task(void *arg)
+{
+    reader_result_t *result = arg;
+    audio_reader_t reader;
+    audio_recorder_reader_init(&reader);
+    int16_t samples[AUDIO_TEST_BLOCK_BYTES / sizeof(int16_t)];
+    bool first = true;
+    int16_t last = 0;
+    uint32_t target = TEST_READ_MS * AUDIO_TEST_RATE / 1000;
+    while (result->samples < target) {
+        size_t count = 0;
+        esp_err_t ret = audio_recorder_reader_read(&reader, samples, sizeof(samples) / sizeof(samples[0]), &count,
+                                                   NULL, 100);
+        if (ret == ESP_ERR_TIMEOUT) {
+            result->timeouts++;
+            continue;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (!first && samples[i] != (int16_t)(last + 1)) {
+                result->gaps++;
+            }
+            first = false;
+            last = samples[i];
+        }
+        result->samples += count;
+    }
+    result->overruns = reader.overruns;
+    xSemaphoreGive(result->done);
+    vTaskDelete(NULL);
+}
+
+TEST_CASE("concurrent readers are woken for every block", "[audio][recorder]")
+{
+    audio_test_recorder_start(0);
+    reader_result_t results[TEST_READERS];
+    memset(results, 0, sizeof(results));
+    for (int i = 0; i < TEST_READERS; i++) {
+        results[i].done = xSemaphoreCreateBinary();
+        TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(reader_task, "reader", 4096, &results[i], 5, NULL));
+    }
+    for (int i = 0; i < TEST_READERS; i++) {
+        TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(results[i].done, pdMS_TO_TICKS(TEST_READ_MS * 3)));
+        TEST_ASSERT_EQUAL(0, results[i].timeouts);
+        TEST_ASSERT_EQUAL(0, results[i].gaps);
+        TEST_ASSERT_EQUAL(0, results[i].overruns);
+        vSemaphoreDelete(results[i].done);
+    }
+
+    audio_recorder_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_stats(&stats));
+    TEST_ASSERT_EQUAL(0, stats.dma_overflows);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_deinit());
+}
+
+TEST_CASE("recording stops and starts again", "[audio][recorder]")
+{
+    audio_test_recorder_start(0);
+    for (int i = 0; i < 3; i++) {
+        vTaskDelay(pdMS_TO_TICKS(200));
+        TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+        TEST_ASSERT_FALSE(audio_recorder_is_recording());
+
+        // The task has exited, so the counts hold still and agree
+        audio_recorder_stats_t stats;
+        TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_stats(&stats));
+        TEST_ASSERT_GREATER_THAN(0, stats.blocks);
+        TEST_ASSERT_EQUAL(stats.blocks * (uint64_t)stats.block_samples, stats.samples);
+        vTaskDelay(pdMS_TO_TICKS(50));
+        audio_recorder_stats_t later;
+        audio_recorder_get_stats(&later);
+        TEST_ASSERT_EQUAL(stats.blocks, later.blocks);
+
+        TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_start_recording());
+        TEST_ASSERT_TRUE(audio_recorder_is_recording());
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_deinit());
+}
+
+TEST_CASE("an analyser cannot hold more blocks than there are spares", "[audio][recorder]")
+{
+    audio_test_recorder_start(200);
+
+    // 512 samples span up to five 128-sample blocks, one more than the default spares
+    audio_stft_t stft;
+    audio_stft_config_t stft_config = { .fft_size = 512, .hop = 1 };
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, audio_stft_init(&stft, &stft_config));
+    stft_config.fft_size = 256;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_stft_init(&stft, &stft_config));
+
+    // The second frame straddles the most blocks, and a hop of one lets go
+    // of none of them; lapped twice over meanwhile, the task never waits
+    static float power[256 / 2 + 1];
+    TEST_ASSERT_EQUAL(ESP_OK, audio_stft_next(&stft, power, NULL, 100));
+    TEST_ASSERT_EQUAL(ESP_OK, audio_stft_next(&stft, power, NULL, 100));
+    vTaskDelay(pdMS_TO_TICKS(500));
+    audio_recorder_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_get_stats(&stats));
+    TEST_ASSERT_EQUAL(0, stats.ref_waits);
+    TEST_ASSERT_EQUAL(0, stats.dma_overflows);
+    TEST_ASSERT_EQUAL(ESP_OK, audio_stft_next(&stft, power, NULL, 100));
+    audio_stft_deinit(&stft);
+
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_stop_recording());
+    TEST_ASSERT_EQUAL(ESP_OK, audio_recorder_deinit());
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed-rate capture schedule: a session is N slots spread over D ms, slot k
+// due at start + k * D / N on the esp_timer clock, or the config's own.
+// Deadlines come from that absolute schedule, so slow frames never push the
+// later ones back, and the session ends at start + D.
+#define CAPTURE_PACER_HIST_BUCKETS  10
+
+typedef enum {
+    CAPTURE_PACER_CATCH_UP = 0,     // late slots run back to back until on schedule again
+    CAPTURE_PACER_SKIP,             // late slots are left out; fewer frames, timing intact
+    CAPTURE_PACER_DROP,             // late slots are issued with drop set; caller fills them
+} capture_pacer_policy_t;
+
+// Time source of a session in microseconds; tests drive a fake one
+typedef struct {
+    int64_t (*now)(void *ctx);
+    void (*wait_until)(int64_t deadline_us, void *ctx);
+    void *ctx;
+} capture_pacer_clock_t;
+
+typedef struct {
+    uint32_t frame_count;           // N
+    uint32_t duration_ms;           // D
+    capture_pacer_policy_t policy;
+    uint32_t late_tolerance_us;     // lateness still treated as on time, 0 = half a slot
+    const capture_pacer_clock_t *clock;     // NULL = esp_timer
+} capture_pacer_config_t;
+
+typedef struct {
+    uint32_t index;                 // slot number, 0..N-1
+    int64_t deadline_us;            // clock time at which the slot was due
+    int64_t lateness_us;            // how far past the deadline the slot was issued
+    uint32_t skipped;               // slots left out just before this one (SKIP)
+    bool drop;                      // slot missed; don't capture, fill it (DROP)
+} capture_pacer_tick_t;
+
+// Histogram bucket upper edges: 100 us, 250 us, 500 us, 1, 2, 5, 10, 20,
+// 50 ms, and everything above
+typedef struct {
+    uint32_t slots_issued;
+    uint32_t slots_skipped;
+    uint32_t slots_dropped;
+    uint32_t overruns;              // times the caller came back after a deadline
+    uint32_t lateness_avg_us;
+    uint32_t lateness_max_us;
+    uint32_t elapsed_ms;            // session length as actually run
+    uint32_t lateness_hist[CAPTURE_PACER_HIST_BUCKETS];    // issue time vs deadline
+    uint32_t interval_hist[CAPTURE_PACER_HIST_BUCKETS];    // |gap between slots - period|
+} capture_pacer_stats_t;
+
+esp_err_t capture_pacer_start(const capture_pacer_config_t *config);
+
+// Blocks until the next slot is due and describes it. Once all N slots are
+// issued it waits for the end of the session and returns false.
+bool capture_pacer_next(capture_pacer_tick_t *tick);
+
+void capture_pacer_stop(void);
+
+esp_err_t capture_pacer_get_stats(capture_pacer_stats_t *stats);
+
+void capture_pacer_log_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "unity.h"
+#include "capture_pacer.h"
+#include <string.h>
+
+// Runs against a fake clock: waits return at once, a little past their
+// deadline, and the test moves time on by what each frame costs, so a
+// day-long session takes milliseconds and every deadline is exact.
+
+typedef struct {
+    int64_t now;
+    uint32_t overshoot_us;      // a wait wakes up to this late
+    uint32_t rng;
+} fake_clock_t;
+
+static uint32_t next_random(fake_clock_t *clock)
+{
+    clock->rng ^= clock->rng << 13;
+    clock->rng ^= clock->rng >> 17;
+    clock->rng ^= clock->rng << 5;
+    return clock->rng;
+}
+
+static int64_t fake_now(void *ctx)
+{
+    fake_clock_t *clock = ctx;
+    return clock->now;
+}
+
+static void fake_wait_until(int64_t deadline_us, void *ctx)
+{
+    fake_clock_t *clock = ctx;
+    uint32_t late = clock->overshoot_us ? next_random(clock) % (clock->overshoot_us + 1) : 0;
+    clock->now = deadline_us + late;
+}
+
+static fake_clock_t s_clock;
+static const capture_pacer_clock_t s_pacer_clock = {
+    .now = fake_now,
+    .wait_until = fake_wait_until,
+    .ctx = &s_clock,
+};
+
+static void clock_reset(uint32_t overshoot_us)
+{
+    memset(&s_clock, 0, sizeof(s_clock));
+    s_clock.now = 1000000;
+    s_clock.overshoot_us = overshoot_us;
+    s_clock.rng = 1;
+}
+
+TEST_CASE("a day of frames comes out exactly N, on the first schedule", "[capture_pacer]")
+{
+    // One frame a second for 24 h, each taking up to 0.4 s and every wait
+    // waking up to 2 ms late; deadlines that followed the last issue
+    // would drift by a minute and a half
+    const uint32_t frames = 86400;
+    const uint32_t duration_ms = 86400 * 1000;
+    clock_reset(2000);
+    capture_pacer_config_t config = {
+        .frame_count = frames,
+        .duration_ms = duration_ms,
+        .clock = &s_pacer_clock,
+    };
+    int64_t start = s_clock.now;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_pacer_start(&config));
+
+    capture_pacer_tick_t tick;
+    uint32_t issued = 0;
+    while (capture_pacer_next(&tick)) {
+        TEST_ASSERT_EQUAL(issued, tick.index);
+        TEST_ASSERT_FALSE(tick.drop);
+        TEST_ASSERT_EQUAL(0, tick.skipped);
+        TEST_ASSERT_TRUE(tick.deadline_us == start + (int64_t)issued * duration_ms * 1000 / frames);
+        TEST_ASSERT_LESS_OR_EQUAL(2000, tick.lateness_us);
+        s_clock.now += (next_random(&s_clock) % 400) * 1000;
+        issued++;
+    }
+    TEST_ASSERT_EQUAL(frames, issued);
+
+    // The session ends on time too, however long it ran
+    TEST_ASSERT_GREATER_OR_EQUAL(start + (int64_t)duration_ms * 1000, s_clock.now);
+    TEST_ASSERT_LESS_OR_EQUAL(start + (int64_t)duration_ms * 1000 + 2000, s_clock.now);
+    capture_pacer_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_pacer_get_stats(&stats));
+    TEST_ASSERT_EQUAL(frames, stats.slots_issued);
+    TEST_ASSERT_EQUAL(0, stats.overruns);
+    TEST_ASSERT_GREATER_OR_EQUAL(duration_ms, stats.elapsed_ms);
+    TEST_ASSERT_LESS_OR_EQUAL(duration_ms + 2, stats.elapsed_ms);
+    TEST_ASSERT_LESS_OR_EQUAL(2000, stats.lateness_max_us);
+}
+
+TEST_CASE("an uneven period rounds without adding up", "[capture_pacer]")
+{
+    // 33 333.3 us apart: a period rounded once and added up would be a
+    // millisecond short by the end
+    clock_reset(0);
+    capture_pacer_config_t config = {
+        .frame_count = 3000,
+        .duration_ms = 100000,
+        .clock = &s_pacer_clock,
+    };
+    int64_t start = s_clock.now;
+    TEST_ASSERT_EQUAL(ESP_OK, capture_pacer_start(&config));
+    capture_pacer_tick_t tick;
+    int64_t last = start;
+    uint32_t issued = 0;
+    while (capture_pacer_next(&tick)) {
+        if (issued > 0) {
+            int64_t gap = tick.deadline_us - last;
+            TEST_ASSERT_TRUE(gap == 33333 || gap == 33334);
+        }
+        TEST_ASSERT_EQUAL(0, tick.lateness_us);
+        last = tick.deadline_us;
+        issued++;
+    }
+    TEST_ASSERT_EQUAL(3000, issued);
+    TEST_ASSERT_TRUE(last == start + 99966666);
+    TEST_ASSERT_TRUE(s_clock.now == start + 100000000);
+}
+
+TEST_CASE("a slow frame costs only the slots it overran", "[capture_pacer]")
+{
+    // Ten slots 100 ms apart; frame 3 takes 260 ms, past slots 4 and 5
+    capture_pacer_policy_t policies[] = { CAPTURE_PACER_CATCH_UP, CAPTURE_PACER_SKIP, CAPTURE_PACER_DROP };
+    for (int p = 0; p < 3; p++) {
+        clock_reset(0);
+        capture_pacer_config_t config = {
+            .frame_count = 10,
+            .duration_ms = 1000,
+            .policy = policies[p],
+            .clock = &s_pacer_clock,
+        };
+        int64_t start = s_clock.now;
+        TEST_ASSERT_EQUAL(ESP_OK, capture_pacer_start(&config));
+        capture_pacer_tick_t tick;
+        uint32_t issued = 0, skipped = 0, dropped = 0;
+        while (capture_pacer_next(&tick)) {
+            TEST_ASSERT_TRUE(tick.deadline_us == start + tick.index * 100000LL);
+            if (tick.index == 3) {
+                s_clock.now += 260000;
+            }
+            issued++;
+            skipped += tick.skipped;
+            dropped += tick.drop;
+        }
+        TEST_ASSERT_EQUAL(10, issued + skipped);
+        TEST_ASSERT_TRUE(s_clock.now == start + 1000000);
+        capture_pacer_stats_t stats;
+        TEST_ASSERT_EQUAL(ESP_OK, capture_pacer_get_stats(&stats));
+        if (policies[p] == CAPTURE_PACER_SKIP) {
+            TEST_ASSERT_EQUAL(2, skipped);
+        } else {
+            TEST_ASSERT_EQUAL(0, skipped);
+        }
+        TEST_ASSERT_EQUAL(policies[p] == CAPTURE_PACER_DROP ? 2 : 0, dropped);
+        TEST_ASSERT_EQUAL(skipped, stats.slots_skipped);
+        TEST_ASSERT_EQUAL(dropped, stats.slots_dropped);
+    }
+}
\ No newline at end of file
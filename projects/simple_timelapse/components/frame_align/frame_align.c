@@ -0,0 +1,555 @@
+#include "frame_align.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_dsp.h"
+#endif
+
+static const char *TAG = "frame_align";
+
+// Binning leaves the short side this much larger than the tile (in quarters),
+// so the tile can sit on texture instead of always in the middle
+#define TILE_MARGIN_QUARTERS    5
+// Offsets this close to half the tile alias with the opposite direction
+#define EDGE_SAMPLES            1
+
+typedef struct {
+    bool set;
+    uint16_t width;             // image samples
+    uint16_t height;
+    uint8_t bin;
+    uint16_t tile;
+    uint16_t x0;                // tile origin in binned samples
+    uint16_t y0;
+    float base_dx;              // this reference's offset from the first one, frame pixels
+    float base_dy;
+} reference_t;
+
+static frame_align_config_t s_config;
+static bool s_initialized = false;
+static reference_t s_ref;
+static reference_t s_burst;
+
+// Interleaved complex spectra, fft_size squared each
+static float *s_ref_spectrum = NULL;
+static float *s_burst_spectrum = NULL;
+static float *s_spectrum = NULL;
+static float s_column[2 * FRAME_ALIGN_MAX_FFT];
+static float s_window[FRAME_ALIGN_MAX_FFT];
+static uint16_t s_window_size = 0;
+
+static float *s_binned = NULL;
+static size_t s_binned_size = 0;
+
+static frame_align_stats_t s_stats;
+static uint64_t s_total_us = 0;
+
+#if CONFIG_IDF_TARGET_LINUX
+// Host builds have no esp-dsp: plain iterative radix-2 with the same
+// sign convention and in-order output
+static void fft_1d(float *data, int n)
+{
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            float re = data[2 * i], im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+    for (int len = 2; len <= n; len <<= 1) {
+        float angle = -2.0f * (float)M_PI / len;
+        for (int i = 0; i < n; i += len) {
+            for (int k = 0; k < len / 2; k++) {
+                float c = cosf(angle * k), s = sinf(angle * k);
+                float *a = &data[2 * (i + k)];
+                float *b = &data[2 * (i + k + len / 2)];
+                float re = b[0] * c - b[1] * s;
+                float im = b[0] * s + b[1] * c;
+                b[0] = a[0] - re;
+                b[1] = a[1] - im;
+                a[0] += re;
+                a[1] += im;
+            }
+        }
+    }
+}
+#else
+static void fft_1d(float *data, int n)
+{
+    dsps_fft2r_fc32(data, n);
+    dsps_bit_rev_fc32(data, n);
+}
+#endif
+
+// Rows in place, columns through a contiguous scratch line
+static void fft_2d(float *data, int n)
+{
+    for (int r = 0; r < n; r++) {
+        fft_1d(data + 2 * n * r, n);
+    }
+    for (int c = 0; c < n; c++) {
+        for (int r = 0; r < n; r++) {
+            s_column[2 * r] = data[2 * (r * n + c)];
+            s_column[2 * r + 1] = data[2 * (r * n + c) + 1];
+        }
+        fft_1d(s_column, n);
+        for (int r = 0; r < n; r++) {
+            data[2 * (r * n + c)] = s_column[2 * r];
+            data[2 * (r * n + c) + 1] = s_column[2 * r + 1];
+        }
+    }
+}
+
+static float *alloc_floats(size_t count, uint32_t prefer)
+{
+    float *buf = heap_caps_aligned_alloc(16, count * sizeof(float), prefer | MALLOC_CAP_8BIT);
+    if (!buf) {
+        buf = heap_caps_aligned_alloc(16, count * sizeof(float), MALLOC_CAP_8BIT);
+    }
+    return buf;
+}
+
+static bool pick_geometry(const frame_align_image_t *image, reference_t *geometry)
+{
+    uint16_t short_side = image->width < image->height ? image->width : image->height;
+    int bin = short_side * 4 / (s_config.fft_size * TILE_MARGIN_QUARTERS);
+    if (bin < 1) {
+        bin = 1;
+    } else if (bin > 255) {
+        bin = 255;
+    }
+
+    int binned = short_side / bin;
+    int tile = s_config.fft_size;
+    while (tile > binned) {
+        tile >>= 1;
+    }
+    if (tile < FRAME_ALIGN_MIN_FFT) {
+        return false;
+    }
+
+    geometry->width = image->width;
+    geometry->height = image->height;
+    geometry->bin = (uint8_t)bin;
+    geometry->tile = (uint16_t)tile;
+    return true;
+}
+
+static float binned_sample(const frame_align_image_t *image, int bx, int by, int bin)
+{
+    const uint8_t *row = image->data + (size_t)by * bin * image->stride + (size_t)bx * bin * image->step;
+    if (bin == 1) {
+        return row[0];
+    }
+
+    uint32_t sum = 0;
+    for (int y = 0; y < bin; y++, row += image->stride) {
+        for (int x = 0; x < bin; x++) {
+            sum += row[x * image->step];
+        }
+    }
+    return (float)sum / (bin * bin);
+}
+
+// Places the tile where the binned view has the most gradient energy
+static esp_err_t pick_tile(const frame_align_image_t *image, reference_t *geometry)
+{
+    int bw = geometry->width / geometry->bin;
+    int bh = geometry->height / geometry->bin;
+    int n = geometry->tile;
+    size_t size = (size_t)bw * bh;
+
+    if (!s_binned || size > s_binned_size) {
+        heap_caps_free(s_binned);
+        s_binned = alloc_floats(size, MALLOC_CAP_SPIRAM);
+        s_binned_size = s_binned ? size : 0;
+        if (!s_binned) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    for (int y = 0; y < bh; y++) {
+        for (int x = 0; x < bw; x++) {
+            s_binned[y * bw + x] = binned_sample(image, x, y, geometry->bin);
+        }
+    }
+
+    int step = n / 4;
+    float best = -1.0f;
+    for (int y0 = (bh - n) % step / 2; y0 + n <= bh; y0 += step) {
+        for (int x0 = (bw - n) % step / 2; x0 + n <= bw; x0 += step) {
+            float energy = 0.0f;
+            for (int y = y0; y < y0 + n - 1; y++) {
+                const float *p = &s_binned[y * bw];
+                for (int x = x0; x < x0 + n - 1; x++) {
+                    energy += fabsf(p[x + 1] - p[x]) + fabsf(p[x + bw] - p[x]);
+                }
+            }
+            if (energy > best) {
+                best = energy;
+                geometry->x0 = (uint16_t)x0;
+                geometry->y0 = (uint16_t)y0;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+static void make_window(int n)
+{
+    if (s_window_size == n) {
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        s_window[i] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * (i + 0.5f) / n);
+    }
+    s_window_size = (uint16_t)n;
+}
+
+// Windowed, zero-mean tile of the image at the geometry's place, transformed
+static void load_spectrum(const frame_align_image_t *image, const reference_t *geometry, float *out)
+{
+    int n = geometry->tile;
+    float sum = 0.0f;
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            float v = binned_sample(image, geometry->x0 + x, geometry->y0 + y, geometry->bin);
+            out[2 * (y * n + x)] = v;
+            sum += v;
+        }
+    }
+
+    float mean = sum / (n * n);
+    make_window(n);
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            float *c = &out[2 * (y * n + x)];
+            c[0] = (c[0] - mean) * s_window[x] * s_window[y];
+            c[1] = 0.0f;
+        }
+    }
+    fft_2d(out, n);
+}
+
+// Parabola through the peak and its neighbours, in samples
+static float peak_offset(float left, float centre, float right)
+{
+    float denom = left - 2.0f * centre + right;
+    if (denom >= 0.0f) {
+        return 0.0f;
+    }
+    float offset = 0.5f * (left - right) / denom;
+    return offset < -0.5f ? -0.5f : (offset > 0.5f ? 0.5f : offset);
+}
+
+// Phase correlation of cur against ref; cur is overwritten with the surface
+static void correlate(const float *ref, float *cur, const reference_t *geometry, int scale,
+                      frame_align_result_t *result)
+{
+    int n = geometry->tile;
+    int count = n * n;
+
+    // Whitened cross-power spectrum, conjugated ready for the inverse transform
+    for (int i = 0; i < count; i++) {
+        float a = cur[2 * i], b = cur[2 * i + 1];
+        float c = ref[2 * i], d = ref[2 * i + 1];
+        float re = a * c + b * d;
+        float im = b * c - a * d;
+        float mag = sqrtf(re * re + im * im);
+        if (mag > 1e-12f) {
+            cur[2 * i] = re / mag;
+            cur[2 * i + 1] = -im / mag;
+        } else {
+            cur[2 * i] = cur[2 * i + 1] = 0.0f;
+        }
+    }
+    fft_2d(cur, n);
+
+    // Real part only (the conjugate back does not change it); scale is irrelevant
+    int peak = 0;
+    double energy = 0.0;
+    for (int i = 0; i < count; i++) {
+        float v = cur[2 * i];
+        energy += (double)v * v;
+        if (v > cur[2 * peak]) {
+            peak = i;
+        }
+    }
+
+    int px = peak % n, py = peak / n;
+#define SURFACE(x, y) cur[2 * ((((y) + n) % n) * n + (((x) + n) % n))]
+    float centre = SURFACE(px, py);
+    double near = 0.0;
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            float v = SURFACE(px + x, py + y);
+            near += (double)v * v;
+        }
+    }
+    float sub_x = peak_offset(SURFACE(px - 1, py), centre, SURFACE(px + 1, py));
+    float sub_y = peak_offset(SURFACE(px, py - 1), centre, SURFACE(px, py + 1));
+#undef SURFACE
+
+    float rms = sqrtf((float)((energy - near) / (count - 9)));
+    result->confidence = rms > 0.0f ? centre / rms : 0.0f;
+
+    if (px > n / 2) {
+        px -= n;
+    }
+    if (py > n / 2) {
+        py -= n;
+    }
+    float pixels = (float)geometry->bin * scale;
+    result->dx = (px + sub_x) * pixels;
+    result->dy = (py + sub_y) * pixels;
+    result->valid = result->confidence >= s_config.min_confidence &&
+                    abs(px) < n / 2 - EDGE_SAMPLES && abs(py) < n / 2 - EDGE_SAMPLES;
+    result->tile = (uint16_t)n;
+    result->bin = geometry->bin;
+}
+
+static void record_stats(frame_align_result_t *result, int64_t start)
+{
+    result->compute_us = (uint32_t)(esp_timer_get_time() - start);
+    s_stats.frames++;
+    s_stats.valid += result->valid;
+    s_total_us += result->compute_us;
+    s_stats.avg_us = (uint32_t)(s_total_us / s_stats.frames);
+    if (result->compute_us > s_stats.max_us) {
+        s_stats.max_us = result->compute_us;
+    }
+}
+
+static bool same_size(const frame_align_image_t *image, const reference_t *geometry)
+{
+    return image->width == geometry->width && image->height == geometry->height;
+}
+
+static bool image_ok(const frame_align_image_t *image)
+{
+    return image && image->data && image->width && image->height && image->step && image->scale &&
+           image->stride >= image->width * image->step;
+}
+
+static esp_err_t set_reference(reference_t *ref, float *spectrum, const frame_align_image_t *image,
+                               float base_dx, float base_dy)
+{
+    reference_t geometry = {0};
+    if (!pick_geometry(image, &geometry)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    esp_err_t ret = pick_tile(image, &geometry);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    load_spectrum(image, &geometry, spectrum);
+    geometry.base_dx = base_dx;
+    geometry.base_dy = base_dy;
+    geometry.set = true;
+    *ref = geometry;
+    return ESP_OK;
+}
+
+esp_err_t frame_align_init(const frame_align_config_t *config)
+{
+    if (!config || config->fft_size < FRAME_ALIGN_MIN_FFT || config->fft_size > FRAME_ALIGN_MAX_FFT ||
+        (config->fft_size & (config->fft_size - 1)) || config->min_confidence < 0.0f) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_initialized) {
+        frame_align_deinit();
+    }
+
+#if !CONFIG_IDF_TARGET_LINUX
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, FRAME_ALIGN_MAX_FFT);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "FFT init failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+#endif
+
+    // The working spectrum is transformed twice per frame, so it gets internal
+    // RAM when there is room; the references are read once per frame
+    size_t count = 2 * (size_t)config->fft_size * config->fft_size;
+    s_spectrum = alloc_floats(count, MALLOC_CAP_INTERNAL);
+    s_ref_spectrum = alloc_floats(count, MALLOC_CAP_SPIRAM);
+    s_burst_spectrum = alloc_floats(count, MALLOC_CAP_SPIRAM);
+    if (!s_spectrum || !s_ref_spectrum || !s_burst_spectrum) {
+        ESP_LOGE(TAG, "No memory for %d-point spectra", config->fft_size);
+        frame_align_deinit();
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_config = *config;
+    memset(&s_ref, 0, sizeof(s_ref));
+    memset(&s_burst, 0, sizeof(s_burst));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_total_us = 0;
+    s_initialized = true;
+
+    ESP_LOGI(TAG, "Initialized: tile up to %d, confidence %.1f, rebase below %.1f",
+             config->fft_size, config->min_confidence, config->rebase_confidence);
+    return ESP_OK;
+}
+
+esp_err_t frame_align_measure(const frame_align_image_t *image, frame_align_result_t *result)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!image_ok(image) || !result) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t start = esp_timer_get_time();
+    memset(result, 0, sizeof(*result));
+
+    if (!s_ref.set) {
+        esp_err_t ret = set_reference(&s_ref, s_ref_spectrum, image, 0.0f, 0.0f);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        result->valid = true;
+        result->reference = true;
+        result->tile = s_ref.tile;
+        result->bin = s_ref.bin;
+        record_stats(result, start);
+        ESP_LOGI(TAG, "Reference set: %dx%d samples, %d-point tile at %d,%d, bin %d",
+                 image->width, image->height, s_ref.tile, s_ref.x0, s_ref.y0, s_ref.bin);
+        return ESP_OK;
+    }
+    if (!same_size(image, &s_ref)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    load_spectrum(image, &s_ref, s_spectrum);
+    correlate(s_ref_spectrum, s_spectrum, &s_ref, image->scale, result);
+    result->dx += s_ref.base_dx;
+    result->dy += s_ref.base_dy;
+
+    // The view has drifted from the reference (light, season, growth) but
+    // still matches: carry on from this frame before it stops matching
+    if (result->valid && result->confidence < s_config.rebase_confidence &&
+        set_reference(&s_ref, s_ref_spectrum, image, result->dx, result->dy) == ESP_OK) {
+        result->reference = true;
+        s_stats.rebases++;
+        ESP_LOGI(TAG, "Rebased at %+.1f,%+.1f (confidence %.1f)", result->dx, result->dy, result->confidence);
+    }
+
+    record_stats(result, start);
+    return ESP_OK;
+}
+
+esp_err_t frame_align_burst_reference(const frame_align_image_t *image)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!image_ok(image)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_burst.set = false;
+    return set_reference(&s_burst, s_burst_spectrum, image, 0.0f, 0.0f);
+}
+
+esp_err_t frame_align_burst_measure(const frame_align_image_t *image, frame_align_result_t *result)
+{
+    if (!s_initialized || !s_burst.set) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!image_ok(image) || !result) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!same_size(image, &s_burst)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    int64_t start = esp_timer_get_time();
+    memset(result, 0, sizeof(*result));
+    load_spectrum(image, &s_burst, s_spectrum);
+    correlate(s_burst_spectrum, s_spectrum, &s_burst, image->scale, result);
+    record_stats(result, start);
+    return ESP_OK;
+}
+
+void frame_align_reset(void)
+{
+    s_ref.set = false;
+}
+
+void frame_align_shift(uint8_t *buf, uint16_t width, uint16_t height, uint8_t bytes_per_pixel, int dx, int dy)
+{
+    if (!buf || width == 0 || height == 0 || bytes_per_pixel == 0) {
+        return;
+    }
+    dx = dx >= width ? width - 1 : (dx <= -width ? -(width - 1) : dx);
+    dy = dy >= height ? height - 1 : (dy <= -height ? -(height - 1) : dy);
+
+    size_t row = (size_t)width * bytes_per_pixel;
+    if (dy > 0) {
+        memmove(buf + dy * row, buf, (height - dy) * row);
+        for (int y = 0; y < dy; y++) {
+            memcpy(buf + y * row, buf + dy * row, row);
+        }
+    } else if (dy < 0) {
+        int up = -dy;
+        memmove(buf, buf + up * row, (height - up) * row);
+        for (int y = height - up; y < height; y++) {
+            memcpy(buf + y * row, buf + (height - up - 1) * row, row);
+        }
+    }
+
+    if (dx == 0) {
+        return;
+    }
+    size_t move = (size_t)abs(dx) * bytes_per_pixel;
+    for (int y = 0; y < height; y++) {
+        uint8_t *line = buf + y * row;
+        if (dx > 0) {
+            memmove(line + move, line, row - move);
+            for (size_t x = 0; x < move; x += bytes_per_pixel) {
+                memcpy(line + x, line + move, bytes_per_pixel);
+            }
+        } else {
+            memmove(line, line + move, row - move);
+            for (size_t x = row - move; x < row; x += bytes_per_pixel) {
+                memcpy(line + x, line + row - move - bytes_per_pixel, bytes_per_pixel);
+            }
+        }
+    }
+}
+
+esp_err_t frame_align_get_stats(frame_align_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    return ESP_OK;
+}
+
+void frame_align_deinit(void)
+{
+    heap_caps_free(s_spectrum);
+    heap_caps_free(s_ref_spectrum);
+    heap_caps_free(s_burst_spectrum);
+    heap_caps_free(s_binned);
+    s_spectrum = s_ref_spectrum = s_burst_spectrum = s_binned = NULL;
+    s_binned_size = 0;
+    s_ref.set = false;
+    s_burst.set = false;
+    s_initialized = false;
+}
\ No newline at end of file
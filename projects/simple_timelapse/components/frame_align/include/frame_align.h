@@ -0,0 +1,87 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Global translation between frames by phase correlation: a square tile of
+// downscaled luma is windowed and transformed, its spectrum is whitened
+// against the reference's (cross-power divided by its magnitude) and
+// transformed back, leaving one sharp peak at the offset. The input is a
+// small luma image such as the 1/8-size JPEG DC map, binned further until
+// the tile (at most FRAME_ALIGN_MAX_FFT square) spans most of the short
+// side. The tile sits on the most textured part of the reference view.
+#define FRAME_ALIGN_MIN_FFT     16
+#define FRAME_ALIGN_MAX_FFT     64
+
+typedef struct {
+    const uint8_t *data;
+    uint16_t width;             // samples
+    uint16_t height;
+    uint16_t stride;            // bytes from one row to the next
+    uint8_t step;               // bytes from one sample to the next: 1 for a DC map, 2 for YUV422 luma
+    uint8_t scale;              // frame pixels per sample: 8 for a DC map, 1 at full resolution
+} frame_align_image_t;
+
+typedef struct {
+    uint16_t fft_size;          // largest tile, power of two FRAME_ALIGN_MIN_FFT..FRAME_ALIGN_MAX_FFT
+    float min_confidence;       // correlation peak over surface RMS needed to trust a result, e.g. 8
+    float rebase_confidence;    // trusted results below this become the new reference (0 = never)
+} frame_align_config_t;
+
+typedef struct {
+    bool valid;
+    bool reference;             // this image became the reference
+    float dx;                   // frame pixels the view moved against the reference, right positive
+    float dy;                   // down positive
+    float confidence;
+    uint16_t tile;              // FFT size used
+    uint8_t bin;                // image samples per tile sample, each way
+    uint32_t compute_us;
+} frame_align_result_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t valid;
+    uint32_t rebases;
+    uint32_t avg_us;
+    uint32_t max_us;
+} frame_align_stats_t;
+
+esp_err_t frame_align_init(const frame_align_config_t *config);
+
+// Offset of image against the session reference. The first image (and the
+// first after frame_align_reset) becomes the reference; later images must
+// have its dimensions. Offsets stay relative to the first reference across
+// rebases.
+esp_err_t frame_align_measure(const frame_align_image_t *image, frame_align_result_t *result);
+
+// A second, short-lived reference for bursts such as the frames of one
+// stacked still; the session reference is left alone. The image is only
+// read during the call.
+esp_err_t frame_align_burst_reference(const frame_align_image_t *image);
+
+// Offset of image against the burst reference
+esp_err_t frame_align_burst_measure(const frame_align_image_t *image, frame_align_result_t *result);
+
+// Forgets the session reference
+void frame_align_reset(void);
+
+// Moves a frame's content by dx, dy pixels in place, repeating the edge
+// pixels into the uncovered border. YUV422 moves in pixel pairs: pass
+// width / 2, 4 bytes per pair and dx / 2.
+void frame_align_shift(uint8_t *buf, uint16_t width, uint16_t height, uint8_t bytes_per_pixel, int dx, int dy);
+
+esp_err_t frame_align_get_stats(frame_align_stats_t *stats);
+
+// Frees the spectra
+void frame_align_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
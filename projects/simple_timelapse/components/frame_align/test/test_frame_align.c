@@ -0,0 +1,259 @@
+#include "unity.h"
+#include "frame_align.h"
+#include <string.h>
+#include <math.h>
+
+// Synthetic scene rendered at VGA with known sub-pixel shifts, then reduced
+// to the 80x60 block-mean map luma_meter hands over, or kept at full size
+
+#define SCENE_W         640
+#define SCENE_H         480
+#define MAP_W           (SCENE_W / 8)
+#define MAP_H           (SCENE_H / 8)
+#define SCENE_OCTAVES   5       // lattice cells of 64 down to 4 pixels
+#define SCENE_RECTS     16
+
+// Same settings simple_timelapse runs with
+static const frame_align_config_t s_config = {
+    .fft_size = 64,
+    .min_confidence = 8.0f,
+    .rebase_confidence = 0.0f,
+};
+
+static struct {
+    float x0, y0, x1, y1, level;
+} s_rects[SCENE_RECTS];
+static uint32_t s_scene_seed;
+static uint8_t s_frame[SCENE_W * SCENE_H];
+static uint8_t s_map[MAP_W * MAP_H];
+static uint32_t s_seed = 1;
+
+static float uniform(void)
+{
+    s_seed = s_seed * 1103515245u + 12345u;
+    return (s_seed >> 8) / 16777216.0f;
+}
+
+static float lattice(int x, int y, int octave)
+{
+    uint32_t h = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u ^ (uint32_t)octave * 83492791u ^ s_scene_seed;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return (h & 0xFFFF) / 65535.0f - 0.5f;
+}
+
+// Value noise with amplitude proportional to cell size: roughly the 1/f
+// spectrum of natural scenes, and defined at any sub-pixel position
+static float value_noise(float x, float y)
+{
+    float v = 0.0f;
+    for (int o = 0; o < SCENE_OCTAVES; o++) {
+        float cell = (float)(64 >> o);
+        float gx = x / cell + 1000.0f;
+        float gy = y / cell + 1000.0f;
+        int ix = (int)gx;
+        int iy = (int)gy;
+        float fx = gx - ix;
+        float fy = gy - iy;
+        fx = fx * fx * (3.0f - 2.0f * fx);
+        fy = fy * fy * (3.0f - 2.0f * fy);
+        float top = lattice(ix, iy, o) + fx * (lattice(ix + 1, iy, o) - lattice(ix, iy, o));
+        float bottom = lattice(ix, iy + 1, o) + fx * (lattice(ix + 1, iy + 1, o) - lattice(ix, iy + 1, o));
+        v += (top + fy * (bottom - top)) * cell;
+    }
+    return v;
+}
+
+static void build_scene(uint32_t seed)
+{
+    s_seed = seed;
+    s_scene_seed = seed * 2654435761u;
+    for (int i = 0; i < SCENE_RECTS; i++) {
+        s_rects[i].x0 = uniform() * SCENE_W;
+        s_rects[i].y0 = uniform() * SCENE_H;
+        s_rects[i].x1 = s_rects[i].x0 + 20.0f + uniform() * 150.0f;
+        s_rects[i].y1 = s_rects[i].y0 + 20.0f + uniform() * 150.0f;
+        s_rects[i].level = (uniform() - 0.5f) * 60.0f;
+    }
+}
+
+// Content moved right by dx and down by dy, with uniform noise of the given sigma
+static void render(float dx, float dy, float noise)
+{
+    for (int y = 0; y < SCENE_H; y++) {
+        float sy = y - dy;
+        for (int x = 0; x < SCENE_W; x++) {
+            float sx = x - dx;
+            float v = 110.0f + 0.5f * value_noise(sx, sy);
+            for (int i = 0; i < SCENE_RECTS; i++) {
+                if (sx >= s_rects[i].x0 && sx < s_rects[i].x1 && sy >= s_rects[i].y0 && sy < s_rects[i].y1) {
+                    v += s_rects[i].level;
+                }
+            }
+            v += noise * (uniform() - 0.5f) * 3.46f;
+            s_frame[y * SCENE_W + x] = v < 0.0f ? 0 : v > 255.0f ? 255 : (uint8_t)v;
+        }
+    }
+
+    for (int by = 0; by < MAP_H; by++) {
+        for (int bx = 0; bx < MAP_W; bx++) {
+            uint32_t sum = 0;
+            for (int y = 0; y < 8; y++) {
+                for (int x = 0; x < 8; x++) {
+                    sum += s_frame[(by * 8 + y) * SCENE_W + bx * 8 + x];
+                }
+            }
+            s_map[by * MAP_W + bx] = (uint8_t)(sum / 64);
+        }
+    }
+}
+
+static const frame_align_image_t s_map_image = {
+    .data = s_map, .width = MAP_W, .height = MAP_H, .stride = MAP_W, .step = 1, .scale = 8,
+};
+
+static const frame_align_image_t s_full_image = {
+    .data = s_frame, .width = SCENE_W, .height = SCENE_H, .stride = SCENE_W, .step = 1, .scale = 1,
+};
+
+static float measure_rms(const frame_align_image_t *image, float max_shift, int trials)
+{
+    frame_align_result_t result;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_init(&s_config));
+    render(0.0f, 0.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(image, &result));
+    TEST_ASSERT_TRUE(result.reference);
+
+    double sum = 0.0;
+    for (int i = 0; i < trials; i++) {
+        float dx = (2.0f * uniform() - 1.0f) * max_shift;
+        float dy = (2.0f * uniform() - 1.0f) * max_shift;
+        render(dx, dy, 3.0f);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(image, &result));
+        TEST_ASSERT_TRUE(result.valid);
+        TEST_ASSERT_FALSE(result.reference);
+        float ex = result.dx - dx;
+        float ey = result.dy - dy;
+        TEST_ASSERT_LESS_THAN(image->scale * 0.5f + 1.5f, fabsf(ex));
+        TEST_ASSERT_LESS_THAN(image->scale * 0.5f + 1.5f, fabsf(ey));
+        sum += ex * ex + ey * ey;
+    }
+    frame_align_deinit();
+    return (float)sqrt(sum / (2 * trials));
+}
+
+TEST_CASE("DC map offsets are within a pixel", "[align]")
+{
+    build_scene(11);
+    TEST_ASSERT_LESS_THAN(1.0f, measure_rms(&s_map_image, 40.0f, 12));
+}
+
+TEST_CASE("full resolution offsets are within a pixel", "[align]")
+{
+    build_scene(12);
+    TEST_ASSERT_LESS_THAN(1.0f, measure_rms(&s_full_image, 60.0f, 6));
+}
+
+TEST_CASE("an unrelated view is not trusted", "[align]")
+{
+    frame_align_result_t result;
+    build_scene(13);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_init(&s_config));
+    render(0.0f, 0.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(&s_map_image, &result));
+
+    for (int i = 0; i < MAP_W * MAP_H; i++) {
+        s_map[i] = (uint8_t)(uniform() * 255.0f);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(&s_map_image, &result));
+    TEST_ASSERT_FALSE(result.valid);
+    TEST_ASSERT_LESS_THAN(s_config.min_confidence, result.confidence);
+
+    frame_align_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_get_stats(&stats));
+    TEST_ASSERT_EQUAL(1, stats.frames - stats.valid);
+    frame_align_deinit();
+}
+
+TEST_CASE("offsets stay on the first reference across rebases", "[align]")
+{
+    frame_align_config_t config = s_config;
+    config.rebase_confidence = 1000.0f;     // every trusted frame rebases
+    frame_align_result_t result;
+    build_scene(14);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_init(&config));
+    render(0.0f, 0.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(&s_map_image, &result));
+
+    // A slow pan: each step is small, the total is not. Every rebase
+    // chains one more measurement, so the tolerance grows with the step.
+    for (int i = 1; i <= 8; i++) {
+        render(12.0f * i, -6.0f * i, 3.0f);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(&s_map_image, &result));
+        TEST_ASSERT_TRUE(result.valid);
+        TEST_ASSERT_FLOAT_WITHIN(2.0f + i, 12.0f * i, result.dx);
+        TEST_ASSERT_FLOAT_WITHIN(2.0f + i, -6.0f * i, result.dy);
+    }
+
+    frame_align_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_get_stats(&stats));
+    TEST_ASSERT_EQUAL(8, stats.rebases);
+    frame_align_deinit();
+}
+
+TEST_CASE("a burst reference leaves the session reference alone", "[align]")
+{
+    frame_align_result_t result;
+    build_scene(15);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_init(&s_config));
+    render(0.0f, 0.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(&s_map_image, &result));
+
+    render(40.0f, 0.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_burst_reference(&s_full_image));
+    render(45.0f, 3.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_burst_measure(&s_full_image, &result));
+    TEST_ASSERT_TRUE(result.valid);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 5.0f, result.dx);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 3.0f, result.dy);
+
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_measure(&s_map_image, &result));
+    TEST_ASSERT_TRUE(result.valid);
+    TEST_ASSERT_FLOAT_WITHIN(3.0f, 45.0f, result.dx);
+    frame_align_deinit();
+}
+
+TEST_CASE("shifting a frame undoes the measured offset", "[align]")
+{
+    enum { W = 6, H = 4 };
+    uint8_t buf[W * H];
+    for (int i = 0; i < W * H; i++) {
+        buf[i] = (uint8_t)i;
+    }
+    frame_align_shift(buf, W, H, 1, 2, -1);
+    // Content moved right by 2 and up by 1, edges repeated into the border
+    static const uint8_t expected[W * H] = {
+        6, 6, 6, 7, 8, 9,
+        12, 12, 12, 13, 14, 15,
+        18, 18, 18, 19, 20, 21,
+        18, 18, 18, 19, 20, 21,
+    };
+    TEST_ASSERT_EQUAL_MEMORY(expected, buf, sizeof(buf));
+
+    // Measuring, shifting back and measuring again leaves under a pixel
+    frame_align_result_t result;
+    build_scene(16);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_init(&s_config));
+    render(0.0f, 0.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_burst_reference(&s_full_image));
+    render(17.0f, -9.0f, 3.0f);
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_burst_measure(&s_full_image, &result));
+    TEST_ASSERT_TRUE(result.valid);
+    frame_align_shift(s_frame, SCENE_W, SCENE_H, 1, -(int)lroundf(result.dx), -(int)lroundf(result.dy));
+    TEST_ASSERT_EQUAL(ESP_OK, frame_align_burst_measure(&s_full_image, &result));
+    TEST_ASSERT_TRUE(result.valid);
+    TEST_ASSERT_LESS_THAN(1.0f, fabsf(result.dx));
+    TEST_ASSERT_LESS_THAN(1.0f, fabsf(result.dy));
+    frame_align_deinit();
+}
\ No newline at end of file
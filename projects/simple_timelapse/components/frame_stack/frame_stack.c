@@ -0,0 +1,398 @@
+#include "frame_stack.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+#include <string.h>
+#if !CONFIG_IDF_TARGET_LINUX
+#include "img_converters.h"
+#endif
+
+static const char *TAG = "frame_stack";
+
+#define LANE_HIGH   0x80808080u
+#define LANE_LOW    0x7F7F7F7Fu
+#define PAIR_MASK   0x00FF00FFu
+
+// Luma is sampled every MEAN_STEP bytes to estimate a frame's exposure.
+// Even, so YUV422 (Y U Y V) lands on Y bytes.
+#define MEAN_STEP   64
+#define GAIN_MIN    0.25f
+#define GAIN_MAX    4.0f
+
+static frame_stack_config_t s_config;
+static bool s_active = false;
+static uint32_t s_frames = 0;
+static size_t s_frame_bytes = 0;        // input bytes per frame
+static size_t s_samples = 0;            // accumulated channels per frame
+static int s_tiles = 0;
+static size_t s_tile_bytes = 0;
+
+// Per tile: FRAME_STACK_TILE 16-bit sums, then (when rejecting outliers) the
+// per-sample min and max bytes. Sums are stored two lanes per 32-bit word:
+// word 2g holds samples 4g and 4g+2, word 2g+1 holds 4g+1 and 4g+3, which is
+// what splitting one source word into even and odd bytes gives.
+static uint8_t *s_acc = NULL;
+
+// Unpacked RGB565, gain-mapped or ragged-tail samples go through here
+static uint32_t s_stage[FRAME_STACK_TILE / 4];
+static uint8_t s_lut_even[256];
+static uint8_t s_lut_odd[256];
+
+static float s_ref_mean = 0.0f;
+static frame_stack_stats_t s_stats;
+static uint64_t s_add_sum_us = 0;
+
+// Byte lanes where a < b get 0xFF. The subtraction keeps each lane's borrow
+// from spilling into its neighbour; same trick as motion_detect's absdiff.
+static inline uint32_t swar_less_mask(uint32_t a, uint32_t b)
+{
+    uint32_t d = ((a | LANE_HIGH) - (b & LANE_LOW)) ^ ((a ^ ~b) & LANE_HIGH);
+    uint32_t neg = ((~a & b) | (~(a ^ b) & d)) & LANE_HIGH;
+    return (neg >> 7) * 0xFFu;
+}
+
+static inline uint32_t swar_min(uint32_t a, uint32_t b)
+{
+    uint32_t lt = swar_less_mask(a, b);
+    return (a & lt) | (b & ~lt);
+}
+
+static inline uint32_t swar_max(uint32_t a, uint32_t b)
+{
+    uint32_t lt = swar_less_mask(a, b);
+    return (b & lt) | (a & ~lt);
+}
+
+static inline uint8_t expand5(uint16_t v)
+{
+    return (uint8_t)((v << 3) | (v >> 2));
+}
+
+static inline uint8_t expand6(uint16_t v)
+{
+    return (uint8_t)((v << 2) | (v >> 4));
+}
+
+static inline uint16_t pack565(uint8_t r, uint8_t g, uint8_t b)
+{
+    // Rounded rescale; exact inverse of expand5/expand6
+    uint16_t r5 = (r * 31 + 127) / 255;
+    uint16_t g6 = (g * 63 + 127) / 255;
+    uint16_t b5 = (b * 31 + 127) / 255;
+    return (uint16_t)((r5 << 11) | (g6 << 5) | b5);
+}
+
+static float frame_mean(const uint8_t *buf)
+{
+    uint32_t sum = 0;
+    uint32_t count = 0;
+    for (size_t i = 0; i + 1 < s_frame_bytes; i += MEAN_STEP) {
+        if (s_config.format == PIXFORMAT_RGB565) {
+            // Camera RGB565 is big-endian
+            uint16_t p = (uint16_t)((buf[i] << 8) | buf[i + 1]);
+            sum += (expand5(p >> 11) + expand6((p >> 5) & 0x3F) + expand5(p & 0x1F)) / 3;
+        } else {
+            sum += buf[i];
+        }
+        count++;
+    }
+    return count ? (float)sum / count : 0.0f;
+}
+
+static void build_luts(float gain)
+{
+    for (int v = 0; v < 256; v++) {
+        int mapped = (int)(v * gain + 0.5f);
+        s_lut_even[v] = mapped > 255 ? 255 : (uint8_t)mapped;
+        // YUV422 chroma sits on odd bytes and is centred on 128; leave it
+        s_lut_odd[v] = s_config.format == PIXFORMAT_YUV422 ? (uint8_t)v : s_lut_even[v];
+    }
+}
+
+// Fills s_stage with tile t's samples, mapped through the LUTs when
+// identity is false, zero-padded to a whole word. Returns the padded count.
+static size_t stage_tile(const uint8_t *buf, int t, size_t n, bool identity)
+{
+    uint8_t *stage = (uint8_t *)s_stage;
+    size_t first = (size_t)t * FRAME_STACK_TILE;
+
+    if (s_config.format == PIXFORMAT_RGB565) {
+        const uint8_t *src = buf + first / 3 * 2;
+        for (size_t i = 0; i < n; i += 3, src += 2) {
+            uint16_t p = (uint16_t)((src[0] << 8) | src[1]);
+            stage[i] = expand5(p >> 11);
+            stage[i + 1] = expand6((p >> 5) & 0x3F);
+            stage[i + 2] = expand5(p & 0x1F);
+        }
+        if (!identity) {
+            for (size_t i = 0; i < n; i++) {
+                stage[i] = s_lut_even[stage[i]];
+            }
+        }
+    } else if (identity) {
+        memcpy(stage, buf + first, n);
+    } else {
+        // Tiles start on a multiple of 4, so local parity is the frame's
+        const uint8_t *src = buf + first;
+        for (size_t i = 0; i < n; i++) {
+            stage[i] = (i & 1) ? s_lut_odd[src[i]] : s_lut_even[src[i]];
+        }
+    }
+
+    size_t padded = (n + 3) & ~(size_t)3;
+    memset(stage + n, 0, padded - n);
+    return padded;
+}
+
+static void accumulate_tile(uint8_t *tile, const uint32_t *src, size_t n, bool first)
+{
+    uint32_t *sums = (uint32_t *)tile;
+    uint32_t *mins = (uint32_t *)(tile + FRAME_STACK_TILE * 2);
+    uint32_t *maxs = mins + FRAME_STACK_TILE / 4;
+    size_t words = n / 4;
+
+    // Two 16-bit lanes per add; FRAME_STACK_MAX_FRAMES keeps them from carrying
+    for (size_t g = 0; g < words; g++) {
+        uint32_t s = src[g];
+        sums[2 * g] += s & PAIR_MASK;
+        sums[2 * g + 1] += (s >> 8) & PAIR_MASK;
+    }
+
+    if (!s_config.reject_outliers) {
+        return;
+    }
+    if (first) {
+        memcpy(mins, src, n);
+        memcpy(maxs, src, n);
+        return;
+    }
+    for (size_t g = 0; g < words; g++) {
+        mins[g] = swar_min(mins[g], src[g]);
+        maxs[g] = swar_max(maxs[g], src[g]);
+    }
+}
+
+esp_err_t frame_stack_begin(const frame_stack_config_t *config)
+{
+    if (!config || config->width == 0 || config->height == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t pixels = (size_t)config->width * config->height;
+    size_t frame_bytes;
+    size_t samples;
+    switch (config->format) {
+    case PIXFORMAT_GRAYSCALE:
+        frame_bytes = pixels;
+        samples = pixels;
+        break;
+    case PIXFORMAT_YUV422:
+        frame_bytes = pixels * 2;
+        samples = pixels * 2;
+        break;
+    case PIXFORMAT_RGB565:
+        frame_bytes = pixels * 2;
+        samples = pixels * 3;
+        break;
+    default:
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    frame_stack_end();
+
+    s_config = *config;
+    s_frame_bytes = frame_bytes;
+    s_samples = samples;
+    s_tiles = (int)((samples + FRAME_STACK_TILE - 1) / FRAME_STACK_TILE);
+    s_tile_bytes = FRAME_STACK_TILE * (config->reject_outliers ? 4 : 2);
+
+    size_t size = s_tile_bytes * s_tiles;
+    s_acc = heap_caps_calloc(1, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!s_acc) {
+        ESP_LOGE(TAG, "Failed to allocate %zu byte accumulator", size);
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_frames = 0;
+    s_ref_mean = 0.0f;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.gain_min = GAIN_MAX;
+    s_stats.gain_max = 0.0f;
+    s_add_sum_us = 0;
+    s_active = true;
+
+    ESP_LOGI(TAG, "Stacking %dx%d frames: %d tiles, %zu KB accumulator%s%s",
+             config->width, config->height, s_tiles, size / 1024,
+             config->reject_outliers ? ", min/max rejection" : "",
+             config->normalize_exposure ? ", exposure normalised" : "");
+    return ESP_OK;
+}
+
+esp_err_t frame_stack_add(const camera_fb_t *fb, float gain)
+{
+    if (!s_active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!fb || fb->format != s_config.format || fb->width != s_config.width ||
+        fb->height != s_config.height || fb->len < s_frame_bytes || gain <= 0.0f) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_frames >= FRAME_STACK_MAX_FRAMES) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    if (s_config.normalize_exposure) {
+        float mean = frame_mean(fb->buf);
+        if (s_frames == 0) {
+            s_ref_mean = mean;
+        } else if (mean > 0.0f) {
+            gain *= s_ref_mean / mean;
+        }
+    }
+    gain = gain < GAIN_MIN ? GAIN_MIN : (gain > GAIN_MAX ? GAIN_MAX : gain);
+
+    bool identity = gain > 1.0f - 1.0f / 512 && gain < 1.0f + 1.0f / 512;
+    if (!identity) {
+        build_luts(gain);
+    }
+
+    bool first = s_frames == 0;
+    for (int t = 0; t < s_tiles; t++) {
+        size_t n = s_samples - (size_t)t * FRAME_STACK_TILE;
+        n = n > FRAME_STACK_TILE ? FRAME_STACK_TILE : n;
+        uint8_t *tile = s_acc + (size_t)t * s_tile_bytes;
+
+        if (identity && s_config.format != PIXFORMAT_RGB565 && (n & 3) == 0) {
+            // Straight from the frame buffer; tiles start word aligned
+            accumulate_tile(tile, (const uint32_t *)(fb->buf + (size_t)t * FRAME_STACK_TILE), n, first);
+        } else {
+            size_t padded = stage_tile(fb->buf, t, n, identity);
+            accumulate_tile(tile, s_stage, padded, first);
+        }
+    }
+
+    s_frames++;
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    s_add_sum_us += elapsed;
+    s_stats.add_max_us = elapsed > s_stats.add_max_us ? elapsed : s_stats.add_max_us;
+    s_stats.gain_min = gain < s_stats.gain_min ? gain : s_stats.gain_min;
+    s_stats.gain_max = gain > s_stats.gain_max ? gain : s_stats.gain_max;
+
+    ESP_LOGD(TAG, "Frame %lu stacked in %lu us (gain %.2f)",
+             (unsigned long)s_frames, (unsigned long)elapsed, gain);
+    return ESP_OK;
+}
+
+esp_err_t frame_stack_finish(uint8_t *out, size_t out_size)
+{
+    if (!s_active || s_frames == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!out || out_size < s_frame_bytes) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int64_t start = esp_timer_get_time();
+
+    bool reject = s_config.reject_outliers && s_frames >= 4;
+    uint32_t count = s_frames - (reject ? 2 : 0);
+    // Rounded Q16 reciprocal; sums stay below 2^16 so the product fits
+    uint32_t recip = (65536u + count / 2) / count;
+    uint8_t *stage = (uint8_t *)s_stage;
+
+    for (int t = 0; t < s_tiles; t++) {
+        size_t n = s_samples - (size_t)t * FRAME_STACK_TILE;
+        n = n > FRAME_STACK_TILE ? FRAME_STACK_TILE : n;
+        const uint8_t *tile = s_acc + (size_t)t * s_tile_bytes;
+        const uint32_t *sums = (const uint32_t *)tile;
+        const uint8_t *mins = tile + FRAME_STACK_TILE * 2;
+        const uint8_t *maxs = mins + FRAME_STACK_TILE;
+
+        for (size_t i = 0; i < n; i++) {
+            uint32_t word = sums[(i & ~(size_t)3) / 2 + (i & 1)];
+            uint32_t sum = (i & 2) ? word >> 16 : word & 0xFFFF;
+            if (reject) {
+                sum -= mins[i] + maxs[i];
+            }
+            uint32_t value = count == 1 ? sum : (sum * recip + 0x8000) >> 16;
+            stage[i] = value > 255 ? 255 : (uint8_t)value;
+        }
+
+        if (s_config.format == PIXFORMAT_RGB565) {
+            uint8_t *dst = out + (size_t)t * FRAME_STACK_TILE / 3 * 2;
+            for (size_t i = 0; i < n; i += 3, dst += 2) {
+                uint16_t p = pack565(stage[i], stage[i + 1], stage[i + 2]);
+                dst[0] = (uint8_t)(p >> 8);
+                dst[1] = (uint8_t)p;
+            }
+        } else {
+            memcpy(out + (size_t)t * FRAME_STACK_TILE, stage, n);
+        }
+    }
+
+    s_stats.finish_us = (uint32_t)(esp_timer_get_time() - start);
+    return ESP_OK;
+}
+
+esp_err_t frame_stack_encode_jpeg(int quality, uint8_t **jpeg, size_t *jpeg_len)
+{
+    if (!jpeg || !jpeg_len || quality < 1 || quality > 100) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+#if CONFIG_IDF_TARGET_LINUX
+    // Host builds have no esp32-camera encoder; frame_stack_finish still works
+    return ESP_ERR_NOT_SUPPORTED;
+#else
+    uint8_t *frame = heap_caps_malloc(s_frame_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!frame) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = frame_stack_finish(frame, s_frame_bytes);
+    if (ret == ESP_OK) {
+        int64_t start = esp_timer_get_time();
+        if (!fmt2jpg(frame, s_frame_bytes, s_config.width, s_config.height, s_config.format,
+                     (uint8_t)quality, jpeg, jpeg_len)) {
+            ESP_LOGE(TAG, "JPEG encode of stacked frame failed");
+            ret = ESP_FAIL;
+        }
+        s_stats.encode_us = (uint32_t)(esp_timer_get_time() - start);
+    }
+
+    heap_caps_free(frame);
+    return ret;
+#endif
+}
+
+void frame_stack_end(void)
+{
+    heap_caps_free(s_acc);
+    s_acc = NULL;
+    s_active = false;
+}
+
+esp_err_t frame_stack_get_stats(frame_stack_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = s_stats;
+    stats->frames = s_frames;
+    if (s_frames) {
+        stats->add_avg_us = (uint32_t)(s_add_sum_us / s_frames);
+    } else {
+        stats->gain_min = 0.0f;
+    }
+    if (s_add_sum_us) {
+        stats->mbytes_per_sec = (float)s_frame_bytes * s_frames / s_add_sum_us;
+    }
+    return ESP_OK;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_camera.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Low-light stacking: N raw frames are summed into a 16-bit-per-channel
+// accumulator in PSRAM and averaged once at the end, cutting random noise
+// by about sqrt(N). The accumulator is laid out in tiles of
+// FRAME_STACK_TILE samples (sums, then per-sample min and max) so one
+// tile's state plus its source bytes stays inside the data cache.
+#define FRAME_STACK_MAX_FRAMES  256     // 255 * 256 still fits a 16-bit sum
+#define FRAME_STACK_TILE        3072    // samples; multiple of 3 (RGB565 unpacks to 3) and 4 (SWAR)
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    pixformat_t format;         // PIXFORMAT_YUV422, PIXFORMAT_GRAYSCALE or PIXFORMAT_RGB565
+    bool reject_outliers;       // drop each sample's highest and lowest frame (4+ frames)
+    bool normalize_exposure;    // scale frames to the first frame's mean level
+} frame_stack_config_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t add_avg_us;
+    uint32_t add_max_us;
+    uint32_t finish_us;
+    uint32_t encode_us;
+    float mbytes_per_sec;       // input bytes stacked per second of add time
+    float gain_min;             // exposure gains applied (1.0 when not normalising)
+    float gain_max;
+} frame_stack_stats_t;
+
+esp_err_t frame_stack_begin(const frame_stack_config_t *config);
+
+// gain scales the frame's samples (luma only for YUV422); with
+// normalize_exposure it multiplies the automatic gain. Pass 1.0 normally.
+esp_err_t frame_stack_add(const camera_fb_t *fb, float gain);
+
+// Writes the averaged frame in the input format (width * height * bytes per pixel)
+esp_err_t frame_stack_finish(uint8_t *out, size_t out_size);
+
+// Averages and JPEG-encodes the stack in one go. quality is 1..100 (higher
+// is better, unlike the sensor's scale); free *jpeg with free().
+esp_err_t frame_stack_encode_jpeg(int quality, uint8_t **jpeg, size_t *jpeg_len);
+
+// Frees the accumulator
+void frame_stack_end(void);
+
+esp_err_t frame_stack_get_stats(frame_stack_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include "unity.h"
+#include "frame_stack.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Odd size so the last tile is partial
+#define FRAME_W     161
+#define FRAME_H     121
+#define FRAME_BYTES (FRAME_W * FRAME_H * 2)
+
+static uint8_t s_clean[FRAME_BYTES];
+static uint8_t s_noisy[FRAME_BYTES];
+static uint8_t s_out[FRAME_BYTES];
+static camera_fb_t s_fb = { .buf = s_noisy, .width = FRAME_W, .height = FRAME_H };
+static uint32_t s_seed = 1;
+
+static float gaussian(void)
+{
+    // Irwin-Hall: twelve uniforms, mean 6, variance 1
+    float sum = 0.0f;
+    for (int i = 0; i < 12; i++) {
+        s_seed = s_seed * 1103515245u + 12345u;
+        sum += (s_seed >> 8) / 16777216.0f;
+    }
+    return sum - 6.0f;
+}
+
+static uint8_t clamp8(float v)
+{
+    return v < 0.0f ? 0 : v > 255.0f ? 255 : (uint8_t)(v + 0.5f);
+}
+
+static size_t frame_bytes(pixformat_t format)
+{
+    return format == PIXFORMAT_GRAYSCALE ? FRAME_W * FRAME_H : FRAME_BYTES;
+}
+
+// Gradient in mid-grey, away from the clip points so noise stays symmetric
+static void draw_clean(pixformat_t format)
+{
+    size_t bytes = frame_bytes(format);
+    for (size_t i = 0; i < bytes; i++) {
+        size_t pixel = format == PIXFORMAT_GRAYSCALE ? i : i / 2;
+        int x = pixel % FRAME_W;
+        int y = pixel / FRAME_W;
+        s_clean[i] = (format == PIXFORMAT_YUV422 && (i & 1)) ? 128 : (uint8_t)(60 + x / 2 + y / 3);
+    }
+}
+
+static void draw_noisy(pixformat_t format, float sigma, float gain)
+{
+    size_t bytes = frame_bytes(format);
+    for (size_t i = 0; i < bytes; i++) {
+        bool chroma = format == PIXFORMAT_YUV422 && (i & 1);
+        s_noisy[i] = clamp8((chroma ? s_clean[i] : s_clean[i] * gain) + sigma * gaussian());
+    }
+    s_fb.format = format;
+    s_fb.len = bytes;
+}
+
+// Luma samples only, so YUV422 chroma does not dilute the error
+static float rmse(const uint8_t *frame, pixformat_t format)
+{
+    size_t bytes = frame_bytes(format);
+    int step = format == PIXFORMAT_YUV422 ? 2 : 1;
+    double sum = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < bytes; i += step) {
+        double d = (double)frame[i] - s_clean[i];
+        sum += d * d;
+        count++;
+    }
+    return (float)sqrt(sum / count);
+}
+
+static float stack(pixformat_t format, int frames, bool reject, bool normalize, float sigma, float gain_spread)
+{
+    frame_stack_config_t config = {
+        .width = FRAME_W,
+        .height = FRAME_H,
+        .format = format,
+        .reject_outliers = reject,
+        .normalize_exposure = normalize,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_begin(&config));
+    draw_clean(format);
+    for (int i = 0; i < frames; i++) {
+        float gain = 1.0f + gain_spread * ((i % 3) - 1);
+        draw_noisy(format, sigma, i == 0 ? 1.0f : gain);
+        TEST_ASSERT_EQUAL(ESP_OK, frame_stack_add(&s_fb, 1.0f));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_finish(s_out, sizeof(s_out)));
+    frame_stack_end();
+    return rmse(s_out, format);
+}
+
+TEST_CASE("identical frames stack back exactly", "[stack]")
+{
+    static const pixformat_t formats[] = { PIXFORMAT_GRAYSCALE, PIXFORMAT_YUV422 };
+    for (int f = 0; f < 2; f++) {
+        TEST_ASSERT_EQUAL(0.0f, stack(formats[f], 6, false, false, 0.0f, 0.0f));
+        TEST_ASSERT_EQUAL(0.0f, stack(formats[f], 6, true, false, 0.0f, 0.0f));
+    }
+
+    // Big-endian RGB565 goes through 8-bit channels and packs back the same
+    frame_stack_config_t config = { .width = FRAME_W, .height = FRAME_H, .format = PIXFORMAT_RGB565 };
+    for (size_t i = 0; i < FRAME_BYTES; i++) {
+        s_noisy[i] = (uint8_t)(i * 37 + (i >> 7));
+    }
+    s_fb.format = PIXFORMAT_RGB565;
+    s_fb.len = FRAME_BYTES;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_begin(&config));
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, frame_stack_add(&s_fb, 1.0f));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_finish(s_out, sizeof(s_out)));
+    TEST_ASSERT_EQUAL_MEMORY(s_noisy, s_out, FRAME_BYTES);
+    frame_stack_end();
+}
+
+TEST_CASE("noise falls with the square root of the frame count", "[stack]")
+{
+    float single = stack(PIXFORMAT_YUV422, 1, false, false, 10.0f, 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 10.0f, single);
+    float four = stack(PIXFORMAT_YUV422, 4, false, false, 10.0f, 0.0f);
+    float sixteen = stack(PIXFORMAT_YUV422, 16, false, false, 10.0f, 0.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f * single, single / 2.0f, four);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f * single, single / 4.0f, sixteen);
+
+    // Dropping each sample's extremes costs a little of that
+    float rejected = stack(PIXFORMAT_YUV422, 16, true, false, 10.0f, 0.0f);
+    TEST_ASSERT_LESS_THAN(single / 3.0f, rejected);
+}
+
+TEST_CASE("outlier rejection removes a headlight frame and hot pixels", "[stack]")
+{
+    float results[2];
+    for (int reject = 0; reject < 2; reject++) {
+        frame_stack_config_t config = {
+            .width = FRAME_W,
+            .height = FRAME_H,
+            .format = PIXFORMAT_GRAYSCALE,
+            .reject_outliers = reject,
+        };
+        TEST_ASSERT_EQUAL(ESP_OK, frame_stack_begin(&config));
+        draw_clean(PIXFORMAT_GRAYSCALE);
+        for (int i = 0; i < 8; i++) {
+            draw_noisy(PIXFORMAT_GRAYSCALE, 4.0f, 1.0f);
+            // One frame with a headlight sweep, and a random hot pixel each frame
+            if (i == 3) {
+                memset(s_noisy + FRAME_W * 40, 255, FRAME_W * 30);
+            }
+            for (int h = 0; h < 40; h++) {
+                s_noisy[(h * 7919 + i * 104729) % (FRAME_W * FRAME_H)] = 255;
+            }
+            TEST_ASSERT_EQUAL(ESP_OK, frame_stack_add(&s_fb, 1.0f));
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, frame_stack_finish(s_out, sizeof(s_out)));
+        frame_stack_end();
+        results[reject] = rmse(s_out, PIXFORMAT_GRAYSCALE);
+    }
+    // Pixels where a hot pixel meets the headlight keep one of the two
+    TEST_ASSERT_GREATER_THAN(8.0f, results[0]);
+    TEST_ASSERT_LESS_THAN(results[0] / 4.0f, results[1]);
+}
+
+TEST_CASE("exposure normalisation evens out gain steps", "[stack]")
+{
+    float plain = stack(PIXFORMAT_YUV422, 9, false, false, 2.0f, 0.2f);
+    float normalized = stack(PIXFORMAT_YUV422, 9, false, true, 2.0f, 0.2f);
+    TEST_ASSERT_LESS_THAN(plain / 2.0f, normalized);
+
+    frame_stack_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_get_stats(&stats));
+    TEST_ASSERT_EQUAL(9, stats.frames);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.0f / 1.2f, stats.gain_min);
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 1.0f / 0.8f, stats.gain_max);
+}
+
+TEST_CASE("256 full-scale frames fit and the next is refused", "[stack]")
+{
+    frame_stack_config_t config = { .width = FRAME_W, .height = FRAME_H, .format = PIXFORMAT_GRAYSCALE };
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_begin(&config));
+    memset(s_noisy, 255, FRAME_W * FRAME_H);
+    s_fb.format = PIXFORMAT_GRAYSCALE;
+    s_fb.len = FRAME_W * FRAME_H;
+    for (int i = 0; i < FRAME_STACK_MAX_FRAMES; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, frame_stack_add(&s_fb, 1.0f));
+    }
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, frame_stack_add(&s_fb, 1.0f));
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_finish(s_out, sizeof(s_out)));
+    for (int i = 0; i < FRAME_W * FRAME_H; i++) {
+        TEST_ASSERT_EQUAL(255, s_out[i]);
+    }
+    frame_stack_end();
+}
+
+TEST_CASE("frames that do not match the stack are refused", "[stack]")
+{
+    frame_stack_config_t config = { .width = FRAME_W, .height = FRAME_H, .format = PIXFORMAT_GRAYSCALE };
+    TEST_ASSERT_EQUAL(ESP_OK, frame_stack_begin(&config));
+    s_fb.format = PIXFORMAT_YUV422;
+    s_fb.len = FRAME_BYTES;
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, frame_stack_add(&s_fb, 1.0f));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, frame_stack_finish(s_out, sizeof(s_out)));
+    frame_stack_end();
+
+    config.format = PIXFORMAT_JPEG;
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, frame_stack_begin(&config));
+}
\ No newline at end of file
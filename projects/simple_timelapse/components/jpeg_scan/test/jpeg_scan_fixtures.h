@@ -0,0 +1,337 @@
+#pragma once
+
+#include <stdint.h>
+
+// 40x24 test card encoded by libjpeg at quality 95; regenerate with any
+// baseline encoder, the expected block means are taken from its input
+
+#define FIXTURE_WIDTH   40
+#define FIXTURE_HEIGHT  24
+
+static const uint8_t fixture_means_gray[15] = {
+     57, 112, 105, 159, 152, 102,  98, 152, 146, 199,  89, 142, 138, 190, 185,
+};
+
+static const uint8_t fixture_means_color[15] = {
+     61, 114, 107, 161, 154, 105, 101, 153, 147, 200,  92, 144, 140, 191, 186,
+};
+
+static const uint8_t fixture_jpeg_gray[690] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06,
+    0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x08,
+    0x0b, 0x0c, 0x0b, 0x0a, 0x0c, 0x09, 0x0a, 0x0a, 0x0a, 0xff, 0xc0, 0x00, 0x0b, 0x08, 0x00, 0x18,
+    0x00, 0x28, 0x01, 0x01, 0x11, 0x00, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00,
+    0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+    0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+    0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94,
+    0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+    0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9,
+    0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,
+    0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3f, 0x00, 0xfc, 0xe5, 0xf0, 0x5f, 0x86, 0x23, 0x91, 0xd1,
+    0x56, 0xd8, 0x19, 0x1e, 0x41, 0xf3, 0x2a, 0xfc, 0xbd, 0x73, 0xce, 0xec, 0xe0, 0xf2, 0x5b, 0x9f,
+    0x4f, 0x7c, 0xd7, 0xdb, 0x1e, 0x0c, 0xf0, 0xc4, 0x77, 0x38, 0x60, 0xac, 0x46, 0x15, 0x70, 0x30,
+    0x4a, 0x7c, 0xa4, 0x80, 0x0f, 0x6c, 0x01, 0xe9, 0xd0, 0x56, 0x2f, 0x81, 0xfc, 0x3f, 0x12, 0x34,
+    0x68, 0xea, 0xd9, 0xfb, 0x9b, 0x41, 0xe0, 0x92, 0x41, 0xf9, 0xb9, 0xcf, 0x5c, 0xf1, 0x8e, 0x83,
+    0x8e, 0xa2, 0xbe, 0xda, 0xf0, 0x17, 0x86, 0x71, 0x12, 0xab, 0xc3, 0xe7, 0x04, 0x52, 0x14, 0x86,
+    0xcf, 0x00, 0x8c, 0xff, 0x00, 0x17, 0x27, 0xbf, 0x3f, 0xa5, 0x61, 0x78, 0x23, 0xc2, 0xb2, 0x4f,
+    0x19, 0x79, 0x80, 0x70, 0x57, 0x1b, 0x86, 0x0e, 0x72, 0x47, 0x4c, 0x63, 0x91, 0xe8, 0x38, 0xe9,
+    0xc7, 0x03, 0x1f, 0x1b, 0x78, 0x13, 0xc3, 0x0b, 0xf6, 0xbd, 0xa2, 0x04, 0x66, 0x8d, 0x14, 0x6f,
+    0xd8, 0x40, 0x63, 0x8e, 0x7a, 0x70, 0x4f, 0xa6, 0x3a, 0x73, 0xf5, 0xac, 0xff, 0x00, 0x02, 0x78,
+    0x7d, 0x5d, 0xa3, 0x71, 0x13, 0x31, 0x4e, 0x02, 0x8f, 0x9b, 0x20, 0x11, 0xea, 0x7b, 0x74, 0xcf,
+    0x6c, 0xd7, 0xda, 0xfe, 0x0b, 0xf0, 0xb4, 0x16, 0x8d, 0x14, 0x2c, 0xbb, 0x06, 0xc5, 0x64, 0x6c,
+    0x63, 0x8f, 0xef, 0x9e, 0x80, 0x1c, 0x92, 0x7f, 0x0f, 0x7a, 0xc7, 0xf0, 0x77, 0x87, 0x03, 0x46,
+    0x91, 0xa4, 0x20, 0x3a, 0x0d, 0xaa, 0x71, 0x85, 0xc9, 0x18, 0x23, 0x1d, 0xf9, 0x3e, 0xb8, 0xe0,
+    0xd7, 0xda, 0xde, 0x0b, 0xf0, 0xb5, 0xc6, 0xe4, 0x38, 0x2c, 0xdb, 0x40, 0x01, 0xc7, 0x41, 0xb8,
+    0x0c, 0x71, 0xc0, 0xe7, 0x3f, 0x9f, 0x63, 0x5f, 0x88, 0xde, 0x04, 0xf0, 0xec, 0x4f, 0x26, 0xd7,
+    0xc6, 0xf5, 0xc6, 0xe0, 0xab, 0xf7, 0x86, 0x0e, 0x3e, 0x51, 0xec, 0x3a, 0xfa, 0x0e, 0xdd, 0x6b,
+    0xed, 0x5f, 0x02, 0x78, 0x68, 0x05, 0x48, 0xe1, 0x45, 0x76, 0xde, 0xac, 0x24, 0x65, 0x03, 0x82,
+    0x79, 0x3c, 0xf5, 0xff, 0x00, 0x3c, 0x75, 0xc6, 0x67, 0x82, 0x7c, 0x2b, 0x31, 0x89, 0x1a, 0x78,
+    0x89, 0x64, 0x23, 0x6e, 0x40, 0x65, 0xdb, 0xc9, 0x07, 0x19, 0xfc, 0x3e, 0x83, 0x3d, 0xab, 0xed,
+    0x4f, 0x05, 0xf8, 0x54, 0xb6, 0xcb, 0x78, 0x11, 0xd6, 0x35, 0x7f, 0xdc, 0xee, 0xe0, 0x37, 0x07,
+    0xb6, 0x3e, 0xbc, 0x60, 0x0c, 0x63, 0xaf, 0x7c, 0x8f, 0x04, 0xf8, 0x7e, 0xf4, 0x88, 0xd6, 0x20,
+    0xa4, 0x10, 0xe5, 0xe3, 0x91, 0x88, 0x3c, 0xe3, 0x3c, 0x67, 0x07, 0x85, 0x1d, 0xb2, 0x33, 0x9a,
+    0xff, 0xd9,
+};
+
+static const uint8_t fixture_jpeg_444[1042] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06,
+    0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x08,
+    0x0b, 0x0c, 0x0b, 0x0a, 0x0c, 0x09, 0x0a, 0x0a, 0x0a, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0a, 0x07, 0x06, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x18, 0x00, 0x28, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xf5, 0xf0, 0x5f, 0x86, 0x23, 0x91, 0xd1, 0x56, 0xd8, 0x17, 0x79, 0x07, 0xcc, 0xab, 0xf2, 0xf5,
+    0xce, 0x4e, 0xec, 0xe0, 0xf2, 0x5b, 0xf0, 0xf7, 0xcd, 0x79, 0xb1, 0x47, 0xbc, 0xd9, 0xf6, 0xa7,
+    0x83, 0x7c, 0x33, 0x1d, 0xc6, 0x18, 0x06, 0x23, 0x0a, 0x30, 0x30, 0x4a, 0x70, 0x48, 0x00, 0xf6,
+    0xc0, 0x03, 0xb7, 0x41, 0x5d, 0xd1, 0x89, 0xc5, 0x26, 0x62, 0xf8, 0x1f, 0xc3, 0xf1, 0x23, 0x46,
+    0x8e, 0xad, 0x9f, 0xbb, 0xb4, 0x1e, 0x09, 0x24, 0x1f, 0x9b, 0x9c, 0xf5, 0xcf, 0x18, 0xe8, 0x38,
+    0xea, 0x2a, 0x62, 0x87, 0x26, 0x7d, 0xad, 0xe0, 0x3f, 0x0d, 0x62, 0x25, 0x57, 0x87, 0xce, 0x08,
+    0xa4, 0x29, 0x0d, 0x9e, 0x01, 0x19, 0xfe, 0x2e, 0xbd, 0xf9, 0xfd, 0x2b, 0xbe, 0x28, 0xe3, 0x93,
+    0x30, 0xbc, 0x11, 0xe1, 0x69, 0x27, 0x8c, 0xbc, 0xc0, 0x38, 0x2b, 0x82, 0xc3, 0x07, 0x39, 0x23,
+    0xa7, 0x4e, 0x47, 0xa0, 0xe3, 0xdb, 0x81, 0x89, 0x8a, 0x2a, 0x4e, 0xc7, 0xc7, 0x5e, 0x04, 0xf0,
+    0xc2, 0xfd, 0xaf, 0x68, 0x81, 0x19, 0xa3, 0x45, 0xf9, 0xf6, 0x10, 0x18, 0xe3, 0x9e, 0x9c, 0x13,
+    0xe9, 0x8e, 0x9c, 0xfd, 0x6b, 0x8a, 0x28, 0xeb, 0x93, 0x33, 0xfc, 0x09, 0xe1, 0xf5, 0x76, 0x8d,
+    0xc4, 0x4c, 0xc5, 0x38, 0x0a, 0x3e, 0x6c, 0x80, 0x47, 0xa9, 0xed, 0xd3, 0x3d, 0xb3, 0x4a, 0x28,
+    0x72, 0x67, 0xda, 0x7e, 0x0b, 0xf0, 0xb4, 0x16, 0x8f, 0x14, 0x2c, 0xbb, 0x46, 0xc5, 0x64, 0x6c,
+    0x63, 0x8f, 0xef, 0x9e, 0x80, 0x1c, 0x92, 0x7f, 0x0f, 0x7a, 0xee, 0x8a, 0xb1, 0xc9, 0x26, 0x63,
+    0xf8, 0x3b, 0xc3, 0xa1, 0xe3, 0x44, 0x48, 0x40, 0x74, 0x1b, 0x55, 0xb1, 0x81, 0x92, 0x30, 0x46,
+    0x3b, 0xf2, 0x7d, 0x71, 0xc1, 0xa9, 0x8a, 0xd0, 0x6d, 0x9f, 0x69, 0xf8, 0x33, 0xc2, 0xf7, 0x1b,
+    0x90, 0xe0, 0xb3, 0x6d, 0x00, 0x07, 0x1d, 0x06, 0xe0, 0x31, 0xc7, 0x03, 0x9c, 0xfe, 0x7d, 0x8d,
+    0x77, 0xc5, 0x1c, 0x4d, 0x9f, 0x89, 0xbe, 0x05, 0xf0, 0xf4, 0x52, 0x49, 0x87, 0xc6, 0xf5, 0xc6,
+    0xe5, 0x55, 0xfb, 0xc3, 0x07, 0x1f, 0x28, 0xf6, 0x1d, 0x7d, 0x07, 0x6e, 0xb5, 0xe0, 0xc5, 0x1e,
+    0xd4, 0x99, 0xf6, 0x8f, 0x81, 0x7c, 0x35, 0x85, 0x44, 0x89, 0x15, 0xdb, 0x7a, 0xb7, 0x98, 0x54,
+    0x0e, 0x09, 0xe4, 0xfb, 0xff, 0x00, 0x9e, 0x3a, 0xe3, 0xba, 0x28, 0xe3, 0x93, 0x33, 0x7c, 0x15,
+    0xe1, 0x69, 0xcc, 0x48, 0x67, 0x8c, 0xee, 0x42, 0x31, 0x90, 0x19, 0x71, 0xc9, 0x07, 0x19, 0xfc,
+    0x3e, 0x83, 0x3d, 0xb8, 0x22, 0x81, 0xb3, 0xed, 0x0f, 0x06, 0x78, 0x5c, 0xb8, 0x4b, 0x78, 0x11,
+    0x95, 0x15, 0xff, 0x00, 0x73, 0xbb, 0x80, 0x78, 0x3d, 0xb1, 0xf5, 0xe3, 0x00, 0x63, 0x1d, 0x6b,
+    0xb6, 0x28, 0xe3, 0x6c, 0xc9, 0xf0, 0x5e, 0x81, 0x78, 0x44, 0x6b, 0x0e, 0xd2, 0x0a, 0xb1, 0x78,
+    0xa4, 0x62, 0x0f, 0x38, 0xcf, 0x7c, 0x1e, 0x17, 0xd3, 0x23, 0x39, 0xf5, 0xa5, 0x14, 0x39, 0x33,
+    0xff, 0xd9,
+};
+
+static const uint8_t fixture_jpeg_422[1029] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06,
+    0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x08,
+    0x0b, 0x0c, 0x0b, 0x0a, 0x0c, 0x09, 0x0a, 0x0a, 0x0a, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0a, 0x07, 0x06, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x18, 0x00, 0x28, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xf5, 0xf0, 0x5f, 0x86, 0x23, 0x91, 0xd1, 0x56, 0xd8, 0x17, 0x79, 0x07, 0xcc, 0xab, 0xf2, 0xf5,
+    0xce, 0x4e, 0xec, 0xe0, 0xf2, 0x5b, 0xf0, 0xf7, 0xcd, 0x7d, 0xa9, 0xe0, 0xdf, 0x0c, 0xc7, 0x71,
+    0x86, 0x01, 0x88, 0xc2, 0x8c, 0x0c, 0x12, 0x9c, 0x12, 0x00, 0x3d, 0xb0, 0x00, 0xed, 0xd0, 0x57,
+    0x25, 0x04, 0x7a, 0xf5, 0x99, 0x8b, 0xe0, 0x7f, 0x0f, 0xc4, 0x8d, 0x1a, 0x3a, 0xb6, 0x7e, 0xee,
+    0xd0, 0x78, 0x24, 0x90, 0x7e, 0x6e, 0x73, 0xd7, 0x3c, 0x63, 0xa0, 0xe3, 0xa8, 0xaf, 0xb5, 0xbc,
+    0x07, 0xe1, 0xac, 0x44, 0xaa, 0xf0, 0xf9, 0xc1, 0x14, 0x85, 0x21, 0xb3, 0xc0, 0x23, 0x3f, 0xc5,
+    0xd7, 0xbf, 0x3f, 0xa5, 0x76, 0xd0, 0x47, 0x25, 0x66, 0x61, 0x78, 0x23, 0xc2, 0xd2, 0x4f, 0x19,
+    0x79, 0x80, 0x70, 0x57, 0x05, 0x86, 0x0e, 0x72, 0x47, 0x4e, 0x9c, 0x8f, 0x41, 0xc7, 0xb7, 0x03,
+    0x05, 0x6c, 0x96, 0x86, 0x4e, 0x5a, 0x9f, 0x1d, 0x78, 0x13, 0xc3, 0x0b, 0xf6, 0xbd, 0xa2, 0x04,
+    0x66, 0x8d, 0x17, 0xe7, 0xd8, 0x40, 0x63, 0x8e, 0x7a, 0x70, 0x4f, 0xa6, 0x3a, 0x73, 0xf5, 0xac,
+    0xff, 0x00, 0x02, 0x78, 0x7d, 0x5d, 0xa3, 0x71, 0x13, 0x31, 0x4e, 0x02, 0x8f, 0x9b, 0x20, 0x11,
+    0xea, 0x7b, 0x74, 0xcf, 0x6c, 0xd7, 0x05, 0xb6, 0x3b, 0x6f, 0xb9, 0xf6, 0x9f, 0x82, 0xfc, 0x2d,
+    0x05, 0xa3, 0xc5, 0x0b, 0x2e, 0xd1, 0xb1, 0x59, 0x1b, 0x18, 0xe3, 0xfb, 0xe7, 0xa0, 0x07, 0x24,
+    0x9f, 0xc3, 0xde, 0xb1, 0xfc, 0x1d, 0xe1, 0xd0, 0xf1, 0xa2, 0x24, 0x20, 0x3a, 0x0d, 0xaa, 0xd8,
+    0xc0, 0xc9, 0x18, 0x23, 0x1d, 0xf9, 0x3e, 0xb8, 0xe0, 0xd7, 0x6d, 0xb6, 0x39, 0x2e, 0x7d, 0xa7,
+    0xe0, 0xcf, 0x0b, 0xdc, 0x6e, 0x43, 0x82, 0xcd, 0xb4, 0x00, 0x1c, 0x74, 0x1b, 0x80, 0xc7, 0x1c,
+    0x0e, 0x73, 0xf9, 0xf6, 0x34, 0x57, 0x7c, 0x63, 0xa1, 0xc4, 0xda, 0xb9, 0xf8, 0x9b, 0xe0, 0x5f,
+    0x0f, 0x45, 0x24, 0x98, 0x7c, 0x6f, 0x5c, 0x6e, 0x55, 0x5f, 0xbc, 0x30, 0x71, 0xf2, 0x8f, 0x61,
+    0xd7, 0xd0, 0x76, 0xeb, 0x5f, 0x68, 0xf8, 0x17, 0xc3, 0x58, 0x54, 0x48, 0x91, 0x5d, 0xb7, 0xab,
+    0x79, 0x85, 0x40, 0xe0, 0x9e, 0x4f, 0xbf, 0xf9, 0xe3, 0xae, 0x3c, 0x7a, 0x08, 0xf5, 0x6b, 0x33,
+    0x37, 0xc1, 0x5e, 0x16, 0x9c, 0xc4, 0x86, 0x78, 0xce, 0xe4, 0x23, 0x19, 0x01, 0x97, 0x1c, 0x90,
+    0x71, 0x9f, 0xc3, 0xe8, 0x33, 0xdb, 0x8f, 0xb4, 0x3c, 0x19, 0xe1, 0x72, 0xe1, 0x2d, 0xe0, 0x46,
+    0x54, 0x57, 0xfd, 0xce, 0xee, 0x01, 0xe0, 0xf6, 0xc7, 0xd7, 0x8c, 0x01, 0x8c, 0x75, 0xae, 0xea,
+    0x08, 0xe3, 0xac, 0xf6, 0x32, 0x7c, 0x17, 0xa0, 0x5e, 0x11, 0x1a, 0xc3, 0xb4, 0x82, 0xac, 0x5e,
+    0x29, 0x18, 0x83, 0xce, 0x33, 0xdf, 0x07, 0x85, 0xf4, 0xc8, 0xce, 0x7d, 0x68, 0xad, 0x92, 0x6d,
+    0x18, 0xb7, 0xa9, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_jpeg_420[1023] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06,
+    0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x08,
+    0x0b, 0x0c, 0x0b, 0x0a, 0x0c, 0x09, 0x0a, 0x0a, 0x0a, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0a, 0x07, 0x06, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x18, 0x00, 0x28, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc,
+    0xf5, 0xf0, 0x5f, 0x86, 0x23, 0x91, 0xd1, 0x56, 0xd8, 0x17, 0x79, 0x07, 0xcc, 0xab, 0xf2, 0xf5,
+    0xce, 0x4e, 0xec, 0xe0, 0xf2, 0x5b, 0xf0, 0xf7, 0xcd, 0x7d, 0xa9, 0xe0, 0xdf, 0x0c, 0xc7, 0x71,
+    0x86, 0x01, 0x88, 0xc2, 0x8c, 0x0c, 0x12, 0x9c, 0x12, 0x00, 0x3d, 0xb0, 0x00, 0xed, 0xd0, 0x57,
+    0x33, 0xe0, 0x4f, 0x0c, 0x2f, 0xda, 0xf6, 0x88, 0x11, 0x9a, 0x34, 0x5f, 0x9f, 0x61, 0x01, 0x8e,
+    0x39, 0xe9, 0xc1, 0x3e, 0x98, 0xe9, 0xcf, 0xd6, 0xb3, 0xfc, 0x09, 0xe1, 0xf5, 0x76, 0x8d, 0xc4,
+    0x4c, 0xc5, 0x38, 0x0a, 0x3e, 0x6c, 0x80, 0x47, 0xa9, 0xed, 0xd3, 0x3d, 0xb3, 0x5c, 0xd4, 0xe3,
+    0xc8, 0x7a, 0xb5, 0x25, 0xce, 0x6e, 0x78, 0x1f, 0xc3, 0xf1, 0x23, 0x46, 0x8e, 0xad, 0x9f, 0xbb,
+    0xb4, 0x1e, 0x09, 0x24, 0x1f, 0x9b, 0x9c, 0xf5, 0xcf, 0x18, 0xe8, 0x38, 0xea, 0x2b, 0xed, 0x6f,
+    0x01, 0xf8, 0x6b, 0x11, 0x2a, 0xbc, 0x3e, 0x70, 0x45, 0x21, 0x48, 0x6c, 0xf0, 0x08, 0xcf, 0xf1,
+    0x75, 0xef, 0xcf, 0xe9, 0x58, 0x1e, 0x0b, 0xf0, 0xb4, 0x16, 0x8f, 0x14, 0x2c, 0xbb, 0x46, 0xc5,
+    0x64, 0x6c, 0x63, 0x8f, 0xef, 0x9e, 0x80, 0x1c, 0x92, 0x7f, 0x0f, 0x7a, 0xc7, 0xf0, 0x77, 0x87,
+    0x43, 0xc6, 0x88, 0x90, 0x80, 0xe8, 0x36, 0xab, 0x63, 0x03, 0x24, 0x60, 0x8c, 0x77, 0xe4, 0xfa,
+    0xe3, 0x83, 0x5d, 0xb4, 0xe1, 0xc8, 0x72, 0xce, 0x5c, 0xe6, 0xd7, 0x82, 0x3c, 0x2d, 0x24, 0xf1,
+    0x97, 0x98, 0x07, 0x05, 0x70, 0x58, 0x60, 0xe7, 0x24, 0x74, 0xe9, 0xc8, 0xf4, 0x1c, 0x7b, 0x70,
+    0x30, 0x57, 0xd7, 0x3e, 0x0c, 0xf0, 0xbd, 0xc6, 0xe4, 0x38, 0x2c, 0xdb, 0x40, 0x01, 0xc7, 0x41,
+    0xb8, 0x0c, 0x71, 0xc0, 0xe7, 0x3f, 0x9f, 0x63, 0x45, 0x75, 0xc6, 0x8d, 0xd1, 0xca, 0xeb, 0x6a,
+    0x7e, 0x26, 0xf8, 0x17, 0xc3, 0xd1, 0x49, 0x26, 0x1f, 0x1b, 0xd7, 0x1b, 0x95, 0x57, 0xef, 0x0c,
+    0x1c, 0x7c, 0xa3, 0xd8, 0x75, 0xf4, 0x1d, 0xba, 0xd7, 0xda, 0x3e, 0x05, 0xf0, 0xd6, 0x15, 0x12,
+    0x24, 0x57, 0x6d, 0xea, 0xde, 0x61, 0x50, 0x38, 0x27, 0x93, 0xef, 0xfe, 0x78, 0xeb, 0x82, 0x8a,
+    0xf3, 0xa8, 0x23, 0xd0, 0xac, 0xd9, 0x9b, 0xe0, 0xaf, 0x0b, 0x4e, 0x62, 0x43, 0x3c, 0x67, 0x72,
+    0x11, 0x8c, 0x80, 0xcb, 0x8e, 0x48, 0x38, 0xcf, 0xe1, 0xf4, 0x19, 0xed, 0xc7, 0xda, 0x1e, 0x0c,
+    0xf0, 0xb9, 0x70, 0x96, 0xf0, 0x23, 0x2a, 0x2b, 0xfe, 0xe7, 0x77, 0x00, 0xf0, 0x7b, 0x63, 0xeb,
+    0xc6, 0x00, 0xc6, 0x3a, 0xd1, 0x45, 0x77, 0x50, 0x48, 0xe3, 0xac, 0xd9, 0x93, 0xe0, 0xbd, 0x02,
+    0xf0, 0x88, 0xd6, 0x1d, 0xa4, 0x15, 0x62, 0xf1, 0x48, 0xc4, 0x1e, 0x71, 0x9e, 0xf8, 0x3c, 0x2f,
+    0xa6, 0x46, 0x73, 0xeb, 0x45, 0x14, 0x56, 0xc9, 0x2b, 0x18, 0x36, 0xee, 0x7f, 0xff, 0xd9,
+};
+
+static const uint8_t fixture_jpeg_420_restart[1042] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+    0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06, 0x07, 0x09, 0x08, 0x06,
+    0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0b, 0x08, 0x09, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x06, 0x08,
+    0x0b, 0x0c, 0x0b, 0x0a, 0x0c, 0x09, 0x0a, 0x0a, 0x0a, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0a, 0x07, 0x06, 0x07, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x18, 0x00, 0x28, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+    0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+    0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+    0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+    0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+    0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+    0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+    0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+    0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+    0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x01, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11,
+    0x03, 0x11, 0x00, 0x3f, 0x00, 0xfc, 0xf5, 0xf0, 0x5f, 0x86, 0x23, 0x91, 0xd1, 0x56, 0xd8, 0x17,
+    0x79, 0x07, 0xcc, 0xab, 0xf2, 0xf5, 0xce, 0x4e, 0xec, 0xe0, 0xf2, 0x5b, 0xf0, 0xf7, 0xcd, 0x7d,
+    0xa9, 0xe0, 0xdf, 0x0c, 0xc7, 0x71, 0x86, 0x01, 0x88, 0xc2, 0x8c, 0x0c, 0x12, 0x9c, 0x12, 0x00,
+    0x3d, 0xb0, 0x00, 0xed, 0xd0, 0x57, 0x33, 0xe0, 0x4f, 0x0c, 0x2f, 0xda, 0xf6, 0x88, 0x11, 0x9a,
+    0x34, 0x5f, 0x9f, 0x61, 0x01, 0x8e, 0x39, 0xe9, 0xc1, 0x3e, 0x98, 0xe9, 0xcf, 0xd6, 0xb3, 0xfc,
+    0x09, 0xe1, 0xf5, 0x76, 0x8d, 0xc4, 0x4c, 0xc5, 0x38, 0x0a, 0x3e, 0x6c, 0x80, 0x47, 0xa9, 0xed,
+    0xd3, 0x3d, 0xb3, 0x5c, 0xd4, 0xe3, 0xc8, 0x7a, 0xb5, 0x25, 0xce, 0x7f, 0xff, 0xd0, 0xf2, 0xff,
+    0x00, 0x03, 0xf8, 0x7e, 0x24, 0x68, 0xd1, 0xd5, 0xb3, 0xf7, 0x76, 0x83, 0xc1, 0x24, 0x83, 0xf3,
+    0x73, 0x9e, 0xb9, 0xe3, 0x1d, 0x07, 0x1d, 0x45, 0x7d, 0xad, 0xe0, 0x3f, 0x0d, 0x62, 0x25, 0x57,
+    0x87, 0xce, 0x08, 0xa4, 0x29, 0x0d, 0x9e, 0x01, 0x19, 0xfe, 0x2e, 0xbd, 0xf9, 0xfd, 0x2b, 0x03,
+    0xc1, 0x7e, 0x16, 0x82, 0xd1, 0xe2, 0x85, 0x97, 0x68, 0xd8, 0xac, 0x8d, 0x8c, 0x71, 0xfd, 0xf3,
+    0xd0, 0x03, 0x92, 0x4f, 0xe1, 0xef, 0x58, 0xfe, 0x0e, 0xf0, 0xe8, 0x78, 0xd1, 0x12, 0x10, 0x1d,
+    0x06, 0xd5, 0x6c, 0x60, 0x64, 0x8c, 0x11, 0x8e, 0xfc, 0x9f, 0x5c, 0x70, 0x6b, 0x4a, 0x70, 0xe4,
+    0x3a, 0xe7, 0x2e, 0x73, 0xff, 0xd1, 0xf6, 0x9f, 0x04, 0x78, 0x5a, 0x49, 0xe3, 0x2f, 0x30, 0x0e,
+    0x0a, 0xe0, 0xb0, 0xc1, 0xce, 0x48, 0xe9, 0xd3, 0x91, 0xe8, 0x38, 0xf6, 0xe0, 0x60, 0xaf, 0xae,
+    0x7c, 0x19, 0xe1, 0x7b, 0x8d, 0xc8, 0x70, 0x59, 0xb6, 0x80, 0x03, 0x8e, 0x83, 0x70, 0x18, 0xe3,
+    0x81, 0xce, 0x7f, 0x3e, 0xc6, 0x8a, 0xef, 0x8d, 0x1b, 0xa1, 0xba, 0xda, 0x9f, 0xff, 0xd2, 0xf9,
+    0xbf, 0xc0, 0xbe, 0x1e, 0x8a, 0x49, 0x30, 0xf8, 0xde, 0xb8, 0xdc, 0xaa, 0xbf, 0x78, 0x60, 0xe3,
+    0xe5, 0x1e, 0xc3, 0xaf, 0xa0, 0xed, 0xd6, 0xbe, 0xd1, 0xf0, 0x2f, 0x86, 0xb0, 0xa8, 0x91, 0x22,
+    0xbb, 0x6f, 0x56, 0xf3, 0x0a, 0x81, 0xc1, 0x3c, 0x9f, 0x7f, 0xf3, 0xc7, 0x5c, 0x14, 0x54, 0xd0,
+    0x47, 0xa3, 0x59, 0xb3, 0xff, 0xd3, 0xeb, 0xfc, 0x15, 0xe1, 0x69, 0xcc, 0x48, 0x67, 0x8c, 0xee,
+    0x42, 0x31, 0x90, 0x19, 0x71, 0xc9, 0x07, 0x19, 0xfc, 0x3e, 0x83, 0x3d, 0xb8, 0xfb, 0x43, 0xc1,
+    0x9e, 0x17, 0x2e, 0x12, 0xde, 0x04, 0x65, 0x45, 0x7f, 0xdc, 0xee, 0xe0, 0x1e, 0x0f, 0x6c, 0x7d,
+    0x78, 0xc0, 0x18, 0xc7, 0x5a, 0x28, 0xae, 0xca, 0x09, 0x1a, 0xd6, 0x6c, 0xff, 0xd4, 0xfb, 0xa7,
+    0xc1, 0x7a, 0x05, 0xe1, 0x11, 0xac, 0x3b, 0x48, 0x2a, 0xc5, 0xe2, 0x91, 0x88, 0x3c, 0xe3, 0x3d,
+    0xf0, 0x78, 0x5f, 0x4c, 0x8c, 0xe7, 0xd6, 0x8a, 0x28, 0xaf, 0x49, 0x25, 0x62, 0x5b, 0x77, 0x3f,
+    0xff, 0xd9,
+};
\ No newline at end of file
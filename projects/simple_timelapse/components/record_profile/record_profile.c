@@ -0,0 +1,321 @@
+#include "record_profile.h"
+#include "sdcard_module.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "nvs.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "record_profile";
+
+#define NVS_NAMESPACE       "rec_profile"
+#define CACHE_VERSION       1
+#define BENCH_HEADER_BYTES  8       // a record header before every frame, as AVI chunks have
+#define PROMOTE_HEADROOM    1.25f   // the better profile must fit with this much to spare
+#define DEMOTE_SLACK        1.2f    // the margin may stretch this far before a step down
+#define FRAME_SCALE_RATE    0.1f
+#define FRAME_SCALE_MIN     0.5f
+#define FRAME_SCALE_MAX     2.0f
+
+typedef struct {
+    uint8_t version;
+    uint8_t index;              // profile in use when stored, for the log
+    uint16_t reserved;
+    uint32_t bytes_per_sec;
+    uint32_t latency_max_us;
+} cache_entry_t;
+
+static record_profile_config_t s_config;
+static record_profile_state_t s_state;
+static bool s_initialized = false;
+static uint8_t s_room_checks = 0;
+
+static uint32_t profile_need(int index)
+{
+    const record_profile_t *p = &s_config.profiles[index];
+    return (uint32_t)(p->frame_bytes * s_state.frame_scale) * p->fps;
+}
+
+static int pick_profile(uint32_t bytes_per_sec)
+{
+    float budget = bytes_per_sec * s_config.margin;
+    for (int i = 0; i < s_config.profile_count; i++) {
+        if (profile_need(i) <= budget) {
+            return i;
+        }
+    }
+    return s_config.profile_count - 1;
+}
+
+// NVS keys are 15 characters at most; the CID string is hashed into one
+static void cache_key(char *key, size_t len)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *c = s_state.card_id; *c; c++) {
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+    snprintf(key, len, "c%08lx", (unsigned long)hash);
+}
+
+static bool cache_load(cache_entry_t *entry)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return false;
+    }
+    char key[16];
+    cache_key(key, sizeof(key));
+    size_t len = sizeof(*entry);
+    esp_err_t ret = nvs_get_blob(nvs, key, entry, &len);
+    nvs_close(nvs);
+    return ret == ESP_OK && len == sizeof(*entry) && entry->version == CACHE_VERSION &&
+           entry->bytes_per_sec > 0;
+}
+
+static void cache_store(void)
+{
+    cache_entry_t entry = {
+        .version = CACHE_VERSION,
+        .index = s_state.index,
+        .bytes_per_sec = s_state.bytes_per_sec,
+        .latency_max_us = s_state.bench_latency_max_us
+    };
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret == ESP_OK) {
+        char key[16];
+        cache_key(key, sizeof(key));
+        ret = nvs_set_blob(nvs, key, &entry, sizeof(entry));
+        if (ret == ESP_OK) {
+            ret = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Card result not cached: %s", esp_err_to_name(ret));
+    }
+}
+
+// Writes frames of the best profile's size the way the recorders do: clips
+// append to one file, each frame after a small record header, and photos
+// each get a file of their own
+static esp_err_t run_benchmark(void)
+{
+    size_t frame_bytes = s_config.profiles[0].frame_bytes;
+    uint8_t *frame = heap_caps_malloc(frame_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!frame) {
+        frame = heap_caps_malloc(frame_bytes, MALLOC_CAP_8BIT);
+    }
+    if (!frame) {
+        return ESP_ERR_NO_MEM;
+    }
+    // Incompressible content, in case the card or the bus cares
+    uint32_t seed = 0x9e3779b9;
+    for (size_t i = 0; i < frame_bytes; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        frame[i] = (uint8_t)(seed >> 24);
+    }
+    const uint8_t header[BENCH_HEADER_BYTES] = {'0', '0', 'd', 'c'};
+
+    uint32_t frames = (s_config.bench_bytes + frame_bytes - 1) / frame_bytes;
+    uint32_t latency_max_us = 0;
+    uint64_t written = 0;
+    char path[96];
+    esp_err_t ret = ESP_OK;
+    int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < frames && ret == ESP_OK; i++) {
+        int64_t frame_start = esp_timer_get_time();
+        if (s_config.file_per_frame) {
+            snprintf(path, sizeof(path), "%s.%lu", s_config.bench_path, (unsigned long)i);
+            ret = sdcard_module_write_file(path, frame, frame_bytes);
+        } else {
+            if (i == 0) {
+                ret = sdcard_module_write_file(s_config.bench_path, header, sizeof(header));
+            } else {
+                ret = sdcard_module_append_file(s_config.bench_path, header, sizeof(header));
+            }
+            written += sizeof(header);
+            if (ret == ESP_OK) {
+                ret = sdcard_module_append_file(s_config.bench_path, frame, frame_bytes);
+            }
+        }
+        if (ret == ESP_OK) {
+            written += frame_bytes;
+        }
+        uint32_t latency_us = (uint32_t)(esp_timer_get_time() - frame_start);
+        if (latency_us > latency_max_us) {
+            latency_max_us = latency_us;
+        }
+    }
+    int64_t elapsed_us = esp_timer_get_time() - start;
+    if (s_config.file_per_frame) {
+        for (uint32_t i = 0; i < frames; i++) {
+            snprintf(path, sizeof(path), "%s.%lu", s_config.bench_path, (unsigned long)i);
+            sdcard_module_delete_file(path);
+        }
+    } else {
+        sdcard_module_delete_file(s_config.bench_path);
+    }
+    heap_caps_free(frame);
+
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Benchmark write failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    s_state.from_cache = false;
+    s_state.bytes_per_sec = (uint32_t)(written * 1000000 / (elapsed_us > 0 ? elapsed_us : 1));
+    s_state.bench_latency_max_us = latency_max_us;
+    s_state.bench_us = (uint32_t)elapsed_us;
+    sdcard_module_reset_write_latency();
+
+    ESP_LOGI(TAG, "Card %s: %lu KB in %lu ms, %lu KB/s, slowest frame %lu ms",
+             s_state.card_id, (unsigned long)(written / 1024), (unsigned long)(elapsed_us / 1000),
+             (unsigned long)(s_state.bytes_per_sec / 1024), (unsigned long)(latency_max_us / 1000));
+    return ESP_OK;
+}
+
+static void log_choice(const char *why)
+{
+    const record_profile_t *p = &s_config.profiles[s_state.index];
+    ESP_LOGI(TAG, "%s: %s (%dx%d, %d fps, q%d), ~%lu KB/s of %lu KB/s",
+             why, p->name, p->width, p->height, p->fps, p->jpeg_quality,
+             (unsigned long)(profile_need(s_state.index) / 1024), (unsigned long)(s_state.bytes_per_sec / 1024));
+}
+
+esp_err_t record_profile_init(const record_profile_config_t *config)
+{
+    if (!config || !config->profiles || config->profile_count == 0 ||
+        config->profile_count > RECORD_PROFILE_MAX || config->margin <= 0.0f ||
+        config->bench_bytes == 0 || !config->bench_path) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_config = *config;
+    memset(&s_state, 0, sizeof(s_state));
+    s_state.frame_scale = 1.0f;
+    s_room_checks = 0;
+
+    // Until the card is measured, the least demanding profile
+    s_state.index = config->profile_count - 1;
+    s_initialized = true;
+
+    esp_err_t ret = sdcard_module_get_card_id(s_state.card_id, sizeof(s_state.card_id));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    cache_entry_t entry;
+    if (cache_load(&entry)) {
+        s_state.from_cache = true;
+        s_state.bytes_per_sec = entry.bytes_per_sec;
+        s_state.bench_latency_max_us = entry.latency_max_us;
+        ESP_LOGI(TAG, "Card %s known: %lu KB/s", s_state.card_id, (unsigned long)(entry.bytes_per_sec / 1024));
+    } else {
+        ret = run_benchmark();
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    s_state.index = pick_profile(s_state.bytes_per_sec);
+    if (!s_state.from_cache) {
+        cache_store();
+    }
+    log_choice("Recording profile");
+    return ESP_OK;
+}
+
+const record_profile_t *record_profile_get(void)
+{
+    return s_initialized ? &s_config.profiles[s_state.index] : NULL;
+}
+
+void record_profile_observe_frame(size_t frame_len)
+{
+    if (!s_initialized || frame_len == 0) {
+        return;
+    }
+    float ratio = (float)frame_len / s_config.profiles[s_state.index].frame_bytes;
+    float scale = s_state.frame_scale + FRAME_SCALE_RATE * (ratio - s_state.frame_scale);
+    if (scale < FRAME_SCALE_MIN) {
+        scale = FRAME_SCALE_MIN;
+    } else if (scale > FRAME_SCALE_MAX) {
+        scale = FRAME_SCALE_MAX;
+    }
+    s_state.frame_scale = scale;
+}
+
+bool record_profile_update(void)
+{
+    sdcard_write_stats_t stats;
+    if (!s_initialized || s_state.bytes_per_sec == 0 || sdcard_module_get_write_stats(&stats) != ESP_OK ||
+        stats.writes == 0 || stats.bytes_per_sec == 0) {
+        return false;
+    }
+    sdcard_module_reset_write_latency();
+
+    // The p95 is rounded up to a power of two; a call that long past two
+    // frame periods has lost a slot whatever the rounding
+    int index = s_state.index;
+    float budget = stats.bytes_per_sec * s_config.margin;
+    uint32_t period_us = 1000000 / s_config.profiles[index].fps;
+    bool behind = profile_need(index) > budget * DEMOTE_SLACK || stats.latency_p95_us > 2 * period_us;
+
+    if (behind && index < s_config.profile_count - 1) {
+        // At least one step, further if the measured rate says so
+        int fits = pick_profile(stats.bytes_per_sec);
+        s_room_checks = 0;
+        s_state.bytes_per_sec = stats.bytes_per_sec;
+        s_state.index = fits > index ? fits : index + 1;
+        s_state.demotions++;
+        cache_store();
+        ESP_LOGW(TAG, "Card fell behind (%lu KB/s, write p95 %lu ms)",
+                 (unsigned long)(stats.bytes_per_sec / 1024), (unsigned long)(stats.latency_p95_us / 1000));
+        log_choice("Stepping down");
+        return true;
+    }
+
+    bool room = index > 0 && !behind &&
+                profile_need(index - 1) * PROMOTE_HEADROOM <= budget &&
+                stats.latency_p95_us <= 1000000 / s_config.profiles[index - 1].fps;
+    s_room_checks = room ? s_room_checks + 1 : 0;
+    if (room && s_room_checks >= s_config.promote_checks) {
+        s_room_checks = 0;
+        s_state.bytes_per_sec = stats.bytes_per_sec;
+        s_state.index = index - 1;
+        s_state.promotions++;
+        cache_store();
+        log_choice("Stepping up");
+        return true;
+    }
+    return false;
+}
+
+esp_err_t record_profile_recalibrate(void)
+{
+    if (!s_initialized || s_state.card_id[0] == '\0') {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t ret = run_benchmark();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    s_state.index = pick_profile(s_state.bytes_per_sec);
+    s_room_checks = 0;
+    cache_store();
+    log_choice("Recording profile");
+    return ESP_OK;
+}
+
+esp_err_t record_profile_get_state(record_profile_state_t *state)
+{
+    if (!state) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *state = s_state;
+    return ESP_OK;
+}
\ No newline at end of file
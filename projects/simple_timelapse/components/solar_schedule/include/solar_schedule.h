@@ -0,0 +1,71 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Capture schedule driven by the sun's elevation at the site, from the NOAA
+// solar position equations (declination and equation of time from the
+// Julian century, refraction-corrected elevation). A profile splits the sky
+// into elevation bands, each with its own capture interval. The next capture
+// time is solved directly, including the instants the sun crosses a band
+// edge, so a sleeping node wakes only when there is something to capture.
+#define SOLAR_SCHEDULE_MAX_BANDS    6
+
+typedef struct {
+    float min_elevation;        // degrees; band runs from here up to the next band's edge
+    uint32_t interval_s;        // 0 = no captures in this band
+    int action;                 // application-defined, e.g. clip or still
+} solar_band_t;
+
+typedef struct {
+    double latitude;            // degrees, north positive
+    double longitude;           // degrees, east positive
+    const solar_band_t *bands;  // highest min_elevation first; the last should start at -90
+    int band_count;
+} solar_schedule_config_t;
+
+typedef struct {
+    time_t time;                // UTC
+    int band;
+    float elevation;
+} solar_capture_t;
+
+typedef struct {
+    uint32_t captures[SOLAR_SCHEDULE_MAX_BANDS];
+    uint32_t seconds[SOLAR_SCHEDULE_MAX_BANDS];    // time the sun spends in each band
+    uint32_t total_captures;
+    float max_elevation;
+} solar_day_projection_t;
+
+esp_err_t solar_schedule_init(const solar_schedule_config_t *config);
+
+// Moves the site, e.g. once a GPS fix arrives
+esp_err_t solar_schedule_set_location(double latitude, double longitude);
+
+// Apparent elevation of the sun's centre in degrees at UTC time t
+float solar_elevation(double latitude, double longitude, time_t t);
+
+float solar_schedule_elevation(time_t t);
+
+int solar_schedule_band_at(time_t t);
+
+// Earliest capture at or after now that keeps its band's interval from
+// last_capture (0 = none yet). Bands without captures are skipped over.
+esp_err_t solar_schedule_next(time_t now, time_t last_capture, solar_capture_t *next);
+
+// Seconds from now until the next capture, for vTaskDelay or a deep-sleep
+// timer; 0 when it is due already
+uint32_t solar_schedule_seconds_until_next(time_t now, time_t last_capture, solar_capture_t *next);
+
+// Runs the schedule over the 24 hours from day_start
+esp_err_t solar_schedule_project_day(time_t day_start, solar_day_projection_t *projection);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
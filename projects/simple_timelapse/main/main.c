@@ -1,9 +1,12 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "camera_module.h"
 #include "sdcard_module.h"
@@ -11,6 +14,12 @@
 #include "manifest_manager.h"
 // #include "audio_recorder.h" - removed for video-only recording
 #include "avi_recorder.h"
+#include "capture_pacer.h"
+#include "frame_stack.h"
+#include "luma_meter.h"
+#include "frame_align.h"
+#include "solar_schedule.h"
+#include "record_profile.h"
 #include "wifi_config.h"
 
 static const char *TAG = "timelapse_camera";
@@ -28,11 +37,312 @@ static const char *TAG = "timelapse_camera";
 #define VIDEO_WIDTH         640
 #define VIDEO_HEIGHT        480
 
+// Clip size and rate come from the card: the first profile whose frames
+// fit under PROFILE_MARGIN of the write throughput measured at first boot
+// (cached per card in NVS) is recorded, and it moves a step after a clip
+// the card fell behind on or had room to spare for PROFILE_PROMOTE_CLIPS
+// clips. Quality is left to the rate controller; stills stay at VGA.
+#define PROFILE_MARGIN       0.6f
+#define PROFILE_BENCH_BYTES  (512 * 1024)
+#define PROFILE_BENCH_PATH   "timelapse_data/bench.tmp"
+#define PROFILE_PROMOTE_CLIPS 8
+
+// JPEG rate control: frames are budgeted against half of the measured SD
+// write throughput so AVI appends keep up with the frame rate
+#define RC_WRITE_HEADROOM    0.5f
+#define RC_DEFAULT_FRAME_BYTES  (40 * 1024)
+#define RC_MIN_QUALITY       8
+#define RC_MAX_QUALITY       40
+
 // Audio constants removed - using video-only recording
 
 #define CAPTURE_DURATION_MS  (VIDEO_DURATION_SEC * 1000)
 #define CAPTURE_INTERVAL_MS  (10 * 1000)
 
+// Capture slots follow the sun at the site: clips every VIDEO_INTERVAL_SEC by
+// day, every GOLDEN_INTERVAL_SEC while the sun is within 6 degrees of the
+// horizon, and one stacked still every NIGHT_INTERVAL_SEC once it is more
+// than 6 degrees below. Without a synced clock the fixed interval applies.
+#define SITE_LATITUDE        39.6654    // Red Rocks, CO; set to the node's location
+#define SITE_LONGITUDE       -105.2057
+#define GOLDEN_INTERVAL_SEC  30
+#define NIGHT_INTERVAL_SEC   1800
+
+// Rough per-capture costs for the daily projection
+#define CLIP_BYTES_EST       (VIDEO_FPS * VIDEO_DURATION_SEC * RC_DEFAULT_FRAME_BYTES)
+#define CLIP_ENERGY_MWH_EST  2.0f       // ~0.7 W for the 10 s clip
+#define STILL_BYTES_EST      (120 * 1024)
+#define STILL_ENERGY_MWH_EST 0.6f       // YUV burst, stack and encode
+
+typedef enum {
+    SLOT_CLIP = 1,
+    SLOT_STILL,
+} slot_action_t;
+
+static const solar_band_t s_sun_bands[] = {
+    { 6.0f, VIDEO_INTERVAL_SEC, SLOT_CLIP },
+    { -6.0f, GOLDEN_INTERVAL_SEC, SLOT_CLIP },
+    { -90.0f, NIGHT_INTERVAL_SEC, SLOT_STILL },
+};
+
+// At night a clip would be mostly sensor noise, so each slot produces one
+// still instead: STACK_FRAMES raw YUV422 frames averaged and encoded once
+#define STACK_FRAMES         8
+#define STACK_SETTLE_FRAMES  4      // AE/AWB settling after the format switch
+#define STACK_JPEG_QUALITY   85     // encoder scale, 1..100 higher is better
+
+// Clip brightness is measured from the JPEG DC terms of every
+// LUMA_EVERY_FRAMES-th frame. Those measurements drive a manual exposure in
+// place of the sensor AEC so clips do not flicker against each other, and
+// the clip's average goes into its manifest row.
+#define LUMA_EVERY_FRAMES    5
+#define DEFLICKER_TARGET     110
+#define DEFLICKER_RATE       0.2f
+#define DEFLICKER_DEADBAND   3
+#define DEFLICKER_MAX_EXPOSURE 1200
+
+// Wind shakes the mount. The metered frames are also aligned against the
+// session's first frame by phase correlation on the same DC map, and each
+// clip's mean offset goes into its manifest row for stabilising in post.
+// Night bursts are aligned to their first frame and shifted into place
+// before stacking (STACK_ALIGN 0 stacks them as captured).
+#define ALIGN_FFT_SIZE       64     // the DC map gets a 32-point tile, full-res bursts 64
+#define ALIGN_MIN_CONFIDENCE 8.0f
+#define ALIGN_REBASE_CONFIDENCE 12.0f
+#define STACK_ALIGN          1
+
+static const record_profile_t s_clip_profiles[] = {
+    { "SVGA 10 fps", FRAMESIZE_SVGA, 800, 600, 10, 12, 60 * 1024 },
+    { "VGA 10 fps", FRAMESIZE_VGA, 640, 480, 10, 12, 40 * 1024 },
+    { "VGA 5 fps", FRAMESIZE_VGA, 640, 480, 5, 12, 40 * 1024 },
+    { "QVGA 10 fps", FRAMESIZE_QVGA, 320, 240, 10, 12, 12 * 1024 },
+};
+
+// Frame size and quality follow the recording profile
+static camera_config_params_t s_clip_camera = {
+    .frame_size = FRAMESIZE_VGA,
+    .pixel_format = PIXFORMAT_JPEG,
+    .jpeg_quality = 12,
+    .fb_count = 2
+};
+
+static const camera_config_params_t s_stack_camera = {
+    .frame_size = FRAMESIZE_VGA,
+    .pixel_format = PIXFORMAT_YUV422,
+    .jpeg_quality = 12,
+    .fb_count = 2
+};
+
+static const camera_rate_control_config_t s_rate_config = {
+    .target_frame_bytes = RC_DEFAULT_FRAME_BYTES,
+    .min_quality = RC_MIN_QUALITY,
+    .max_quality = RC_MAX_QUALITY,
+    .kp = 4.0f,
+    .ki = 1.5f,
+    .deadband = 0.1f,
+    .log_interval_ms = 5000
+};
+
+static slot_action_t slot_action(time_t now)
+{
+    if (!time_sync_is_time_set()) {
+        return SLOT_CLIP;
+    }
+    return (slot_action_t)s_sun_bands[solar_schedule_band_at(now)].action;
+}
+
+// Sleeps until the schedule's next capture
+static void wait_for_next_slot(time_t last_capture)
+{
+    uint32_t wait_s = VIDEO_INTERVAL_SEC;
+    if (time_sync_is_time_set()) {
+        solar_capture_t next;
+        wait_s = solar_schedule_seconds_until_next(time(NULL), last_capture, &next);
+        ESP_LOGI(TAG, "Next capture in %lu s (sun at %.1f deg)", (unsigned long)wait_s, next.elevation);
+    } else {
+        ESP_LOGI(TAG, "Sleeping for %d seconds before next recording...", VIDEO_INTERVAL_SEC);
+    }
+    vTaskDelay(pdMS_TO_TICKS(wait_s * 1000ULL));
+}
+
+// Compares the coming day under the solar schedule with fixed-interval clips
+static void log_day_projection(void)
+{
+    solar_day_projection_t day;
+    if (!time_sync_is_time_set() || solar_schedule_project_day(time(NULL), &day) != ESP_OK) {
+        return;
+    }
+    
+    uint32_t clips = 0;
+    uint32_t stills = 0;
+    for (int i = 0; i < sizeof(s_sun_bands) / sizeof(s_sun_bands[0]); i++) {
+        if (s_sun_bands[i].action == SLOT_STILL) {
+            stills += day.captures[i];
+        } else {
+            clips += day.captures[i];
+        }
+    }
+    uint32_t fixed = 24 * 60 * 60 / VIDEO_INTERVAL_SEC;
+    float mb = (clips * (float)CLIP_BYTES_EST + stills * (float)STILL_BYTES_EST) / (1024 * 1024);
+    float fixed_mb = fixed * (float)CLIP_BYTES_EST / (1024 * 1024);
+    float mwh = clips * CLIP_ENERGY_MWH_EST + stills * STILL_ENERGY_MWH_EST;
+    float fixed_mwh = fixed * CLIP_ENERGY_MWH_EST;
+    
+    ESP_LOGI(TAG, "Next 24 h: sun up to %.1f deg, %lu min above 6 deg, %lu min near the horizon",
+             day.max_elevation, (unsigned long)(day.seconds[0] / 60), (unsigned long)(day.seconds[1] / 60));
+    ESP_LOGI(TAG, "Next 24 h: %lu clips + %lu stills, ~%.0f MB, ~%.0f mWh capture energy (fixed interval: %lu clips, ~%.0f MB, ~%.0f mWh)",
+             (unsigned long)clips, (unsigned long)stills, mb, mwh, (unsigned long)fixed, fixed_mb, fixed_mwh);
+}
+
+static esp_err_t switch_camera(const camera_config_params_t *params)
+{
+    camera_module_rate_control_stop();
+    camera_module_deinit();
+    esp_err_t ret = camera_module_init(params);
+    if (ret == ESP_OK && params->pixel_format == PIXFORMAT_JPEG) {
+        camera_module_rate_control_start(&s_rate_config);
+        // A fresh sensor is back on its own AEC
+        luma_deflicker_resume();
+    }
+    return ret;
+}
+
+// Moves the clip camera and the AVI recorder to the current recording profile
+static esp_err_t apply_profile(void)
+{
+    const record_profile_t *profile = record_profile_get();
+    if (s_clip_camera.frame_size != profile->frame_size || s_clip_camera.jpeg_quality != profile->jpeg_quality) {
+        s_clip_camera.frame_size = profile->frame_size;
+        s_clip_camera.jpeg_quality = profile->jpeg_quality;
+        esp_err_t ret = switch_camera(&s_clip_camera);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Camera switch to %s failed: %s", profile->name, esp_err_to_name(ret));
+            return ret;
+        }
+        // Offsets measured at the old size do not carry over
+        frame_align_reset();
+    }
+    avi_recorder_deinit();
+    return avi_recorder_init(profile->width, profile->height, profile->fps);
+}
+
+// Aligns the DC map of the last JPEG luma measurement against the session reference
+static bool align_last_scan(frame_align_result_t *offset)
+{
+    frame_align_image_t image = { .step = 1, .scale = 8 };
+    if (luma_meter_get_map(&image.data, &image.width, &image.height) != ESP_OK) {
+        return false;
+    }
+    image.stride = image.width;
+    return frame_align_measure(&image, offset) == ESP_OK && offset->valid;
+}
+
+static void to_manifest_align(float dx, float dy, manifest_align_t *align)
+{
+    align->dx = (int16_t)lroundf(dx);
+    align->dy = (int16_t)lroundf(dy);
+}
+
+// Grabs the burst, stacks it and writes one JPEG to full_path; *has_luma
+// says whether luma holds the still's brightness
+static esp_err_t capture_stacked_still(const char *full_path, size_t *jpeg_len, int *span_ms,
+                                       manifest_luma_t *luma, bool *has_luma)
+{
+    esp_err_t ret = switch_camera(&s_stack_camera);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Camera switch to YUV422 failed: %s", esp_err_to_name(ret));
+        switch_camera(&s_clip_camera);
+        return ret;
+    }
+    
+    for (int i = 0; i < STACK_SETTLE_FRAMES; i++) {
+        camera_fb_t *fb = camera_module_capture();
+        if (fb) {
+            camera_module_return_fb(fb);
+        }
+    }
+    
+    frame_stack_config_t stack_config = {
+        .width = VIDEO_WIDTH,
+        .height = VIDEO_HEIGHT,
+        .format = PIXFORMAT_YUV422,
+        .reject_outliers = true,
+        .normalize_exposure = true
+    };
+    ret = frame_stack_begin(&stack_config);
+    
+    int64_t start = esp_timer_get_time();
+    bool have_burst_ref = false;
+    for (int i = 0; i < STACK_FRAMES && ret == ESP_OK; i++) {
+        camera_fb_t *fb = camera_module_capture();
+        if (!fb) {
+            ESP_LOGW(TAG, "Stack frame %d capture failed", i);
+            continue;
+        }
+        
+        if (STACK_ALIGN) {
+            // Luma is every other byte of YUV422
+            frame_align_image_t image = {
+                .data = fb->buf,
+                .width = fb->width,
+                .height = fb->height,
+                .stride = fb->width * 2,
+                .step = 2,
+                .scale = 1
+            };
+            frame_align_result_t offset;
+            if (!have_burst_ref) {
+                have_burst_ref = frame_align_burst_reference(&image) == ESP_OK;
+            } else if (frame_align_burst_measure(&image, &offset) == ESP_OK && offset.valid) {
+                // Whole pixel pairs keep the U and V samples with their luma
+                int dx = (int)lroundf(offset.dx / 2.0f);
+                int dy = (int)lroundf(offset.dy);
+                if (dx != 0 || dy != 0) {
+                    frame_align_shift(fb->buf, fb->width / 2, fb->height, 4, -dx, -dy);
+                    ESP_LOGD(TAG, "Stack frame %d shifted %+d,%+d", i, -2 * dx, -dy);
+                }
+            }
+        }
+        
+        esp_err_t add_ret = frame_stack_add(fb, 1.0f);
+        if (add_ret != ESP_OK) {
+            ESP_LOGW(TAG, "Stack frame %d rejected: %s", i, esp_err_to_name(add_ret));
+        }
+        camera_module_return_fb(fb);
+    }
+    *span_ms = (int)((esp_timer_get_time() - start) / 1000);
+    
+    // Back to JPEG before the slow encode and write so the sensor settles meanwhile
+    switch_camera(&s_clip_camera);
+    
+    uint8_t *jpeg = NULL;
+    if (ret == ESP_OK) {
+        ret = frame_stack_encode_jpeg(STACK_JPEG_QUALITY, &jpeg, jpeg_len);
+    }
+    
+    frame_stack_stats_t stats;
+    frame_stack_get_stats(&stats);
+    ESP_LOGI(TAG, "Stacked %lu frames: add avg %lu us (%.1f MB/s), average %lu us, encode %lu us, gain %.2f..%.2f",
+             (unsigned long)stats.frames, (unsigned long)stats.add_avg_us, stats.mbytes_per_sec,
+             (unsigned long)stats.finish_us, (unsigned long)stats.encode_us, stats.gain_min, stats.gain_max);
+    frame_stack_end();
+    
+    luma_stats_t stats_luma;
+    *has_luma = ret == ESP_OK && luma_meter_measure_jpeg(jpeg, *jpeg_len, &stats_luma) == ESP_OK;
+    if (*has_luma) {
+        luma->mean = stats_luma.mean;
+        luma->p5 = stats_luma.p5;
+        luma->p50 = stats_luma.p50;
+        luma->p95 = stats_luma.p95;
+    }
+    
+    if (ret == ESP_OK) {
+        ret = sdcard_module_save_jpeg(jpeg, *jpeg_len, full_path);
+    }
+    free(jpeg);
+    return ret;
+}
+
 static void video_recording_task(void *pvParameters)
 {
     int video_index = 0;
@@ -53,6 +363,7 @@ static void video_recording_task(void *pvParameters)
                 time_sync_disconnect_wifi();
                 last_sync_time = current_time;
                 ESP_LOGI(TAG, "Time resync completed");
+                log_day_projection();
             } else {
                 ESP_LOGW(TAG, "Time resync failed, continuing with current time");
             }
@@ -71,6 +382,48 @@ static void video_recording_task(void *pvParameters)
             ESP_LOGE(TAG, "Failed to create directory: %s", date_path);
         }
         
+        char relative_path[64];
+        if (time_sync_is_time_set()) {
+            time_sync_format_timestamp(relative_path, sizeof(relative_path), "%Y/%m/%d");
+        } else {
+            snprintf(relative_path, sizeof(relative_path), "no_time");
+        }
+        
+        time_t slot_start = time(NULL);
+        if (slot_action(slot_start) == SLOT_STILL) {
+            char still_filename[64];
+            char still_full_path[128];
+            char timestamp[32];
+            time_sync_format_timestamp(timestamp, sizeof(timestamp), "%H%M%S");
+            snprintf(still_filename, sizeof(still_filename), "night_%s_%04d.jpg", timestamp, video_index);
+            snprintf(still_full_path, sizeof(still_full_path), "%s/%s", date_path, still_filename);
+            
+            size_t still_len = 0;
+            int span_ms = 0;
+            manifest_luma_t still_luma;
+            bool has_luma = false;
+            ret = capture_stacked_still(still_full_path, &still_len, &span_ms, &still_luma, &has_luma);
+            if (ret == ESP_OK) {
+                ESP_LOGI(TAG, "Saved night still: %s (%zu bytes)", still_full_path, still_len);
+                // The still's luma was the last scan, so its DC map is still there
+                frame_align_result_t offset;
+                manifest_align_t still_align;
+                bool has_align = has_luma && align_last_scan(&offset);
+                if (has_align) {
+                    to_manifest_align(offset.dx, offset.dy, &still_align);
+                }
+                manifest_add_video_meta(relative_path, still_filename, still_len, span_ms,
+                                        has_luma ? &still_luma : NULL, has_align ? &still_align : NULL);
+                manifest_save_to_sd();
+            } else {
+                ESP_LOGE(TAG, "Night still failed: %s", esp_err_to_name(ret));
+            }
+            
+            video_index++;
+            wait_for_next_slot(slot_start);
+            continue;
+        }
+        
         // Generate filename with timestamp
         if (time_sync_is_time_set()) {
             char timestamp[32];
@@ -92,13 +445,35 @@ static void video_recording_task(void *pvParameters)
             continue;
         }
         
-        // Recording loop
-        TickType_t recording_start = xTaskGetTickCount();
+        // Re-derive the frame budget from what the card actually sustained
+        const record_profile_t *profile = record_profile_get();
+        uint32_t frame_budget = camera_module_rate_control_target(sdcard_module_get_write_throughput(),
+                                                                  profile->fps, RC_WRITE_HEADROOM);
+        if (frame_budget > 0) {
+            camera_module_rate_control_set_target(frame_budget);
+        }
+        
+        // Recording loop: one AVI frame per slot so the clip plays back at
+        // the profile's rate; slots missed to a slow write become empty frames
+        capture_pacer_config_t pacer_config = {
+            .frame_count = profile->fps * VIDEO_DURATION_SEC,
+            .duration_ms = VIDEO_DURATION_SEC * 1000,
+            .policy = CAPTURE_PACER_DROP
+        };
+        if (capture_pacer_start(&pacer_config) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to start capture pacer");
+        }
+        
         int frame_count = 0;
+        uint32_t luma_sum[4] = {0};
+        uint32_t luma_count = 0;
+        uint32_t luma_us = 0;
+        float align_sum[2] = {0};
+        uint32_t align_count = 0;
+        capture_pacer_tick_t tick;
         
-        while ((xTaskGetTickCount() - recording_start) < pdMS_TO_TICKS(VIDEO_DURATION_SEC * 1000)) {
-            // Capture and add video frame
-            camera_fb_t *fb = camera_module_capture();
+        while (capture_pacer_next(&tick)) {
+            camera_fb_t *fb = tick.drop ? NULL : camera_module_capture();
             if (fb) {
                 esp_err_t frame_ret = avi_recorder_add_frame(fb->buf, fb->len);
                 if (frame_ret == ESP_OK) {
@@ -106,28 +481,64 @@ static void video_recording_task(void *pvParameters)
                 } else {
                     ESP_LOGW(TAG, "Failed to add frame to AVI");
                 }
+                
+                luma_stats_t luma;
+                if (tick.index % LUMA_EVERY_FRAMES == 0 && luma_meter_measure(fb, &luma) == ESP_OK) {
+                    luma_deflicker_observe(&luma);
+                    luma_sum[0] += luma.mean;
+                    luma_sum[1] += luma.p5;
+                    luma_sum[2] += luma.p50;
+                    luma_sum[3] += luma.p95;
+                    luma_count++;
+                    luma_us += luma.scan_us;
+                    
+                    frame_align_result_t offset;
+                    if (align_last_scan(&offset)) {
+                        align_sum[0] += offset.dx;
+                        align_sum[1] += offset.dy;
+                        align_count++;
+                    }
+                }
                 camera_module_return_fb(fb);
             } else {
-                ESP_LOGW(TAG, "Camera capture failed");
+                if (!tick.drop) {
+                    ESP_LOGW(TAG, "Camera capture failed");
+                }
+                avi_recorder_add_empty_frame();
             }
-            
-            // Frame rate control
-            vTaskDelay(pdMS_TO_TICKS(1000 / VIDEO_FPS));
         }
         
         // Stop recording
         avi_recorder_stop();
+        capture_pacer_log_stats();
         
         // Add to manifest
-        char relative_path[64];
-        if (time_sync_is_time_set()) {
-            time_sync_format_timestamp(relative_path, sizeof(relative_path), "%Y/%m/%d");
-        } else {
-            snprintf(relative_path, sizeof(relative_path), "no_time");
-        }
-        
         avi_recording_state_t *avi_state = avi_recorder_get_state();
-        manifest_add_video(relative_path, avi_filename, avi_state->total_bytes, VIDEO_DURATION_SEC * 1000);
+        manifest_luma_t clip_luma = {0};
+        if (luma_count > 0) {
+            clip_luma.mean = (luma_sum[0] + luma_count / 2) / luma_count;
+            clip_luma.p5 = (luma_sum[1] + luma_count / 2) / luma_count;
+            clip_luma.p50 = (luma_sum[2] + luma_count / 2) / luma_count;
+            clip_luma.p95 = (luma_sum[3] + luma_count / 2) / luma_count;
+            
+            luma_deflicker_stats_t deflicker;
+            luma_deflicker_get_stats(&deflicker);
+            ESP_LOGI(TAG, "Clip luma %d (p5 %d, p95 %d) over %lu frames, scan avg %lu us, exposure %u, flicker rms %.1f",
+                     clip_luma.mean, clip_luma.p5, clip_luma.p95, (unsigned long)luma_count,
+                     (unsigned long)(luma_us / luma_count), deflicker.exposure, deflicker.flicker_rms);
+        }
+        manifest_align_t clip_align;
+        if (align_count > 0) {
+            to_manifest_align(align_sum[0] / align_count, align_sum[1] / align_count, &clip_align);
+            
+            frame_align_stats_t align_stats;
+            frame_align_get_stats(&align_stats);
+            ESP_LOGI(TAG, "Clip offset %+d,%+d px over %lu frames, align avg %lu us, %lu rebases",
+                     clip_align.dx, clip_align.dy, (unsigned long)align_count,
+                     (unsigned long)align_stats.avg_us, (unsigned long)align_stats.rebases);
+        }
+        manifest_add_video_meta(relative_path, avi_filename, avi_state->total_bytes, VIDEO_DURATION_SEC * 1000,
+                                luma_count > 0 ? &clip_luma : NULL, align_count > 0 ? &clip_align : NULL);
         manifest_save_to_sd();
         
         // Show storage info
@@ -140,9 +551,12 @@ static void video_recording_task(void *pvParameters)
         video_index++;
         ESP_LOGI(TAG, "Completed video #%d: %d frames", video_index, frame_count);
         
-        // Sleep for 250 seconds before next recording
-        ESP_LOGI(TAG, "Sleeping for %d seconds before next recording...", VIDEO_INTERVAL_SEC);
-        vTaskDelay(pdMS_TO_TICKS(VIDEO_INTERVAL_SEC * 1000));
+        // The clip's writes tell whether the card keeps up with the profile
+        if (record_profile_update()) {
+            apply_profile();
+        }
+        
+        wait_for_next_slot(slot_start);
     }
 }
 
@@ -187,15 +601,8 @@ void app_main(void)
         ESP_LOGE(TAG, "Time sync init failed, continuing without time sync");
     }
     
-    camera_config_params_t camera_params = {
-        .frame_size = FRAMESIZE_VGA,
-        .pixel_format = PIXFORMAT_JPEG,
-        .jpeg_quality = 12,
-        .fb_count = 2
-    };
-    
     ESP_LOGI(TAG, "Initializing camera...");
-    ret = camera_module_init(&camera_params);
+    ret = camera_module_init(&s_clip_camera);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Camera init failed");
         return;
@@ -205,6 +612,31 @@ void app_main(void)
     camera_module_set_contrast(0);
     camera_module_set_saturation(0);
     
+    camera_module_rate_control_start(&s_rate_config);
+    
+    luma_deflicker_config_t deflicker_config = {
+        .target_mean = DEFLICKER_TARGET,
+        .rate = DEFLICKER_RATE,
+        .deadband = DEFLICKER_DEADBAND,
+        .min_exposure = 1,
+        .max_exposure = DEFLICKER_MAX_EXPOSURE,
+        .initial_exposure = DEFLICKER_MAX_EXPOSURE / 4
+    };
+    ret = luma_deflicker_start(&deflicker_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Deflicker unavailable, exposure stays automatic");
+    }
+    
+    frame_align_config_t align_config = {
+        .fft_size = ALIGN_FFT_SIZE,
+        .min_confidence = ALIGN_MIN_CONFIDENCE,
+        .rebase_confidence = ALIGN_REBASE_CONFIDENCE
+    };
+    ret = frame_align_init(&align_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Frame alignment unavailable: %s", esp_err_to_name(ret));
+    }
+    
     sdcard_config_t sd_config = {
         .miso_gpio = SD_MISO_GPIO,
         .mosi_gpio = SD_MOSI_GPIO,
@@ -232,9 +664,36 @@ void app_main(void)
         ESP_LOGE(TAG, "Manifest init failed");
     }
     
+    solar_schedule_config_t schedule_config = {
+        .latitude = SITE_LATITUDE,
+        .longitude = SITE_LONGITUDE,
+        .bands = s_sun_bands,
+        .band_count = sizeof(s_sun_bands) / sizeof(s_sun_bands[0])
+    };
+    ret = solar_schedule_init(&schedule_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Solar schedule init failed: %s", esp_err_to_name(ret));
+    }
+    log_day_projection();
+    
+    record_profile_config_t profile_config = {
+        .profiles = s_clip_profiles,
+        .profile_count = sizeof(s_clip_profiles) / sizeof(s_clip_profiles[0]),
+        .margin = PROFILE_MARGIN,
+        .bench_bytes = PROFILE_BENCH_BYTES,
+        .bench_path = PROFILE_BENCH_PATH,
+        .file_per_frame = false,
+        .promote_checks = PROFILE_PROMOTE_CLIPS
+    };
+    ret = record_profile_init(&profile_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Card calibration failed (%s), recording %s", esp_err_to_name(ret),
+                 record_profile_get()->name);
+    }
+    
     ESP_LOGI(TAG, "Starting timelapse capture task...");
     ESP_LOGI(TAG, "Initializing AVI recorder...");
-    ret = avi_recorder_init(VIDEO_WIDTH, VIDEO_HEIGHT, VIDEO_FPS);
+    ret = apply_profile();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "AVI recorder init failed: %s", esp_err_to_name(ret));
     }
@@ -242,8 +701,10 @@ void app_main(void)
     xTaskCreate(video_recording_task, "video_task", 8192, NULL, 5, NULL);
     
     ESP_LOGI(TAG, "Video recording system ready!");
-    ESP_LOGI(TAG, "Recording %d-second MJPEG AVI videos every %d seconds", VIDEO_DURATION_SEC, VIDEO_INTERVAL_SEC);
-    ESP_LOGI(TAG, "Frame rate: %d FPS, Resolution: %dx%d", VIDEO_FPS, VIDEO_WIDTH, VIDEO_HEIGHT);
+    ESP_LOGI(TAG, "Recording %d-second MJPEG AVI videos every %d seconds by day, %d near sunrise and sunset",
+             VIDEO_DURATION_SEC, VIDEO_INTERVAL_SEC, GOLDEN_INTERVAL_SEC);
+    ESP_LOGI(TAG, "Frame rate: %d FPS, Resolution: %dx%d", record_profile_get()->fps,
+             record_profile_get()->width, record_profile_get()->height);
     ESP_LOGI(TAG, "Files organized in timelapse_data/YYYY/MM/DD/");
     ESP_LOGI(TAG, "Manifest available at timelapse_data/manifest.json");
 }
\ No newline at end of file
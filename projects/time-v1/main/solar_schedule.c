@@ -0,0 +1,296 @@
+#include "solar_schedule.h"
+#include "esp_log.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "solar_schedule";
+
+#define DEG_TO_RAD(d)   ((d) * M_PI / 180.0)
+#define RAD_TO_DEG(r)   ((r) * 180.0 / M_PI)
+
+#define SECONDS_PER_DAY     86400
+#define NO_CROSSING_SPAN_S  (2 * SECONDS_PER_DAY)   // polar day/night: look again after this
+#define MAX_BAND_HOPS       16
+
+static solar_band_t s_bands[SOLAR_SCHEDULE_MAX_BANDS];
+static int s_band_count = 0;
+static double s_latitude = 0.0;
+static double s_longitude = 0.0;
+static bool s_initialized = false;
+
+typedef struct {
+    double declination;         // radians
+    double eq_time;             // minutes, apparent minus mean solar time
+} sun_t;
+
+static double julian_day(double unix_seconds)
+{
+    return unix_seconds / SECONDS_PER_DAY + 2440587.5;
+}
+
+// NOAA solar calculator, Julian-century form
+static void sun_at(double jd, sun_t *sun)
+{
+    double jc = (jd - 2451545.0) / 36525.0;
+    double mean_long = fmod(280.46646 + jc * (36000.76983 + jc * 0.0003032), 360.0);
+    double mean_anom = 357.52911 + jc * (35999.05029 - 0.0001537 * jc);
+    double ecc = 0.016708634 - jc * (0.000042037 + 0.0000001267 * jc);
+    double m = DEG_TO_RAD(mean_anom);
+    double center = sin(m) * (1.914602 - jc * (0.004817 + 0.000014 * jc)) +
+                    sin(2 * m) * (0.019993 - 0.000101 * jc) + sin(3 * m) * 0.000289;
+    double omega = DEG_TO_RAD(125.04 - 1934.136 * jc);
+    double app_long = DEG_TO_RAD(mean_long + center - 0.00569 - 0.00478 * sin(omega));
+    double mean_obliq = 23.0 + (26.0 + (21.448 - jc * (46.815 + jc * (0.00059 - jc * 0.001813))) / 60.0) / 60.0;
+    double obliq = DEG_TO_RAD(mean_obliq + 0.00256 * cos(omega));
+
+    sun->declination = asin(sin(obliq) * sin(app_long));
+
+    double y = tan(obliq / 2) * tan(obliq / 2);
+    double l0 = DEG_TO_RAD(mean_long);
+    sun->eq_time = 4.0 * RAD_TO_DEG(y * sin(2 * l0) - 2 * ecc * sin(m) + 4 * ecc * y * sin(m) * cos(2 * l0) -
+                                    0.5 * y * y * sin(4 * l0) - 1.25 * ecc * ecc * sin(2 * m));
+}
+
+// Atmospheric refraction in degrees for a geometric elevation
+static double refraction(double elevation)
+{
+    if (elevation > 85.0) {
+        return 0.0;
+    }
+
+    double te = tan(DEG_TO_RAD(elevation));
+    double arcsec;
+    if (elevation > 5.0) {
+        arcsec = 58.1 / te - 0.07 / (te * te * te) + 0.000086 / (te * te * te * te * te);
+    } else if (elevation > -0.575) {
+        arcsec = 1735.0 + elevation * (-518.2 + elevation * (103.4 + elevation * (-12.79 + elevation * 0.711)));
+    } else {
+        arcsec = -20.772 / te;
+    }
+    return arcsec / 3600.0;
+}
+
+static double elevation_at(double latitude, double longitude, double t)
+{
+    sun_t sun;
+    sun_at(julian_day(t), &sun);
+
+    double minutes = fmod(t, SECONDS_PER_DAY) / 60.0;
+    double true_solar = fmod(minutes + sun.eq_time + 4.0 * longitude, 1440.0);
+    if (true_solar < 0) {
+        true_solar += 1440.0;
+    }
+    double hour_angle = DEG_TO_RAD(true_solar / 4.0 - 180.0);
+
+    double lat = DEG_TO_RAD(latitude);
+    double cos_zenith = sin(lat) * sin(sun.declination) + cos(lat) * cos(sun.declination) * cos(hour_angle);
+    cos_zenith = cos_zenith > 1.0 ? 1.0 : (cos_zenith < -1.0 ? -1.0 : cos_zenith);
+
+    double elevation = 90.0 - RAD_TO_DEG(acos(cos_zenith));
+    return elevation + refraction(elevation);
+}
+
+float solar_elevation(double latitude, double longitude, time_t t)
+{
+    return (float)elevation_at(latitude, longitude, (double)t);
+}
+
+// Sharpens an analytic crossing estimate against the full elevation model
+static double refine_crossing(double edge, double estimate)
+{
+    double t0 = estimate - 60.0;
+    double t1 = estimate + 60.0;
+    double f0 = elevation_at(s_latitude, s_longitude, t0) - edge;
+    double f1 = elevation_at(s_latitude, s_longitude, t1) - edge;
+
+    for (int i = 0; i < 4 && f1 != f0; i++) {
+        double t2 = t1 - f1 * (t1 - t0) / (f1 - f0);
+        t0 = t1;
+        f0 = f1;
+        t1 = t2;
+        f1 = elevation_at(s_latitude, s_longitude, t1) - edge;
+    }
+    // Near the day's highest or lowest point the slope vanishes; keep the estimate
+    return fabs(t1 - estimate) < 1800.0 ? t1 : estimate;
+}
+
+// Earliest time after t at which the sun crosses edge degrees, or 0
+static time_t next_crossing(double edge, time_t t)
+{
+    double lat = DEG_TO_RAD(s_latitude);
+    // The analytic hour angle is geometric; refraction near the edge shifts it slightly
+    double sin_edge = sin(DEG_TO_RAD(edge - refraction(edge)));
+    time_t day0 = t - ((t % SECONDS_PER_DAY) + SECONDS_PER_DAY) % SECONDS_PER_DAY;
+    double best = 0;
+
+    for (int d = -1; d <= 2; d++) {
+        double day = (double)day0 + (double)d * SECONDS_PER_DAY;
+        sun_t sun;
+        sun_at(julian_day(day + SECONDS_PER_DAY / 2 - s_longitude * 240.0), &sun);
+
+        double cos_ha = (sin_edge - sin(lat) * sin(sun.declination)) / (cos(lat) * cos(sun.declination));
+        if (cos_ha < -1.0 || cos_ha > 1.0) {
+            continue;
+        }
+        double ha_min = 4.0 * RAD_TO_DEG(acos(cos_ha));
+        double noon_min = 720.0 - 4.0 * s_longitude - sun.eq_time;
+        double events[2] = { noon_min - ha_min, noon_min + ha_min };
+
+        for (int e = 0; e < 2; e++) {
+            double when = refine_crossing(edge, day + events[e] * 60.0);
+            if (when > (double)t && (best == 0 || when < best)) {
+                best = when;
+            }
+        }
+    }
+    return (time_t)ceil(best);
+}
+
+static time_t next_band_edge(time_t t)
+{
+    time_t best = t + NO_CROSSING_SPAN_S;
+    // The lowest band has no edge below it
+    for (int i = 0; i < s_band_count - 1; i++) {
+        time_t crossing = next_crossing(s_bands[i].min_elevation, t);
+        if (crossing > t && crossing < best) {
+            best = crossing;
+        }
+    }
+    return best;
+}
+
+esp_err_t solar_schedule_init(const solar_schedule_config_t *config)
+{
+    if (!config || !config->bands || config->band_count < 1 || config->band_count > SOLAR_SCHEDULE_MAX_BANDS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (int i = 1; i < config->band_count; i++) {
+        if (config->bands[i].min_elevation >= config->bands[i - 1].min_elevation) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    memcpy(s_bands, config->bands, config->band_count * sizeof(solar_band_t));
+    s_band_count = config->band_count;
+    s_initialized = true;
+
+    esp_err_t ret = solar_schedule_set_location(config->latitude, config->longitude);
+    if (ret != ESP_OK) {
+        s_initialized = false;
+        return ret;
+    }
+
+    for (int i = 0; i < s_band_count; i++) {
+        ESP_LOGI(TAG, "Band %d: sun above %.1f deg, every %lu s (action %d)",
+                 i, s_bands[i].min_elevation, (unsigned long)s_bands[i].interval_s, s_bands[i].action);
+    }
+    return ESP_OK;
+}
+
+esp_err_t solar_schedule_set_location(double latitude, double longitude)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // The poles themselves have no hour angle
+    if (!(latitude > -89.9 && latitude < 89.9) || !(longitude >= -180.0 && longitude <= 180.0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_latitude = latitude;
+    s_longitude = longitude;
+    ESP_LOGI(TAG, "Site at %.4f, %.4f", latitude, longitude);
+    return ESP_OK;
+}
+
+float solar_schedule_elevation(time_t t)
+{
+    return solar_elevation(s_latitude, s_longitude, t);
+}
+
+int solar_schedule_band_at(time_t t)
+{
+    float elevation = solar_schedule_elevation(t);
+    for (int i = 0; i < s_band_count - 1; i++) {
+        if (elevation >= s_bands[i].min_elevation) {
+            return i;
+        }
+    }
+    return s_band_count - 1;
+}
+
+esp_err_t solar_schedule_next(time_t now, time_t last_capture, solar_capture_t *next)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!next) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Walk band to band: capture in this one if its interval runs out before
+    // the sun leaves it, otherwise continue from the edge
+    time_t t = now;
+    for (int hop = 0; hop < MAX_BAND_HOPS; hop++) {
+        int band = solar_schedule_band_at(t);
+        time_t edge = next_band_edge(t);
+        uint32_t interval = s_bands[band].interval_s;
+
+        if (interval > 0) {
+            time_t due = (last_capture && last_capture + (time_t)interval > t) ? last_capture + interval : t;
+            if (due <= edge) {
+                next->time = due;
+                next->band = solar_schedule_band_at(due);
+                next->elevation = solar_schedule_elevation(due);
+                return ESP_OK;
+            }
+        }
+        t = edge + 1;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+uint32_t solar_schedule_seconds_until_next(time_t now, time_t last_capture, solar_capture_t *next)
+{
+    solar_capture_t local;
+    solar_capture_t *capture = next ? next : &local;
+    if (solar_schedule_next(now, last_capture, capture) != ESP_OK) {
+        // Nothing to capture within reach (polar night profile); look again later
+        capture->time = now + NO_CROSSING_SPAN_S;
+        capture->band = -1;
+        capture->elevation = solar_schedule_elevation(now);
+        return NO_CROSSING_SPAN_S;
+    }
+    return capture->time > now ? (uint32_t)(capture->time - now) : 0;
+}
+
+esp_err_t solar_schedule_project_day(time_t day_start, solar_day_projection_t *projection)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!projection) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(projection, 0, sizeof(*projection));
+    projection->max_elevation = -90.0f;
+    for (time_t t = day_start; t < day_start + SECONDS_PER_DAY; t += 60) {
+        float elevation = solar_schedule_elevation(t);
+        if (elevation > projection->max_elevation) {
+            projection->max_elevation = elevation;
+        }
+        projection->seconds[solar_schedule_band_at(t)] += 60;
+    }
+
+    time_t t = day_start;
+    time_t last = 0;
+    solar_capture_t capture;
+    while (solar_schedule_next(t, last, &capture) == ESP_OK && capture.time < day_start + SECONDS_PER_DAY) {
+        projection->captures[capture.band]++;
+        projection->total_captures++;
+        last = capture.time;
+        t = capture.time;
+    }
+    return ESP_OK;
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <sys/stat.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -26,6 +28,7 @@
 #include "sd_manager.h"
 #include "wifi_manager.h"
 #include "esp_now_comm.h"
+#include "solar_schedule.h"
 
 static const char *TAG = "time-v1";
 
@@ -44,6 +47,7 @@ typedef struct {
     uint32_t boot_count;
     uint64_t last_capture_time;
     uint32_t capture_interval;
+    time_t last_capture_epoch;      // wall clock, survives deep sleep unlike esp_timer
 } system_config_t;
 
 // RTC memory for persistent data across deep sleep
@@ -51,15 +55,38 @@ RTC_DATA_ATTR system_config_t system_config = {
     .first_boot = true,
     .boot_count = 0,
     .last_capture_time = 0,
-    .capture_interval = 300  // Default 5 minutes
+    .capture_interval = CONFIG_TIMELAPSE_INTERVAL_SEC,
+    .last_capture_epoch = 0
 };
 
+// Wall clock is trusted once it is past this (2024-01-01); before NTP it starts at 1970
+#define CLOCK_VALID_AFTER   1704067200
+
+// Rough cost of one wake-capture-sleep cycle (5 s clip + audio), for the daily projection
+#define CAPTURE_BYTES_EST       (1536 * 1024)
+#define CAPTURE_ENERGY_MWH_EST  2.5f
+
+#ifdef CONFIG_SOLAR_SCHEDULE_ENABLED
+// Day at the normal interval, golden and blue hour more often, nothing once
+// the sun is 6 degrees down (civil dusk): those frames are black anyway
+static const solar_band_t sun_bands[] = {
+    { .min_elevation = 6.0f,   .interval_s = CONFIG_TIMELAPSE_INTERVAL_SEC, .action = 1 },
+    { .min_elevation = -6.0f,  .interval_s = CONFIG_GOLDEN_INTERVAL_SEC, .action = 1 },
+    { .min_elevation = -90.0f, .interval_s = 0, .action = 0 },
+};
+static bool solar_ready = false;
+#endif
+
 // Function prototypes
 static void system_init(void);
 static void system_shutdown_prepare(void);
 static void capture_timelapse(void);
 static void enter_deep_sleep(void);
 static bool should_capture_now(void);
+static uint32_t seconds_until_next_capture(void);
+#ifdef CONFIG_SOLAR_SCHEDULE_ENABLED
+static void log_day_projection(void);
+#endif
 
 void app_main(void) {
     ESP_LOGI(TAG, "=== Time-V1 Timelapse System Starting ===");
@@ -76,14 +103,18 @@ void app_main(void) {
         ESP_LOGI(TAG, "Not time for capture, but staying awake for debugging");
     }
     
-    // DEBUG MODE: Stay awake instead of deep sleep
-    ESP_LOGI(TAG, "DEBUG MODE: Staying awake, sleeping for 10 seconds then repeating");
+    // DEBUG MODE: Stay awake instead of deep sleep, waiting out the schedule
+    ESP_LOGI(TAG, "DEBUG MODE: Staying awake, waiting for each scheduled capture");
     while (1) {
-        vTaskDelay(pdMS_TO_TICKS(10000)); // 10 seconds
+        uint32_t wait_s = seconds_until_next_capture();
+        ESP_LOGI(TAG, "DEBUG: Next capture in %lu s", (unsigned long)wait_s);
+        // Wake at least hourly to log and re-read the clock
+        vTaskDelay(pdMS_TO_TICKS((wait_s > 3600 ? 3600 : wait_s) * 1000ULL));
         ESP_LOGI(TAG, "DEBUG: Still alive, boot count: %lu", system_config.boot_count);
         
-        // Run capture sequence every minute instead of deep sleep
-        capture_timelapse();
+        if (should_capture_now()) {
+            capture_timelapse();
+        }
     }
 }
 
@@ -131,6 +162,23 @@ static void system_init(void) {
         }
     }
     
+#ifdef CONFIG_SOLAR_SCHEDULE_ENABLED
+    ESP_LOGI(TAG, "Initializing solar schedule...");
+    solar_schedule_config_t solar_config = {
+        .latitude = atof(CONFIG_SITE_LATITUDE),
+        .longitude = atof(CONFIG_SITE_LONGITUDE),
+        .bands = sun_bands,
+        .band_count = sizeof(sun_bands) / sizeof(sun_bands[0]),
+    };
+    if (solar_schedule_init(&solar_config) == ESP_OK) {
+        solar_ready = true;
+        log_day_projection();
+    } else {
+        ESP_LOGW(TAG, "Solar schedule rejected site %s, %s; using fixed interval",
+                 CONFIG_SITE_LATITUDE, CONFIG_SITE_LONGITUDE);
+    }
+#endif
+    
     ESP_LOGI(TAG, "Initializing camera manager...");
     if (camera_manager_init() == ESP_OK) {
         xEventGroupSetBits(system_events, CAMERA_READY_BIT);
@@ -170,6 +218,53 @@ static void system_init(void) {
     ESP_LOGI(TAG, "System initialization complete");
 }
 
+static bool clock_is_valid(void) {
+    return time(NULL) > CLOCK_VALID_AFTER;
+}
+
+#ifdef CONFIG_SOLAR_SCHEDULE_ENABLED
+static void log_day_projection(void) {
+    if (!clock_is_valid()) {
+        return;
+    }
+    
+    time_t now = time(NULL);
+    solar_day_projection_t projection;
+    if (solar_schedule_project_day(now - now % 86400, &projection) != ESP_OK) {
+        return;
+    }
+    
+    // The day band runs at the configured interval, so compare against that
+    uint32_t baseline = 86400 / CONFIG_TIMELAPSE_INTERVAL_SEC;
+    uint32_t saved = baseline > projection.total_captures ? baseline - projection.total_captures : 0;
+    ESP_LOGI(TAG, "Today: sun peaks at %.1f deg, %lu captures (%lu day, %lu golden) vs %lu at a fixed interval",
+             projection.max_elevation, (unsigned long)projection.total_captures,
+             (unsigned long)projection.captures[0], (unsigned long)projection.captures[1],
+             (unsigned long)baseline);
+    ESP_LOGI(TAG, "Projected savings: %lu wakes, ~%lu MB, ~%.0f mWh per day",
+             (unsigned long)saved, (unsigned long)((uint64_t)saved * CAPTURE_BYTES_EST / (1024 * 1024)),
+             saved * CAPTURE_ENERGY_MWH_EST);
+    stats_engine_log_event("schedule.captures_per_day", projection.total_captures);
+}
+#endif
+
+static uint32_t seconds_until_next_capture(void) {
+#ifdef CONFIG_SOLAR_SCHEDULE_ENABLED
+    if (solar_ready && clock_is_valid()) {
+        solar_capture_t next;
+        uint32_t wait_s = solar_schedule_seconds_until_next(time(NULL), system_config.last_capture_epoch, &next);
+        ESP_LOGI(TAG, "Next capture in band %d, sun at %.1f deg", next.band, next.elevation);
+        return wait_s;
+    }
+#endif
+    if (system_config.last_capture_epoch == 0 || !clock_is_valid()) {
+        return system_config.capture_interval;
+    }
+    time_t due = system_config.last_capture_epoch + system_config.capture_interval;
+    time_t now = time(NULL);
+    return due > now ? (uint32_t)(due - now) : 0;
+}
+
 static bool should_capture_now(void) {
     uint64_t current_time = esp_timer_get_time() / 1000000; // Convert to seconds
     
@@ -178,6 +273,13 @@ static bool should_capture_now(void) {
         return true;
     }
     
+#ifdef CONFIG_SOLAR_SCHEDULE_ENABLED
+    // The wake timer is set from the schedule; a couple of seconds of RTC drift still counts as due
+    if (solar_ready && clock_is_valid()) {
+        return seconds_until_next_capture() <= 2;
+    }
+#endif
+    
     // Check if interval has elapsed
     if ((current_time - system_config.last_capture_time) >= system_config.capture_interval) {
         return true;
@@ -192,6 +294,7 @@ static void capture_timelapse(void) {
     
     // Update last capture time
     system_config.last_capture_time = esp_timer_get_time() / 1000000;
+    system_config.last_capture_epoch = time(NULL);
     
     // Start audio capture
     EventBits_t bits = xEventGroupGetBits(system_events);
@@ -257,10 +360,14 @@ static void system_shutdown_prepare(void) {
 }
 
 static void enter_deep_sleep(void) {
-    ESP_LOGI(TAG, "Entering deep sleep for %d seconds", system_config.capture_interval);
+    uint32_t sleep_s = seconds_until_next_capture();
+    if (sleep_s == 0) {
+        sleep_s = 1;
+    }
+    ESP_LOGI(TAG, "Entering deep sleep for %lu seconds", (unsigned long)sleep_s);
     
     // Configure wake up timer
-    esp_sleep_enable_timer_wakeup(system_config.capture_interval * 1000000ULL);
+    esp_sleep_enable_timer_wakeup(sleep_s * 1000000ULL);
     
     // Enable wake up from external sources if needed
     // esp_sleep_enable_ext1_wakeup(BUTTON_PIN_BITMASK, ESP_EXT1_WAKEUP_ANY_HIGH);